@@ -15,6 +15,7 @@
 #include "message/ResponseReceivedMessage.h"
 #include "DeviceConfigurationHelper.h"
 #include "profiles/eep.h"
+#include "profiles/eepDescriptors.h"
 #include "message/UTE_GigaConceptReversedAnswerSendMessage.h"
 #include <shared/Log.h>
 
@@ -191,6 +192,7 @@ void CEnOcean::loadAllDevices()
                                     profileHelper);
 
          m_devices[deviceId] = device;
+         m_tableDrivenDecoders.erase(deviceId);
       }
       catch (shared::exception::CEmptyResult&)
       {
@@ -344,6 +346,7 @@ void CEnOcean::processDeviceRemmoved(boost::shared_ptr<const shared::plugin::yPl
       return;
 
    m_devices.erase(deviceRemoved->device());
+   m_tableDrivenDecoders.erase(deviceRemoved->device());
 }
 
 void CEnOcean::processDeviceConfiguration(const std::string& deviceId,
@@ -369,6 +372,7 @@ void CEnOcean::processDeviceConfiguration(const std::string& deviceId,
          m_api->declareKeywords(deviceId,
                                 device->allHistorizers());
          m_devices[deviceId] = device;
+         m_tableDrivenDecoders.erase(deviceId);
       }
 
       // Send configuration to device
@@ -467,7 +471,7 @@ void CEnOcean::processRadioErp1(boost::shared_ptr<const message::CEsp3ReceivedPa
    // Create associated RORG object
    auto erp1UserData = bitset_from_bytes(erp1Message.userData());
    auto erp1Status = bitset_from_byte(erp1Message.status());
-   auto rorg = CRorgs::createRorg(erp1Message.rorg());
+   const auto& rorg = this->rorg(erp1Message.rorg());
    auto deviceId = erp1Message.senderId();
 
    if (rorg->isTeachIn(erp1UserData))
@@ -584,11 +588,16 @@ void CEnOcean::processRadioErp1(boost::shared_ptr<const message::CEsp3ReceivedPa
 
       auto device = m_devices[deviceId];
 
-      auto keywordsToHistorize = device->states(static_cast<unsigned char>(erp1Message.rorg()),
-                                                erp1UserData,
-                                                erp1Status,
-                                                m_senderId,
-                                                m_messageHandler);
+      // Read-only profiles are decoded from generated tables, others by their profile class
+      const auto decoder = tableDrivenDecoder(deviceId,
+                                              *device);
+      auto keywordsToHistorize = decoder
+                                    ? decoder->decode(erp1Message.userData())
+                                    : device->states(static_cast<unsigned char>(erp1Message.rorg()),
+                                                     erp1UserData,
+                                                     erp1Status,
+                                                     m_senderId,
+                                                     m_messageHandler);
       if (keywordsToHistorize.empty())
       {
          YADOMS_LOG(information) << "Received message for id#" << deviceId << ", but nothing to historize";
@@ -815,9 +824,36 @@ boost::shared_ptr<IType> CEnOcean::declareDevice(const std::string& deviceId,
    YADOMS_LOG(information) << "  - TYPE         : " << device->title();
 
    m_devices[deviceId] = device;
+   m_tableDrivenDecoders.erase(deviceId);
    return device;
 }
 
+const boost::shared_ptr<IRorg>& CEnOcean::rorg(unsigned int rorgId)
+{
+   auto rorg = m_rorgs.find(rorgId);
+   if (rorg == m_rorgs.end())
+      rorg = m_rorgs.insert(std::make_pair(rorgId, CRorgs::createRorg(rorgId))).first;
+   return rorg->second;
+}
+
+boost::shared_ptr<CTableDrivenDecoder> CEnOcean::tableDrivenDecoder(const std::string& deviceId,
+                                                                    const IType& device)
+{
+   auto decoder = m_tableDrivenDecoders.find(deviceId);
+   if (decoder == m_tableDrivenDecoders.end())
+   {
+      const CProfileHelper profile(device.profile());
+      const auto descriptor = findEepProfileDescriptor(profile.rorg(),
+                                                       profile.func(),
+                                                       profile.type());
+      decoder = m_tableDrivenDecoders.insert(std::make_pair(deviceId,
+                                                            descriptor
+                                                               ? boost::make_shared<CTableDrivenDecoder>(*descriptor)
+                                                               : boost::shared_ptr<CTableDrivenDecoder>())).first;
+   }
+   return decoder->second;
+}
+
 void CEnOcean::requestDongleVersion()
 {
    message::CCommonCommandSendMessage sendMessage(message::CCommonCommandSendMessage::CO_RD_VERSION);
@@ -6,6 +6,8 @@
 #include "message/UTE_ReceivedMessage.h"
 #include "message/DongleVersionResponseReceivedMessage.h"
 #include "profiles/IType.h"
+#include "profiles/IRorg.h"
+#include "profiles/TableDrivenDecoder.h"
 #include "ProfileHelper.h"
 #include "IMessageHandler.h"
 #include <shared/communication/AsyncPortConnectionNotification.h>
@@ -178,6 +180,22 @@ protected:
                              const std::string& manufacturer,
                              const CProfileHelper& profile) const;
 
+   //--------------------------------------------------------------
+   /// \brief	                     Get the RORG object (created once per RORG)
+   /// \param [in] rorgId           The RORG ID
+   /// \return                      The RORG object
+   //--------------------------------------------------------------
+   const boost::shared_ptr<IRorg>& rorg(unsigned int rorgId);
+
+   //--------------------------------------------------------------
+   /// \brief	                     Get the table-driven decoder of a device
+   /// \param [in] deviceId         The device ID
+   /// \param [in] device           The device
+   /// \return                      The decoder, null if device profile is not table-driven
+   //--------------------------------------------------------------
+   boost::shared_ptr<CTableDrivenDecoder> tableDrivenDecoder(const std::string& deviceId,
+                                                             const IType& device);
+
 private:
    //--------------------------------------------------------------
    /// \brief	The plugin configuration
@@ -204,6 +222,16 @@ private:
    //--------------------------------------------------------------
    std::map<std::string, boost::shared_ptr<IType>> m_devices;
 
+   //--------------------------------------------------------------
+   /// \brief  The table-driven decoders of known devices (null if profile is not table-driven)
+   //--------------------------------------------------------------
+   std::map<std::string, boost::shared_ptr<CTableDrivenDecoder>> m_tableDrivenDecoders;
+
+   //--------------------------------------------------------------
+   /// \brief  The RORG objects, by RORG ID
+   //--------------------------------------------------------------
+   std::map<unsigned int, boost::shared_ptr<IRorg>> m_rorgs;
+
    //--------------------------------------------------------------
    /// \brief  The send ID (ID of EnOcean chip on the USB dongle)
    //--------------------------------------------------------------
@@ -0,0 +1,46 @@
+#pragma once
+
+//--------------------------------------------------------------
+/// \brief	Historizer type fed by an EEP data field
+//--------------------------------------------------------------
+enum EDataFieldKind
+{
+   kTemperature = 0,
+   kHumidity,
+   kPressure,
+   kVoltage,
+   kIllumination,
+   kBatteryLevel,
+   kSwitch
+};
+
+//--------------------------------------------------------------
+/// \brief	Description of an EEP data field
+///
+/// Linear values are computed as : multiplier * (raw - rangeMin) + scaleMin
+/// (same formula as the generated profile classes).
+/// Switch values are the bit at bitOffset.
+//--------------------------------------------------------------
+struct DataFieldDescriptor
+{
+   unsigned int bitOffset;
+   unsigned int bitSize;
+   EDataFieldKind kind;
+   int rangeMin;
+   double multiplier;
+   double scaleMin;
+   const char* keywordName;
+};
+
+//--------------------------------------------------------------
+/// \brief	Description of a read-only EEP profile, decodable without the profile class
+//--------------------------------------------------------------
+struct ProfileDescriptor
+{
+   unsigned int rorg;
+   unsigned int func;
+   unsigned int type;
+   const char* profile;
+   const DataFieldDescriptor* fields;
+   unsigned int fieldsCount;
+};
@@ -0,0 +1,111 @@
+#include "stdafx.h"
+#include "TableDrivenDecoder.h"
+
+CTableDrivenDecoder::CTableDrivenDecoder(const ProfileDescriptor& profile)
+   : m_profile(profile.profile),
+     m_minUserDataSize(0)
+{
+   m_fields.reserve(profile.fieldsCount);
+   m_historizers.reserve(profile.fieldsCount);
+
+   for (auto descriptor = profile.fields; descriptor != profile.fields + profile.fieldsCount; ++descriptor)
+   {
+      Field field = {descriptor};
+      switch (descriptor->kind)
+      {
+      case kTemperature:
+         field.doubleHistorizer = boost::make_shared<yApi::historization::CTemperature>(descriptor->keywordName);
+         break;
+      case kHumidity:
+         field.doubleHistorizer = boost::make_shared<yApi::historization::CHumidity>(descriptor->keywordName);
+         break;
+      case kPressure:
+         field.doubleHistorizer = boost::make_shared<yApi::historization::CPressure>(descriptor->keywordName);
+         break;
+      case kVoltage:
+         field.doubleHistorizer = boost::make_shared<yApi::historization::CVoltage>(descriptor->keywordName);
+         break;
+      case kIllumination:
+         field.doubleHistorizer = boost::make_shared<yApi::historization::CIllumination>(descriptor->keywordName);
+         break;
+      case kBatteryLevel:
+         field.batteryLevelHistorizer = boost::make_shared<yApi::historization::CBatteryLevel>(descriptor->keywordName);
+         break;
+      case kSwitch:
+         field.switchHistorizer = boost::make_shared<yApi::historization::CSwitch>(descriptor->keywordName,
+                                                                                   yApi::EKeywordAccessMode::kGet);
+         break;
+      default:
+         throw std::out_of_range((boost::format("Invalid data field kind %1% in profile %2%") % descriptor->kind % m_profile).str());
+      }
+
+      if (field.doubleHistorizer)
+         m_historizers.push_back(field.doubleHistorizer);
+      else if (field.batteryLevelHistorizer)
+         m_historizers.push_back(field.batteryLevelHistorizer);
+      else
+         m_historizers.push_back(field.switchHistorizer);
+
+      m_fields.push_back(field);
+
+      m_minUserDataSize = std::max(m_minUserDataSize,
+                                   static_cast<std::size_t>((descriptor->bitOffset + descriptor->bitSize + 7) / 8));
+   }
+}
+
+CTableDrivenDecoder::~CTableDrivenDecoder()
+{
+}
+
+const std::string& CTableDrivenDecoder::profile() const
+{
+   return m_profile;
+}
+
+const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>>& CTableDrivenDecoder::allHistorizers() const
+{
+   return m_historizers;
+}
+
+const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>>& CTableDrivenDecoder::decode(const std::vector<unsigned char>& userData)
+{
+   if (userData.size() < m_minUserDataSize)
+      throw std::out_of_range((boost::format("Telegram too short for profile %1% : %2% bytes received, %3% expected")
+         % m_profile % userData.size() % m_minUserDataSize).str());
+
+   for (const auto& field : m_fields)
+   {
+      const auto& descriptor = *field.descriptor;
+      const auto rawValue = extract(userData, descriptor.bitOffset, descriptor.bitSize);
+
+      if (field.switchHistorizer)
+      {
+         field.switchHistorizer->set(rawValue != 0);
+         continue;
+      }
+
+      const auto value = descriptor.multiplier * (static_cast<signed>(rawValue) - descriptor.rangeMin) + descriptor.scaleMin;
+      if (field.doubleHistorizer)
+         field.doubleHistorizer->set(value);
+      else
+         field.batteryLevelHistorizer->set(static_cast<int>(value));
+   }
+
+   return m_historizers;
+}
+
+unsigned int CTableDrivenDecoder::extract(const std::vector<unsigned char>& data,
+                                          unsigned int bitOffset,
+                                          unsigned int bitSize)
+{
+   if (bitSize == 0 || bitSize > 32)
+      throw std::out_of_range((boost::format("Invalid field size : %1%") % bitSize).str());
+
+   // Field spans 5 bytes at most, so fits in a 64-bits word
+   const auto lastBit = bitOffset + bitSize - 1;
+   boost::uint64_t word = 0;
+   for (auto byte = bitOffset / 8; byte <= lastBit / 8; ++byte)
+      word = (word << 8) | data[byte];
+
+   return static_cast<unsigned int>((word >> (7 - lastBit % 8)) & ((static_cast<boost::uint64_t>(1) << bitSize) - 1));
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <shared/plugin/yPluginApi/IYPluginApi.h>
+#include "EepDescriptor.h"
+
+namespace yApi = shared::plugin::yPluginApi;
+
+//--------------------------------------------------------------
+/// \brief	Decoder of data telegrams of read-only profiles, driven by generated descriptor tables
+///
+/// Fields are extracted directly from the telegram bytes, in one pass,
+/// to historizers allocated once at construction.
+//--------------------------------------------------------------
+class CTableDrivenDecoder
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	    Constructor
+   /// \param[in]  profile            the profile descriptor (must outlive the decoder)
+   //--------------------------------------------------------------
+   explicit CTableDrivenDecoder(const ProfileDescriptor& profile);
+
+   //--------------------------------------------------------------
+   /// \brief	    Destructor
+   //--------------------------------------------------------------
+   virtual ~CTableDrivenDecoder();
+
+   //--------------------------------------------------------------
+   /// \brief	    Get the decoded profile (ie A5-02-05)
+   //--------------------------------------------------------------
+   const std::string& profile() const;
+
+   //--------------------------------------------------------------
+   /// \brief	    Get all historizers of the profile
+   //--------------------------------------------------------------
+   const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>>& allHistorizers() const;
+
+   //--------------------------------------------------------------
+   /// \brief	    Decode a data telegram
+   /// \param[in]  userData           the telegram user data
+   /// \return     the historizers, up to date
+   /// \throw      std::out_of_range if user data is too short for the profile
+   //--------------------------------------------------------------
+   const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>>& decode(const std::vector<unsigned char>& userData);
+
+   //--------------------------------------------------------------
+   /// \brief	    Extract a field from bytes (bit 0 is the MSB of the first byte, as bitset_extract)
+   /// \param[in]  data               the bytes
+   /// \param[in]  bitOffset          the field offset
+   /// \param[in]  bitSize            the field size (up to 32 bits)
+   /// \return     the field raw value
+   //--------------------------------------------------------------
+   static unsigned int extract(const std::vector<unsigned char>& data,
+                               unsigned int bitOffset,
+                               unsigned int bitSize);
+
+private:
+   struct Field
+   {
+      const DataFieldDescriptor* descriptor;
+      boost::shared_ptr<yApi::historization::CSingleHistorizableData<double>> doubleHistorizer;
+      boost::shared_ptr<yApi::historization::CBatteryLevel> batteryLevelHistorizer;
+      boost::shared_ptr<yApi::historization::CSwitch> switchHistorizer;
+   };
+
+   const std::string m_profile;
+   std::vector<Field> m_fields;
+   std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>> m_historizers;
+   std::size_t m_minUserDataSize;
+};
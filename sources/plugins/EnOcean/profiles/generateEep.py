@@ -42,6 +42,8 @@ profilePath = os.path.dirname(xmlInputFilePath)
 hardCodedProfiles = cppHelper.HardCodedProfiles(profilePath)
 # Supported profiles are at least composed of hard coded profiles
 supportedProfiles = copy.deepcopy(hardCodedProfiles.getProfilesHardCoded())
+# Read-only profiles decodable by table (rorg, func, type, profile name, fields code)
+profileDescriptors = []
 
 
 #-------------------------------------------------------------------------------
@@ -249,7 +251,27 @@ for xmlRorgNode in xmlProfileNode.findall("rorg"):
             return ", ".join(ctorExtraParameters)
 
 
+         def descriptorFieldCode(xmlDataFieldNode, fieldKind, applyCoef = None):
+            offset = xmlDataFieldNode.find("bitoffs").text
+            size = xmlDataFieldNode.find("bitsize").text
+            keywordName = xmlDataFieldNode.find("shortcut").text + " - " + xmlDataFieldNode.find("data").text
+            if fieldKind == "kSwitch":
+               return "   { " + offset + ", " + size + ", " + fieldKind + ", 0, 0.0, 0.0, \"" + keywordName + "\" }"
+            # Same computation as statesCodeForLinearValue
+            rangeMin = int(xmlDataFieldNode.find("range/min").text)
+            rangeMax = int(xmlDataFieldNode.find("range/max").text)
+            scaleMin = float(xmlDataFieldNode.find("scale/min").text)
+            scaleMax = float(xmlDataFieldNode.find("scale/max").text)
+            if applyCoef is not None:
+               scaleMin = scaleMin * float(applyCoef)
+               scaleMax = scaleMax * float(applyCoef)
+            multiplier = (scaleMax - scaleMin) / (rangeMax - rangeMin);
+            return "   { " + offset + ", " + size + ", " + fieldKind + ", " + str(rangeMin) + ", " + str(multiplier) + ", " + str(scaleMin) + ", \"" + keywordName + "\" }"
+
+
          historizersCppName = []
+         descriptorFieldsCode = []
+         tableDriven = True
          if len(xmlTypeNode.findall("case")) != 1:            
             util.warning("func/type : Unsupported number of \"case\" tags (expected 1) for \"" + xmlTypeNode.find("title").text.encode("utf-8") + "\" node. This profile will be ignored.")
          else:
@@ -259,57 +281,73 @@ for xmlRorgNode in xmlProfileNode.findall("rorg"):
                historizerCppName = "m_" + cppHelper.toCppName(keywordName)
                cppHistorizerClassName = ""
                ctorExtraParameters = []
+               fieldKind = None
+               applyCoef = None
                if isLinearValue(xmlDataFieldNode):
                   if dataText == "Temperature":
                      if not supportedUnit(xmlDataFieldNode, u"°C"):
                         continue
                      cppHistorizerClassName = "yApi::historization::CTemperature"
+                     fieldKind = "kTemperature"
                   elif dataText == "Humidity":
                      if not supportedUnit(xmlDataFieldNode, u"%"):
                         continue
                      cppHistorizerClassName = "yApi::historization::CHumidity"
+                     fieldKind = "kHumidity"
                   elif dataText == "Barometer":
                      if not supportedUnit(xmlDataFieldNode, u"hPa"):
                         continue
                      cppHistorizerClassName = "yApi::historization::CPressure"
+                     fieldKind = "kPressure"
                   elif dataText == "Supply voltage" and xmlDataFieldNode.find("range") is not None:
                      if not supportedUnit(xmlDataFieldNode, u"V"):
                         continue
                      cppHistorizerClassName = "yApi::historization::CVoltage"
+                     fieldKind = "kVoltage"
                   elif dataText == "Illumination":
                      if not supportedUnit(xmlDataFieldNode, u"lx"):
                         continue
                      cppHistorizerClassName = "yApi::historization::CIllumination"
+                     fieldKind = "kIllumination"
                   elif dataText == "Illuminance":
                      if not supportedUnit(xmlDataFieldNode, u"lx"):
                         continue
                      cppHistorizerClassName = "yApi::historization::CIllumination"
+                     fieldKind = "kIllumination"
                   elif dataText.encode("utf-8") == "Sun – West" \
                      or dataText.encode("utf-8") == "Sun – South" \
                      or dataText.encode("utf-8") == "Sun – East":            
                      if not supportedUnit(xmlDataFieldNode, u"klx"):
                         continue
                      cppHistorizerClassName = "yApi::historization::CIllumination"
+                     fieldKind = "kIllumination"
+                     applyCoef = 1000
                   elif dataText == "Energy Storage":
                      if not supportedUnit(xmlDataFieldNode, u"%"):
                         continue
                      cppHistorizerClassName = "yApi::historization::CBatteryLevel"
+                     fieldKind = "kBatteryLevel"
                   else:
                      util.warning("func/type : Unsupported linear data type \"" + dataText.encode("utf-8") + "\" for \"" + xmlTypeNode.find("title").text.encode("utf-8") + "\" node. This data will be ignored.")
                      continue
                elif isBoolValue(xmlDataFieldNode):
                   cppHistorizerClassName = "yApi::historization::CSwitch"
                   ctorExtraParameters.append(", yApi::EKeywordAccessMode::kGet")
+                  fieldKind = "kSwitch"
                elif isEnumValue(xmlDataFieldNode):
                   cppHistorizerClass = createSpecificEnumHistorizer(xmlDataFieldNode, xmlTypeNode)
                   typeClass.addDependency(cppHistorizerClass)
                   cppHistorizerClassName = cppHistorizerClass.cppClassName()
+                  # Enum historizers are specific classes, profile can not be decoded from table
+                  tableDriven = False
                else:
                   util.warning("func/type : Unsupported data type \"" + xmlDataFieldNode.find("data").text.encode("utf-8") + "\" for \"" + xmlTypeNode.find("title").text.encode("utf-8") + "\" node. This data will be ignored.")
                   continue
                typeClass.addMember(cppClass.CppMember(historizerCppName, "boost::shared_ptr<" + cppHistorizerClassName + ">", \
                   cppClass.PRIVATE, cppClass.NO_QUALIFER, initilizationCode= historizerCppName + "(boost::make_shared<" + cppHistorizerClassName + ">(\"" + keywordName + "\"" + printCtorExtraParameters(ctorExtraParameters) + "))"))
                historizersCppName.append(historizerCppName)
+               if fieldKind is not None:
+                  descriptorFieldsCode.append(descriptorFieldCode(xmlDataFieldNode, fieldKind, applyCoef))
                
          typeClass.addMember(cppClass.CppMember("m_historizers", "std::vector<boost::shared_ptr<const yApi::historization::IHistorizable> >", cppClass.PRIVATE, cppClass.NO_QUALIFER, \
             initilizationCode="m_historizers( { " + ", ".join(historizersCppName) + " } )"))
@@ -393,6 +431,12 @@ for xmlRorgNode in xmlProfileNode.findall("rorg"):
 
          typeClass.addMethod(cppClass.CppMethod("states", "std::vector<boost::shared_ptr<const yApi::historization::IHistorizable> >", "unsigned char rorg, const boost::dynamic_bitset<>& data, const boost::dynamic_bitset<>& status, const std::string& senderId, boost::shared_ptr<IMessageHandler> messageHandler", cppClass.PUBLIC, cppClass.OVERRIDE | cppClass.CONST, statesCode(xmlTypeNode)))
          supportedProfiles.append(profileHelper.profileName(xmlRorgNode, xmlFuncNode, xmlTypeNode))
+         if tableDriven:
+            profileDescriptors.append((int(xmlRorgNode.find("number").text, 16), \
+                                       int(xmlFuncNode.find("number").text, 16), \
+                                       int(xmlTypeNode.find("number").text, 16), \
+                                       profileHelper.profileName(xmlRorgNode, xmlFuncNode, xmlTypeNode), \
+                                       descriptorFieldsCode))
 
 
       def createTypeCode(xmlRorgNode, xmlFuncNode):
@@ -499,6 +543,63 @@ with codecs.open(os.path.join(outputPath, 'eep.cpp'), 'w', 'utf_8') as cppSource
       generateRorgDependency(dependency, outputPath)
    rorgsClass.generateSource(cppSourceFile)
 
+# Generate descriptor tables, sorted by (rorg, func, type) for binary search
+profileDescriptors.sort(key=lambda descriptor: (descriptor[0], descriptor[1], descriptor[2]))
+
+with codecs.open(os.path.join(outputPath, 'eepDescriptors.h'), 'w', 'utf_8') as cppHeaderFile:
+   cppHeaderFile.write('// Generated file, don\'t modify\n')
+   cppHeaderFile.write('#pragma once\n')
+   cppHeaderFile.write('#include <profiles/EepDescriptor.h>\n')
+   cppHeaderFile.write('\n')
+   cppHeaderFile.write('// Find the descriptor of a read-only profile, nullptr if profile is not table-driven\n')
+   cppHeaderFile.write('const ProfileDescriptor* findEepProfileDescriptor(unsigned int rorg, unsigned int func, unsigned int type);\n')
+   cppHeaderFile.write('\n')
+   cppHeaderFile.write('// All table-driven profiles, sorted by (rorg, func, type)\n')
+   cppHeaderFile.write('const ProfileDescriptor* eepProfileDescriptorsBegin();\n')
+   cppHeaderFile.write('const ProfileDescriptor* eepProfileDescriptorsEnd();\n')
+
+with codecs.open(os.path.join(outputPath, 'eepDescriptors.cpp'), 'w', 'utf_8') as cppSourceFile:
+   cppSourceFile.write('// Generated file, don\'t modify\n')
+   cppSourceFile.write('#include "stdafx.h"\n')
+   cppSourceFile.write('#include "eepDescriptors.h"\n')
+   cppSourceFile.write('#include <algorithm>\n')
+   cppSourceFile.write('#include <tuple>\n')
+   cppSourceFile.write('\n')
+   cppSourceFile.write('namespace\n')
+   cppSourceFile.write('{\n')
+   for descriptor in profileDescriptors:
+      cppSourceFile.write('constexpr DataFieldDescriptor ' + cppHelper.toCppName('Fields_' + descriptor[3]) + '[] = {\n')
+      cppSourceFile.write(',\n'.join(descriptor[4]) + '\n')
+      cppSourceFile.write('};\n')
+   cppSourceFile.write('\n')
+   cppSourceFile.write('constexpr ProfileDescriptor ProfileDescriptors[] = {\n')
+   cppSourceFile.write(',\n'.join(['   { ' + '0x%02X, 0x%02X, 0x%02X' % (descriptor[0], descriptor[1], descriptor[2]) + ', "' + descriptor[3] + '", ' + \
+                                   cppHelper.toCppName('Fields_' + descriptor[3]) + ', ' + str(len(descriptor[4])) + ' }' for descriptor in profileDescriptors]) + '\n')
+   cppSourceFile.write('};\n')
+   cppSourceFile.write('}\n')
+   cppSourceFile.write('\n')
+   cppSourceFile.write('const ProfileDescriptor* findEepProfileDescriptor(unsigned int rorg, unsigned int func, unsigned int type)\n')
+   cppSourceFile.write('{\n')
+   cppSourceFile.write('   const auto descriptor = std::lower_bound(eepProfileDescriptorsBegin(), eepProfileDescriptorsEnd(), std::make_tuple(rorg, func, type),\n')
+   cppSourceFile.write('      [](const ProfileDescriptor& item, const std::tuple<unsigned int, unsigned int, unsigned int>& id)\n')
+   cppSourceFile.write('      {\n')
+   cppSourceFile.write('         return std::make_tuple(item.rorg, item.func, item.type) < id;\n')
+   cppSourceFile.write('      });\n')
+   cppSourceFile.write('   if (descriptor == eepProfileDescriptorsEnd() || descriptor->rorg != rorg || descriptor->func != func || descriptor->type != type)\n')
+   cppSourceFile.write('      return nullptr;\n')
+   cppSourceFile.write('   return descriptor;\n')
+   cppSourceFile.write('}\n')
+   cppSourceFile.write('\n')
+   cppSourceFile.write('const ProfileDescriptor* eepProfileDescriptorsBegin()\n')
+   cppSourceFile.write('{\n')
+   cppSourceFile.write('   return ProfileDescriptors;\n')
+   cppSourceFile.write('}\n')
+   cppSourceFile.write('\n')
+   cppSourceFile.write('const ProfileDescriptor* eepProfileDescriptorsEnd()\n')
+   cppSourceFile.write('{\n')
+   cppSourceFile.write('   return ProfileDescriptors + sizeof(ProfileDescriptors) / sizeof(ProfileDescriptors[0]);\n')
+   cppSourceFile.write('}\n')
+
 # Generate package.json
 import generatePackage
 generatePackage.generate(packageJsonInPath, packageJsonPath, localesPath, localesInPath, supportedProfiles)
@@ -35,17 +35,20 @@ void CIOManager::removeDevice(boost::shared_ptr<yApi::IYPluginApi> api, const st
 
 void CIOManager::readAllIOFromDevice(boost::shared_ptr<yApi::IYPluginApi> api, bool forceHistorization)
 {
-   // Initial Reading of relays
-   readIOFromDevice(api, "R", forceHistorization);
+   // Reading of relays, DIs, Analog Input and Counters, all requests pipelined on the same connection
+   static const std::vector<std::string> types = { "R", "D", "A", "C" };
 
-   // Initial Reading of DIs
-   readIOFromDevice(api, "D", forceHistorization);
+   std::vector<shared::CDataContainer> parametersList;
+   for (const auto& type : types)
+      parametersList.push_back(buildReadParameters(type));
 
-   // Initial Reading of Analog Input
-   readIOFromDevice(api, "A", forceHistorization);
+   auto results = urlManager::sendCommands(m_socketAddress, parametersList);
 
-   // Initial Reading of Counters
-   readIOFromDevice(api, "C", forceHistorization);
+   for (std::size_t index = 0; index < types.size(); ++index)
+   {
+      for (const auto& extension : m_devicesList)
+         extension->updateFromDevice(types[index], api, results[index], forceHistorization);
+   }
 }
 
 void CIOManager::onCommand(boost::shared_ptr<yApi::IYPluginApi> api,
@@ -86,6 +89,16 @@ void CIOManager::onCommand(boost::shared_ptr<yApi::IYPluginApi> api,
 void CIOManager::readIOFromDevice(boost::shared_ptr<yApi::IYPluginApi> api, 
                                   const std::string& type,
                                   bool forceHistorization)
+{
+   auto results = urlManager::sendCommand( m_socketAddress, buildReadParameters(type));
+
+   for (std::vector<boost::shared_ptr<equipments::IEquipment> >::const_iterator iteratorExtension = m_devicesList.begin();
+      iteratorExtension != m_devicesList.end();
+      ++iteratorExtension)
+      (*iteratorExtension)->updateFromDevice(type, api, results, forceHistorization);
+}
+
+shared::CDataContainer CIOManager::buildReadParameters(const std::string& type) const
 {
    shared::CDataContainer parameters;
 
@@ -95,12 +108,7 @@ void CIOManager::readIOFromDevice(boost::shared_ptr<yApi::IYPluginApi> api,
 
    parameters.set("Get", type);
 
-   auto results = urlManager::sendCommand( m_socketAddress, parameters);
-
-   for (std::vector<boost::shared_ptr<equipments::IEquipment> >::const_iterator iteratorExtension = m_devicesList.begin();
-      iteratorExtension != m_devicesList.end();
-      ++iteratorExtension)
-      (*iteratorExtension)->updateFromDevice(type, api, results, forceHistorization);
+   return parameters;
 }
 
 void CIOManager::OnConfigurationUpdate(boost::shared_ptr<yApi::IYPluginApi> api,
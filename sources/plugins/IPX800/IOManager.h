@@ -91,6 +91,13 @@ public:
 
 private:
 
+   //--------------------------------------------------------------
+   /// \brief	                     Build the parameters of a read request
+   /// \param [in] type              The type of IOs to read
+   /// \return                       The parameters
+   //--------------------------------------------------------------
+   shared::CDataContainer buildReadParameters(const std::string& type) const;
+
    //--------------------------------------------------------------
    /// \brief	The plugin name
    //--------------------------------------------------------------
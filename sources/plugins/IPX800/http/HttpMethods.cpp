@@ -1,11 +1,10 @@
 #include "stdafx.h"
 #include "HttpMethods.h"
-#include <Poco/Net/HTTPSession.h>
-#include <Poco/Net/HTTPClientSession.h>
 #include <Poco/Net/HTTPRequest.h>
 #include <Poco/Net/HTTPResponse.h>
 #include <Poco/StreamCopier.h>
 #include <Poco/URI.h>
+#include <shared/http/HttpSessionPool.h>
 #include <shared/Log.h>
 
 #include "failedSendingException.hpp"
@@ -13,67 +12,103 @@
 
 namespace http
 {
+   // The time out is drastically lowered. The module is considered in the same network.
+   static const boost::posix_time::time_duration IPX800Timeout(boost::posix_time::seconds(2));
+
    shared::CDataContainer CHttpMethods::SendGetRequest(const std::string & url, shared::CDataContainer & parameters)
    {
       try
       {
-         std::map<std::string, std::string> mapParameters = parameters.getAsMap();
-         Poco::URI uri(url);
-
-         if (!parameters.empty())
-         {
-            for (std::map<std::string, std::string>::iterator parametersIterator = mapParameters.begin(); parametersIterator != mapParameters.end(); ++parametersIterator)
-               uri.addQueryParameter(parametersIterator->first, parametersIterator->second);
-         }
+         auto uri = buildUri(url, parameters);
 
-         Poco::Net::HTTPClientSession session(uri.getHost(), uri.getPort());
+         auto session = shared::HttpSessionPool().getSession(url);
          Poco::Net::HTTPRequest request(Poco::Net::HTTPRequest::HTTP_GET, uri.getPathAndQuery(), Poco::Net::HTTPMessage::HTTP_1_1);
 
-         // The time out is drastically lowered. The module is considered in the same network.
-		   session.setTimeout(Poco::Timespan(2, 0));
-         session.sendRequest(request);
+		   session->setTimeout(IPX800Timeout);
+         session->sendRequest(request);
 
          Poco::Net::HTTPResponse response;
-         auto& rs = session.receiveResponse(response);
+         auto& rs = session->receiveResponse(response);
 
-         if (response.getStatus() == Poco::Net::HTTPResponse::HTTP_OK)
-         {
-            std::ostringstream oss;
-            Poco::StreamCopier::copyStream(rs, oss);
-
-/*       The structure of this return when a command is properly executed is not JSON compliant
-            {
-               "product": "IPX800_V4",
-               "Success"
-            }
-
-         This part add a value to this parameter, to be JSON compliant
-*/       
+         return readAnswer(response, rs);
+      }
+      catch (Poco::Exception& e) 
+      {
+         auto message = (boost::format("Fail to send get http request \"%1%\" : %2%") % url % e.message()).str();
+         YADOMS_LOG(error) << message ;
+         throw CFailedSendingException(message);
+      }
+   }
 
-            std::string buff = oss.str();
-            size_t successFind = buff.find("Success");
+   std::vector<shared::CDataContainer> CHttpMethods::SendGetRequests(const std::string & url, const std::vector<shared::CDataContainer> & parametersList)
+   {
+      std::vector<std::string> pathAndQueries;
+      for (const auto& parameters : parametersList)
+         pathAndQueries.push_back(buildUri(url, parameters).getPathAndQuery());
 
-            if (successFind == std::string::npos)
-               return shared::CDataContainer(oss.str());
-            else
-            {
-               buff.insert(successFind + 8, ": \"0\"");
-               return shared::CDataContainer(buff);
-            }
-//----------------------------------------------------------------
-         }
-         else
-         {
-            auto message = (boost::format("Invalid HTTP result : %1%") % response.getReason()).str();
-            YADOMS_LOG(error) << message ;
-            throw CInvalidHTTPResultException(message);
-         }
+      std::vector<shared::CDataContainer> answers(parametersList.size());
+      try
+      {
+         shared::HttpSessionPool().sendPipelinedGetRequests(url,
+                                                            pathAndQueries,
+                                                            [&](std::size_t index, Poco::Net::HTTPResponse& response, std::istream& body)
+                                                            {
+                                                               answers[index] = readAnswer(response, body);
+                                                            },
+                                                            IPX800Timeout);
       }
       catch (Poco::Exception& e) 
       {
-         auto message = (boost::format("Fail to send get http request \"%1%\" : %2%") % url % e.message()).str();
+         auto message = (boost::format("Fail to send get http requests \"%1%\" : %2%") % url % e.message()).str();
          YADOMS_LOG(error) << message ;
          throw CFailedSendingException(message);
       }
+
+      return answers;
+   }
+
+   Poco::URI CHttpMethods::buildUri(const std::string & url, const shared::CDataContainer & parameters)
+   {
+      Poco::URI uri(url);
+
+      if (!parameters.empty())
+      {
+         for (const auto& parametersIterator : parameters.getAsMap())
+            uri.addQueryParameter(parametersIterator.first, parametersIterator.second);
+      }
+
+      return uri;
+   }
+
+   shared::CDataContainer CHttpMethods::readAnswer(Poco::Net::HTTPResponse & response, std::istream & body)
+   {
+      if (response.getStatus() == Poco::Net::HTTPResponse::HTTP_OK)
+      {
+         std::ostringstream oss;
+         Poco::StreamCopier::copyStream(body, oss);
+
+/*       The structure of this return when a command is properly executed is not JSON compliant
+         {
+            "product": "IPX800_V4",
+            "Success"
+         }
+
+      This part add a value to this parameter, to be JSON compliant
+*/       
+
+         std::string buff = oss.str();
+         size_t successFind = buff.find("Success");
+
+         if (successFind == std::string::npos)
+            return shared::CDataContainer(oss.str());
+
+         buff.insert(successFind + 8, ": \"0\"");
+         return shared::CDataContainer(buff);
+//----------------------------------------------------------------
+      }
+
+      auto message = (boost::format("Invalid HTTP result : %1%") % response.getReason()).str();
+      YADOMS_LOG(error) << message ;
+      throw CInvalidHTTPResultException(message);
    }
-} // namespace http
\ No newline at end of file
+} // namespace http
@@ -2,6 +2,8 @@
 
 #include <shared/Export.h>
 #include <shared/DataContainer.h>
+#include <Poco/Net/HTTPResponse.h>
+#include <Poco/URI.h>
 
 namespace http
 {
@@ -20,6 +22,31 @@ namespace http
       /// \return     the answer of the request
       //--------------------------------------------------------------
       static shared::CDataContainer SendGetRequest(const std::string & url, shared::CDataContainer & parameters);
+
+      //--------------------------------------------------------------
+      /// \brief	    SendGetRequests - send several requests to the same url, pipelined on one kept-alive connection
+      /// \param[in]  url                 the url to send the requests
+      /// \param[in]  parametersList      parameters at the end of the url, for each request
+      /// \return     the answers of the requests, in the same order
+      //--------------------------------------------------------------
+      static std::vector<shared::CDataContainer> SendGetRequests(const std::string & url, const std::vector<shared::CDataContainer> & parametersList);
+
+   private:
+      //--------------------------------------------------------------
+      /// \brief	    Build the URI of a request
+      /// \param[in]  url                 the url to send the request
+      /// \param[in]  parameters          parameters at the end of the url
+      /// \return     the URI
+      //--------------------------------------------------------------
+      static Poco::URI buildUri(const std::string & url, const shared::CDataContainer & parameters);
+
+      //--------------------------------------------------------------
+      /// \brief	    Read an answer of the IPX800
+      /// \param[in]  response            the HTTP response
+      /// \param[in]  body                the response body
+      /// \return     the answer
+      //--------------------------------------------------------------
+      static shared::CDataContainer readAnswer(Poco::Net::HTTPResponse & response, std::istream & body);
    };
 
-} // namespace http
\ No newline at end of file
+} // namespace http
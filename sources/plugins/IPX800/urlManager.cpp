@@ -10,4 +10,14 @@ shared::CDataContainer urlManager::sendCommand(Poco::Net::SocketAddress socket,
    url << "http://" << socket.toString() << "/api/xdevices.json";
 
    return http::CHttpMethods::SendGetRequest(url.str(), parameters);
-}
\ No newline at end of file
+}
+
+std::vector<shared::CDataContainer> urlManager::sendCommands(Poco::Net::SocketAddress socket, const std::vector<shared::CDataContainer>& parametersList)
+{
+   std::stringstream url;
+
+   // create the URL
+   url << "http://" << socket.toString() << "/api/xdevices.json";
+
+   return http::CHttpMethods::SendGetRequests(url.str(), parametersList);
+}
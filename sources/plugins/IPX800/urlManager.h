@@ -19,4 +19,12 @@ public:
    //--------------------------------------------------------------
    static shared::CDataContainer sendCommand(Poco::Net::SocketAddress socket, shared::CDataContainer parameters);
 
+   //--------------------------------------------------------------
+   /// \brief	    SendUrlRequests, pipelined on the same connection
+   /// \param[in]  socket              the IP adress with the socket where to send the frames
+   /// \param[in]  parametersList      extra-parameters to the url, for each request
+   /// \return     the answers of the requests, in the same order
+   //--------------------------------------------------------------
+   static std::vector<shared::CDataContainer> sendCommands(Poco::Net::SocketAddress socket, const std::vector<shared::CDataContainer>& parametersList);
+
 };
\ No newline at end of file
@@ -92,4 +92,25 @@ public:
    //--------------------------------------------------------------
    virtual void changeDeviceConfiguration(const boost::shared_ptr<yApi::IYPluginApi>& api,
                                           const boost::shared_ptr<const yApi::ISetDeviceConfiguration>& deviceConfiguration) const = 0;
+
+   //--------------------------------------------------------------
+   /// \brief	                     Check if a device is known as declared (with all its keywords)
+   /// \param [in] deviceName       The device name
+   /// \return                      true if device is known as declared, no need to check it in Yadoms
+   //--------------------------------------------------------------
+   virtual bool isDeclaredDevice(const std::string& deviceName) const = 0;
+
+   //--------------------------------------------------------------
+   /// \brief	                     Notify that the device of a message is declared (with all its keywords)
+   /// \param [in] message          Last received message of the device
+   /// \note                        If the device keywords can not change, next received messages of this device
+   ///                              are not checked anymore, and are updated in place
+   //--------------------------------------------------------------
+   virtual void setDeclaredDevice(boost::shared_ptr<rfxcomMessages::IRfxcomMessage> message) = 0;
+
+   //--------------------------------------------------------------
+   /// \brief	                     Notify that a device was removed
+   /// \param [in] deviceName       The device name
+   //--------------------------------------------------------------
+   virtual void removeDevice(const std::string& deviceName) = 0;
 };
@@ -95,6 +95,13 @@ void CRfxcom::doWork(boost::shared_ptr<yApi::IYPluginApi> api)
                   request->sendError(e.what());
                }
 
+               break;
+            }
+         case yApi::IYPluginApi::kEventDeviceRemoved:
+            {
+               const auto device = api->getEventHandler().getEventData<boost::shared_ptr<const yApi::IDeviceRemoved>>();
+               YADOMS_LOG(information) << device->device() << " was removed";
+               m_transceiver->removeDevice(device->device());
                break;
             }
          case yApi::IYPluginApi::kSetDeviceConfiguration:
@@ -386,10 +393,15 @@ void CRfxcom::processRfxcomDataReceived(boost::shared_ptr<yApi::IYPluginApi> api
    }
 
    // Sensor message, historize all data contained in the message
-   if (api->deviceExists(message->getDeviceName()))
+   if (m_transceiver->isDeclaredDevice(message->getDeviceName()))
+   {
+      message->historizeData(api);
+   }
+   else if (api->deviceExists(message->getDeviceName()))
    {
       createPossiblyMissingKeywords(api,
                                     message);
+      m_transceiver->setDeclaredDevice(message);
       message->historizeData(api);
    }
    else
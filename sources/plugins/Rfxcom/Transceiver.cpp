@@ -63,6 +63,9 @@
 
 const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>> rfxcomMessages::IRfxcomMessage::NoKeywords;
 
+// Size of the header common to all sensor messages (packetlength, packettype, subtype, seqnbr, id1, id2)
+static const size_t SensorHeaderSize = 6;
+
 CTransceiver::CTransceiver(boost::shared_ptr<IPairingHelper> pairingHelper)
    : m_pairingHelper(pairingHelper),
      m_seqNumberProvider(boost::make_shared<CIncrementSequenceNumber>()),
@@ -265,112 +268,33 @@ boost::shared_ptr<rfxcomMessages::IRfxcomMessage> CTransceiver::decodeRfxcomMess
       const auto buf = reinterpret_cast<const RBUF* const>(data.begin());
       const auto bufSize = data.size();
 
-      boost::shared_ptr<rfxcomMessages::IRfxcomMessage> message;
-      switch (buf->RXRESPONSE.packettype)
+      // Message of a known sensor, updated in place
+      auto message = updateCachedMessage(*buf, bufSize);
+      if (message)
       {
-      case pTypeInterfaceMessage: message = boost::make_shared<rfxcomMessages::CTransceiverStatus>(*buf, bufSize, m_seqNumberProvider);
-         break;
-      case pTypeRecXmitMessage: message = boost::make_shared<rfxcomMessages::CAck>(*buf, bufSize, m_seqNumberProvider);
-         break;
-      case pTypeRFXMeter: message = boost::make_shared<rfxcomMessages::CRFXMeter>(api, *buf, bufSize);
-         break;
-      case pTypeLighting1: message = boost::make_shared<rfxcomMessages::CLighting1>(api, *buf, bufSize);
-         break;
-      case pTypeLighting2: message = boost::make_shared<rfxcomMessages::CLighting2>(api, *buf, bufSize);
-         break;
-      case pTypeLighting3: message = boost::make_shared<rfxcomMessages::CLighting3>(api, *buf, bufSize);
-         break;
-      case pTypeLighting4: message = boost::make_shared<rfxcomMessages::CLighting4
-         >(api, *buf, bufSize, m_unsecuredProtocolFilters.at(pTypeLighting4));
-         break;
-      case pTypeLighting5: message = boost::make_shared<rfxcomMessages::CLighting5
-         >(api, *buf, bufSize, m_unsecuredProtocolFilters.at(pTypeLighting5));
-         break;
-      case pTypeLighting6: message = boost::make_shared<rfxcomMessages::CLighting6>(api, *buf, bufSize);
-         break;
-      case pTypeChime: message = boost::make_shared<rfxcomMessages::CChime>(api, *buf, bufSize);
-         break;
-      case pTypeFan: message = boost::make_shared<rfxcomMessages::CFan>(api, *buf, bufSize);
-         break;
-      case pTypeCurtain: message = boost::make_shared<rfxcomMessages::CCurtain1>(api, *buf, bufSize);
-         break;
-      case pTypeBlinds: message = boost::make_shared<rfxcomMessages::CBlinds1>(api, *buf, bufSize);
-         break;
-      case pTypeRFY: message = boost::make_shared<rfxcomMessages::CRfy>(api, *buf, bufSize);
-         break;
-      case pTypeHomeConfort: message = boost::make_shared<rfxcomMessages::CHomeConfort>(api, *buf, bufSize);
-         break;
-      case pTypeTEMP_RAIN: message = boost::make_shared<rfxcomMessages::CTempRain>(api, *buf, bufSize);
-         break;
-      case pTypeTEMP: message = boost::make_shared<rfxcomMessages::CTemp>(api, *buf, bufSize);
-         break;
-      case pTypeHUM: message = boost::make_shared<rfxcomMessages::CHumidity>(api, *buf, bufSize);
-         break;
-      case pTypeTEMP_HUM: message = boost::make_shared<rfxcomMessages::CTempHumidity>(api, *buf, bufSize);
-         break;
-      case pTypeBARO: message = boost::make_shared<rfxcomMessages::CBarometric>(api, *buf, bufSize);
-         break;
-      case pTypeTEMP_HUM_BARO: message = boost::make_shared<rfxcomMessages::CTempHumidityBarometric>(api, *buf, bufSize);
-         break;
-      case pTypeRAIN: message = boost::make_shared<rfxcomMessages::CRain>(api, *buf, bufSize);
-         break;
-      case pTypeWIND: message = boost::make_shared<rfxcomMessages::CWind>(api, *buf, bufSize);
-         break;
-      case pTypeUV: message = boost::make_shared<rfxcomMessages::CUV>(api, *buf, bufSize);
-         break;
-      case pTypeDT: message = boost::make_shared<rfxcomMessages::CDateTime>(api, *buf, bufSize);
-         break;
-      case pTypeCURRENT: message = boost::make_shared<rfxcomMessages::CCurrent>(api, *buf, bufSize);
-         break;
-      case pTypeENERGY: message = boost::make_shared<rfxcomMessages::CEnergy>(api, *buf, bufSize);
-         break;
-      case pTypeCURRENTENERGY: message = boost::make_shared<rfxcomMessages::CCurrentEnergy>(
-            api, *buf, bufSize, m_unsecuredProtocolFilters.at(pTypeCURRENTENERGY));
-         break;
-      case pTypePOWER: message = boost::make_shared<rfxcomMessages::CPower>(api, *buf, bufSize);
-         break;
-      case pTypeWEIGHT: message = boost::make_shared<rfxcomMessages::CWeight>(api, *buf, bufSize);
-         break;
-      case pTypeCARTELECTRONIC: message = boost::make_shared<rfxcomMessages::CCartelectronic>(api, *buf, bufSize);
-         break;
-      case pTypeRFXSensor: message = boost::make_shared<rfxcomMessages::CRFXSensor>(api, *buf, bufSize);
-         break;
-      case pTypeSecurity1: message = boost::make_shared<rfxcomMessages::CSecurity1
-         >(api, *buf, bufSize, m_unsecuredProtocolFilters.at(pTypeSecurity1));
-         break;
-      case pTypeSecurity2: message = boost::make_shared<rfxcomMessages::CSecurity2>(api, *buf, bufSize);
-         break;
-      case pTypeCamera: message = boost::make_shared<rfxcomMessages::CCamera1>(api, *buf, bufSize);
-         break;
-      case pTypeRemote: message = boost::make_shared<rfxcomMessages::CRemote>(api, *buf, bufSize);
-         break;
-      case pTypeThermostat1: message = boost::make_shared<rfxcomMessages::CThermostat1>(api, *buf, bufSize);
-         break;
-      case pTypeThermostat2: message = boost::make_shared<rfxcomMessages::CThermostat2>(api, *buf, bufSize);
-         break;
-      case pTypeThermostat3: message = boost::make_shared<rfxcomMessages::CThermostat3>(api, *buf, bufSize);
-         break;
-      case pTypeRadiator1: message = boost::make_shared<rfxcomMessages::CRadiator1>(api, *buf, bufSize);
-         break;
-      case pTypeBBQ: message = boost::make_shared<rfxcomMessages::CBbq>(api, *buf, bufSize);
-         break;
-      case pTypeFS20: message = boost::make_shared<rfxcomMessages::CFS20>(api, *buf, bufSize);
-         break;
-      default:
-         {
-            YADOMS_LOG(warning) << "Invalid RfxCom message received, unknown packet type " << std::setfill('0')
-               << std::setw(sizeof(unsigned char) * 2) << std::hex << static_cast<int>(buf->RXRESPONSE.packettype);
-            return boost::shared_ptr<rfxcomMessages::IRfxcomMessage>();
-         }
+         logMessage(api, message);
+         return message;
       }
 
-      if (m_pairingHelper->needPairing(message->getDeviceName()))
+      message = createRfxcomMessage(api, *buf, bufSize);
+      if (!message)
+         return message;
+
+      if (!isDeclaredDevice(message->getDeviceName()) && m_pairingHelper->needPairing(message->getDeviceName()))
       {
          if (m_pairingHelper->getMode() == IPairingHelper::kAuto)
             message->filter();
          message->declareDevice(api);
       }
 
+      // Keep messages of declared devices, to update them in place from next frames
+      if (isDeclaredDevice(message->getDeviceName()))
+      {
+         const auto updatableMessage = boost::dynamic_pointer_cast<rfxcomMessages::IUpdatableRfxcomMessage>(message);
+         if (!!updatableMessage)
+            m_cachedMessages[cacheKey(*buf)] = {message, updatableMessage.get()};
+      }
+
       logMessage(api, message);
       return message;
    }
@@ -388,6 +312,161 @@ boost::shared_ptr<rfxcomMessages::IRfxcomMessage> CTransceiver::decodeRfxcomMess
    }
 }
 
+boost::shared_ptr<rfxcomMessages::IRfxcomMessage> CTransceiver::createRfxcomMessage(boost::shared_ptr<yApi::IYPluginApi> api,
+                                                                                    const RBUF& rbuf,
+                                                                                    size_t rbufSize) const
+{
+   boost::shared_ptr<rfxcomMessages::IRfxcomMessage> message;
+   switch (rbuf.RXRESPONSE.packettype)
+   {
+   case pTypeInterfaceMessage: message = boost::make_shared<rfxcomMessages::CTransceiverStatus>(rbuf, rbufSize, m_seqNumberProvider);
+      break;
+   case pTypeRecXmitMessage: message = boost::make_shared<rfxcomMessages::CAck>(rbuf, rbufSize, m_seqNumberProvider);
+      break;
+   case pTypeRFXMeter: message = boost::make_shared<rfxcomMessages::CRFXMeter>(api, rbuf, rbufSize);
+      break;
+   case pTypeLighting1: message = boost::make_shared<rfxcomMessages::CLighting1>(api, rbuf, rbufSize);
+      break;
+   case pTypeLighting2: message = boost::make_shared<rfxcomMessages::CLighting2>(api, rbuf, rbufSize);
+      break;
+   case pTypeLighting3: message = boost::make_shared<rfxcomMessages::CLighting3>(api, rbuf, rbufSize);
+      break;
+   case pTypeLighting4: message = boost::make_shared<rfxcomMessages::CLighting4
+      >(api, rbuf, rbufSize, m_unsecuredProtocolFilters.at(pTypeLighting4));
+      break;
+   case pTypeLighting5: message = boost::make_shared<rfxcomMessages::CLighting5
+      >(api, rbuf, rbufSize, m_unsecuredProtocolFilters.at(pTypeLighting5));
+      break;
+   case pTypeLighting6: message = boost::make_shared<rfxcomMessages::CLighting6>(api, rbuf, rbufSize);
+      break;
+   case pTypeChime: message = boost::make_shared<rfxcomMessages::CChime>(api, rbuf, rbufSize);
+      break;
+   case pTypeFan: message = boost::make_shared<rfxcomMessages::CFan>(api, rbuf, rbufSize);
+      break;
+   case pTypeCurtain: message = boost::make_shared<rfxcomMessages::CCurtain1>(api, rbuf, rbufSize);
+      break;
+   case pTypeBlinds: message = boost::make_shared<rfxcomMessages::CBlinds1>(api, rbuf, rbufSize);
+      break;
+   case pTypeRFY: message = boost::make_shared<rfxcomMessages::CRfy>(api, rbuf, rbufSize);
+      break;
+   case pTypeHomeConfort: message = boost::make_shared<rfxcomMessages::CHomeConfort>(api, rbuf, rbufSize);
+      break;
+   case pTypeTEMP_RAIN: message = boost::make_shared<rfxcomMessages::CTempRain>(api, rbuf, rbufSize);
+      break;
+   case pTypeTEMP: message = boost::make_shared<rfxcomMessages::CTemp>(api, rbuf, rbufSize);
+      break;
+   case pTypeHUM: message = boost::make_shared<rfxcomMessages::CHumidity>(api, rbuf, rbufSize);
+      break;
+   case pTypeTEMP_HUM: message = boost::make_shared<rfxcomMessages::CTempHumidity>(api, rbuf, rbufSize);
+      break;
+   case pTypeBARO: message = boost::make_shared<rfxcomMessages::CBarometric>(api, rbuf, rbufSize);
+      break;
+   case pTypeTEMP_HUM_BARO: message = boost::make_shared<rfxcomMessages::CTempHumidityBarometric>(api, rbuf, rbufSize);
+      break;
+   case pTypeRAIN: message = boost::make_shared<rfxcomMessages::CRain>(api, rbuf, rbufSize);
+      break;
+   case pTypeWIND: message = boost::make_shared<rfxcomMessages::CWind>(api, rbuf, rbufSize);
+      break;
+   case pTypeUV: message = boost::make_shared<rfxcomMessages::CUV>(api, rbuf, rbufSize);
+      break;
+   case pTypeDT: message = boost::make_shared<rfxcomMessages::CDateTime>(api, rbuf, rbufSize);
+      break;
+   case pTypeCURRENT: message = boost::make_shared<rfxcomMessages::CCurrent>(api, rbuf, rbufSize);
+      break;
+   case pTypeENERGY: message = boost::make_shared<rfxcomMessages::CEnergy>(api, rbuf, rbufSize);
+      break;
+   case pTypeCURRENTENERGY: message = boost::make_shared<rfxcomMessages::CCurrentEnergy>(
+         api, rbuf, rbufSize, m_unsecuredProtocolFilters.at(pTypeCURRENTENERGY));
+      break;
+   case pTypePOWER: message = boost::make_shared<rfxcomMessages::CPower>(api, rbuf, rbufSize);
+      break;
+   case pTypeWEIGHT: message = boost::make_shared<rfxcomMessages::CWeight>(api, rbuf, rbufSize);
+      break;
+   case pTypeCARTELECTRONIC: message = boost::make_shared<rfxcomMessages::CCartelectronic>(api, rbuf, rbufSize);
+      break;
+   case pTypeRFXSensor: message = boost::make_shared<rfxcomMessages::CRFXSensor>(api, rbuf, rbufSize);
+      break;
+   case pTypeSecurity1: message = boost::make_shared<rfxcomMessages::CSecurity1
+      >(api, rbuf, rbufSize, m_unsecuredProtocolFilters.at(pTypeSecurity1));
+      break;
+   case pTypeSecurity2: message = boost::make_shared<rfxcomMessages::CSecurity2>(api, rbuf, rbufSize);
+      break;
+   case pTypeCamera: message = boost::make_shared<rfxcomMessages::CCamera1>(api, rbuf, rbufSize);
+      break;
+   case pTypeRemote: message = boost::make_shared<rfxcomMessages::CRemote>(api, rbuf, rbufSize);
+      break;
+   case pTypeThermostat1: message = boost::make_shared<rfxcomMessages::CThermostat1>(api, rbuf, rbufSize);
+      break;
+   case pTypeThermostat2: message = boost::make_shared<rfxcomMessages::CThermostat2>(api, rbuf, rbufSize);
+      break;
+   case pTypeThermostat3: message = boost::make_shared<rfxcomMessages::CThermostat3>(api, rbuf, rbufSize);
+      break;
+   case pTypeRadiator1: message = boost::make_shared<rfxcomMessages::CRadiator1>(api, rbuf, rbufSize);
+      break;
+   case pTypeBBQ: message = boost::make_shared<rfxcomMessages::CBbq>(api, rbuf, rbufSize);
+      break;
+   case pTypeFS20: message = boost::make_shared<rfxcomMessages::CFS20>(api, rbuf, rbufSize);
+      break;
+   default:
+      {
+         YADOMS_LOG(warning) << "Invalid RfxCom message received, unknown packet type " << std::setfill('0')
+            << std::setw(sizeof(unsigned char) * 2) << std::hex << static_cast<int>(rbuf.RXRESPONSE.packettype);
+         return boost::shared_ptr<rfxcomMessages::IRfxcomMessage>();
+      }
+   }
+
+   return message;
+}
+
+boost::shared_ptr<rfxcomMessages::IRfxcomMessage> CTransceiver::updateCachedMessage(const RBUF& rbuf,
+                                                                                    size_t rbufSize) const
+{
+   if (m_cachedMessages.empty() || rbufSize < SensorHeaderSize)
+      return boost::shared_ptr<rfxcomMessages::IRfxcomMessage>();
+
+   const auto cachedMessage = m_cachedMessages.find(cacheKey(rbuf));
+   if (cachedMessage == m_cachedMessages.end())
+      return boost::shared_ptr<rfxcomMessages::IRfxcomMessage>();
+
+   if (!cachedMessage->second.updatable->update(rbuf, rbufSize))
+      return boost::shared_ptr<rfxcomMessages::IRfxcomMessage>();
+
+   return cachedMessage->second.message;
+}
+
+unsigned int CTransceiver::cacheKey(const RBUF& rbuf)
+{
+   // All sensor messages begin with the same header (packetlength, packettype, subtype, seqnbr, id1, id2)
+   return rbuf.TEMP.packettype << 24 | rbuf.TEMP.subtype << 16 | rbuf.TEMP.id1 << 8 | rbuf.TEMP.id2;
+}
+
+bool CTransceiver::isDeclaredDevice(const std::string& deviceName) const
+{
+   return m_declaredDevices.find(deviceName) != m_declaredDevices.end();
+}
+
+void CTransceiver::setDeclaredDevice(boost::shared_ptr<rfxcomMessages::IRfxcomMessage> message)
+{
+   // Only updatable messages have fixed keywords, others must be checked at each reception
+   if (!boost::dynamic_pointer_cast<rfxcomMessages::IUpdatableRfxcomMessage>(message))
+      return;
+
+   m_declaredDevices.insert(message->getDeviceName());
+}
+
+void CTransceiver::removeDevice(const std::string& deviceName)
+{
+   m_declaredDevices.erase(deviceName);
+
+   for (auto cachedMessage = m_cachedMessages.begin(); cachedMessage != m_cachedMessages.end();)
+   {
+      if (cachedMessage->second.message->getDeviceName() == deviceName)
+         cachedMessage = m_cachedMessages.erase(cachedMessage);
+      else
+         ++cachedMessage;
+   }
+}
+
 std::string CTransceiver::createDeviceManually(boost::shared_ptr<yApi::IYPluginApi> api,
                                                const yApi::IManuallyDeviceCreationData& data) const
 {
@@ -2,6 +2,7 @@
 
 #include "ITransceiver.h"
 #include "rfxcomMessages/IRfxcomMessage.h"
+#include "rfxcomMessages/IUpdatableRfxcomMessage.h"
 #include "ISequenceNumber.h"
 #include "IUnsecuredProtocolFilter.h"
 
@@ -34,9 +35,47 @@ public:
                                     const yApi::IManuallyDeviceCreationData& data) const override;
    void changeDeviceConfiguration(const boost::shared_ptr<yApi::IYPluginApi>& api,
                                   const boost::shared_ptr<const yApi::ISetDeviceConfiguration>& deviceConfiguration) const override;
+   bool isDeclaredDevice(const std::string& deviceName) const override;
+   void setDeclaredDevice(boost::shared_ptr<rfxcomMessages::IRfxcomMessage> message) override;
+   void removeDevice(const std::string& deviceName) override;
    // [END] ITransceiver implementation
 
 private:
+   //--------------------------------------------------------------
+   /// \brief	                     Message kept to be updated in place by next frames of the same device
+   //--------------------------------------------------------------
+   struct CachedMessage
+   {
+      boost::shared_ptr<rfxcomMessages::IRfxcomMessage> message;
+      rfxcomMessages::IUpdatableRfxcomMessage* updatable;
+   };
+
+   //--------------------------------------------------------------
+   /// \brief	                     Build the message from a received frame
+   /// \param [in] api              Plugin execution context (Yadoms API)
+   /// \param [in] rbuf             The received frame
+   /// \param [in] rbufSize         The received frame size
+   /// \return                      The message, NULL if unknown packet type
+   //--------------------------------------------------------------
+   boost::shared_ptr<rfxcomMessages::IRfxcomMessage> createRfxcomMessage(boost::shared_ptr<yApi::IYPluginApi> api,
+                                                                         const RBUF& rbuf,
+                                                                         size_t rbufSize) const;
+
+   //--------------------------------------------------------------
+   /// \brief	                     Update in place the cached message of the device sending the frame
+   /// \param [in] rbuf             The received frame
+   /// \param [in] rbufSize         The received frame size
+   /// \return                      The updated message, NULL if no message is cached for this device
+   //--------------------------------------------------------------
+   boost::shared_ptr<rfxcomMessages::IRfxcomMessage> updateCachedMessage(const RBUF& rbuf,
+                                                                         size_t rbufSize) const;
+
+   //--------------------------------------------------------------
+   /// \brief	                     Key identifying the device sending a sensor frame (packet type, subtype and id)
+   /// \param [in] rbuf             The received frame
+   /// \return                      The key
+   //--------------------------------------------------------------
+   static unsigned int cacheKey(const RBUF& rbuf);
 
    static void logMessage(boost::shared_ptr<yApi::IYPluginApi> api,
                           const boost::shared_ptr<rfxcomMessages::IRfxcomMessage>& message);
@@ -46,4 +85,14 @@ private:
    boost::shared_ptr<IPairingHelper> m_pairingHelper;
    boost::shared_ptr<ISequenceNumber> m_seqNumberProvider;
    const std::map<int, boost::shared_ptr<IUnsecuredProtocolFilter>> m_unsecuredProtocolFilters;
+
+   //--------------------------------------------------------------
+   /// \brief	                     Messages of declared devices, updated in place (key is cacheKey)
+   //--------------------------------------------------------------
+   mutable std::map<unsigned int, CachedMessage> m_cachedMessages;
+
+   //--------------------------------------------------------------
+   /// \brief	                     Devices known as declared, with fixed keywords
+   //--------------------------------------------------------------
+   std::set<std::string> m_declaredDevices;
 };
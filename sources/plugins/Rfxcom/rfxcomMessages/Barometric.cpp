@@ -27,10 +27,7 @@ namespace rfxcomMessages
 
       m_id = rbuf.BARO.id1 | (rbuf.BARO.id2 << 8);
 
-      m_pressure->set(rbuf.BARO.baro1 << 8 | (rbuf.BARO.baro2));
-
-      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.BARO.battery_level));
-      m_signalPower->set(NormalizesignalPowerLevel(rbuf.BARO.rssi));
+      decodeValues(rbuf);
 
       buildDeviceModel();
       buildDeviceName();
@@ -40,6 +37,31 @@ namespace rfxcomMessages
    {
    }
 
+   bool CBarometric::update(const RBUF& rbuf,
+                            size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypeBARO,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(BARO),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.BARO.subtype != m_subType || (rbuf.BARO.id1 | (rbuf.BARO.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CBarometric::decodeValues(const RBUF& rbuf)
+   {
+      m_pressure->set(rbuf.BARO.baro1 << 8 | (rbuf.BARO.baro2));
+
+      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.BARO.battery_level));
+      m_signalPower->set(NormalizesignalPowerLevel(rbuf.BARO.rssi));
+   }
+
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CBarometric::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
    {
       throw shared::exception::CInvalidParameter("Barometric is a read-only message, can not be encoded");
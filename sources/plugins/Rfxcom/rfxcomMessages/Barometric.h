@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IRfxcomMessage.h"
+#include "IUpdatableRfxcomMessage.h"
 #include "RFXtrxHelpers.h"
 #include <shared/plugin/yPluginApi/IYPluginApi.h>
 
@@ -11,7 +12,7 @@ namespace rfxcomMessages
    //--------------------------------------------------------------
    /// \brief	The Barometric protocol support (reception only)
    //--------------------------------------------------------------
-   class CBarometric : public IRfxcomMessage
+   class CBarometric : public IRfxcomMessage, public IUpdatableRfxcomMessage
    {
    public:
       CBarometric(boost::shared_ptr<yApi::IYPluginApi> api, const RBUF& rbuf, size_t rbufSize);
@@ -27,7 +28,13 @@ namespace rfxcomMessages
       const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>>& keywords() override;
       // [END] IRfxcomMessage implementation
 
+      // IUpdatableRfxcomMessage implementation
+      bool update(const RBUF& rbuf,
+                  size_t rbufSize) override;
+      // [END] IUpdatableRfxcomMessage implementation
+
    protected:
+      void decodeValues(const RBUF& rbuf);
       void buildDeviceName();
       void buildDeviceModel();
 
@@ -29,12 +29,7 @@ namespace rfxcomMessages
 
       m_id = rbuf.CURRENT.id1 | (rbuf.CURRENT.id2 << 8);
 
-      m_current1->set((rbuf.CURRENT.ch1h << 8 | rbuf.CURRENT.ch1l) / 10.0);
-      m_current2->set((rbuf.CURRENT.ch2h << 8 | rbuf.CURRENT.ch2l) / 10.0);
-      m_current3->set((rbuf.CURRENT.ch3h << 8 | rbuf.CURRENT.ch3l) / 10.0);
-
-      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.CURRENT.battery_level));
-      m_signalPower->set(NormalizesignalPowerLevel(rbuf.CURRENT.rssi));
+      decodeValues(rbuf);
 
       buildDeviceModel();
       buildDeviceName();
@@ -44,6 +39,33 @@ namespace rfxcomMessages
    {
    }
 
+   bool CCurrent::update(const RBUF& rbuf,
+                         size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypeCURRENT,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(CURRENT),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.CURRENT.subtype != m_subType || (rbuf.CURRENT.id1 | (rbuf.CURRENT.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CCurrent::decodeValues(const RBUF& rbuf)
+   {
+      m_current1->set((rbuf.CURRENT.ch1h << 8 | rbuf.CURRENT.ch1l) / 10.0);
+      m_current2->set((rbuf.CURRENT.ch2h << 8 | rbuf.CURRENT.ch2l) / 10.0);
+      m_current3->set((rbuf.CURRENT.ch3h << 8 | rbuf.CURRENT.ch3l) / 10.0);
+
+      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.CURRENT.battery_level));
+      m_signalPower->set(NormalizesignalPowerLevel(rbuf.CURRENT.rssi));
+   }
+
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CCurrent::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
    {
       throw shared::exception::CInvalidParameter("Current is a read-only message, can not be encoded");
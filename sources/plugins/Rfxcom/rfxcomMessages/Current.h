@@ -1,5 +1,6 @@
 #pragma once
 #include "IRfxcomMessage.h"
+#include "IUpdatableRfxcomMessage.h"
 #include "RFXtrxHelpers.h"
 #include <shared/plugin/yPluginApi/IYPluginApi.h>
 
@@ -10,7 +11,7 @@ namespace rfxcomMessages
    //--------------------------------------------------------------
    /// \brief	The current protocol support (reception only)
    //--------------------------------------------------------------
-   class CCurrent : public IRfxcomMessage
+   class CCurrent : public IRfxcomMessage, public IUpdatableRfxcomMessage
    {
    public:
       CCurrent(boost::shared_ptr<yApi::IYPluginApi> api,
@@ -28,7 +29,13 @@ namespace rfxcomMessages
       const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>>& keywords() override;
       // [END] IRfxcomMessage implementation
 
+      // IUpdatableRfxcomMessage implementation
+      bool update(const RBUF& rbuf,
+                  size_t rbufSize) override;
+      // [END] IUpdatableRfxcomMessage implementation
+
    protected:
+      void decodeValues(const RBUF& rbuf);
       void buildDeviceName();
       void buildDeviceModel();
 
@@ -27,10 +27,7 @@ namespace rfxcomMessages
 
       m_id = rbuf.HUM.id1 | (rbuf.HUM.id2 << 8);
 
-      m_humidity->set(rbuf.HUM.humidity);
-
-      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.HUM.battery_level));
-      m_signalPower->set(NormalizesignalPowerLevel(rbuf.HUM.rssi));
+      decodeValues(rbuf);
 
       buildDeviceModel();
       buildDeviceName();
@@ -40,6 +37,31 @@ namespace rfxcomMessages
    {
    }
 
+   bool CHumidity::update(const RBUF& rbuf,
+                          size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypeHUM,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(HUM),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.HUM.subtype != m_subType || (rbuf.HUM.id1 | (rbuf.HUM.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CHumidity::decodeValues(const RBUF& rbuf)
+   {
+      m_humidity->set(rbuf.HUM.humidity);
+
+      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.HUM.battery_level));
+      m_signalPower->set(NormalizesignalPowerLevel(rbuf.HUM.rssi));
+   }
+
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CHumidity::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
    {
       throw shared::exception::CInvalidParameter("Humidity is a read-only message, can not be encoded");
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "RFXtrxHelpers.h"
+
+namespace rfxcomMessages
+{
+   //--------------------------------------------------------------
+   /// \brief	Interface of received messages which can be updated in place
+   ///
+   /// Sensors send the same message periodically : the message object decoded
+   /// from the first frame is kept, and its values are updated from the next frames.
+   //--------------------------------------------------------------
+   class IUpdatableRfxcomMessage
+   {
+   public:
+      //--------------------------------------------------------------
+      /// \brief	Destructor
+      //--------------------------------------------------------------
+      virtual ~IUpdatableRfxcomMessage()
+      {
+      }
+
+      //--------------------------------------------------------------
+      /// \brief	                        Update the message values from a new received frame
+      /// \param[in] rbuf                 The received buffer
+      /// \param[in] rbufSize             Message size, received from Rfxcom
+      /// \return                         false if the frame is from another device (message is not modified)
+      /// \throw                          shared::exception::CException if the frame is invalid
+      //--------------------------------------------------------------
+      virtual bool update(const RBUF& rbuf,
+                          size_t rbufSize) = 0;
+   };
+}
@@ -31,6 +31,35 @@ namespace rfxcomMessages
 
       m_id = rbuf.POWER.id1 | (rbuf.POWER.id2 << 8);
 
+      decodeValues(rbuf);
+
+      buildDeviceModel();
+      buildDeviceName();
+   }
+
+   CPower::~CPower()
+   {
+   }
+
+   bool CPower::update(const RBUF& rbuf,
+                       size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypePOWER,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(POWER),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.POWER.subtype != m_subType || (rbuf.POWER.id1 | (rbuf.POWER.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CPower::decodeValues(const RBUF& rbuf)
+   {
       m_voltage->set(rbuf.POWER.voltage);
 
       m_current->set((rbuf.POWER.currentH << 8 | rbuf.POWER.currentL) / 100.0);
@@ -44,13 +73,6 @@ namespace rfxcomMessages
       m_frequency->set(rbuf.POWER.freq);
 
       m_signalPower->set(NormalizesignalPowerLevel(rbuf.POWER.rssi));
-
-      buildDeviceModel();
-      buildDeviceName();
-   }
-
-   CPower::~CPower()
-   {
    }
 
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CPower::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
@@ -31,6 +31,35 @@ namespace rfxcomMessages
                                                               (m_subType == sTypeRAIN6) ? (yApi::historization::EMeasureType::kIncrement) : (yApi::historization::EMeasureType::kCumulative));
       m_keywords.push_back(m_rain);
 
+      decodeValues(rbuf);
+
+      buildDeviceModel();
+      buildDeviceName();
+   }
+
+   CRain::~CRain()
+   {
+   }
+
+   bool CRain::update(const RBUF& rbuf,
+                      size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypeRAIN,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(RAIN),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.RAIN.subtype != m_subType || (rbuf.RAIN.id1 | (rbuf.RAIN.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CRain::decodeValues(const RBUF& rbuf)
+   {
       switch (m_subType)
       {
       case sTypeRAIN1:
@@ -57,13 +86,6 @@ namespace rfxcomMessages
 
       m_batteryLevel->set(NormalizeBatteryLevel(rbuf.RAIN.battery_level));
       m_signalPower->set(NormalizesignalPowerLevel(rbuf.RAIN.rssi));
-
-      buildDeviceModel();
-      buildDeviceName();
-   }
-
-   CRain::~CRain()
-   {
    }
 
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CRain::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
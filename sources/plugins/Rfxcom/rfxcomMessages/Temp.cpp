@@ -27,9 +27,7 @@ namespace rfxcomMessages
 
       m_id = rbuf.TEMP.id1 | (rbuf.TEMP.id2 << 8);
 
-      m_temperature->set(NormalizeTemperature(rbuf.TEMP.temperatureh, rbuf.TEMP.temperaturel, rbuf.TEMP.tempsign == 1));
-      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.TEMP.battery_level));
-      m_signalPower->set(NormalizesignalPowerLevel(rbuf.TEMP.rssi));
+      decodeValues(rbuf);
 
       buildDeviceModel();
       buildDeviceName();
@@ -39,6 +37,30 @@ namespace rfxcomMessages
    {
    }
 
+   bool CTemp::update(const RBUF& rbuf,
+                      size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypeTEMP,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(TEMP),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.TEMP.subtype != m_subType || (rbuf.TEMP.id1 | (rbuf.TEMP.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CTemp::decodeValues(const RBUF& rbuf)
+   {
+      m_temperature->set(NormalizeTemperature(rbuf.TEMP.temperatureh, rbuf.TEMP.temperaturel, rbuf.TEMP.tempsign == 1));
+      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.TEMP.battery_level));
+      m_signalPower->set(NormalizesignalPowerLevel(rbuf.TEMP.rssi));
+   }
+
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CTemp::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
    {
       throw shared::exception::CInvalidParameter("Temp is a read-only message, can not be encoded");
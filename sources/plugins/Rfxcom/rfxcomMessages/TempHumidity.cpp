@@ -28,11 +28,7 @@ namespace rfxcomMessages
 
       m_id = rbuf.TEMP_HUM.id1 | (rbuf.TEMP_HUM.id2 << 8);
 
-      m_temperature->set(NormalizeTemperature(rbuf.TEMP_HUM.temperatureh, rbuf.TEMP_HUM.temperaturel, rbuf.TEMP_HUM.tempsign == 1));
-      m_humidity->set(rbuf.TEMP_HUM.humidity);
-
-      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.TEMP_HUM.battery_level));
-      m_signalPower->set(NormalizesignalPowerLevel(rbuf.TEMP_HUM.rssi));
+      decodeValues(rbuf);
 
       buildDeviceModel();
       buildDeviceName();
@@ -42,6 +38,32 @@ namespace rfxcomMessages
    {
    }
 
+   bool CTempHumidity::update(const RBUF& rbuf,
+                              size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypeTEMP_HUM,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(TEMP_HUM),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.TEMP_HUM.subtype != m_subType || (rbuf.TEMP_HUM.id1 | (rbuf.TEMP_HUM.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CTempHumidity::decodeValues(const RBUF& rbuf)
+   {
+      m_temperature->set(NormalizeTemperature(rbuf.TEMP_HUM.temperatureh, rbuf.TEMP_HUM.temperaturel, rbuf.TEMP_HUM.tempsign == 1));
+      m_humidity->set(rbuf.TEMP_HUM.humidity);
+
+      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.TEMP_HUM.battery_level));
+      m_signalPower->set(NormalizesignalPowerLevel(rbuf.TEMP_HUM.rssi));
+   }
+
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CTempHumidity::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
    {
       throw shared::exception::CInvalidParameter("TempHumidity is a read-only message, can not be encoded");
@@ -29,13 +29,7 @@ namespace rfxcomMessages
 
       m_id = rbuf.TEMP_HUM_BARO.id1 | (rbuf.TEMP_HUM_BARO.id2 << 8);
 
-      m_temperature->set(NormalizeTemperature(rbuf.TEMP_HUM_BARO.temperatureh, rbuf.TEMP_HUM_BARO.temperaturel, rbuf.TEMP_HUM_BARO.tempsign == 1));
-      m_humidity->set(rbuf.TEMP_HUM_BARO.humidity);
-
-      m_pressure->set(rbuf.TEMP_HUM_BARO.baroh << 8 | (rbuf.TEMP_HUM_BARO.barol));
-
-      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.TEMP_HUM_BARO.battery_level));
-      m_signalPower->set(NormalizesignalPowerLevel(rbuf.TEMP_HUM_BARO.rssi));
+      decodeValues(rbuf);
 
       buildDeviceModel();
       buildDeviceName();
@@ -45,6 +39,34 @@ namespace rfxcomMessages
    {
    }
 
+   bool CTempHumidityBarometric::update(const RBUF& rbuf,
+                                        size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypeTEMP_HUM_BARO,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(TEMP_HUM_BARO),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.TEMP_HUM_BARO.subtype != m_subType || (rbuf.TEMP_HUM_BARO.id1 | (rbuf.TEMP_HUM_BARO.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CTempHumidityBarometric::decodeValues(const RBUF& rbuf)
+   {
+      m_temperature->set(NormalizeTemperature(rbuf.TEMP_HUM_BARO.temperatureh, rbuf.TEMP_HUM_BARO.temperaturel, rbuf.TEMP_HUM_BARO.tempsign == 1));
+      m_humidity->set(rbuf.TEMP_HUM_BARO.humidity);
+
+      m_pressure->set(rbuf.TEMP_HUM_BARO.baroh << 8 | (rbuf.TEMP_HUM_BARO.barol));
+
+      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.TEMP_HUM_BARO.battery_level));
+      m_signalPower->set(NormalizesignalPowerLevel(rbuf.TEMP_HUM_BARO.rssi));
+   }
+
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CTempHumidityBarometric::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
    {
       throw shared::exception::CInvalidParameter("TempHumidityBarometric is a read-only message, can not be encoded");
@@ -30,10 +30,7 @@ namespace rfxcomMessages
 
       m_id = rbuf.TEMP_RAIN.id1 | (rbuf.TEMP_RAIN.id2 << 8);
 
-      m_temperature->set(NormalizeTemperature(rbuf.TEMP_RAIN.temperatureh, rbuf.TEMP_RAIN.temperaturel, rbuf.TEMP_RAIN.tempsign == 1));
-      m_rain->set(static_cast<double>((rbuf.TEMP_RAIN.raintotal1 << 8) | rbuf.TEMP_RAIN.raintotal2) / 10.0);
-      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.TEMP_RAIN.battery_level));
-      m_signalPower->set(NormalizesignalPowerLevel(rbuf.TEMP_RAIN.rssi));
+      decodeValues(rbuf);
 
       buildDeviceModel();
       buildDeviceName();
@@ -43,6 +40,31 @@ namespace rfxcomMessages
    {
    }
 
+   bool CTempRain::update(const RBUF& rbuf,
+                          size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypeTEMP_RAIN,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(TEMP_RAIN),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.TEMP_RAIN.subtype != m_subType || (rbuf.TEMP_RAIN.id1 | (rbuf.TEMP_RAIN.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CTempRain::decodeValues(const RBUF& rbuf)
+   {
+      m_temperature->set(NormalizeTemperature(rbuf.TEMP_RAIN.temperatureh, rbuf.TEMP_RAIN.temperaturel, rbuf.TEMP_RAIN.tempsign == 1));
+      m_rain->set(static_cast<double>((rbuf.TEMP_RAIN.raintotal1 << 8) | rbuf.TEMP_RAIN.raintotal2) / 10.0);
+      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.TEMP_RAIN.battery_level));
+      m_signalPower->set(NormalizesignalPowerLevel(rbuf.TEMP_RAIN.rssi));
+   }
+
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CTempRain::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
    {
       throw shared::exception::CInvalidParameter("Temp is a read-only message, can not be encoded");
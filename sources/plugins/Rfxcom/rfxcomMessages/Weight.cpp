@@ -27,10 +27,7 @@ namespace rfxcomMessages
 
       m_id = rbuf.WEIGHT.id1 | (rbuf.WEIGHT.id2 << 8);
 
-      m_weight->set((rbuf.WEIGHT.weighthigh << 8 | rbuf.WEIGHT.weightlow) / 10.0);
-
-      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.WEIGHT.filler)); // In SDK specification battery_level is at filler location
-      m_signalPower->set(NormalizesignalPowerLevel(rbuf.WEIGHT.rssi));
+      decodeValues(rbuf);
 
       // Build device description
       buildDeviceModel();
@@ -41,6 +38,31 @@ namespace rfxcomMessages
    {
    }
 
+   bool CWeight::update(const RBUF& rbuf,
+                        size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypeWEIGHT,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(WEIGHT),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.WEIGHT.subtype != m_subType || (rbuf.WEIGHT.id1 | (rbuf.WEIGHT.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CWeight::decodeValues(const RBUF& rbuf)
+   {
+      m_weight->set((rbuf.WEIGHT.weighthigh << 8 | rbuf.WEIGHT.weightlow) / 10.0);
+
+      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.WEIGHT.filler)); // In SDK specification battery_level is at filler location
+      m_signalPower->set(NormalizesignalPowerLevel(rbuf.WEIGHT.rssi));
+   }
+
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CWeight::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
    {
       throw shared::exception::CInvalidParameter("Weight is a read-only message, can not be encoded");
@@ -28,37 +28,25 @@ namespace rfxcomMessages
 
       m_id = rbuf.WIND.id1 | (rbuf.WIND.id2 << 8);
 
-      if (m_subType != sTypeWIND8)
-      {
-         m_windDirection->set(rbuf.WIND.directionl | (rbuf.WIND.directionh << 8));
-      }
-
       if (m_subType != sTypeWIND5)
       {
          m_windAverageSpeed = boost::make_shared<yApi::historization::CSpeed>("windAverageSpeed");
          m_keywords.push_back(m_windAverageSpeed);
-
-         m_windAverageSpeed->set((rbuf.WIND.av_speedl | (rbuf.WIND.av_speedh << 8)) / 10.0);
       }
 
-      m_windMaxSpeed->set((rbuf.WIND.gustl | (rbuf.WIND.gusth << 8)) / 10.0);
-
       if (m_subType == sTypeWIND4 || m_subType == sTypeWIND8)
       {
          m_temperature = boost::make_shared<yApi::historization::CTemperature>("temperature");
-         m_temperature->set(NormalizeTemperature(rbuf.WIND.temperatureh, rbuf.WIND.temperaturel, rbuf.WIND.tempsign == 1));
          m_keywords.push_back(m_temperature);
       }
 
       if (m_subType == sTypeWIND4)
       {
          m_chillTemperature = boost::make_shared<yApi::historization::CTemperature>("chillTemperature");
-         m_chillTemperature->set(NormalizeTemperature(rbuf.WIND.chillh, rbuf.WIND.chilll, rbuf.WIND.chillsign == 1));
          m_keywords.push_back(m_chillTemperature);
       }
 
-      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.WIND.battery_level));
-      m_signalPower->set(NormalizesignalPowerLevel(rbuf.WIND.rssi));
+      decodeValues(rbuf);
 
       buildDeviceModel();
       buildDeviceName();
@@ -68,6 +56,43 @@ namespace rfxcomMessages
    {
    }
 
+   bool CWind::update(const RBUF& rbuf,
+                      size_t rbufSize)
+   {
+      CheckReceivedMessage(rbuf,
+                           rbufSize,
+                           pTypeWIND,
+                           DONT_CHECK_SUBTYPE,
+                           GET_RBUF_STRUCT_SIZE(WIND),
+                           DONT_CHECK_SEQUENCE_NUMBER);
+
+      if (rbuf.WIND.subtype != m_subType || (rbuf.WIND.id1 | (rbuf.WIND.id2 << 8)) != m_id)
+         return false;
+
+      decodeValues(rbuf);
+      return true;
+   }
+
+   void CWind::decodeValues(const RBUF& rbuf)
+   {
+      if (m_subType != sTypeWIND8)
+         m_windDirection->set(rbuf.WIND.directionl | (rbuf.WIND.directionh << 8));
+
+      if (m_windAverageSpeed)
+         m_windAverageSpeed->set((rbuf.WIND.av_speedl | (rbuf.WIND.av_speedh << 8)) / 10.0);
+
+      m_windMaxSpeed->set((rbuf.WIND.gustl | (rbuf.WIND.gusth << 8)) / 10.0);
+
+      if (m_temperature)
+         m_temperature->set(NormalizeTemperature(rbuf.WIND.temperatureh, rbuf.WIND.temperaturel, rbuf.WIND.tempsign == 1));
+
+      if (m_chillTemperature)
+         m_chillTemperature->set(NormalizeTemperature(rbuf.WIND.chillh, rbuf.WIND.chilll, rbuf.WIND.chillsign == 1));
+
+      m_batteryLevel->set(NormalizeBatteryLevel(rbuf.WIND.battery_level));
+      m_signalPower->set(NormalizesignalPowerLevel(rbuf.WIND.rssi));
+   }
+
    boost::shared_ptr<std::queue<shared::communication::CByteBuffer>> CWind::encode(boost::shared_ptr<ISequenceNumber> seqNumberProvider) const
    {
       throw shared::exception::CInvalidParameter("Wind is a read-only message, can not be encoded");
@@ -1,11 +1,12 @@
 #pragma once
 
 #include "../ILoad.h"
+#include "ProcStat.h"
 #include <shared/plugin/yPluginApi/IYPluginApi.h>
 
 //--------------------------------------------------------------
 /// \brief	CPU Load of the Linux System
-/// \note   return the CPU load under Linux Operating System
+/// \note   return the CPU load (of all cores, or of one core) under Linux Operating System
 //--------------------------------------------------------------
 class CCPULoad : public ILoad
 {
@@ -13,8 +14,12 @@ public:
    //--------------------------------------------------------------
    /// \brief	    Constructor
    /// \param[in] keywordName The keyword name
+   /// \param[in] procStat    The CPU times sampler (read by the caller before read)
+   /// \param[in] cpuIndex    Index in CPU times (0 for all cores, n for core n-1)
    //--------------------------------------------------------------
-   explicit CCPULoad(const std::string& keywordName);
+   CCPULoad(const std::string& keywordName,
+            boost::shared_ptr<const CProcStat> procStat,
+            std::size_t cpuIndex = 0);
 
    //--------------------------------------------------------------
    /// \brief	    Destructor
@@ -31,35 +36,17 @@ public:
 
    // [END] ILoad Implementation
 
-protected:
-   //--------------------------------------------------------------
-   /// \brief	    Initialization
-   //--------------------------------------------------------------
-   void Initialize();   
-
 private:
-
    //--------------------------------------------------------------
-   /// \brief	    Read all needed information
+   /// \brief	    The CPU times sampler
    //--------------------------------------------------------------
-   void ReadFromFile(unsigned long long& dtotalUser,
-                     unsigned long long& dtotalUserLow,
-                     unsigned long long& dtotalSys,
-                     unsigned long long& dtotalIdle,
-                     unsigned long long& dtotalIowait,
-                     unsigned long long& dtotalIrq,
-                     unsigned long long& dtotalSoftIrq);
+   boost::shared_ptr<const CProcStat> m_procStat;
+   const std::size_t m_cpuIndex;
 
    //--------------------------------------------------------------
-   /// \brief	    Temp variables
+   /// \brief	    CPU times of last read
    //--------------------------------------------------------------
-   unsigned long long m_lastTotalUser; 
-   unsigned long long m_lastTotalUserLow; 
-   unsigned long long m_lastTotalSys; 
-   unsigned long long m_lastTotalIdle;
-   unsigned long long m_lastTotalIowait; 
-   unsigned long long m_lastTotalIrq;   
-   unsigned long long m_lastTotalSoftIrq;
+   CProcStat::CpuTimes m_lastTimes;
 
    //--------------------------------------------------------------
    /// \brief	    Keyword
@@ -1,16 +1,16 @@
 #include "stdafx.h"
 #include "DiskUsage.h"
-#include <shared/exception/Exception.hpp>
-#include <shared/plugin/yPluginApi/StandardCapacities.h>
-#include <shared/plugin/yPluginApi/StandardUnits.h>
-#include <boost/regex.hpp> 
-#include <boost/lexical_cast.hpp>
-#include "LinuxHelpers.h"
+#include <shared/Log.h>
+#include <sys/statvfs.h>
+#include <cerrno>
+#include <cstring>
 #include "Helpers.h"
 
 CDiskUsage::CDiskUsage(const std::string& keywordName,
-                       const std::string& driveName)
+                       const std::string& driveName,
+                       const std::string& mountPoint)
    : m_driveName(driveName),
+     m_mountPoint(mountPoint),
      m_keyword(boost::make_shared<yApi::historization::CLoad>(keywordName))
 {
 }
@@ -21,24 +21,19 @@ CDiskUsage::~CDiskUsage()
 
 void CDiskUsage::read()
 {
-   std::vector<std::string> _rlines=ExecuteCommandAndReturn("df");
-   std::vector<std::string>::const_iterator iteratorCommandDF;
-
-   for (iteratorCommandDF = _rlines.begin(); iteratorCommandDF != _rlines.end(); ++iteratorCommandDF)
+   struct statvfs fileSystemStat;
+   if (statvfs(m_mountPoint.c_str(), &fileSystemStat) != 0)
    {
-      if (strstr((*iteratorCommandDF).c_str(), m_driveName.c_str()) != NULL)
-      {
-         boost::regex reg("([^\\s]+)\\s+(\\d+)\\s+(\\d+)\\s+(\\d+)");
-         boost::smatch match;
-
-         if (boost::regex_search(*iteratorCommandDF, match, reg))
-         {
-             long long numblock    = boost::lexical_cast<long long>(match[2]);
-             long long availblocks = boost::lexical_cast<long long>(match[4]);
-			 
-             m_keyword->set(valueRoundWithPrecision((numblock - availblocks)/double(numblock)*100,3));
-         }
-       }
+      YADOMS_LOG(warning) << "Unable to get usage of " << m_driveName << " (" << m_mountPoint << ") : " << strerror(errno);
+      return;
    }
-}
 
+   if (fileSystemStat.f_blocks == 0)
+      return;
+
+   // Same computation as df : available blocks are those available to unprivileged users
+   const auto numblock = static_cast<double>(fileSystemStat.f_blocks);
+   const auto availblocks = static_cast<double>(fileSystemStat.f_bavail);
+
+   m_keyword->set(valueRoundWithPrecision((numblock - availblocks) / numblock * 100, 3));
+}
@@ -17,9 +17,11 @@ public:
    /// \brief	    Constructor
    /// \param[in] keywordName The keyword name
    /// \param[in] driveName   The drive name ex: /dev/sda1
+   /// \param[in] mountPoint  Where the drive is mounted ex: /home
    //--------------------------------------------------------------
    CDiskUsage(const std::string& keywordName,
-              const std::string& driveName);
+              const std::string& driveName,
+              const std::string& mountPoint);
 
    //--------------------------------------------------------------
    /// \brief	    Destructor
@@ -42,9 +44,13 @@ private:
    //--------------------------------------------------------------
    const std::string m_driveName;
 
+   //--------------------------------------------------------------
+   /// \brief	    Disk mount point
+   //--------------------------------------------------------------
+   const std::string m_mountPoint;
+
    //--------------------------------------------------------------
    /// \brief	    Keyword
    //--------------------------------------------------------------
    boost::shared_ptr<yApi::historization::CLoad> m_keyword;
 };
-
@@ -1,34 +1,26 @@
 #include "stdafx.h"
 #include "DisksList.h"
-#include "LinuxHelpers.h"
-#include <shared/exception/Exception.hpp>
-#include <boost/regex.hpp> 
-#include <boost/lexical_cast.hpp>
-#include <fstream>
-#include <iostream>
-#include <unistd.h>
+#include "ProcFile.h"
 #include <shared/Log.h>
 
 CDisksList::CDisksList()
 {
-   std::vector<std::string> _rlines = ExecuteCommandAndReturn("df");
-   std::vector<std::string>::const_iterator iteratorCommandDF;
+   // Lines are "device mountPoint fsType options dump pass"
+   std::istringstream mounts(CProcFile("/proc/self/mounts").read());
 
-   for (iteratorCommandDF = _rlines.begin(); iteratorCommandDF != _rlines.end(); ++iteratorCommandDF)
+   std::string line;
+   while (std::getline(mounts, line))
    {
-      boost::regex reg("(.(dev)[^\\s]+)");
-      std::string dname;
-      boost::smatch match;
+      std::istringstream fields(line);
+      std::string device, mountPoint;
+      if (!(fields >> device >> mountPoint))
+         continue;
 
-      if ( boost::regex_search( *iteratorCommandDF, match, reg ) )
-      {
-         dname = boost::lexical_cast<std::string>(match[1]);
-      }
-      if (!dname.empty())
-      {
-         DrivesList.push_back( dname.c_str() );
-         YADOMS_LOG(information) << "found:" << dname;
-      }
+      if (device.compare(0, 5, "/dev/") != 0)
+         continue;
+
+      if (DrivesList.insert(std::make_pair(decodeField(device), decodeField(mountPoint))).second)
+         YADOMS_LOG(information) << "found:" << device << " mounted on " << mountPoint;
    }
 }
 
@@ -36,8 +28,25 @@ CDisksList::~CDisksList()
 {
 }
 
-const std::vector<std::string>& CDisksList::getList() const
+const std::map<std::string, std::string>& CDisksList::getList() const
 {
    return DrivesList;
 }
 
+std::string CDisksList::decodeField(const std::string& field)
+{
+   std::string decoded;
+   for (std::size_t index = 0; index < field.size(); ++index)
+   {
+      if (field[index] == '\\' && index + 3 < field.size() && isdigit(field[index + 1]) && isdigit(field[index + 2]) && isdigit(field[index + 3]))
+      {
+         decoded.push_back(static_cast<char>(std::stoi(field.substr(index + 1, 3), nullptr, 8)));
+         index += 3;
+      }
+      else
+      {
+         decoded.push_back(field[index]);
+      }
+   }
+   return decoded;
+}
@@ -1,15 +1,14 @@
 #pragma once
 
 //--------------------------------------------------------------
-/// \brief	CPU Load of the Linux System
-/// \note   return the list of availables disks with Linux Operating System
+/// \brief	Disks list of the Linux System
+/// \note   return the list of availables disks with Linux Operating System, read from /proc/self/mounts
 //--------------------------------------------------------------
 class CDisksList
 {
 public:
    //--------------------------------------------------------------
    /// \brief	    Constructor
-   /// \param[in] deviceId    The device ID
    //--------------------------------------------------------------
    CDisksList();
 
@@ -20,14 +19,20 @@ public:
 
    //--------------------------------------------------------------
    /// \brief	    Returns the Drive List
+   /// \return     The mounted drives (ex: /dev/sda1) and their mount point (first one, if mounted several times)
    //--------------------------------------------------------------
-   const std::vector<std::string>& getList() const;
+   const std::map<std::string, std::string>& getList() const;
 
 private:
+   //--------------------------------------------------------------
+   /// \brief	    Decode a field of /proc/self/mounts (space, tab, newline and backslash are octal-escaped)
+   /// \param[in] field       The field, as written in /proc/self/mounts
+   /// \return     The decoded field
+   //--------------------------------------------------------------
+   static std::string decodeField(const std::string& field);
 
    //--------------------------------------------------------------
-   /// \brief	    Drive List vector
+   /// \brief	    Drive List
    //--------------------------------------------------------------
-   std::vector<std::string> DrivesList;
+   std::map<std::string, std::string> DrivesList;
 };
-
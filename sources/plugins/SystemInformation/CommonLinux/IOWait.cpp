@@ -0,0 +1,34 @@
+#include "stdafx.h"
+#include "IOWait.h"
+#include <shared/Log.h>
+#include "Helpers.h"
+
+CIOWait::CIOWait(const std::string& keywordName,
+                 boost::shared_ptr<const CProcStat> procStat)
+   : m_procStat(procStat),
+     m_lastTimes(m_procStat->cpus().at(0)),
+     m_keyword(boost::make_shared<yApi::historization::CLoad>(keywordName))
+{
+}
+
+CIOWait::~CIOWait()
+{
+}
+
+void CIOWait::read()
+{
+   const auto& times = m_procStat->cpus().at(0);
+
+   if (times.iowait < m_lastTimes.iowait || times.total() <= m_lastTimes.total())
+   {
+      //Overflow detection, or time too short. Just skip this value.
+   }
+   else
+   {
+      const double total = times.total() - m_lastTimes.total();
+      m_keyword->set(valueRoundWithPrecision((times.iowait - m_lastTimes.iowait) / total * 100, 3));
+      YADOMS_LOG(trace) << "IO wait : " << m_keyword->get();
+   }
+
+   m_lastTimes = times;
+}
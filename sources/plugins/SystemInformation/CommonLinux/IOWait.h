@@ -0,0 +1,52 @@
+#pragma once
+
+#include "../ILoad.h"
+#include "ProcStat.h"
+#include <shared/plugin/yPluginApi/IYPluginApi.h>
+
+//--------------------------------------------------------------
+/// \brief	IO wait of the Linux System
+/// \note   return the part of CPU time spent waiting for IO completion
+//--------------------------------------------------------------
+class CIOWait : public ILoad
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	    Constructor
+   /// \param[in] keywordName The keyword name
+   /// \param[in] procStat    The CPU times sampler (read by the caller before read)
+   //--------------------------------------------------------------
+   CIOWait(const std::string& keywordName,
+           boost::shared_ptr<const CProcStat> procStat);
+
+   //--------------------------------------------------------------
+   /// \brief	    Destructor
+   //--------------------------------------------------------------
+   virtual ~CIOWait();
+
+   // ILoad Implementation
+   void read() override;
+
+   boost::shared_ptr<const yApi::historization::IHistorizable> historizable() const override
+   {
+      return m_keyword;
+   }
+
+   // [END] ILoad Implementation
+
+private:
+   //--------------------------------------------------------------
+   /// \brief	    The CPU times sampler
+   //--------------------------------------------------------------
+   boost::shared_ptr<const CProcStat> m_procStat;
+
+   //--------------------------------------------------------------
+   /// \brief	    CPU times of last read
+   //--------------------------------------------------------------
+   CProcStat::CpuTimes m_lastTimes;
+
+   //--------------------------------------------------------------
+   /// \brief	    Keyword
+   //--------------------------------------------------------------
+   boost::shared_ptr<yApi::historization::CLoad> m_keyword;
+};
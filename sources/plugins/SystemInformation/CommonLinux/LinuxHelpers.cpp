@@ -1,26 +0,0 @@
-#include "stdafx.h"
-#include "LinuxHelpers.h"
-
-std::vector<std::string> ExecuteCommandAndReturn(const std::string &szCommand)
-{
-   std::vector<std::string> ret;
-
-   FILE *fp;
-
-   /* Open the command for reading. */
-
-   fp = popen(szCommand.c_str(), "r");
-
-   if (fp != NULL) 
-   {
-      char path[1035];
-      /* Read the output a line at a time - output it. */
-      while (fgets(path, sizeof(path)-1, fp) != NULL)
-      {
-         ret.push_back(path);
-      }
-      /* close */
-      pclose(fp);
-   }
-   return ret;
-}
@@ -1,6 +0,0 @@
-#pragma once
-
-#include "../ILoad.h"
-
-std::vector<std::string> ExecuteCommandAndReturn(const std::string &szCommand);
-
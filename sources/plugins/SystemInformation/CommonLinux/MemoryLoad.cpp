@@ -1,16 +1,14 @@
 #include "stdafx.h"
 #include "MemoryLoad.h"
 #include <shared/exception/Exception.hpp>
-#include <sys/sysinfo.h>
-#include <sys/types.h>
-#include <shared/DataContainer.h>
 #include <shared/Log.h>
+#include <cstdlib>
+#include <cstring>
 #include "Helpers.h"
 
-#define NB_LINE_TO_PARSE 10
-
 CMemoryLoad::CMemoryLoad(const std::string& keywordName)
-   : m_keyword(boost::make_shared<yApi::historization::CLoad>(keywordName))
+   : m_procFile("/proc/meminfo"),
+     m_keyword(boost::make_shared<yApi::historization::CLoad>(keywordName))
 {
 }
 
@@ -23,49 +21,32 @@ bool CMemoryLoad::ReadFromFile(unsigned long long *dmemTotal,
                                unsigned long long *dbuffer,
                                unsigned long long *dcached)
 {
-   // Enum type, declare keys labels
-   static const shared::CDataContainer::EnumValuesNames EEnumTypeNames = boost::assign::map_list_of
-      ("MemTotal", kmemTotal)
-      ("MemFree" , kmemFree)
-      ("Buffers" , kbuffer)
-      ("Cached"  , kcached);
-
-   std::ifstream procFile("/proc/meminfo");
-   
-   boost::regex reg("^(.*): *(\\d+)");
+   // Needed values
+   const std::pair<const char*, unsigned long long*> Fields[] = {
+      { "MemTotal:", dmemTotal },
+      { "MemFree:" , dmemFree },
+      { "Buffers:" , dbuffer },
+      { "Cached:"  , dcached }
+   };
 
-   std::string line;
-   unsigned long long memTab[4]={0};
-   bool memTabUsed[4] = {false, false, false, false};
-   unsigned char counter = 0;
+   const auto& content = m_procFile.read();
 
-   while ( std::getline(procFile, line) && (counter < NB_LINE_TO_PARSE) ) 
+   auto foundFields = 0;
+   for (const auto& field : Fields)
    {
-      boost::smatch match;
-      if ( boost::regex_search( line, match, reg ) ) 
-      {
-         shared::CDataContainer::EnumValuesNames::const_iterator it = EEnumTypeNames.find(boost::lexical_cast<std::string>(match[1]));
+      // Search field at beginning of a line (don't match "SwapCached:" for "Cached:")
+      auto position = content.find(field.first);
+      while (position != std::string::npos && position != 0 && content[position - 1] != '\n')
+         position = content.find(field.first, position + 1);
+      if (position == std::string::npos)
+         continue;
 
-         if (it != EEnumTypeNames.end())
-         {
-             memTab[ it->second ]  = boost::lexical_cast<long long>(match[2]);
-             memTabUsed[ it->second ] = true;
-         }
-      }
-      counter++;
+      // Lines are "Name:   value kB"
+      *field.second = strtoull(content.c_str() + position + strlen(field.first), nullptr, 10);
+      ++foundFields;
    }
 
-   *dmemTotal = memTab[ 0 ];
-   *dmemFree  = memTab[ 1 ];
-   *dbuffer   = memTab[ 2 ];
-   *dcached   = memTab[ 3 ];
-
-   procFile.close();
-   
-   if (memTabUsed[0] && memTabUsed[1] && memTabUsed[2] && memTabUsed[3])
-      return true;
-   else
-      return false;
+   return foundFields == sizeof(Fields) / sizeof(Fields[0]);
 }
 
 void CMemoryLoad::read()
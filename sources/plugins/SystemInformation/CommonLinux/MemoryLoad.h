@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../ILoad.h"
+#include "ProcFile.h"
 #include <shared/plugin/yPluginApi/IYPluginApi.h>
 
 // Shortcut to yPluginApi namespace
@@ -38,17 +39,10 @@ public:
                      unsigned long long *dcached);
 
 private:
-
    //--------------------------------------------------------------
-   /// \brief	tab indexes used for needed values
+   /// \brief	    /proc/meminfo, kept opened
    //--------------------------------------------------------------
-   enum EEnumType
-   {
-      kmemTotal = 0,
-      kmemFree  = 1,
-      kbuffer   = 2,
-      kcached   = 3
-   };
+   CProcFile m_procFile;
 
    //--------------------------------------------------------------
    /// \brief	    Keyword
@@ -0,0 +1,195 @@
+#include "stdafx.h"
+#include "OptionalLoads.h"
+#include "CPULoad.h"
+#include "IOWait.h"
+#include <shared/exception/Exception.hpp>
+#include <shared/Log.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <fstream>
+
+COptionalLoads::COptionalLoads(boost::shared_ptr<const CProcStat> procStat)
+   : m_procStat(procStat),
+     m_processesLoadEnabled(false)
+{
+}
+
+COptionalLoads::~COptionalLoads()
+{
+}
+
+void COptionalLoads::configure(const ISIConfiguration& configuration)
+{
+   m_loads.clear();
+
+   if (configuration.isPerCoreCpuLoadEnabled())
+   {
+      for (std::size_t core = 0; core < m_procStat->coresCount(); ++core)
+         m_loads.push_back(boost::make_shared<CCPULoad>("CPULoad_core" + std::to_string(core), m_procStat, core + 1));
+   }
+
+   if (configuration.isIOWaitEnabled())
+      m_loads.push_back(boost::make_shared<CIOWait>("IOWait", m_procStat));
+
+   m_processesLoadEnabled = configuration.isProcessesLoadEnabled();
+   m_processesLoad.clear();
+   if (m_processesLoadEnabled)
+      refreshProcesses();
+
+   buildHistorizables();
+}
+
+bool COptionalLoads::refreshProcesses()
+{
+   if (!m_processesLoadEnabled)
+      return false;
+
+   const auto processes = yadomsProcesses();
+   auto changed = false;
+
+   // Forget terminated processes (restarted ones are monitored again below, with the same keywords)
+   for (auto process = m_processesLoad.begin(); process != m_processesLoad.end();)
+   {
+      if (processes.find(process->first) == processes.end())
+      {
+         process = m_processesLoad.erase(process);
+         changed = true;
+      }
+      else
+      {
+         ++process;
+      }
+   }
+
+   // Several instances of the same plugin run the same executable, the instance ID is added to their name to get distinct keywords
+   // (the pid is used only if instance ID is unknown, as it changes each time the process is restarted)
+   std::map<std::string, int> namesCount;
+   for (const auto& process : processes)
+      ++namesCount[process.second.name];
+
+   for (const auto& process : processes)
+   {
+      if (m_processesLoad.find(process.first) != m_processesLoad.end())
+         continue;
+
+      auto name = process.second.name;
+      if (namesCount[name] > 1)
+         name += "_" + (process.second.instanceId.empty() ? std::to_string(process.first) : process.second.instanceId);
+      try
+      {
+         m_processesLoad[process.first] = boost::make_shared<CProcessLoad>(name, process.first, m_procStat);
+         changed = true;
+      }
+      catch (shared::exception::CException& exception)
+      {
+         YADOMS_LOG(debug) << "Process " << name << " not monitored : " << exception.what();
+      }
+   }
+
+   if (changed)
+      buildHistorizables();
+   return changed;
+}
+
+void COptionalLoads::read()
+{
+   for (const auto& load : m_loads)
+      load->read();
+
+   for (const auto& process : m_processesLoad)
+   {
+      try
+      {
+         process.second->read();
+      }
+      catch (shared::exception::CException& exception)
+      {
+         // Process has terminated, will be forgotten at next refresh
+         YADOMS_LOG(debug) << exception.what();
+      }
+   }
+}
+
+const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>>& COptionalLoads::historizables() const
+{
+   return m_keywords;
+}
+
+std::map<int, COptionalLoads::YadomsProcess> COptionalLoads::yadomsProcesses()
+{
+   // Plugins are children of the Yadoms server, which is our parent
+   const auto serverPid = getppid();
+
+   std::map<int, YadomsProcess> processes;
+
+   const auto procDirectory = opendir("/proc");
+   if (!procDirectory)
+      return processes;
+
+   while (const auto entry = readdir(procDirectory))
+   {
+      char* end;
+      const auto pid = static_cast<int>(strtol(entry->d_name, &end, 10));
+      if (*end != '\0' || pid <= 0)
+         continue;
+
+      // Line is "pid (comm) state ppid ...", comm can contain spaces and parenthesis
+      std::ifstream statFile("/proc/" + std::string(entry->d_name) + "/stat");
+      std::string stat;
+      if (!std::getline(statFile, stat))
+         continue;
+
+      const auto commBegin = stat.find('(');
+      const auto commEnd = stat.rfind(')');
+      if (commBegin == std::string::npos || commEnd == std::string::npos || commEnd + 4 >= stat.size())
+         continue;
+
+      const auto parentPid = static_cast<int>(strtol(stat.c_str() + commEnd + 4, nullptr, 10));
+      if (pid == serverPid || parentPid == serverPid)
+         processes[pid] = yadomsProcess(pid, stat.substr(commBegin + 1, commEnd - commBegin - 1));
+   }
+
+   closedir(procDirectory);
+   return processes;
+}
+
+COptionalLoads::YadomsProcess COptionalLoads::yadomsProcess(int pid,
+                                                            const std::string& comm)
+{
+   YadomsProcess process;
+
+   // Command line is the NUL-separated arguments, first is the executable path
+   std::ifstream cmdlineFile("/proc/" + std::to_string(pid) + "/cmdline");
+   std::string executable;
+   if (!std::getline(cmdlineFile, executable, '\0') || executable.empty())
+   {
+      process.name = comm;
+      return process;
+   }
+
+   const auto nameBegin = executable.rfind('/');
+   process.name = nameBegin == std::string::npos ? executable : executable.substr(nameBegin + 1);
+
+   // Plugins get their API accessor ID as argument : "yPlugin.<instanceId>.<unique ID>"
+   static const std::string PluginAccessorPrefix("yPlugin.");
+   std::string accessorId;
+   if (std::getline(cmdlineFile, accessorId, '\0') && accessorId.compare(0, PluginAccessorPrefix.size(), PluginAccessorPrefix) == 0)
+   {
+      const auto instanceIdEnd = accessorId.find('.', PluginAccessorPrefix.size());
+      if (instanceIdEnd != std::string::npos)
+         process.instanceId = accessorId.substr(PluginAccessorPrefix.size(), instanceIdEnd - PluginAccessorPrefix.size());
+   }
+
+   return process;
+}
+
+void COptionalLoads::buildHistorizables()
+{
+   m_keywords.clear();
+
+   for (const auto& load : m_loads)
+      m_keywords.push_back(load->historizable());
+
+   for (const auto& process : m_processesLoad)
+      m_keywords.insert(m_keywords.end(), process.second->historizables().begin(), process.second->historizables().end());
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "../ILoad.h"
+#include "../ISIConfiguration.h"
+#include "ProcStat.h"
+#include "ProcessLoad.h"
+
+//--------------------------------------------------------------
+/// \brief	Optional keywords of the Linux System (per-core CPU load, IO wait, Yadoms processes load)
+/// \note   All are sampled from the same /proc/stat read
+//--------------------------------------------------------------
+class COptionalLoads
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	    Constructor
+   /// \param[in] procStat    The CPU times sampler (read by the caller before read)
+   //--------------------------------------------------------------
+   explicit COptionalLoads(boost::shared_ptr<const CProcStat> procStat);
+
+   //--------------------------------------------------------------
+   /// \brief	    Destructor
+   //--------------------------------------------------------------
+   virtual ~COptionalLoads();
+
+   //--------------------------------------------------------------
+   /// \brief	    Create the keywords enabled by configuration
+   /// \param[in] configuration     The plugin configuration
+   //--------------------------------------------------------------
+   void configure(const ISIConfiguration& configuration);
+
+   //--------------------------------------------------------------
+   /// \brief	    Search for Yadoms processes (server and plugins), as plugins can be started or restarted
+   /// \return     true if keywords list changed
+   //--------------------------------------------------------------
+   bool refreshProcesses();
+
+   //--------------------------------------------------------------
+   /// \brief	    Read actual values
+   //--------------------------------------------------------------
+   void read();
+
+   //--------------------------------------------------------------
+   /// \brief	    Get the keywords
+   //--------------------------------------------------------------
+   const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>>& historizables() const;
+
+private:
+   //--------------------------------------------------------------
+   /// \brief	    A Yadoms process (server or plugin instance)
+   //--------------------------------------------------------------
+   struct YadomsProcess
+   {
+      std::string name;
+      std::string instanceId;
+   };
+
+   //--------------------------------------------------------------
+   /// \brief	    Get the Yadoms processes
+   /// \return     The processes, by pid
+   //--------------------------------------------------------------
+   static std::map<int, YadomsProcess> yadomsProcesses();
+
+   //--------------------------------------------------------------
+   /// \brief	    Identify a process from its command line
+   /// \param[in] pid         The process ID
+   /// \param[in] comm        The process name read from /proc/<pid>/stat, used if command line is not available
+   /// \return     The process, named from its executable (comm is truncated to 15 characters, so is not used if possible)
+   ///             and with the plugin instance ID if found in its arguments
+   //--------------------------------------------------------------
+   static YadomsProcess yadomsProcess(int pid,
+                                      const std::string& comm);
+
+   //--------------------------------------------------------------
+   /// \brief	    Rebuild the keywords list
+   //--------------------------------------------------------------
+   void buildHistorizables();
+
+   boost::shared_ptr<const CProcStat> m_procStat;
+
+   std::vector<boost::shared_ptr<ILoad>> m_loads;
+
+   bool m_processesLoadEnabled;
+   std::map<int, boost::shared_ptr<CProcessLoad>> m_processesLoad;
+
+   std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>> m_keywords;
+};
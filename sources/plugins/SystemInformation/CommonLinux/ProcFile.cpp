@@ -0,0 +1,52 @@
+#include "stdafx.h"
+#include "ProcFile.h"
+#include <shared/exception/Exception.hpp>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+CProcFile::CProcFile(const std::string& path)
+   : m_path(path),
+     m_fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC)),
+     m_readBuffer(4096)
+{
+   if (m_fd < 0)
+      throw shared::exception::CException("Unable to open " + m_path + " : " + strerror(errno));
+}
+
+CProcFile::~CProcFile()
+{
+   ::close(m_fd);
+}
+
+const std::string& CProcFile::read()
+{
+   // m_content keeps its capacity, so no allocation once the biggest content was read
+   m_content.clear();
+
+   off_t offset = 0;
+   while (true)
+   {
+      const auto readSize = ::pread(m_fd, m_readBuffer.data(), m_readBuffer.size(), offset);
+      if (readSize < 0)
+      {
+         if (errno == EINTR)
+            continue;
+         throw shared::exception::CException("Unable to read " + m_path + " : " + strerror(errno));
+      }
+
+      if (readSize == 0)
+         break;
+
+      m_content.append(m_readBuffer.data(), readSize);
+      offset += readSize;
+   }
+
+   return m_content;
+}
+
+const std::string& CProcFile::path() const
+{
+   return m_path;
+}
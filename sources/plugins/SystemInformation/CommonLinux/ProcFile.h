@@ -0,0 +1,39 @@
+#pragma once
+
+//--------------------------------------------------------------
+/// \brief	A file of /proc (or /sys) kept opened, and re-read on demand
+/// \note   File is read with pread, so without reopening it nor allocating memory at each read
+//--------------------------------------------------------------
+class CProcFile
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	    Constructor
+   /// \param[in] path        The file path (ex: /proc/stat)
+   /// \throw shared::exception::CException if file can not be opened
+   //--------------------------------------------------------------
+   explicit CProcFile(const std::string& path);
+
+   //--------------------------------------------------------------
+   /// \brief	    Destructor
+   //--------------------------------------------------------------
+   virtual ~CProcFile();
+
+   //--------------------------------------------------------------
+   /// \brief	    Read the whole file content
+   /// \return     The file content (valid until next read)
+   /// \throw shared::exception::CException if read fails (ex: process of a /proc/<pid> file has terminated)
+   //--------------------------------------------------------------
+   const std::string& read();
+
+   //--------------------------------------------------------------
+   /// \brief	    Get the file path
+   //--------------------------------------------------------------
+   const std::string& path() const;
+
+private:
+   const std::string m_path;
+   int m_fd;
+   std::vector<char> m_readBuffer;
+   std::string m_content;
+};
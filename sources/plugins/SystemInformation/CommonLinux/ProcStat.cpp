@@ -0,0 +1,87 @@
+#include "stdafx.h"
+#include "ProcStat.h"
+#include <shared/exception/Exception.hpp>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+   unsigned long long readNextValue(const char*& position)
+   {
+      char* end;
+      const auto value = strtoull(position, &end, 10);
+      position = end;
+      return value;
+   }
+}
+
+unsigned long long CProcStat::CpuTimes::busy() const
+{
+   return user + nice + system + irq + softIrq;
+}
+
+unsigned long long CProcStat::CpuTimes::total() const
+{
+   return busy() + idle + iowait;
+}
+
+CProcStat::CProcStat()
+   : m_file("/proc/stat")
+{
+   read();
+}
+
+CProcStat::~CProcStat()
+{
+}
+
+void CProcStat::read()
+{
+   // Lines are "cpu  user nice system idle iowait irq softirq ...", then "cpu0 ...", "cpu1 ..."
+   // All counters (64 bits) are incremented each time of the number of ticks corresponding
+   const auto& content = m_file.read();
+
+   std::size_t cpuIndex = 0;
+   auto line = content.c_str();
+   while (strncmp(line, "cpu", 3) == 0)
+   {
+      // Skip the cpu name
+      auto value = strchr(line, ' ');
+      if (!value)
+         break;
+
+      CpuTimes times;
+      times.user = readNextValue(value);
+      times.nice = readNextValue(value);
+      times.system = readNextValue(value);
+      times.idle = readNextValue(value);
+      times.iowait = readNextValue(value);
+      times.irq = readNextValue(value);
+      times.softIrq = readNextValue(value);
+
+      if (cpuIndex < m_cpus.size())
+         m_cpus[cpuIndex] = times;
+      else
+         m_cpus.push_back(times);
+      ++cpuIndex;
+
+      line = strchr(value, '\n');
+      if (!line)
+         break;
+      ++line;
+   }
+
+   // First line (all cores) is used by most keywords
+   if (m_cpus.empty())
+      throw shared::exception::CException("Invalid content of " + m_file.path() + " : no cpu line found");
+}
+
+const std::vector<CProcStat::CpuTimes>& CProcStat::cpus() const
+{
+   return m_cpus;
+}
+
+std::size_t CProcStat::coresCount() const
+{
+   return m_cpus.empty() ? 0 : m_cpus.size() - 1;
+}
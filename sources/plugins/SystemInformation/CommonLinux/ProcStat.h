@@ -0,0 +1,68 @@
+#pragma once
+
+#include "ProcFile.h"
+
+//--------------------------------------------------------------
+/// \brief	CPU times of the Linux System, read from /proc/stat
+/// \note   /proc/stat is read once per sample, for all CPU-based keywords
+//--------------------------------------------------------------
+class CProcStat
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	    Times of a CPU line (in ticks)
+   //--------------------------------------------------------------
+   struct CpuTimes
+   {
+      unsigned long long user;
+      unsigned long long nice;
+      unsigned long long system;
+      unsigned long long idle;
+      unsigned long long iowait;
+      unsigned long long irq;
+      unsigned long long softIrq;
+
+      //--------------------------------------------------------------
+      /// \brief	    Ticks spent working
+      //--------------------------------------------------------------
+      unsigned long long busy() const;
+
+      //--------------------------------------------------------------
+      /// \brief	    Ticks spent working, idle or waiting for IO
+      //--------------------------------------------------------------
+      unsigned long long total() const;
+   };
+
+   //--------------------------------------------------------------
+   /// \brief	    Constructor
+   /// \note       First sample is read at construction
+   /// \throw shared::exception::CException if no CPU times can be read
+   //--------------------------------------------------------------
+   CProcStat();
+
+   //--------------------------------------------------------------
+   /// \brief	    Destructor
+   //--------------------------------------------------------------
+   virtual ~CProcStat();
+
+   //--------------------------------------------------------------
+   /// \brief	    Read a new sample
+   /// \throw shared::exception::CException if no CPU times can be read
+   //--------------------------------------------------------------
+   void read();
+
+   //--------------------------------------------------------------
+   /// \brief	    Get the CPU times of last sample
+   /// \return     The CPU times, first is for all cores (always present), next are for each core
+   //--------------------------------------------------------------
+   const std::vector<CpuTimes>& cpus() const;
+
+   //--------------------------------------------------------------
+   /// \brief	    Get the number of cores
+   //--------------------------------------------------------------
+   std::size_t coresCount() const;
+
+private:
+   CProcFile m_file;
+   std::vector<CpuTimes> m_cpus;
+};
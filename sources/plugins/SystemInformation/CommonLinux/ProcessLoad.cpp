@@ -0,0 +1,80 @@
+#include "stdafx.h"
+#include "ProcessLoad.h"
+#include <shared/exception/Exception.hpp>
+#include <shared/Log.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <cstring>
+#include "Helpers.h"
+
+CProcessLoad::CProcessLoad(const std::string& name,
+                           int pid,
+                           boost::shared_ptr<const CProcStat> procStat)
+   : m_pid(pid),
+     m_procStat(procStat),
+     m_statFile("/proc/" + std::to_string(pid) + "/stat"),
+     m_statmFile("/proc/" + std::to_string(pid) + "/statm"),
+     m_pageSizeKb(sysconf(_SC_PAGESIZE) / 1024),
+     m_lastProcessTicks(readProcessTicks()),
+     m_lastTotalTicks(m_procStat->cpus().at(0).total()),
+     m_residentMemory(boost::make_shared<yApi::historization::CKByte>(name + "_RSS")),
+     m_cpuLoad(boost::make_shared<yApi::historization::CLoad>(name + "_CPULoad")),
+     m_keywords({m_residentMemory, m_cpuLoad})
+{
+}
+
+CProcessLoad::~CProcessLoad()
+{
+}
+
+unsigned long long CProcessLoad::readProcessTicks()
+{
+   // Line is "pid (comm) state ppid ... utime stime ...", comm can contain spaces and parenthesis
+   const auto& content = m_statFile.read();
+   const auto commEnd = content.rfind(')');
+   if (commEnd == std::string::npos)
+      throw shared::exception::CException("Invalid content of " + m_statFile.path());
+
+   // Skip state (field 3) to cstime (field 13), utime and stime are fields 14 and 15
+   auto field = content.c_str() + commEnd + 1;
+   for (auto index = 3; index <= 13 && field; ++index)
+      field = strchr(field + 1, ' ');
+   if (!field)
+      throw shared::exception::CException("Invalid content of " + m_statFile.path());
+
+   char* end;
+   const auto userTicks = strtoull(field, &end, 10);
+   const auto systemTicks = strtoull(end, nullptr, 10);
+   return userTicks + systemTicks;
+}
+
+void CProcessLoad::read()
+{
+   // Line is "size resident shared text lib data dt" (in pages)
+   const auto& statm = m_statmFile.read();
+   char* residentPages;
+   strtoul(statm.c_str(), &residentPages, 10);
+   m_residentMemory->set(strtol(residentPages, nullptr, 10) * m_pageSizeKb);
+
+   // CPU load relative to all cores
+   const auto processTicks = readProcessTicks();
+   const auto totalTicks = m_procStat->cpus().at(0).total();
+   if (processTicks >= m_lastProcessTicks && totalTicks > m_lastTotalTicks)
+   {
+      m_cpuLoad->set(valueRoundWithPrecision(static_cast<double>(processTicks - m_lastProcessTicks) / (totalTicks - m_lastTotalTicks) * 100, 3));
+      YADOMS_LOG(trace) << m_cpuLoad->getKeyword() << " : " << m_cpuLoad->get() << ", " << m_residentMemory->getKeyword() << " : " << m_residentMemory->get();
+   }
+
+   m_lastProcessTicks = processTicks;
+   m_lastTotalTicks = totalTicks;
+}
+
+int CProcessLoad::pid() const
+{
+   return m_pid;
+}
+
+const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>>& CProcessLoad::historizables() const
+{
+   return m_keywords;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "ProcFile.h"
+#include "ProcStat.h"
+#include "../specificHistorizers/KByte.h"
+#include <shared/plugin/yPluginApi/IYPluginApi.h>
+
+// Shortcut to yPluginApi namespace
+namespace yApi = shared::plugin::yPluginApi;
+
+//--------------------------------------------------------------
+/// \brief	Resident memory and CPU load of a process
+/// \note   /proc/<pid>/stat and /proc/<pid>/statm are kept opened
+//--------------------------------------------------------------
+class CProcessLoad
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	    Constructor
+   /// \param[in] name        The process name, used as keywords prefix
+   /// \param[in] pid         The process ID
+   /// \param[in] procStat    The CPU times sampler (read by the caller before read)
+   /// \throw shared::exception::CException if process doesn't exist
+   //--------------------------------------------------------------
+   CProcessLoad(const std::string& name,
+                int pid,
+                boost::shared_ptr<const CProcStat> procStat);
+
+   //--------------------------------------------------------------
+   /// \brief	    Destructor
+   //--------------------------------------------------------------
+   virtual ~CProcessLoad();
+
+   //--------------------------------------------------------------
+   /// \brief	    Read actual values
+   /// \throw shared::exception::CException if process has terminated
+   //--------------------------------------------------------------
+   void read();
+
+   //--------------------------------------------------------------
+   /// \brief	    Get the process ID
+   //--------------------------------------------------------------
+   int pid() const;
+
+   //--------------------------------------------------------------
+   /// \brief	    Get the keywords
+   //--------------------------------------------------------------
+   const std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>>& historizables() const;
+
+private:
+   //--------------------------------------------------------------
+   /// \brief	    Read the CPU ticks used by the process (user + system)
+   //--------------------------------------------------------------
+   unsigned long long readProcessTicks();
+
+   const int m_pid;
+   boost::shared_ptr<const CProcStat> m_procStat;
+   CProcFile m_statFile;
+   CProcFile m_statmFile;
+   const long m_pageSizeKb;
+
+   //--------------------------------------------------------------
+   /// \brief	    Ticks of last read
+   //--------------------------------------------------------------
+   unsigned long long m_lastProcessTicks;
+   unsigned long long m_lastTotalTicks;
+
+   //--------------------------------------------------------------
+   /// \brief	    Keywords
+   //--------------------------------------------------------------
+   boost::shared_ptr<yApi::historization::CKByte> m_residentMemory;
+   boost::shared_ptr<yApi::historization::CLoad> m_cpuLoad;
+   std::vector<boost::shared_ptr<const yApi::historization::IHistorizable>> m_keywords;
+};
@@ -19,5 +19,20 @@ public:
    /// \param [in] data The data container
    //--------------------------------------------------------------
    virtual void initializeWith(const shared::CDataContainer& data) = 0;
+
+   //--------------------------------------------------------------
+   /// \brief	    Check if load of each CPU core must be monitored
+   //--------------------------------------------------------------
+   virtual bool isPerCoreCpuLoadEnabled() const = 0;
+
+   //--------------------------------------------------------------
+   /// \brief	    Check if IO wait must be monitored
+   //--------------------------------------------------------------
+   virtual bool isIOWaitEnabled() const = 0;
+
+   //--------------------------------------------------------------
+   /// \brief	    Check if Yadoms processes (server and plugins) memory and CPU load must be monitored
+   //--------------------------------------------------------------
+   virtual bool isProcessesLoadEnabled() const = 0;
 };
 
@@ -3,6 +3,8 @@
 #include <MemoryLoad.h>
 #include <CPULoad.h>
 #include <DiskUsage.h>
+#include <OptionalLoads.h>
+#include <ProcStat.h>
 #include "../ISIConfiguration.h"
 
 // Shortcut to yPluginApi namespace
@@ -57,11 +59,22 @@ public:
                               shared::CDataContainer details);
 
 private:
+   //--------------------------------------------------------------
+   /// \brief	    Declare the optional keywords, and rebuild the high frequency keywords list
+   /// \param[in] api                 yPluginApi API
+   //--------------------------------------------------------------
+   void declareOptionalKeywords(boost::shared_ptr<yApi::IYPluginApi> api);
+
    //--------------------------------------------------------------
    /// \brief	    Device name
    //--------------------------------------------------------------
    std::string m_deviceName;
 
+   //--------------------------------------------------------------
+   /// \brief	    CPU times, read once for all CPU-based keywords
+   //--------------------------------------------------------------
+   boost::shared_ptr<CProcStat> m_procStat;
+
    //--------------------------------------------------------------
    /// \brief	    Keywords
    //--------------------------------------------------------------
@@ -73,10 +86,16 @@ private:
    //--------------------------------------------------------------
    std::vector<boost::shared_ptr<CDiskUsage> > m_diskUsageList;
 
+   //--------------------------------------------------------------
+   /// \brief	    Optional keywords (enabled by configuration)
+   //--------------------------------------------------------------
+   boost::shared_ptr<COptionalLoads> m_optionalLoads;
+
    //--------------------------------------------------------------
    /// \brief	The keywords lists to historize in one step for better performances
    //--------------------------------------------------------------
    std::vector<boost::shared_ptr<const yApi::historization::IHistorizable> > m_highFrequencyUpdateKeywords;
    std::vector<boost::shared_ptr<const yApi::historization::IHistorizable> > m_lowFrequencyUpdateKeywords;
+   std::vector<boost::shared_ptr<const yApi::historization::IHistorizable> > m_highFrequencyUpdateAllKeywords;
 };
 
@@ -10,9 +10,11 @@ CSystemFactory::CSystemFactory(boost::shared_ptr<yApi::IYPluginApi> api,
                                const ISIConfiguration& configuration,
                                shared::CDataContainer details)
    : m_DeviceName(device),
+     m_procStat(boost::make_shared<CProcStat>()),
      m_memoryLoad(boost::make_shared<CMemoryLoad>("MemoryLoad")),
-     m_cpuLoad(boost::make_shared<CCPULoad>("CPULoad")),
+     m_cpuLoad(boost::make_shared<CCPULoad>("CPULoad", m_procStat)),
      m_temperatureSensor(boost::make_shared<CTemperatureSensor>("Temperature")),
+     m_optionalLoads(boost::make_shared<COptionalLoads>(m_procStat)),
      m_highFrequencyUpdateKeywords({ m_cpuLoad->historizable(), m_temperatureSensor->historizable() }),
      m_lowFrequencyUpdateKeywords({ m_memoryLoad->historizable() })
 {
@@ -22,13 +24,16 @@ CSystemFactory::CSystemFactory(boost::shared_ptr<yApi::IYPluginApi> api,
    auto diskList = CDisksList().getList();
    for (auto disk = diskList.begin(); disk != diskList.end(); ++disk)
    {
-      auto diskUsage = boost::make_shared<CDiskUsage>(disk->substr(5, 4) + "_DiskUsage", *disk);
+      auto diskUsage = boost::make_shared<CDiskUsage>(disk->first.substr(5, 4) + "_DiskUsage", disk->first, disk->second);
       m_diskUsageList.push_back(diskUsage);
       m_lowFrequencyUpdateKeywords.push_back(diskUsage->historizable());
    }
 
    api->declareDevice(device, Model, Model, m_highFrequencyUpdateKeywords, details);
    api->declareDevice(device, Model, Model, m_lowFrequencyUpdateKeywords, details);
+
+   m_optionalLoads->configure(configuration);
+   declareOptionalKeywords(api);
 }
 
 CSystemFactory::~CSystemFactory()
@@ -37,9 +42,13 @@ CSystemFactory::~CSystemFactory()
 
 void CSystemFactory::OnHighFrequencyUpdate(boost::shared_ptr<yApi::IYPluginApi> api) const
 {
+   // All CPU-based keywords are computed from the same sample
+   m_procStat->read();
+
    m_cpuLoad->read();
    m_temperatureSensor->read();
-   api->historizeData(m_DeviceName, m_highFrequencyUpdateKeywords);
+   m_optionalLoads->read();
+   api->historizeData(m_DeviceName, m_highFrequencyUpdateAllKeywords);
 }
 
 void CSystemFactory::OnLowFrequencyUpdate(boost::shared_ptr<yApi::IYPluginApi> api,
@@ -51,10 +60,28 @@ void CSystemFactory::OnLowFrequencyUpdate(boost::shared_ptr<yApi::IYPluginApi> a
       (*disk)->read();
 
    api->historizeData(m_DeviceName, m_lowFrequencyUpdateKeywords);
+
+   // Plugins can have been started or restarted
+   if (m_optionalLoads->refreshProcesses())
+      declareOptionalKeywords(api);
 }
 
 void CSystemFactory::OnConfigurationUpdate(boost::shared_ptr<yApi::IYPluginApi> api,
                                            const ISIConfiguration& configuration,
                                            shared::CDataContainer details)
-{}
+{
+   m_optionalLoads->configure(configuration);
+   declareOptionalKeywords(api);
+}
+
+void CSystemFactory::declareOptionalKeywords(boost::shared_ptr<yApi::IYPluginApi> api)
+{
+   if (!m_optionalLoads->historizables().empty())
+      api->declareKeywords(m_DeviceName, m_optionalLoads->historizables());
+
+   m_highFrequencyUpdateAllKeywords = m_highFrequencyUpdateKeywords;
+   m_highFrequencyUpdateAllKeywords.insert(m_highFrequencyUpdateAllKeywords.end(),
+                                           m_optionalLoads->historizables().begin(),
+                                           m_optionalLoads->historizables().end());
+}
 
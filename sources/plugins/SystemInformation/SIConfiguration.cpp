@@ -13,4 +13,19 @@ CSIConfiguration::~CSIConfiguration()
 void CSIConfiguration::initializeWith(const shared::CDataContainer& data)
 {
    m_data.initializeWith(data);
-}
\ No newline at end of file
+}
+
+bool CSIConfiguration::isPerCoreCpuLoadEnabled() const
+{
+   return m_data.getWithDefault<bool>("PerCoreCpuLoad", false);
+}
+
+bool CSIConfiguration::isIOWaitEnabled() const
+{
+   return m_data.getWithDefault<bool>("IOWait", false);
+}
+
+bool CSIConfiguration::isProcessesLoadEnabled() const
+{
+   return m_data.getWithDefault<bool>("ProcessesLoad", false);
+}
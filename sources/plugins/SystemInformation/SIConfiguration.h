@@ -21,6 +21,9 @@ public:
 
    // ISIConfiguration implementation
    void initializeWith(const shared::CDataContainer& data) override;
+   bool isPerCoreCpuLoadEnabled() const override;
+   bool isIOWaitEnabled() const override;
+   bool isProcessesLoadEnabled() const override;
    // [END] ISIConfiguration implementation
 
 private:
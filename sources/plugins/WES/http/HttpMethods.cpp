@@ -7,6 +7,7 @@
 #include <shared/exception/Exception.hpp>
 #include <shared/Log.h>
 #include <Poco/StreamCopier.h>
+#include <shared/http/HttpSessionPool.h>
 #include "timeOutException.hpp"
 
 namespace http
@@ -30,8 +31,8 @@ namespace http
                uri.addQueryParameter(parametersIterator.first, parametersIterator.second);
          }
 
-         Poco::Net::HTTPClientSession session(uri.getHost(), uri.getPort());
-         session.setTimeout(Poco::Timespan(timeout.seconds(), 0));
+         auto session = shared::HttpSessionPool().getSession(url);
+         session->setTimeout(timeout);
 
          Poco::Net::HTTPCredentials creds(credentials.get<std::string>("user"), 
                                           credentials.get<std::string>("password"));
@@ -41,19 +42,24 @@ namespace http
                                         Poco::Net::HTTPMessage::HTTP_1_1);
          
          Poco::Net::HTTPResponse response;
-         session.sendRequest(request);
-         session.receiveResponse(response);
+         session->sendRequest(request);
+         auto* receiveStream = &session->receiveResponse(response);
 
          // Retry for protected equipements
-         std::string buffer;
          if (response.getStatus() == Poco::Net::HTTPResponse::HTTP_UNAUTHORIZED)
          {
+            // Skip the answer body, the connection is kept alive for the authenticated request
+            receiveStream->ignore(std::numeric_limits<std::streamsize>::max());
+
             creds.authenticate(request, response);
-            session.sendRequest(request);
-            auto& receiveSecureStream = session.receiveResponse(response);
-            
+            session->sendRequest(request);
+            receiveStream = &session->receiveResponse(response);
+         }
+
+         std::string buffer;
+         {
             std::ostringstream oss;
-            Poco::StreamCopier::copyStream(receiveSecureStream, oss);
+            Poco::StreamCopier::copyStream(*receiveStream, oss);
             buffer = oss.str();
          }
 
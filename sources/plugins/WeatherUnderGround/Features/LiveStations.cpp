@@ -2,7 +2,7 @@
 #include "LiveStations.h"
 #include <shared/exception/Exception.hpp>
 #include <shared/http/HttpMethods.h>
-#include <shared/http/StandardSession.h>
+#include <shared/http/HttpSessionPool.h>
 #include "Location.h"
 #include "../RequestErrorException.hpp"
 #include "../webSiteErrorException.hpp"
@@ -29,8 +29,7 @@ void CLiveStations::processLookUp(boost::shared_ptr<yApi::IYPluginApi> api,
       {
          shared::CDataContainer noParameters, noheaderParameter;
 		 std::string url = "http://api.wunderground.com/api/" + apikey + "/geolookup/q/" + std::to_string(m_location->latitude()) + "," + std::to_string(m_location->longitude()) + ".json";
-		 boost::shared_ptr<shared::StandardSession> session = boost::make_shared<shared::StandardSession>(url);
-		 shared::CHttpMethods::SendGetRequest(session,
+		 shared::CHttpMethods::SendGetRequest(shared::HttpSessionPool().getSession(url),
                                               noheaderParameter,
                                               noParameters,
                                               [&](shared::CDataContainer& data)
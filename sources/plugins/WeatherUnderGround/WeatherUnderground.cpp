@@ -3,7 +3,7 @@
 #include <shared/event/EventTimer.h>
 #include <plugin_cpp_api/ImplementationHelper.h>
 #include <shared/http/HttpMethods.h>
-#include <shared/http/StandardSession.h>
+#include <shared/http/HttpSessionPool.h>
 #include <shared/exception/Exception.hpp>
 #include "ErrorAnswerHandler.h"
 #include "RequestErrorException.hpp"
@@ -240,9 +240,7 @@ shared::CDataContainer CWeatherUnderground::SendUrlRequest(boost::shared_ptr<yAp
    {
       shared::CDataContainer returnData;
       shared::CDataContainer noParameters, noheaderParameter;
-	  boost::shared_ptr<shared::StandardSession> session = boost::make_shared<shared::StandardSession>(url);
-
-      shared::CHttpMethods::SendGetRequest(session,
+      shared::CHttpMethods::SendGetRequest(shared::HttpSessionPool().getSession(url),
                                            noheaderParameter,
                                            noParameters,
                                            [&](shared::CDataContainer& data)
@@ -5,6 +5,7 @@
 #include <ScriptLogger.h>
 #include "ScriptProcess.h"
 #include "ScriptFile.h"
+#include "ScriptHostPool.h"
 
 
 CFactory::CFactory()
@@ -34,13 +35,13 @@ boost::shared_ptr<shared::process::IExternalProcessLogger> CFactory::createScrip
                                                                  scriptLogPath);
 }
 
-boost::shared_ptr<shared::process::IProcess> CFactory::createScriptProcess(int scriptInstanceId,
-                                                                           const boost::filesystem::path& scriptPath,
-                                                                           boost::shared_ptr<IPythonExecutable> pythonExecutable,
-                                                                           const boost::filesystem::path& interpreterPath,
-                                                                           const std::string& scriptApiId,
-                                                                           const boost::filesystem::path& scriptLogPath,
-                                                                           boost::function3<void, bool, int, const std::string&> onInstanceStateChangedFct) const
+boost::shared_ptr<IScriptProcess> CFactory::createScriptProcess(int scriptInstanceId,
+                                                                const boost::filesystem::path& scriptPath,
+                                                                boost::shared_ptr<IPythonExecutable> pythonExecutable,
+                                                                const boost::filesystem::path& interpreterPath,
+                                                                const std::string& scriptApiId,
+                                                                const boost::filesystem::path& scriptLogPath,
+                                                                boost::function3<void, bool, int, const std::string&> onInstanceStateChangedFct) const
 {
    auto scriptLogger = createScriptLogger(scriptInstanceId,
                                           scriptLogPath);
@@ -56,6 +57,31 @@ boost::shared_ptr<shared::process::IProcess> CFactory::createScriptProcess(int s
                                              processObserver);
 }
 
+boost::shared_ptr<IScriptHostPool> CFactory::createScriptHostPool(boost::shared_ptr<IPythonExecutable> pythonExecutable,
+                                                                  const boost::filesystem::path& interpreterPath,
+                                                                  std::size_t scriptsPerHost) const
+{
+   return boost::make_shared<CScriptHostPool>(pythonExecutable,
+                                              interpreterPath,
+                                              scriptsPerHost);
+}
+
+boost::shared_ptr<IScriptProcess> CFactory::createHostedScriptProcess(boost::shared_ptr<IScriptHostPool> scriptHostPool,
+                                                                      int scriptInstanceId,
+                                                                      const boost::filesystem::path& scriptPath,
+                                                                      const std::string& scriptApiId,
+                                                                      const boost::filesystem::path& scriptLogPath,
+                                                                      boost::function3<void, bool, int, const std::string&> onInstanceStateChangedFct) const
+{
+   return scriptHostPool->startScript(scriptInstanceId,
+                                      createScriptFile(scriptPath),
+                                      scriptApiId,
+                                      createScriptLogger(scriptInstanceId,
+                                                         scriptLogPath),
+                                      createScriptProcessObserver(scriptInstanceId,
+                                                                  onInstanceStateChangedFct));
+}
+
 boost::shared_ptr<IScriptFile> CFactory::createScriptFile(const boost::filesystem::path& scriptPath) const
 {
    return boost::make_shared<CScriptFile>(scriptPath);
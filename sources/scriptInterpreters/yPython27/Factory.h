@@ -15,13 +15,22 @@ public:
 
    // IFactory implementation
    boost::shared_ptr<IPythonExecutable> createPythonExecutable() const override;
-   boost::shared_ptr<shared::process::IProcess> createScriptProcess(int scriptInstanceId,
-                                                                    const boost::filesystem::path& scriptPath,
-                                                                    boost::shared_ptr<IPythonExecutable> pythonExecutable,
-                                                                    const boost::filesystem::path& interpreterPath,
-                                                                    const std::string& scriptApiId,
-                                                                    const boost::filesystem::path& scriptLogPath,
-                                                                    boost::function3<void, bool, int, const std::string&> onInstanceStateChangedFct) const override;
+   boost::shared_ptr<IScriptProcess> createScriptProcess(int scriptInstanceId,
+                                                         const boost::filesystem::path& scriptPath,
+                                                         boost::shared_ptr<IPythonExecutable> pythonExecutable,
+                                                         const boost::filesystem::path& interpreterPath,
+                                                         const std::string& scriptApiId,
+                                                         const boost::filesystem::path& scriptLogPath,
+                                                         boost::function3<void, bool, int, const std::string&> onInstanceStateChangedFct) const override;
+   boost::shared_ptr<IScriptHostPool> createScriptHostPool(boost::shared_ptr<IPythonExecutable> pythonExecutable,
+                                                           const boost::filesystem::path& interpreterPath,
+                                                           std::size_t scriptsPerHost) const override;
+   boost::shared_ptr<IScriptProcess> createHostedScriptProcess(boost::shared_ptr<IScriptHostPool> scriptHostPool,
+                                                               int scriptInstanceId,
+                                                               const boost::filesystem::path& scriptPath,
+                                                               const std::string& scriptApiId,
+                                                               const boost::filesystem::path& scriptLogPath,
+                                                               boost::function3<void, bool, int, const std::string&> onInstanceStateChangedFct) const override;
    // [END] IFactory implementation
 
 protected:
@@ -0,0 +1,75 @@
+#include "stdafx.h"
+#include "HostedScriptProcess.h"
+#include "ScriptHost.h"
+
+
+CHostedScriptProcess::CHostedScriptProcess(boost::weak_ptr<CScriptHost> host,
+                                           int scriptInstanceId,
+                                           boost::shared_ptr<shared::process::IExternalProcessLogger> scriptLogger,
+                                           boost::shared_ptr<shared::process::IProcessObserver> processObserver)
+   : m_host(host),
+     m_scriptInstanceId(scriptInstanceId),
+     m_scriptLogger(scriptLogger),
+     m_processObserver(processObserver),
+     m_returnCode(0)
+{
+   m_scriptLogger->init();
+   m_scriptLogger->information("#### START ####");
+}
+
+CHostedScriptProcess::~CHostedScriptProcess()
+{
+}
+
+void CHostedScriptProcess::kill()
+{
+   const auto host = m_host.lock();
+   if (host)
+      host->stopScript(m_scriptInstanceId);
+}
+
+int CHostedScriptProcess::getReturnCode() const
+{
+   return m_returnCode;
+}
+
+std::string CHostedScriptProcess::getError() const
+{
+   return m_lastError;
+}
+
+boost::shared_ptr<shared::process::IExternalProcessLogger> CHostedScriptProcess::logger() const
+{
+   return m_scriptLogger;
+}
+
+void CHostedScriptProcess::onStarted()
+{
+   m_processObserver->onStart();
+}
+
+void CHostedScriptProcess::onOutput(const std::string& line)
+{
+   m_scriptLogger->information(line);
+}
+
+void CHostedScriptProcess::onErrorOutput(const std::string& line)
+{
+   m_lastError += line;
+   m_scriptLogger->error(line);
+}
+
+void CHostedScriptProcess::onStopped(int returnCode,
+                                     const std::string& hostError)
+{
+   m_returnCode = returnCode;
+
+   if (!hostError.empty())
+   {
+      m_lastError += hostError;
+      m_scriptLogger->error(hostError);
+   }
+
+   m_processObserver->onFinish(m_returnCode,
+                               m_lastError);
+}
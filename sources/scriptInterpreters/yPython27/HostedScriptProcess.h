@@ -0,0 +1,54 @@
+#pragma once
+#include "IScriptProcess.h"
+#include <shared/process/IProcessObserver.h>
+
+class CScriptHost;
+
+//--------------------------------------------------------------
+/// \brief	A script running in a Python host process
+/// \details Behaves as a script process : same logs, and same notifications to the process observer
+//--------------------------------------------------------------
+class CHostedScriptProcess : public IScriptProcess
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	Constructor
+   /// \param[in] host The host process running the script
+   /// \param[in] scriptInstanceId The script instance ID
+   /// \param[in] scriptLogger The script logger
+   /// \param[in] processObserver The process observer
+   //--------------------------------------------------------------
+   CHostedScriptProcess(boost::weak_ptr<CScriptHost> host,
+                        int scriptInstanceId,
+                        boost::shared_ptr<shared::process::IExternalProcessLogger> scriptLogger,
+                        boost::shared_ptr<shared::process::IProcessObserver> processObserver);
+
+   //--------------------------------------------------------------
+   /// \brief	Destructor
+   //--------------------------------------------------------------
+   virtual ~CHostedScriptProcess();
+
+   // IScriptProcess Implementation
+   void kill() override;
+   int getReturnCode() const override;
+   std::string getError() const override;
+   boost::shared_ptr<shared::process::IExternalProcessLogger> logger() const override;
+   // [END] IScriptProcess Implementation
+
+   //--------------------------------------------------------------
+   /// \brief	Script events, sent by the host
+   //--------------------------------------------------------------
+   void onStarted();
+   void onOutput(const std::string& line);
+   void onErrorOutput(const std::string& line);
+   void onStopped(int returnCode,
+                  const std::string& hostError = std::string());
+
+private:
+   boost::weak_ptr<CScriptHost> m_host;
+   const int m_scriptInstanceId;
+   const boost::shared_ptr<shared::process::IExternalProcessLogger> m_scriptLogger;
+   boost::shared_ptr<shared::process::IProcessObserver> m_processObserver;
+   int m_returnCode;
+   std::string m_lastError;
+};
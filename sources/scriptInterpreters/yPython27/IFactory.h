@@ -1,6 +1,7 @@
 #pragma once
 #include "IPythonExecutable.h"
-#include <shared/process/IProcess.h>
+#include "IScriptProcess.h"
+#include "IScriptHostPool.h"
 #include <shared/script/yInterpreterApi/IYInterpreterApi.h>
 
 
@@ -15,11 +16,20 @@ public:
    }
 
    virtual boost::shared_ptr<IPythonExecutable> createPythonExecutable() const = 0;
-   virtual boost::shared_ptr<shared::process::IProcess> createScriptProcess(int scriptInstanceId,
-                                                                            const boost::filesystem::path& scriptPath,
-                                                                            boost::shared_ptr<IPythonExecutable> pythonExecutable,
-                                                                            const boost::filesystem::path& interpreterPath,
-                                                                            const std::string& scriptApiId,
-                                                                            const boost::filesystem::path& scriptLogPath,
-                                                                            boost::function3<void, bool, int, const std::string&> onInstanceStateChangedFct) const = 0;
+   virtual boost::shared_ptr<IScriptProcess> createScriptProcess(int scriptInstanceId,
+                                                                 const boost::filesystem::path& scriptPath,
+                                                                 boost::shared_ptr<IPythonExecutable> pythonExecutable,
+                                                                 const boost::filesystem::path& interpreterPath,
+                                                                 const std::string& scriptApiId,
+                                                                 const boost::filesystem::path& scriptLogPath,
+                                                                 boost::function3<void, bool, int, const std::string&> onInstanceStateChangedFct) const = 0;
+   virtual boost::shared_ptr<IScriptHostPool> createScriptHostPool(boost::shared_ptr<IPythonExecutable> pythonExecutable,
+                                                                   const boost::filesystem::path& interpreterPath,
+                                                                   std::size_t scriptsPerHost) const = 0;
+   virtual boost::shared_ptr<IScriptProcess> createHostedScriptProcess(boost::shared_ptr<IScriptHostPool> scriptHostPool,
+                                                                       int scriptInstanceId,
+                                                                       const boost::filesystem::path& scriptPath,
+                                                                       const std::string& scriptApiId,
+                                                                       const boost::filesystem::path& scriptLogPath,
+                                                                       boost::function3<void, bool, int, const std::string&> onInstanceStateChangedFct) const = 0;
 };
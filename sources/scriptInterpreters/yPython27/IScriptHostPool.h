@@ -0,0 +1,34 @@
+#pragma once
+#include "IScriptProcess.h"
+#include "IScriptFile.h"
+#include <shared/process/IProcessObserver.h>
+
+//--------------------------------------------------------------
+/// \brief	Pool of Python host processes, each one running several scripts
+//--------------------------------------------------------------
+class IScriptHostPool
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	Destructor
+   //--------------------------------------------------------------
+   virtual ~IScriptHostPool()
+   {
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	Start a script in a host process of the pool
+   /// \param[in] scriptInstanceId The script instance ID
+   /// \param[in] scriptFile The script file to execute
+   /// \param[in] scriptApiId The script Api ID, used to interact with Yadoms
+   /// \param[in] scriptLogger The script logger
+   /// \param[in] processObserver Object to notify when script starts and stops
+   /// \return The running script
+   /// \throw std::runtime_error if no host process can be started
+   //--------------------------------------------------------------
+   virtual boost::shared_ptr<IScriptProcess> startScript(int scriptInstanceId,
+                                                         boost::shared_ptr<const IScriptFile> scriptFile,
+                                                         const std::string& scriptApiId,
+                                                         boost::shared_ptr<shared::process::IExternalProcessLogger> scriptLogger,
+                                                         boost::shared_ptr<shared::process::IProcessObserver> processObserver) = 0;
+};
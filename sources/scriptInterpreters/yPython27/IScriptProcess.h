@@ -0,0 +1,23 @@
+#pragma once
+#include <shared/process/IProcess.h>
+#include <shared/process/IExternalProcessLogger.h>
+
+//--------------------------------------------------------------
+/// \brief	Running script interface
+//--------------------------------------------------------------
+class IScriptProcess : public shared::process::IProcess
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	Destructor
+   //--------------------------------------------------------------
+   virtual ~IScriptProcess()
+   {
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	Get the script logger
+   /// \return The script logger
+   //--------------------------------------------------------------
+   virtual boost::shared_ptr<shared::process::IExternalProcessLogger> logger() const = 0;
+};
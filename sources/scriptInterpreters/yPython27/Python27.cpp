@@ -11,7 +11,6 @@
 #include "Factory.h"
 #include "EventScriptStopped.h"
 #include <shared/Log.h>
-#include "ScriptProcess.h"
 #include <ScriptLogger.h>
 
 // Declare the script interpreter
@@ -39,6 +38,8 @@ void CPython27::doWork(boost::shared_ptr<yApi::IYInterpreterApi> api)
 
    YADOMS_LOG(information) << "Python interpreter is starting...";
 
+   createScriptHostPool();
+
    while (true)
    {
       switch (api->getEventHandler().waitForEvents())
@@ -135,6 +136,21 @@ const boost::filesystem::path& CPython27::getInterpreterPath() const
    return InterpreterPath;
 }
 
+void CPython27::createScriptHostPool()
+{
+   // Scripts can be run by shared host processes, instead of one process per script (see package.json)
+   const auto package = m_api->getInformation()->getPackage();
+   if (!package->getWithDefault<bool>("pooledRules.enabled", false))
+      return;
+
+   const auto rulesPerHost = package->getWithDefault<int>("pooledRules.rulesPerHost", 5);
+   YADOMS_LOG(information) << "Rules are run by pooled Python host processes, up to " << rulesPerHost << " rules per process";
+   YADOMS_LOG(warning) << "A crash of a Python host process (segmentation fault in a module...) stops all the rules it runs";
+   m_scriptHostPool = m_factory->createScriptHostPool(m_pythonExecutable,
+                                                      getInterpreterPath(),
+                                                      static_cast<std::size_t>(std::max(rulesPerHost, 1)));
+}
+
 const std::string& CPython27::getScriptTemplate() const
 {
    static const auto ScriptTemplate = CScriptFile::pythonFileRead(boost::filesystem::path(getInterpreterPath() / "template.py").string());
@@ -186,18 +202,29 @@ void CPython27::startScript(int scriptInstanceId,
 
    try
    {
-      m_scriptProcesses[scriptInstanceId] = m_factory->createScriptProcess(scriptInstanceId,
-                                                                           scriptPath,
-                                                                           m_pythonExecutable,
-                                                                           getInterpreterPath(),
-                                                                           scriptApiId,
-                                                                           scriptLogPath,
-                                                                           [this](bool running, int scriptId, const std::string& error)
-                                                                           {
-                                                                              if (!running)
-                                                                                 m_api->getEventHandler().postEvent(kEventScriptStopped,
-                                                                                                                    static_cast<boost::shared_ptr<const IEventScriptStopped>>(boost::make_shared<const CEventScriptStopped>(scriptId, error)));
-                                                                           });
+      const auto onInstanceStateChangedFct = [this](bool running, int scriptId, const std::string& error)
+      {
+         if (!running)
+            m_api->getEventHandler().postEvent(kEventScriptStopped,
+                                               static_cast<boost::shared_ptr<const IEventScriptStopped>>(boost::make_shared<const CEventScriptStopped>(scriptId, error)));
+      };
+
+      boost::lock_guard<boost::recursive_mutex> lock(m_processesMutex);
+      if (m_scriptHostPool)
+         m_scriptProcesses[scriptInstanceId] = m_factory->createHostedScriptProcess(m_scriptHostPool,
+                                                                                    scriptInstanceId,
+                                                                                    scriptPath,
+                                                                                    scriptApiId,
+                                                                                    scriptLogPath,
+                                                                                    onInstanceStateChangedFct);
+      else
+         m_scriptProcesses[scriptInstanceId] = m_factory->createScriptProcess(scriptInstanceId,
+                                                                              scriptPath,
+                                                                              m_pythonExecutable,
+                                                                              getInterpreterPath(),
+                                                                              scriptApiId,
+                                                                              scriptLogPath,
+                                                                              onInstanceStateChangedFct);
    }
    catch (std::exception& e)
    {
@@ -253,6 +280,9 @@ void CPython27::onStopRequested()
          break;
       }
    }
+
+   // Stop host processes
+   m_scriptHostPool.reset();
 }
 
 void CPython27::deleteScriptLog(int scriptInstanceId,
@@ -268,10 +298,6 @@ void CPython27::deleteScriptLog(int scriptInstanceId,
       return;
    }
 
-   const auto scriptProcess = boost::dynamic_pointer_cast<CScriptProcess>(scriptProcessIt->second);
-   if (!scriptProcess)
-      return;
-
-   scriptProcess->logger()->purgeLogFile();
+   scriptProcessIt->second->logger()->purgeLogFile();
 }
 
@@ -1,7 +1,6 @@
 #pragma once
 #include "IPythonExecutable.h"
 #include <interpreter_cpp_api/IInterpreter.h>
-#include <shared/process/IProcess.h>
 #include "IFactory.h"
 #include "IEventScriptStopped.h"
 
@@ -20,6 +19,7 @@ public:
 
 protected:
    const boost::filesystem::path& getInterpreterPath() const;
+   void createScriptHostPool();
    const std::string& getScriptTemplate() const;
    bool isAvailable() const;
    std::string loadScriptContent(const std::string& scriptPath) const;
@@ -40,7 +40,12 @@ private:
    boost::shared_ptr<yApi::IYInterpreterApi> m_api;
    boost::shared_ptr<IPythonExecutable> m_pythonExecutable;
 
+   //--------------------------------------------------------------
+   /// \brief	Host processes running the scripts (null if each script runs in its own process)
+   //--------------------------------------------------------------
+   boost::shared_ptr<IScriptHostPool> m_scriptHostPool;
+
    mutable boost::recursive_mutex m_processesMutex;
-   std::map<int, boost::shared_ptr<shared::process::IProcess>> m_scriptProcesses;
+   std::map<int, boost::shared_ptr<IScriptProcess>> m_scriptProcesses;
 };
 
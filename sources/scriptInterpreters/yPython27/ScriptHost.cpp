@@ -0,0 +1,350 @@
+#include "stdafx.h"
+#include "ScriptHost.h"
+#include "HostedScriptProcess.h"
+#include "PythonCommandLine.h"
+#include <shared/Log.h>
+
+
+CScriptHost::CScriptHost(boost::shared_ptr<IPythonExecutable> executable,
+                         const boost::filesystem::path& interpreterPath)
+   : m_executable(executable),
+     m_interpreterPath(interpreterPath),
+     m_running(false),
+     m_stopped(false),
+     m_recycling(false)
+{
+   start();
+}
+
+CScriptHost::~CScriptHost()
+{
+   // Closing host stdin asks host to stop all its scripts and exit
+   {
+      boost::lock_guard<boost::recursive_mutex> lock(m_stdInMutex);
+      if (m_stdIn)
+         m_stdIn->close();
+   }
+
+   if (m_monitorThread->get_id() == boost::this_thread::get_id())
+   {
+      // Last reference released by the monitor thread itself, at its end
+      m_monitorThread->detach();
+      return;
+   }
+
+   if (!m_monitorThread->timed_join(boost::posix_time::seconds(10)))
+   {
+      YADOMS_LOG(warning) << "Python host process doesn't stop, kill it";
+      try
+      {
+         Poco::Process::kill(*m_processHandle);
+      }
+      catch (Poco::Exception&)
+      {
+         // Nothing to do. This exception can occur when process is already stopped
+      }
+      m_monitorThread->join();
+   }
+}
+
+void CScriptHost::start()
+{
+   std::vector<std::string> args;
+   args.push_back("-u"); // Make host outs unbuffered
+   args.push_back("scriptHost.py");
+   const auto commandLine = boost::make_shared<CPythonCommandLine>(m_executable->path(),
+                                                                   m_interpreterPath,
+                                                                   args);
+
+   try
+   {
+      Poco::Process::Args processArgs(commandLine->args().begin(), commandLine->args().end());
+
+      YADOMS_LOG(debug) << "Start Python host process " << commandLine->executable() << " from " << commandLine->workingDirectory();
+
+      Poco::Pipe inPipe, outPipe, errPipe;
+      m_processHandle = boost::make_shared<Poco::ProcessHandle>(Poco::Process::launch(commandLine->executable().string(),
+                                                                                      processArgs,
+                                                                                      commandLine->workingDirectory().string(),
+                                                                                      &inPipe,
+                                                                                      &outPipe,
+                                                                                      &errPipe));
+
+      m_stdIn = boost::make_shared<Poco::PipeOutputStream>(inPipe);
+      m_running = true;
+
+      m_stdOutThread = boost::make_shared<boost::thread>(&CScriptHost::stdOutWorker,
+                                                         this,
+                                                         boost::make_shared<Poco::PipeInputStream>(outPipe));
+      m_stdErrThread = boost::make_shared<boost::thread>(&CScriptHost::stdErrWorker,
+                                                         this,
+                                                         boost::make_shared<Poco::PipeInputStream>(errPipe));
+      m_monitorThread = boost::make_shared<boost::thread>(&CScriptHost::monitorWorker,
+                                                          this);
+   }
+   catch (Poco::Exception& ex)
+   {
+      throw std::runtime_error(std::string("Unable to start Python host process, ") + ex.what());
+   }
+}
+
+boost::shared_ptr<IScriptProcess> CScriptHost::startScript(int scriptInstanceId,
+                                                           boost::shared_ptr<const IScriptFile> scriptFile,
+                                                           const std::string& scriptApiId,
+                                                           boost::shared_ptr<shared::process::IExternalProcessLogger> scriptLogger,
+                                                           boost::shared_ptr<shared::process::IProcessObserver> processObserver)
+{
+   {
+      boost::lock_guard<boost::recursive_mutex> lock(m_scriptsMutex);
+      if (m_recycling)
+         return boost::shared_ptr<IScriptProcess>();
+   }
+
+   const auto hostedScript = boost::make_shared<CHostedScriptProcess>(shared_from_this(),
+                                                                      scriptInstanceId,
+                                                                      scriptLogger,
+                                                                      processObserver);
+   {
+      boost::lock_guard<boost::recursive_mutex> lock(m_scriptsMutex);
+      m_scripts[scriptInstanceId] = hostedScript;
+   }
+
+   try
+   {
+      // Script path is the last argument, as it can contain spaces
+      sendCommand((boost::format("start %1% %2% %3% %4%") % scriptInstanceId % scriptApiId % scriptFile->module() % scriptFile->abslouteParentPath().string()).str());
+   }
+   catch (std::exception&)
+   {
+      removeScript(scriptInstanceId);
+      throw;
+   }
+
+   return hostedScript;
+}
+
+void CScriptHost::stopScript(int scriptInstanceId)
+{
+   if (!script(scriptInstanceId))
+      return;
+
+   try
+   {
+      sendCommand((boost::format("stop %1%") % scriptInstanceId).str());
+   }
+   catch (std::exception& e)
+   {
+      // Host is stopping, script will be notified as stopped by the monitor thread
+      YADOMS_LOG(warning) << "Unable to stop script #" << scriptInstanceId << " : " << e.what();
+   }
+}
+
+std::size_t CScriptHost::scriptsCount() const
+{
+   boost::lock_guard<boost::recursive_mutex> lock(m_scriptsMutex);
+   return m_scripts.size();
+}
+
+bool CScriptHost::acceptsScripts() const
+{
+   {
+      boost::lock_guard<boost::recursive_mutex> lock(m_scriptsMutex);
+      if (m_recycling)
+         return false;
+   }
+
+   boost::lock_guard<boost::recursive_mutex> lock(m_stdInMutex);
+   return m_running;
+}
+
+bool CScriptHost::isStopped() const
+{
+   boost::lock_guard<boost::recursive_mutex> lock(m_stdInMutex);
+   return m_stopped;
+}
+
+void CScriptHost::sendCommand(const std::string& command)
+{
+   boost::lock_guard<boost::recursive_mutex> lock(m_stdInMutex);
+
+   if (!m_running)
+      throw std::runtime_error("Python host process is not running");
+
+   *m_stdIn << command << std::endl;
+
+   if (!m_stdIn->good())
+      throw std::runtime_error("Fail to send command to Python host process");
+}
+
+boost::shared_ptr<CHostedScriptProcess> CScriptHost::script(int scriptInstanceId) const
+{
+   boost::lock_guard<boost::recursive_mutex> lock(m_scriptsMutex);
+   const auto script = m_scripts.find(scriptInstanceId);
+   return script == m_scripts.end() ? boost::shared_ptr<CHostedScriptProcess>() : script->second;
+}
+
+boost::shared_ptr<CHostedScriptProcess> CScriptHost::removeScript(int scriptInstanceId)
+{
+   boost::lock_guard<boost::recursive_mutex> lock(m_scriptsMutex);
+   const auto script = m_scripts.find(scriptInstanceId);
+   if (script == m_scripts.end())
+      return boost::shared_ptr<CHostedScriptProcess>();
+
+   const auto hostedScript = script->second;
+   m_scripts.erase(script);
+   return hostedScript;
+}
+
+void CScriptHost::processHostOutput(const std::string& line)
+{
+   // Lines are "<event> <scriptInstanceId>[ <text>]", see scriptHost.py
+   if (line.size() < 3 || line[1] != ' ')
+   {
+      YADOMS_LOG(warning) << "Python host process, invalid output : " << line;
+      return;
+   }
+
+   const auto idEnd = line.find(' ', 2);
+   const auto scriptInstanceId = std::atoi(line.substr(2, idEnd - 2).c_str());
+   const auto text = idEnd == std::string::npos ? std::string() : line.substr(idEnd + 1);
+
+   if (scriptInstanceId == 0)
+   {
+      // Output of the host itself (or of a thread created by a script)
+      if (line[0] == 'R')
+         YADOMS_LOG(error) << "Python host process : " << text;
+      else
+         YADOMS_LOG(information) << "Python host process : " << text;
+      return;
+   }
+
+   switch (line[0])
+   {
+   case 'S':
+      {
+         const auto hostedScript = script(scriptInstanceId);
+         if (hostedScript)
+            hostedScript->onStarted();
+         break;
+      }
+   case 'O':
+      {
+         const auto hostedScript = script(scriptInstanceId);
+         if (hostedScript)
+            hostedScript->onOutput(text);
+         break;
+      }
+   case 'R':
+      {
+         const auto hostedScript = script(scriptInstanceId);
+         if (hostedScript)
+            hostedScript->onErrorOutput(text);
+         break;
+      }
+   case 'A':
+      onScriptAbandoned(scriptInstanceId);
+      break;
+   case 'E':
+      onScriptStopped(scriptInstanceId,
+                      std::atoi(text.c_str()));
+      break;
+   default:
+      YADOMS_LOG(warning) << "Python host process, invalid output : " << line;
+      break;
+   }
+}
+
+void CScriptHost::onScriptAbandoned(int scriptInstanceId)
+{
+   YADOMS_LOG(warning) << "Python host process : script #" << scriptInstanceId << " doesn't stop, host process will be restarted when all its scripts are stopped";
+
+   boost::lock_guard<boost::recursive_mutex> lock(m_scriptsMutex);
+   m_recycling = true;
+}
+
+void CScriptHost::onScriptStopped(int scriptInstanceId,
+                                  int returnCode)
+{
+   const auto hostedScript = removeScript(scriptInstanceId);
+   if (hostedScript)
+      hostedScript->onStopped(returnCode);
+
+   {
+      boost::lock_guard<boost::recursive_mutex> lock(m_scriptsMutex);
+      if (!m_recycling || !m_scripts.empty())
+         return;
+   }
+
+   // Last script of a recycled host is stopped : exit host, to end the abandoned scripts threads
+   YADOMS_LOG(information) << "Python host process has no more running scripts, stop it";
+   boost::lock_guard<boost::recursive_mutex> lock(m_stdInMutex);
+   if (m_stdIn)
+      m_stdIn->close();
+}
+
+void CScriptHost::stdOutWorker(boost::shared_ptr<Poco::PipeInputStream> hostStdOut)
+{
+   std::string line;
+   while (std::getline(*hostStdOut, line))
+      processHostOutput(line);
+}
+
+void CScriptHost::stdErrWorker(boost::shared_ptr<Poco::PipeInputStream> hostStdErr)
+{
+   // Host redirects scripts stderr to its stdout, so only host fatal errors are received here
+   std::string line;
+   while (std::getline(*hostStdErr, line))
+      YADOMS_LOG(error) << "Python host process : " << line;
+}
+
+void CScriptHost::monitorWorker()
+{
+   int returnCode;
+   try
+   {
+      returnCode = Poco::Process::wait(*m_processHandle);
+   }
+   catch (Poco::SystemException&)
+   {
+      // Process was probably killed
+      returnCode = 0;
+   }
+
+   m_stdOutThread->join();
+   m_stdErrThread->join();
+
+   // Keep the host alive while notifying its scripts : if this is the last reference,
+   // host is destroyed at the end of this function (see destructor)
+   boost::shared_ptr<CScriptHost> self;
+   try
+   {
+      self = shared_from_this();
+   }
+   catch (boost::bad_weak_ptr&)
+   {
+      // Host is being destroyed, its destructor waits for this thread
+   }
+
+   {
+      boost::lock_guard<boost::recursive_mutex> lock(m_stdInMutex);
+      m_running = false;
+   }
+
+   // Scripts still running at this point stopped with the host (host crash, or killed)
+   std::map<int, boost::shared_ptr<CHostedScriptProcess>> stoppedScripts;
+   {
+      boost::lock_guard<boost::recursive_mutex> lock(m_scriptsMutex);
+      stoppedScripts.swap(m_scripts);
+   }
+
+   if (!stoppedScripts.empty())
+      YADOMS_LOG(error) << "Python host process stopped with " << stoppedScripts.size() << " running scripts (return code " << returnCode << ")";
+
+   for (const auto& stoppedScript : stoppedScripts)
+      stoppedScript.second->onStopped(returnCode,
+                                      (boost::format("Python host process stopped (return code %1%)") % returnCode).str());
+
+   // Host can now be forgotten by the pool (so not destroyed while this thread is running)
+   boost::lock_guard<boost::recursive_mutex> lock(m_stdInMutex);
+   m_stopped = true;
+}
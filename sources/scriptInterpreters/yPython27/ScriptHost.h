@@ -0,0 +1,126 @@
+#pragma once
+#include "IPythonExecutable.h"
+#include "IScriptFile.h"
+#include "IScriptProcess.h"
+#include <shared/process/IProcessObserver.h>
+#include <shared/process/IExternalProcessLogger.h>
+
+class CHostedScriptProcess;
+
+//--------------------------------------------------------------
+/// \brief	Python host process, running several scripts (see scriptHost.py)
+/// \details Scripts are started and stopped by commands sent on host stdin.
+///          Host stdout multiplexes scripts events and outputs, dispatched here to each script.
+//--------------------------------------------------------------
+class CScriptHost : public boost::enable_shared_from_this<CScriptHost>
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	Constructor, start the host process
+   /// \param[in] executable  Python executable to call to start host
+   /// \param[in] interpreterPath  The current library path
+   /// \throw std::runtime_error if host process can not be started
+   //--------------------------------------------------------------
+   CScriptHost(boost::shared_ptr<IPythonExecutable> executable,
+               const boost::filesystem::path& interpreterPath);
+
+   //--------------------------------------------------------------
+   /// \brief	Destructor, stop the host process
+   //--------------------------------------------------------------
+   virtual ~CScriptHost();
+
+   //--------------------------------------------------------------
+   /// \brief	Start a script in the host
+   /// \param[in] scriptInstanceId The script instance ID
+   /// \param[in] scriptFile The script file to execute
+   /// \param[in] scriptApiId The script Api ID, used to interact with Yadoms
+   /// \param[in] scriptLogger The script logger
+   /// \param[in] processObserver Object to notify when script starts and stops
+   /// \return The running script, or null if host doesn't accept new scripts anymore (see acceptsScripts)
+   /// \throw std::runtime_error if host is not running
+   //--------------------------------------------------------------
+   boost::shared_ptr<IScriptProcess> startScript(int scriptInstanceId,
+                                                 boost::shared_ptr<const IScriptFile> scriptFile,
+                                                 const std::string& scriptApiId,
+                                                 boost::shared_ptr<shared::process::IExternalProcessLogger> scriptLogger,
+                                                 boost::shared_ptr<shared::process::IProcessObserver> processObserver);
+
+   //--------------------------------------------------------------
+   /// \brief	Ask a script to stop (stop is notified asynchronously by the script process observer)
+   /// \param[in] scriptInstanceId The script instance ID
+   //--------------------------------------------------------------
+   void stopScript(int scriptInstanceId);
+
+   //--------------------------------------------------------------
+   /// \brief	Get the number of scripts running in the host
+   //--------------------------------------------------------------
+   std::size_t scriptsCount() const;
+
+   //--------------------------------------------------------------
+   /// \brief	Check if new scripts can be started in the host
+   /// \details A host running a script which can't be stopped doesn't accept new scripts,
+   ///          and exits when its last script is stopped (the only way to really stop the abandoned script)
+   //--------------------------------------------------------------
+   bool acceptsScripts() const;
+
+   //--------------------------------------------------------------
+   /// \brief	Check if host is stopped (host process is ended and all its scripts are notified as stopped)
+   //--------------------------------------------------------------
+   bool isStopped() const;
+
+protected:
+   void start();
+   void sendCommand(const std::string& command);
+   void processHostOutput(const std::string& line);
+   void onScriptAbandoned(int scriptInstanceId);
+   void onScriptStopped(int scriptInstanceId,
+                        int returnCode);
+   boost::shared_ptr<CHostedScriptProcess> script(int scriptInstanceId) const;
+   boost::shared_ptr<CHostedScriptProcess> removeScript(int scriptInstanceId);
+
+   void stdOutWorker(boost::shared_ptr<Poco::PipeInputStream> hostStdOut);
+   void stdErrWorker(boost::shared_ptr<Poco::PipeInputStream> hostStdErr);
+   void monitorWorker();
+
+private:
+   //--------------------------------------------------------------
+   /// \brief	The Python executable to call to start host
+   //--------------------------------------------------------------
+   boost::shared_ptr<IPythonExecutable> m_executable;
+
+   //--------------------------------------------------------------
+   /// \brief	The current library path
+   //--------------------------------------------------------------
+   const boost::filesystem::path m_interpreterPath;
+
+   //--------------------------------------------------------------
+   /// \brief	The host process
+   //--------------------------------------------------------------
+   boost::shared_ptr<Poco::ProcessHandle> m_processHandle;
+
+   //--------------------------------------------------------------
+   /// \brief	Host stdin, to send commands, and its mutex (also protecting m_running and m_stopped)
+   //--------------------------------------------------------------
+   boost::shared_ptr<Poco::PipeOutputStream> m_stdIn;
+   mutable boost::recursive_mutex m_stdInMutex;
+   bool m_running;
+   bool m_stopped;
+
+   //--------------------------------------------------------------
+   /// \brief	The scripts running in the host, and its mutex (also protecting m_recycling)
+   //--------------------------------------------------------------
+   mutable boost::recursive_mutex m_scriptsMutex;
+   std::map<int, boost::shared_ptr<CHostedScriptProcess>> m_scripts;
+
+   //--------------------------------------------------------------
+   /// \brief	true if a script was abandoned : host must exit when all its scripts are stopped
+   //--------------------------------------------------------------
+   bool m_recycling;
+
+   //--------------------------------------------------------------
+   /// \brief	Threads reading host outputs, and waiting for host end
+   //--------------------------------------------------------------
+   boost::shared_ptr<boost::thread> m_stdOutThread;
+   boost::shared_ptr<boost::thread> m_stdErrThread;
+   boost::shared_ptr<boost::thread> m_monitorThread;
+};
@@ -0,0 +1,63 @@
+#include "stdafx.h"
+#include "ScriptHostPool.h"
+#include "ScriptHost.h"
+#include <shared/Log.h>
+
+
+CScriptHostPool::CScriptHostPool(boost::shared_ptr<IPythonExecutable> executable,
+                                 const boost::filesystem::path& interpreterPath,
+                                 std::size_t scriptsPerHost)
+   : m_executable(executable),
+     m_interpreterPath(interpreterPath),
+     m_scriptsPerHost(std::max(scriptsPerHost, static_cast<std::size_t>(1)))
+{
+}
+
+CScriptHostPool::~CScriptHostPool()
+{
+}
+
+boost::shared_ptr<IScriptProcess> CScriptHostPool::startScript(int scriptInstanceId,
+                                                               boost::shared_ptr<const IScriptFile> scriptFile,
+                                                               const std::string& scriptApiId,
+                                                               boost::shared_ptr<shared::process::IExternalProcessLogger> scriptLogger,
+                                                               boost::shared_ptr<shared::process::IProcessObserver> processObserver)
+{
+   boost::lock_guard<boost::recursive_mutex> lock(m_hostsMutex);
+
+   while (true)
+   {
+      // Host can stop accepting scripts in the meantime (if one of its scripts is abandoned), so try another one
+      const auto script = availableHost()->startScript(scriptInstanceId,
+                                                       scriptFile,
+                                                       scriptApiId,
+                                                       scriptLogger,
+                                                       processObserver);
+      if (script)
+         return script;
+   }
+}
+
+boost::shared_ptr<CScriptHost> CScriptHostPool::availableHost()
+{
+   // Forget stopped hosts (scripts they were running are already notified as stopped).
+   // Hosts are kept until their monitor thread is ended, to not be destroyed by this thread.
+   m_hosts.erase(std::remove_if(m_hosts.begin(),
+                                m_hosts.end(),
+                                [](const boost::shared_ptr<CScriptHost>& host)
+                                {
+                                   return host->isStopped();
+                                }),
+                 m_hosts.end());
+
+   for (const auto& host : m_hosts)
+   {
+      if (host->acceptsScripts() && host->scriptsCount() < m_scriptsPerHost)
+         return host;
+   }
+
+   YADOMS_LOG(information) << "Start a new Python host process (" << m_hosts.size() << " already running)";
+   m_hosts.push_back(boost::make_shared<CScriptHost>(m_executable,
+                                                     m_interpreterPath));
+   return m_hosts.back();
+}
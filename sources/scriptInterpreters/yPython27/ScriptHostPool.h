@@ -0,0 +1,49 @@
+#pragma once
+#include "IScriptHostPool.h"
+#include "IPythonExecutable.h"
+
+class CScriptHost;
+
+//--------------------------------------------------------------
+/// \brief	Pool of Python host processes
+/// \details Scripts are started in the first host running less than scriptsPerHost scripts.
+///          A new host is started when all hosts are full.
+///          A host crash (segfault...) stops all the scripts it runs, so scriptsPerHost should be kept small.
+//--------------------------------------------------------------
+class CScriptHostPool : public IScriptHostPool
+{
+public:
+   //--------------------------------------------------------------
+   /// \brief	Constructor
+   /// \param[in] executable  Python executable to call to start hosts
+   /// \param[in] interpreterPath  The current library path
+   /// \param[in] scriptsPerHost  Maximum number of scripts run by a host
+   //--------------------------------------------------------------
+   CScriptHostPool(boost::shared_ptr<IPythonExecutable> executable,
+                   const boost::filesystem::path& interpreterPath,
+                   std::size_t scriptsPerHost);
+
+   //--------------------------------------------------------------
+   /// \brief	Destructor, stop all hosts
+   //--------------------------------------------------------------
+   virtual ~CScriptHostPool();
+
+   // IScriptHostPool Implementation
+   boost::shared_ptr<IScriptProcess> startScript(int scriptInstanceId,
+                                                 boost::shared_ptr<const IScriptFile> scriptFile,
+                                                 const std::string& scriptApiId,
+                                                 boost::shared_ptr<shared::process::IExternalProcessLogger> scriptLogger,
+                                                 boost::shared_ptr<shared::process::IProcessObserver> processObserver) override;
+   // [END] IScriptHostPool Implementation
+
+protected:
+   boost::shared_ptr<CScriptHost> availableHost();
+
+private:
+   boost::shared_ptr<IPythonExecutable> m_executable;
+   const boost::filesystem::path m_interpreterPath;
+   const std::size_t m_scriptsPerHost;
+
+   boost::recursive_mutex m_hostsMutex;
+   std::vector<boost::shared_ptr<CScriptHost>> m_hosts;
+};
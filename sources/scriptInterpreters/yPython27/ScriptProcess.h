@@ -1,6 +1,6 @@
 #pragma once
 #include "IPythonExecutable.h"
-#include <shared/process/IProcess.h>
+#include "IScriptProcess.h"
 #include "IScriptFile.h"
 #include <shared/process/ICommandLine.h>
 #include <shared/process/IProcessObserver.h>
@@ -9,7 +9,7 @@
 //--------------------------------------------------------------
 /// \brief	Python process
 //--------------------------------------------------------------
-class CScriptProcess : public shared::process::IProcess
+class CScriptProcess : public IScriptProcess
 {
 public:
    //--------------------------------------------------------------
@@ -33,13 +33,12 @@ public:
    //--------------------------------------------------------------
    virtual ~CScriptProcess();
 
-   // shared::process::IProcess Implementation
+   // IScriptProcess Implementation
    void kill() override;
    int getReturnCode() const override;
    std::string getError() const override;
-   // [END] shared::process::IProcess Implementation
-
-   boost::shared_ptr<shared::process::IExternalProcessLogger> logger() const;
+   boost::shared_ptr<shared::process::IExternalProcessLogger> logger() const override;
+   // [END] IScriptProcess Implementation
 
 protected:
    void start();
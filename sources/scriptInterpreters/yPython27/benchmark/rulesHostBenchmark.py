@@ -0,0 +1,140 @@
+#######################################
+# Rules host benchmark
+#
+# Compare startup time, stop time and memory of trivial rules run :
+#  - one process per rule (scriptCaller.py)
+#  - all rules in one pooled host process (scriptHost.py)
+#
+# Usage : python rulesHostBenchmark.py [rulesCount]
+# Runs without Yadoms : a fake yScriptApiWrapper module is used.
+# Memory is read from /proc, so Linux only.
+#######################################
+
+import os
+import sys
+import time
+import shutil
+import tempfile
+import subprocess
+
+InterpreterDirectory = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+FakeApiWrapper = """
+class FakeApi(object):
+   pass
+
+def createScriptApiInstance(yScriptApiAccessorId):
+   return FakeApi()
+
+def deleteScriptApiInstance(yApi):
+   pass
+
+def interruptScriptApiInstance(yApi):
+   pass
+"""
+
+TrivialRule = """
+import time
+
+def yMain(yApi):
+   print 'started'
+   while True:
+      time.sleep(0.1)
+"""
+
+
+def residentMemory(pid):
+   """Resident memory of a process, in kB"""
+   with open('/proc/%d/status' % pid) as status:
+      for line in status:
+         if line.startswith('VmRSS:'):
+            return int(line.split()[1])
+   return 0
+
+
+def createRules(workDirectory, rulesCount):
+   rulesDirectories = []
+   for rule in range(1, rulesCount + 1):
+      ruleDirectory = os.path.join(workDirectory, 'rules', str(rule))
+      os.makedirs(ruleDirectory)
+      with open(os.path.join(ruleDirectory, 'yadomsScript.py'), 'w') as script:
+         script.write(TrivialRule)
+      rulesDirectories.append(ruleDirectory)
+   return rulesDirectories
+
+
+def runProcessPerRule(rulesDirectories, environment):
+   start = time.time()
+   processes = []
+   for rule, ruleDirectory in enumerate(rulesDirectories, 1):
+      processes.append(subprocess.Popen([sys.executable, '-u', 'scriptCaller.py', ruleDirectory, 'yadomsScript', 'api%d' % rule],
+                                        cwd = InterpreterDirectory, env = environment, stdout = subprocess.PIPE))
+   for process in processes:
+      while process.stdout.readline().strip() != 'started':
+         pass
+   startDuration = time.time() - start
+
+   memory = sum(residentMemory(process.pid) for process in processes)
+
+   start = time.time()
+   for process in processes:
+      process.kill()
+   for process in processes:
+      process.wait()
+   stopDuration = time.time() - start
+
+   return startDuration, stopDuration, memory, len(processes)
+
+
+def runPooledHost(rulesDirectories, environment):
+   start = time.time()
+   host = subprocess.Popen([sys.executable, '-u', 'scriptHost.py'],
+                           cwd = InterpreterDirectory, env = environment, stdin = subprocess.PIPE, stdout = subprocess.PIPE)
+   for rule, ruleDirectory in enumerate(rulesDirectories, 1):
+      host.stdin.write('start %d api%d yadomsScript %s\n' % (rule, rule, ruleDirectory))
+   host.stdin.flush()
+   startedRules = 0
+   while startedRules < len(rulesDirectories):
+      if host.stdout.readline().split(' ', 2)[::2] == ['O', 'started\n']:
+         startedRules += 1
+   startDuration = time.time() - start
+
+   memory = residentMemory(host.pid)
+
+   start = time.time()
+   for rule in range(1, len(rulesDirectories) + 1):
+      host.stdin.write('stop %d\n' % rule)
+   host.stdin.flush()
+   stoppedRules = 0
+   while stoppedRules < len(rulesDirectories):
+      if host.stdout.readline().startswith('E '):
+         stoppedRules += 1
+   stopDuration = time.time() - start
+
+   host.stdin.close()
+   host.wait()
+
+   return startDuration, stopDuration, memory, 1
+
+
+if __name__ == '__main__':
+
+   rulesCount = int(sys.argv[1]) if len(sys.argv) > 1 else 100
+
+   workDirectory = tempfile.mkdtemp()
+   try:
+      fakeApiDirectory = os.path.join(workDirectory, 'fakeApi')
+      os.makedirs(fakeApiDirectory)
+      with open(os.path.join(fakeApiDirectory, 'yScriptApiWrapper.py'), 'w') as fakeApi:
+         fakeApi.write(FakeApiWrapper)
+      environment = dict(os.environ, PYTHONPATH = fakeApiDirectory)
+
+      rulesDirectories = createRules(workDirectory, rulesCount)
+
+      print '%d trivial rules' % rulesCount
+      print '%-20s %10s %10s %12s %10s' % ('mode', 'start (s)', 'stop (s)', 'memory (MB)', 'processes')
+      for mode, run in (('process per rule', runProcessPerRule), ('pooled host', runPooledHost)):
+         startDuration, stopDuration, memory, processes = run(rulesDirectories, environment)
+         print '%-20s %10.3f %10.3f %12.1f %10d' % (mode, startDuration, stopDuration, memory / 1024.0, processes)
+   finally:
+      shutil.rmtree(workDirectory)
@@ -0,0 +1,402 @@
+import os
+import sys
+import threading
+import time
+import ctypes
+import traceback
+import imp
+import itertools
+import __builtin__
+
+# Import yScript API
+# We need to relocate current working directory to make yScriptApiWrapper module find it's
+# dependencies (Boost libraries...)
+# Note that yScriptApiWrapper module is in scriptHost directory (so the CWD)
+scriptHostDirectory = os.getcwd()
+# Change directory to all dependencies directory
+os.chdir('../../')
+sys.path.append(scriptHostDirectory)
+import yScriptApiWrapper
+import scriptUtilities
+# Restore working directory
+os.chdir(scriptHostDirectory)
+
+
+# Host of several rules, each one running in its own thread.
+#
+# Commands are read from stdin, one per line :
+#   start <ruleId> <apiId> <module> <scriptPath>
+#   stop <ruleId>
+# Host exits when stdin is closed (all rules are stopped first).
+#
+# Events are written to stdout, one per line :
+#   S <ruleId>               rule is started
+#   A <ruleId>               rule doesn't stop and is abandoned (host must be restarted to really stop it)
+#   E <ruleId> <returnCode>  rule is stopped
+#   O <ruleId> <text>        line written by the rule on its stdout
+#   R <ruleId> <text>        line written by the rule on its stderr
+# Lines written by the host itself (or by threads created by rules) use rule id 0.
+
+
+# Time given to a rule to stop, before to abandon it (in seconds)
+StopTimeout = 5.0
+
+# Period to raise again RuleStopped in a rule which doesn't stop (in seconds)
+StopRetryPeriod = 0.1
+
+# Rule of the current thread
+currentRule = threading.local()
+
+# Exit of the host process
+hostExit = os._exit
+
+# Import of the Python modules (not specific to a rule)
+builtinImport = __builtin__.__import__
+
+# Rule instances numbering (a rule can be restarted while its abandoned instance is still running)
+ruleInstanceNumbers = itertools.count(1)
+
+
+class RuleStopped(BaseException):
+   """Raised in the rule thread to stop it (not an Exception, to not be caught by 'except Exception')"""
+   pass
+
+
+def ruleExit(code):
+   """Replace os._exit, to exit only the calling rule and not the whole host"""
+   if getattr(currentRule, 'rule', None) is None:
+      hostExit(code)
+   raise SystemExit(code)
+
+
+def ruleImport(name, globals = None, locals = None, fromlist = None, level = -1):
+   """Replace __import__, to import the modules of a rule directory only for this rule"""
+   rule = getattr(currentRule, 'rule', None)
+   if rule is not None and level <= 0:
+      ruleModuleName = rule.ruleModuleName(name.split('.', 1)[0])
+      if ruleModuleName is not None:
+         name = ruleModuleName + name[name.find('.'):] if '.' in name else ruleModuleName
+         level = 0
+   return builtinImport(name, globals, locals, fromlist, level)
+
+
+class HostOutput(object):
+   """Write events on the host stdout, line by line"""
+
+   def __init__(self, stream):
+      self.__stream = stream
+      self.__lock = threading.Lock()
+
+   def write(self, kind, ruleId, text = None):
+      with self.__lock:
+         if text is None:
+            self.__stream.write('%s %d\n' % (kind, ruleId))
+         else:
+            self.__stream.write('%s %d %s\n' % (kind, ruleId, text))
+         self.__stream.flush()
+
+
+class RuleStream(object):
+   """Replace sys.stdout or sys.stderr, to send written lines to the rule of the writing thread"""
+
+   def __init__(self, kind, output):
+      self.__kind = kind
+      self.__output = output
+      self.__pendingLines = {}
+      self.__lock = threading.Lock()
+      self.__threadState = threading.local()
+
+   @property
+   def softspace(self):
+      # Used by print statement, must be specific to the writing thread
+      return getattr(self.__threadState, 'softspace', 0)
+
+   @softspace.setter
+   def softspace(self, value):
+      self.__threadState.softspace = value
+
+   def write(self, text):
+      if isinstance(text, unicode):
+         text = text.encode('utf-8')
+      rule = getattr(currentRule, 'rule', None)
+      if rule is not None and rule.abandoned:
+         # Rule is already notified as stopped (and can be restarted), its outputs must not be mixed with the new instance ones
+         return
+      ruleId = 0 if rule is None else rule.ruleId
+      with self.__lock:
+         lines = (self.__pendingLines.pop(ruleId, '') + text).split('\n')
+         if lines[-1]:
+            self.__pendingLines[ruleId] = lines[-1]
+         for line in lines[:-1]:
+            self.__output.write(self.__kind, ruleId, line.rstrip('\r'))
+
+   def writelines(self, lines):
+      for line in lines:
+         self.write(line)
+
+   def flush(self):
+      pass
+
+   def flushRule(self, ruleId):
+      """Write the last uncompleted line of a rule"""
+      with self.__lock:
+         line = self.__pendingLines.pop(ruleId, None)
+         if line is not None:
+            self.__output.write(self.__kind, ruleId, line)
+
+
+def isInstalledModule(name):
+   """Check if a module can be imported from sys.path"""
+   if name in sys.builtin_module_names:
+      return True
+   try:
+      moduleFile = imp.find_module(name)[0]
+   except ImportError:
+      return False
+   if moduleFile is not None:
+      moduleFile.close()
+   return True
+
+
+class Rule(threading.Thread):
+   """A rule, running in its own thread"""
+
+   def __init__(self, host, ruleId, apiId, module, scriptPath):
+      threading.Thread.__init__(self, name = 'rule #%d' % ruleId)
+      self.daemon = True
+      self.__host = host
+      self.ruleId = ruleId
+      self.__apiId = apiId
+      self.__module = module
+      self.__scriptPath = scriptPath
+      self.__yApi = None
+      self.__yApiLock = threading.Lock()
+      self.__stopRequested = False
+      self.__finishing = False
+      self.abandoned = False
+      # Modules of the rule directory are imported under a rule specific name,
+      # so rules don't share modules with the same name (and their state)
+      self.__modulesPrefix = '__rule%d_%d_' % (ruleId, next(ruleInstanceNumbers))
+      self.__ruleModuleNames = {}
+
+   def run(self):
+      currentRule.rule = self
+      returnCode = 0
+      try:
+         returnCode = self.__run()
+      except (KeyboardInterrupt, RuleStopped):
+         # Rule was stopped by Yadoms while handling an exception
+         pass
+      finally:
+         self.__finish()
+         # Delete yScript API instance
+         with self.__yApiLock:
+            if self.__yApi is not None:
+               yScriptApiWrapper.deleteScriptApiInstance(self.__yApi)
+               self.__yApi = None
+         self.__unloadModules()
+         self.__host.ruleStopped(self, returnCode)
+
+   def __run(self):
+      self.__host.ruleStarted(self.ruleId)
+      returnCode = 0
+      try:
+         with self.__yApiLock:
+            if self.__stopRequested:
+               raise RuleStopped()
+            # Create yScript API instance
+            self.__yApi = yScriptApiWrapper.createScriptApiInstance(self.__apiId)
+
+         # Load the script under a name specific to this rule, as all rules have the same module name
+         script = imp.load_source(self.__modulesPrefix + self.__module, os.path.join(self.__scriptPath, self.__module + '.py'))
+
+         script.yMain(self.__yApi)
+      except (KeyboardInterrupt, RuleStopped):
+         # Rule was stopped by Yadoms
+         pass
+      except SystemExit as exit:
+         if exit.code is None or isinstance(exit.code, int):
+            returnCode = exit.code or 0
+         else:
+            print >> sys.stderr, exit.code
+            returnCode = 1
+      except:
+         if not self.__stopRequested:
+            traceback.print_exc()
+            returnCode = 1
+      return returnCode
+
+   def ruleModuleName(self, name):
+      """Get the name under which a module of the rule directory is imported (None if module is not in the rule directory)"""
+      if name in self.__ruleModuleNames:
+         return self.__ruleModuleNames[name]
+
+      # As when the rule ran in its own process (rule directory at the end of sys.path),
+      # already imported and installed modules have priority over rule ones
+      ruleModuleName = None
+      if name not in sys.modules and not isInstalledModule(name):
+         try:
+            moduleFile, pathName, description = imp.find_module(name, [self.__scriptPath])
+         except ImportError:
+            moduleFile = None
+         else:
+            ruleModuleName = self.__modulesPrefix + name
+            imp.acquire_lock()
+            try:
+               if ruleModuleName not in sys.modules:
+                  imp.load_module(ruleModuleName, moduleFile, pathName, description)
+            finally:
+               imp.release_lock()
+               if moduleFile is not None:
+                  moduleFile.close()
+
+      self.__ruleModuleNames[name] = ruleModuleName
+      return ruleModuleName
+
+   def __unloadModules(self):
+      """Forget the rule modules, so they are loaded again if the rule is restarted"""
+      for name in sys.modules.keys():
+         if name.startswith(self.__modulesPrefix):
+            del sys.modules[name]
+
+   def __finish(self):
+      """Stop raising RuleStopped in the rule thread, so the end of the rule can't be interrupted"""
+      while True:
+         try:
+            with self.__yApiLock:
+               self.__finishing = True
+            # Drop a RuleStopped raised but not yet received
+            ctypes.pythonapi.PyThreadState_SetAsyncExc(ctypes.c_long(self.ident), None)
+            return
+         except RuleStopped:
+            pass
+
+   def stop(self):
+      """Ask the rule to stop : pending and next API calls fail, and RuleStopped is raised in the rule thread"""
+      with self.__yApiLock:
+         self.__stopRequested = True
+         if self.__yApi is not None:
+            yScriptApiWrapper.interruptScriptApiInstance(self.__yApi)
+      self.raiseStopped()
+
+   def raiseStopped(self):
+      """Raise RuleStopped in the rule thread (again, as the rule can catch it)"""
+      with self.__yApiLock:
+         if self.ident is not None and not self.__finishing:
+            ctypes.pythonapi.PyThreadState_SetAsyncExc(ctypes.c_long(self.ident), ctypes.py_object(RuleStopped))
+
+
+class Host(object):
+   """The rules host"""
+
+   def __init__(self):
+      self.__output = HostOutput(sys.__stdout__)
+      self.__stdout = RuleStream('O', self.__output)
+      self.__stderr = RuleStream('R', self.__output)
+      self.__rules = {}
+      self.__rulesLock = threading.Lock()
+
+   def run(self):
+      sys.stdout = self.__stdout
+      sys.stderr = self.__stderr
+
+      for command in iter(sys.stdin.readline, ''):
+         try:
+            self.__processCommand(command.rstrip('\r\n'))
+         except Exception:
+            traceback.print_exc()
+
+      # Yadoms closed the channel : stop all rules
+      with self.__rulesLock:
+         ruleIds = self.__rules.keys()
+      stoppers = [self.__stopRule(ruleId) for ruleId in ruleIds]
+      for stopper in stoppers:
+         if stopper is not None:
+            stopper.join()
+
+   def __processCommand(self, command):
+      args = command.split(' ', 4)
+      if args[0] == 'start' and len(args) == 5:
+         self.__startRule(int(args[1]), args[2], args[3], args[4])
+      elif args[0] == 'stop' and len(args) == 2:
+         self.__stopRule(int(args[1]))
+      elif command:
+         print >> sys.stderr, 'scriptHost.py, invalid command :', command
+
+   def __startRule(self, ruleId, apiId, module, scriptPath):
+      with self.__rulesLock:
+         if ruleId in self.__rules:
+            print >> sys.stderr, 'scriptHost.py, rule', ruleId, 'is already running'
+            return
+         rule = Rule(self, ruleId, apiId, module, scriptPath)
+         self.__rules[ruleId] = rule
+      rule.start()
+
+   def __stopRule(self, ruleId):
+      with self.__rulesLock:
+         rule = self.__rules.get(ruleId)
+      if rule is None:
+         return None
+      rule.stop()
+
+      stopper = threading.Thread(target = self.__waitRuleStopped, args = (rule,), name = 'stop rule #%d' % ruleId)
+      stopper.daemon = True
+      stopper.start()
+      return stopper
+
+   def __waitRuleStopped(self, rule):
+      deadline = time.time() + StopTimeout
+      while rule.isAlive() and time.time() < deadline:
+         rule.join(StopRetryPeriod)
+         if rule.isAlive():
+            rule.raiseStopped()
+
+      # A rule blocked outside Python code (sleep...) can not be interrupted :
+      # it is abandoned after timeout, to not block Yadoms
+      if rule.isAlive():
+         self.ruleAbandoned(rule)
+
+   def ruleStarted(self, ruleId):
+      self.__output.write('S', ruleId)
+
+   def ruleAbandoned(self, rule):
+      with self.__rulesLock:
+         if self.__rules.get(rule.ruleId) is not rule:
+            # Already stopped
+            return
+         rule.abandoned = True
+      self.__output.write('A', rule.ruleId)
+      self.ruleStopped(rule, 0)
+
+   def ruleStopped(self, rule, returnCode):
+      ruleId = rule.ruleId
+      with self.__rulesLock:
+         if self.__rules.get(ruleId) is not rule:
+            # Already notified
+            return
+         del self.__rules[ruleId]
+      self.__stdout.flushRule(ruleId)
+      self.__stderr.flushRule(ruleId)
+      self.__output.write('E', ruleId, str(returnCode))
+
+
+if __name__ == '__main__':
+
+   if len(sys.argv) != 1:
+      print "scriptHost.py, invalid argument list ", sys.argv
+      sys.exit(1)
+
+   # Check more often for asynchronous exceptions, so rules stop quickly
+   sys.setcheckinterval(10)
+
+   # A rule calling os._exit must not stop the other rules
+   os._exit = ruleExit
+
+   # A rule must not import the modules of another rule
+   __builtin__.__import__ = ruleImport
+
+   Host().run()
+
+   # Don't wait for abandoned rules
+   sys.__stdout__.flush()
+   hostExit(0)
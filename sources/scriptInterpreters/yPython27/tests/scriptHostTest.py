@@ -0,0 +1,222 @@
+#######################################
+# scriptHost.py tests
+#
+# Usage : python scriptHostTest.py
+# Runs without Yadoms : a fake yScriptApiWrapper module is used.
+# Threads are counted from /proc, so Linux only.
+#######################################
+
+import os
+import sys
+import time
+import shutil
+import tempfile
+import unittest
+import threading
+import subprocess
+import Queue
+
+InterpreterDirectory = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+FakeApiWrapper = """
+class FakeApi(object):
+   pass
+
+def createScriptApiInstance(yScriptApiAccessorId):
+   return FakeApi()
+
+def deleteScriptApiInstance(yApi):
+   pass
+
+def interruptScriptApiInstance(yApi):
+   pass
+"""
+
+# Catches all Exception subclasses, so is only stopped if RuleStopped is not an Exception
+LoopingRule = """
+import time
+
+def yMain(yApi):
+   print 'started'
+   while True:
+      try:
+         time.sleep(0.01)
+      except Exception:
+         pass
+"""
+
+# Catches everything, so is only stopped if RuleStopped is raised again
+CatchAllRule = """
+import time
+
+def yMain(yApi):
+   print 'started'
+   while True:
+      try:
+         time.sleep(0.01)
+      except:
+         pass
+"""
+
+# Blocked outside Python code, can't be stopped
+BlockedRule = """
+import time
+
+def yMain(yApi):
+   print 'started'
+   time.sleep(30)
+   print 'still running'
+"""
+
+ExitingRule = """
+import os
+
+def yMain(yApi):
+   print 'started'
+   os._exit(3)
+"""
+
+# Imports modules shipped in the rule directory
+ImportingRule = """
+import time
+import helper
+from tools import names
+
+def yMain(yApi):
+   helper.counter += 1
+   print 'helper', helper.value, helper.counter, names.value
+   print 'started'
+   while True:
+      time.sleep(0.01)
+"""
+
+
+def threadsCount(pid):
+   with open('/proc/%d/status' % pid) as status:
+      for line in status:
+         if line.startswith('Threads:'):
+            return int(line.split()[1])
+   return 0
+
+
+class ScriptHostTest(unittest.TestCase):
+
+   def setUp(self):
+      self.workDirectory = tempfile.mkdtemp()
+      fakeApiDirectory = os.path.join(self.workDirectory, 'fakeApi')
+      os.makedirs(fakeApiDirectory)
+      with open(os.path.join(fakeApiDirectory, 'yScriptApiWrapper.py'), 'w') as fakeApi:
+         fakeApi.write(FakeApiWrapper)
+
+      self.host = subprocess.Popen([sys.executable, '-u', 'scriptHost.py'],
+                                   cwd = InterpreterDirectory, env = dict(os.environ, PYTHONPATH = fakeApiDirectory),
+                                   stdin = subprocess.PIPE, stdout = subprocess.PIPE)
+      self.events = Queue.Queue()
+      self.reader = threading.Thread(target = self.readEvents)
+      self.reader.daemon = True
+      self.reader.start()
+
+   def tearDown(self):
+      self.host.stdin.close()
+      self.host.wait()
+      shutil.rmtree(self.workDirectory)
+
+   def readEvents(self):
+      for line in iter(self.host.stdout.readline, ''):
+         self.events.put(line.rstrip('\n'))
+
+   def startRule(self, ruleId, code, modules = {}):
+      """Start a rule, return the events received before it is started"""
+      ruleDirectory = os.path.join(self.workDirectory, 'rules', str(ruleId))
+      if not os.path.isdir(ruleDirectory):
+         os.makedirs(ruleDirectory)
+      for modulePath, moduleCode in dict(modules, yadomsScript = code).items():
+         moduleFile = os.path.join(ruleDirectory, *modulePath.split('/')) + '.py'
+         if not os.path.isdir(os.path.dirname(moduleFile)):
+            os.makedirs(os.path.dirname(moduleFile))
+         with open(moduleFile, 'w') as module:
+            module.write(moduleCode)
+      self.sendCommand('start %d api%d yadomsScript %s' % (ruleId, ruleId, ruleDirectory))
+      return self.waitEvent('O %d started' % ruleId)
+
+   def sendCommand(self, command):
+      self.host.stdin.write(command + '\n')
+      self.host.stdin.flush()
+
+   def waitEvent(self, expected, timeout = 10.0):
+      """Wait for an event, return the events received before"""
+      received = []
+      deadline = time.time() + timeout
+      while True:
+         try:
+            event = self.events.get(timeout = max(deadline - time.time(), 0.01))
+         except Queue.Empty:
+            self.fail('%s not received (received : %s)' % (expected, received))
+         if event == expected:
+            return received
+         received.append(event)
+
+   def assertThreadsCount(self, expected, timeout = 2.0):
+      deadline = time.time() + timeout
+      while threadsCount(self.host.pid) != expected and time.time() < deadline:
+         time.sleep(0.05)
+      self.assertEqual(expected, threadsCount(self.host.pid))
+
+   def checkRuleThreadEnds(self, code):
+      idleThreads = threadsCount(self.host.pid)
+      self.startRule(1, code)
+      self.sendCommand('stop 1')
+      received = self.waitEvent('E 1 0')
+      self.assertNotIn('A 1', received)
+      self.assertThreadsCount(idleThreads)
+
+   def test_stopLoopingRule(self):
+      self.checkRuleThreadEnds(LoopingRule)
+
+   def test_stopRuleCatchingAll(self):
+      self.checkRuleThreadEnds(CatchAllRule)
+
+   def test_abandonBlockedRule(self):
+      self.startRule(1, BlockedRule)
+      self.sendCommand('stop 1')
+      received = self.waitEvent('E 1 0')
+      self.assertIn('A 1', received)
+
+      # Rule can be restarted, without outputs of the abandoned instance
+      shutil.rmtree(os.path.join(self.workDirectory, 'rules'))
+      self.startRule(1, LoopingRule)
+      self.sendCommand('stop 1')
+      self.assertEqual([], self.waitEvent('E 1 0'))
+
+   def test_exitOnlyStopsItsRule(self):
+      self.startRule(1, LoopingRule)
+      self.startRule(2, ExitingRule)
+      self.waitEvent('E 2 3')
+
+      self.assertIsNone(self.host.poll())
+      self.sendCommand('stop 1')
+      self.waitEvent('E 1 0')
+
+   def ruleModules(self, value):
+      return {'helper': 'value = %r\ncounter = 0\n' % value,
+              'tools/__init__': '',
+              'tools/names': 'value = %r\n' % (value + 'Name')}
+
+   def test_rulesDontShareModules(self):
+      # Same module names in both rules, each rule must get its own modules
+      self.assertIn('O 1 helper one 1 oneName', self.startRule(1, ImportingRule, self.ruleModules('one')))
+      self.assertIn('O 2 helper two 1 twoName', self.startRule(2, ImportingRule, self.ruleModules('two')))
+
+      # A restarted rule loads its modules again
+      self.sendCommand('stop 1')
+      self.waitEvent('E 1 0')
+      self.assertIn('O 1 helper one 1 oneName', self.startRule(1, ImportingRule))
+
+      self.sendCommand('stop 1')
+      self.waitEvent('E 1 0')
+      self.sendCommand('stop 2')
+      self.waitEvent('E 2 0')
+
+
+if __name__ == '__main__':
+   unittest.main()
@@ -1,5 +1,6 @@
 
-%module(docstring="The Yadoms Script API") yScriptApiWrapper
+// Release the GIL during API calls : scripts run by the same host process don't block each other
+%module(docstring="The Yadoms Script API", threads="1") yScriptApiWrapper
 
 %{
 /* Put headers and other declarations here */
@@ -25,6 +26,9 @@
 // Used by IYScriptApi::waitForEvent
 %template() std::vector<int>;
 %template() std::pair<int, std::string>;
+// Used by IYScriptApi batch and subscription methods
+%template() std::vector<std::string>;
+%template() std::vector<std::pair<int, std::string> >;
 
 /* Add an exception handler to each library method */
 %exception {
@@ -49,3 +53,6 @@ shared::script::yScriptApi::IYScriptApi* createScriptApiInstance(const std::stri
 // yScriptApi instance destruction method
 void deleteScriptApiInstance(shared::script::yScriptApi::IYScriptApi* yApi);
 
+// yScriptApi instance interruption method (pending and next calls throw)
+void interruptScriptApiInstance(shared::script::yScriptApi::IYScriptApi* yApi);
+
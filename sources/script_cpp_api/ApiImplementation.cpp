@@ -14,8 +14,16 @@ void deleteScriptApiInstance(shared::script::yScriptApi::IYScriptApi* yApi)
    delete yApi;
 }
 
+void interruptScriptApiInstance(shared::script::yScriptApi::IYScriptApi* yApi)
+{
+   const auto api = dynamic_cast<CYScriptApiImplementation*>(yApi);
+   if (api)
+      api->interrupt();
+}
+
 
 CYScriptApiImplementation::CYScriptApiImplementation(const std::string& yScriptApiAccessorId)
+   : m_interrupted(false)
 {
    // Verify that the version of the library that we linked against is
    // compatible with the version of the headers we compiled against.
@@ -42,8 +50,13 @@ CYScriptApiImplementation::CYScriptApiImplementation(const std::string& yScriptA
 
 CYScriptApiImplementation::~CYScriptApiImplementation()
 {
-   // Delete all global objects allocated by libprotobuf.
-   google::protobuf::ShutdownProtobufLibrary();
+   // Don't call google::protobuf::ShutdownProtobufLibrary here : several instances
+   // can live in the same process (pooled scripts host), libprotobuf must stay usable
+}
+
+void CYScriptApiImplementation::interrupt()
+{
+   m_interrupted = true;
 }
 
 void CYScriptApiImplementation::sendRequest(const script_IPC::toYadoms::msg& request) const
@@ -52,6 +65,9 @@ void CYScriptApiImplementation::sendRequest(const script_IPC::toYadoms::msg& req
    {
       boost::lock_guard<boost::recursive_mutex> lock(m_sendMutex);
 
+      if (m_interrupted)
+         throw std::runtime_error("CYScriptApiImplementation::send, script API was interrupted");
+
       if (!m_sendMessageQueue || !m_messageCutter)
          throw std::runtime_error((boost::format("CYScriptApiImplementation::send \"%1%\", script API not ready to send message") % request.descriptor()->full_name()).str());
 
@@ -92,10 +108,17 @@ void CYScriptApiImplementation::receiveAnswer(script_IPC::toScript::msg& answer)
 
    while (!messageAssembler->isCompleted())
    {
-      m_receiveMessageQueue->receive(message.get(),
-                                     m_receiveMessageQueue->get_max_msg_size(),
-                                     messageSize,
-                                     messagePriority);
+      // Wake up regularly to check if API was interrupted
+      if (!m_receiveMessageQueue->timed_receive(message.get(),
+                                                m_receiveMessageQueue->get_max_msg_size(),
+                                                messageSize,
+                                                messagePriority,
+                                                boost::posix_time::microsec_clock::universal_time() + boost::posix_time::milliseconds(500)))
+      {
+         if (m_interrupted)
+            throw std::runtime_error("CYScriptApiImplementation::receiveAnswer, script API was interrupted");
+         continue;
+      }
 
       messageAssembler->appendPart(message,
                                    messageSize);
@@ -170,6 +193,27 @@ std::string CYScriptApiImplementation::readKeyword(int keywordId) const
    return answer.readkeyword().value();
 }
 
+std::vector<std::string> CYScriptApiImplementation::readKeywords(const std::vector<int>& keywordIdList) const
+{
+   script_IPC::toYadoms::msg req;
+   auto request = req.mutable_readkeywords();
+   for (const auto it : keywordIdList)
+      request->add_keywordid(it);
+   sendRequest(req);
+
+   script_IPC::toScript::msg answer;
+   receiveAnswer(answer);
+
+   if (!answer.error().empty())
+      throw std::out_of_range(std::string("yScriptApiWrapper::readKeywords returned error : ") + answer.error());
+
+   if (!answer.has_readkeywords())
+      throw std::out_of_range("yScriptApiWrapper::readKeywords, wrong message received");
+
+   return std::vector<std::string>(answer.readkeywords().values().begin(),
+                                   answer.readkeywords().values().end());
+}
+
 std::string CYScriptApiImplementation::waitForNextAcquisition(int keywordId,
                                                               const std::string& timeout) const
 {
@@ -296,6 +340,88 @@ void CYScriptApiImplementation::writeKeyword(int keywordId,
       throw std::out_of_range("yScriptApiWrapper::writeKeyword, wrong message received");
 }
 
+void CYScriptApiImplementation::writeKeywords(const std::vector<std::pair<int, std::string>>& newStates)
+{
+   script_IPC::toYadoms::msg req;
+   auto request = req.mutable_writekeywords();
+   for (const auto& newState : newStates)
+   {
+      auto keyword = request->add_keywords();
+      keyword->set_keywordid(newState.first);
+      keyword->set_newstate(newState.second);
+   }
+   sendRequest(req);
+
+   script_IPC::toScript::msg answer;
+   receiveAnswer(answer);
+
+   if (!answer.error().empty())
+      std::cerr << std::string("yScriptApiWrapper::writeKeywords returned error : ") + answer.error() << std::endl;
+   else if (!answer.has_writekeywords())
+      throw std::out_of_range("yScriptApiWrapper::writeKeywords, wrong message received");
+}
+
+void CYScriptApiImplementation::subscribeAcquisitions(const std::vector<int>& keywordIdList)
+{
+   script_IPC::toYadoms::msg req;
+   auto request = req.mutable_subscribeacquisitions();
+   for (const auto it : keywordIdList)
+      request->add_keywordid(it);
+   sendRequest(req);
+
+   script_IPC::toScript::msg answer;
+   receiveAnswer(answer);
+
+   if (!answer.error().empty())
+      throw std::out_of_range(std::string("yScriptApiWrapper::subscribeAcquisitions returned error : ") + answer.error());
+
+   if (!answer.has_subscribeacquisitions())
+      throw std::out_of_range("yScriptApiWrapper::subscribeAcquisitions, wrong message received");
+}
+
+std::vector<std::pair<int, std::string>> CYScriptApiImplementation::waitForSubscribedAcquisitions(const std::string& timeout)
+{
+   script_IPC::toYadoms::msg req;
+   auto request = req.mutable_waitforsubscribedacquisitions();
+   if (!timeout.empty())
+      request->set_timeout(timeout);
+   sendRequest(req);
+
+   script_IPC::toScript::msg answer;
+   receiveAnswer(answer);
+
+   if (!answer.error().empty())
+      throw std::out_of_range(std::string("yScriptApiWrapper::waitForSubscribedAcquisitions returned error : ") + answer.error());
+
+   if (!answer.has_waitforsubscribedacquisitions())
+      throw std::out_of_range("yScriptApiWrapper::waitForSubscribedAcquisitions, wrong message received");
+
+   const auto& acquisitions = answer.waitforsubscribedacquisitions();
+   if (acquisitions.keywordid_size() != acquisitions.acquisition_size())
+      throw std::out_of_range("yScriptApiWrapper::waitForSubscribedAcquisitions, inconsistent message received");
+
+   std::vector<std::pair<int, std::string>> result;
+   for (auto i = 0; i < acquisitions.keywordid_size(); ++i)
+      result.push_back(std::make_pair(acquisitions.keywordid(i), acquisitions.acquisition(i)));
+   return result;
+}
+
+void CYScriptApiImplementation::unsubscribeAcquisitions()
+{
+   script_IPC::toYadoms::msg req;
+   req.mutable_unsubscribeacquisitions();
+   sendRequest(req);
+
+   script_IPC::toScript::msg answer;
+   receiveAnswer(answer);
+
+   if (!answer.error().empty())
+      throw std::out_of_range(std::string("yScriptApiWrapper::unsubscribeAcquisitions returned error : ") + answer.error());
+
+   if (!answer.has_unsubscribeacquisitions())
+      throw std::out_of_range("yScriptApiWrapper::unsubscribeAcquisitions, wrong message received");
+}
+
 void CYScriptApiImplementation::sendNotification(int keywordId,
                                                  int recipientId,
                                                  const std::string& message)
@@ -3,6 +3,7 @@
 #include <script_IPC/yadomsToScript.pb.h>
 #include <script_IPC/scriptToYadoms.pb.h>
 #include <shared/communication/IMessageCutter.h>
+#include <atomic>
 
 
 //-----------------------------------------------------
@@ -22,12 +23,18 @@ public:
    //-----------------------------------------------------
    virtual ~CYScriptApiImplementation();
 
+   //-----------------------------------------------------
+   ///\brief               Interrupt the API : pending and next calls throw
+   //-----------------------------------------------------
+   void interrupt();
+
    // shared::script::yScriptApi::IYScriptApi implementation
    int getKeywordId(const std::string& deviceName,
                     const std::string& keywordName) const override;
    int getRecipientId(const std::string& firstName,
                       const std::string& lastName) const override;
    std::string readKeyword(int keywordId) const override;
+   std::vector<std::string> readKeywords(const std::vector<int>& keywordIdList) const override;
    std::string waitForNextAcquisition(int keywordId,
                                       const std::string& timeout = std::string()) const override;
    std::pair<int, std::string> waitForNextAcquisitions(const std::vector<int>& keywordIdList,
@@ -38,6 +45,10 @@ public:
    std::vector<int> getKeywordsByCapacity(const std::string& capacity) const override;
    void writeKeyword(int keywordId,
                      const std::string& newState) override;
+   void writeKeywords(const std::vector<std::pair<int, std::string>>& newStates) override;
+   void subscribeAcquisitions(const std::vector<int>& keywordIdList) override;
+   std::vector<std::pair<int, std::string>> waitForSubscribedAcquisitions(const std::string& timeout = std::string()) override;
+   void unsubscribeAcquisitions() override;
    void sendNotification(int keywordId,
                          int recipientId,
                          const std::string& message) override;
@@ -56,7 +67,7 @@ protected:
    //--------------------------------------------------------------
    /// \brief	Wait for an answer
    /// \param[in] answer Received answer from Yadoms
-   /// \throw std::runtime_error if message queue error
+   /// \throw std::runtime_error if message queue error, or if API was interrupted
    /// \throw shared::exception::CInvalidParameter if error parsing message
    //--------------------------------------------------------------
    void receiveAnswer(script_IPC::toScript::msg& answer) const;
@@ -78,5 +89,10 @@ private:
    ///\brief               The buffer
    //-----------------------------------------------------
    boost::shared_ptr<shared::communication::IMessageCutter> m_messageCutter;
+
+   //-----------------------------------------------------
+   ///\brief               Set when API is interrupted
+   //-----------------------------------------------------
+   std::atomic<bool> m_interrupted;
 };
 
@@ -14,4 +14,12 @@ shared::script::yScriptApi::IYScriptApi* createScriptApiInstance(const std::stri
 ///\brief                              Delete the yScriptApi instance
 ///\param[in] yApi                     Pointer on the IYScriptApi pointer
 //-----------------------------------------------------
-void deleteScriptApiInstance(shared::script::yScriptApi::IYScriptApi* yApi);
\ No newline at end of file
+void deleteScriptApiInstance(shared::script::yScriptApi::IYScriptApi* yApi);
+
+//-----------------------------------------------------
+///\brief                              Interrupt the yScriptApi instance
+///\details                            Pending and next calls of the instance throw, so the script stops.
+///                                    Used to stop a script running in a shared host process.
+///\param[in] yApi                     Pointer on the IYScriptApi pointer
+//-----------------------------------------------------
+void interruptScriptApiInstance(shared::script::yScriptApi::IYScriptApi* yApi);
\ No newline at end of file
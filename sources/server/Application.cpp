@@ -13,6 +13,7 @@
 #include "PathProvider.h"
 #include <shared/ServiceLocator.h>
 #include <shared/process/ApplicationStopHandler.h>
+#include <shared/metrics/MetricsSwitch.h>
 
 //define the main entry point
 POCO_SERVER_MAIN(CYadomsServer)
@@ -142,8 +143,12 @@ int CYadomsServer::main(const ArgVec& /*args*/)
 
       if (m_startupOptions->getNoPasswordFlag())
       YADOMS_LOG(information) << "\tnoPassword = true";
+      if (m_startupOptions->getMetricsEnabled())
+      YADOMS_LOG(information) << "\tmetrics = true";
       YADOMS_LOG(information) << "********************************************************************";
 
+      shared::metrics::CMetricsSwitch::enable(m_startupOptions->getMetricsEnabled());
+
       //register Services in serviceLocator
       shared::CServiceLocator::instance().push<const startupOptions::IStartupOptions>(m_startupOptions);
       shared::CServiceLocator::instance().push<IRunningInformation>(m_runningInformation);
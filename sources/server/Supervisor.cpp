@@ -103,6 +103,7 @@ void CSupervisor::run()
       boost::shared_ptr<automation::IRuleManager> automationRulesManager(boost::make_shared<automation::CRuleManager>(scriptInterpreterManager,
                                                                                                                       pDataProvider,
                                                                                                                       pluginGateway,
+                                                                                                                      pluginManager,
                                                                                                                       dal->getKeywordManager(),
                                                                                                                       dal->getEventLogger(),
                                                                                                                       location,
@@ -149,7 +150,7 @@ void CSupervisor::run()
       webServer->getConfigurator()->restHandlerRegisterService(boost::make_shared<web::rest::service::CPluginEventLogger>(pDataProvider));
       webServer->getConfigurator()->restHandlerRegisterService(boost::make_shared<web::rest::service::CEventLogger>(dal->getEventLogger()));
       webServer->getConfigurator()->restHandlerRegisterService(boost::make_shared<web::rest::service::CSystem>(timezoneDatabase));
-      webServer->getConfigurator()->restHandlerRegisterService(boost::make_shared<web::rest::service::CAcquisition>(pDataProvider));
+      webServer->getConfigurator()->restHandlerRegisterService(boost::make_shared<web::rest::service::CAcquisition>(pDataProvider, dal->getKeywordManager()));
       webServer->getConfigurator()->restHandlerRegisterService(
          boost::make_shared<web::rest::service::CAutomationRule>(pDataProvider, automationRulesManager));
       webServer->getConfigurator()->restHandlerRegisterService(boost::make_shared<web::rest::service::CTask>(taskManager));
@@ -160,10 +161,10 @@ void CSupervisor::run()
 
       webServer->start();
 
-      // Start the plugin manager (start all plugin instances)
+      // Start the plugin manager (start all plugin instances, in background)
       pluginManager->start(boost::posix_time::minutes(2));
 
-      //start the rule manager
+      //start the rule manager (rules referencing not yet started plugins are started later)
       automationRulesManager->start();
 
       //create and start the dateTime notification scheduler
@@ -8,18 +8,23 @@
 #include "RuleException.hpp"
 #include "script/GeneralInfo.h"
 #include "script/Properties.h"
+#include "native/Engine.h"
+#include "native/Rule.h"
+#include "native/CompiledRule.h"
 
 namespace automation
 {
    CRuleManager::CRuleManager(boost::shared_ptr<interpreter::IManager> interpreterManager,
                               boost::shared_ptr<database::IDataProvider> dataProvider,
                               boost::shared_ptr<communication::ISendMessageAsync> pluginGateway,
+                              boost::shared_ptr<const pluginSystem::IInstancesStartup> pluginsStartup,
                               boost::shared_ptr<dataAccessLayer::IKeywordManager> keywordAccessLayer,
                               boost::shared_ptr<dataAccessLayer::IEventLogger> eventLogger,
                               boost::shared_ptr<shared::ILocation> location,
                               boost::shared_ptr<dateTime::ITimeZoneProvider> timezoneProvider)
       : m_interpreterManager(interpreterManager),
         m_pluginGateway(pluginGateway),
+        m_pluginsStartup(pluginsStartup),
         m_dbAcquisitionRequester(dataProvider->getAcquisitionRequester()),
         m_dbDeviceRequester(dataProvider->getDeviceRequester()),
         m_keywordAccessLayer(keywordAccessLayer),
@@ -36,6 +41,14 @@ namespace automation
             onRuleStopped(scriptInstanceId,
                           error);
          });
+
+      m_nativeEngine = boost::make_shared<native::CEngine>(m_pluginGateway,
+                                                           m_keywordAccessLayer,
+                                                           [&](int ruleId, const std::string& error)
+                                                           {
+                                                              onRuleStopped(ruleId,
+                                                                            error);
+                                                           });
    }
 
    CRuleManager::~CRuleManager()
@@ -52,15 +65,112 @@ namespace automation
    void CRuleManager::stop()
    {
       m_yadomsShutdown = true;
+      m_deferredRulesStartThread.interrupt();
+      m_deferredRulesStartThread.join();
       stopRules();
    }
 
    void CRuleManager::startAllRules()
    {
-      boost::lock_guard<boost::recursive_mutex> lock(m_startedRulesMutex);
+      // Rules referencing not yet started plugins are deferred
+      std::vector<boost::shared_ptr<database::entities::CRule>> rulesToStart;
+      std::vector<DeferredRule> deferredRules;
+      for (const auto& rule : m_ruleRequester->getRules())
+      {
+         if (rule->AutoStart() && rule->State() != database::entities::ERuleState::kError)
+         {
+            const auto startDependencies = getStartDependencies(*rule);
+            if (!arePluginsStarted(startDependencies))
+            {
+               deferredRules.push_back(startDependencies);
+               continue;
+            }
+         }
+         rulesToStart.push_back(rule);
+      }
 
-      if (!startRules(m_ruleRequester->getRules()))
-      YADOMS_LOG(error) << "One or more automation rules failed to start, check automation rules page for details";
+      {
+         boost::lock_guard<boost::recursive_mutex> lock(m_startedRulesMutex);
+
+         if (!startRules(rulesToStart))
+         YADOMS_LOG(error) << "One or more automation rules failed to start, check automation rules page for details";
+      }
+
+      if (!deferredRules.empty())
+      {
+         YADOMS_LOG(information) << deferredRules.size() << " rule(s) will be started when the plugins they reference are started";
+         m_deferredRulesStartThread = boost::thread(&CRuleManager::doStartDeferredRules, this, deferredRules);
+      }
+   }
+
+   CRuleManager::DeferredRule CRuleManager::getStartDependencies(const database::entities::CRule& rule) const
+   {
+      DeferredRule startDependencies = {rule.Id(), true, std::set<int>()};
+
+      // Only native rules declare the keywords they use
+      if (!isNativeInterpreter(rule.Interpreter()))
+         return startDependencies;
+
+      try
+      {
+         const native::CCompiledRule compiledRule(rule.Id(), shared::CDataContainer(rule.Content()));
+         for (const auto& keywordId : compiledRule.keywords())
+         {
+            const auto keyword = m_keywordAccessLayer->getKeyword(keywordId);
+            startDependencies.pluginInstances.insert(m_dbDeviceRequester->getDevice(keyword->DeviceId())->PluginId());
+         }
+         startDependencies.waitAllPlugins = false;
+      }
+      catch (std::exception& e)
+      {
+         YADOMS_LOG(warning) << "Unable to find plugins used by rule #" << rule.Id() << " (" << e.what() << "), rule will be started when all plugins are started";
+      }
+
+      return startDependencies;
+   }
+
+   bool CRuleManager::arePluginsStarted(const DeferredRule& rule) const
+   {
+      if (!m_pluginsStartup)
+         return true;
+
+      return rule.waitAllPlugins ? m_pluginsStartup->areAllInstancesStarted() : m_pluginsStartup->areInstancesStarted(rule.pluginInstances);
+   }
+
+   void CRuleManager::doStartDeferredRules(std::vector<DeferredRule> rules)
+   {
+      try
+      {
+         while (!rules.empty())
+         {
+            boost::this_thread::sleep(boost::posix_time::milliseconds(500));
+
+            for (auto rule = rules.begin(); rule != rules.end();)
+            {
+               if (!arePluginsStarted(*rule))
+               {
+                  ++rule;
+                  continue;
+               }
+
+               try
+               {
+                  // Rule may have been changed since startup
+                  const auto ruleData = getRule(rule->ruleId);
+                  if (ruleData->AutoStart())
+                     startRule(rule->ruleId);
+               }
+               catch (std::exception& e)
+               {
+                  YADOMS_LOG(error) << "Unable to start rule #" << rule->ruleId << " (" << e.what() << "), skipped";
+               }
+               rule = rules.erase(rule);
+            }
+         }
+      }
+      catch (boost::thread_interrupted&)
+      {
+      }
    }
 
    bool CRuleManager::startRules(const std::vector<boost::shared_ptr<database::entities::CRule>>& rules)
@@ -98,7 +208,14 @@ namespace automation
 
    std::vector<std::string> CRuleManager::getAvailableInterpreters()
    {
-      return m_interpreterManager->getAvailableInterpreters();
+      auto interpreters = m_interpreterManager->getAvailableInterpreters();
+      interpreters.push_back(native::CEngine::InterpreterName);
+      return interpreters;
+   }
+
+   bool CRuleManager::isNativeInterpreter(const std::string& interpreterName)
+   {
+      return interpreterName == native::CEngine::InterpreterName;
    }
 
    void CRuleManager::startRule(int ruleId)
@@ -115,14 +232,20 @@ namespace automation
          YADOMS_LOG(information) << "Start rule #" << ruleId;
 
          boost::lock_guard<boost::recursive_mutex> lock(m_startedRulesMutex);
-         const auto newRule(boost::make_shared<CRule>(ruleData,
-                                                      m_interpreterManager,
-                                                      m_pluginGateway,
-                                                      m_dbAcquisitionRequester,
-                                                      m_dbDeviceRequester,
-                                                      m_keywordAccessLayer,
-                                                      m_dbRecipientRequester,
-                                                      m_generalInfo));
+         boost::shared_ptr<IRule> newRule;
+         if (isNativeInterpreter(ruleData->Interpreter()))
+            newRule = boost::make_shared<native::CRule>(ruleData,
+                                                        m_nativeEngine,
+                                                        m_interpreterManager->getScriptLogFilename(ruleId));
+         else
+            newRule = boost::make_shared<CRule>(ruleData,
+                                                m_interpreterManager,
+                                                m_pluginGateway,
+                                                m_dbAcquisitionRequester,
+                                                m_dbDeviceRequester,
+                                                m_keywordAccessLayer,
+                                                m_dbRecipientRequester,
+                                                m_generalInfo);
          m_startedRules[ruleId] = newRule;
       }
       catch (shared::exception::CEmptyResult& e)
@@ -253,11 +376,22 @@ namespace automation
       // Add rule in database
       const auto ruleId = m_ruleRequester->addRule(ruleData);
 
-      // Create script file
-      const auto ruleProperties(boost::make_shared<script::CProperties>(m_ruleRequester->getRule(ruleId)));
-      m_interpreterManager->updateScriptFile(ruleProperties->interpreterName(),
-                                             ruleProperties->scriptPath().string(),
-                                             code);
+      if (isNativeInterpreter(ruleData->Interpreter()))
+      {
+         // Native rule definition is stored in database
+         auto ruleContent(boost::make_shared<database::entities::CRule>());
+         ruleContent->Id = ruleId;
+         ruleContent->Content = code;
+         m_ruleRequester->updateRule(ruleContent);
+      }
+      else
+      {
+         // Create script file
+         const auto ruleProperties(boost::make_shared<script::CProperties>(m_ruleRequester->getRule(ruleId)));
+         m_interpreterManager->updateScriptFile(ruleProperties->interpreterName(),
+                                                ruleProperties->scriptPath().string(),
+                                                code);
+      }
 
       // Start the rule
       startRule(ruleId);
@@ -274,7 +408,11 @@ namespace automation
    {
       try
       {
-         const auto ruleProperties(boost::make_shared<script::CProperties>(m_ruleRequester->getRule(id)));
+         const auto ruleData(m_ruleRequester->getRule(id));
+         if (isNativeInterpreter(ruleData->Interpreter()))
+            return ruleData->Content();
+
+         const auto ruleProperties(boost::make_shared<script::CProperties>(ruleData));
          return m_interpreterManager->getScriptContent(ruleProperties->interpreterName(),
                                                        ruleProperties->scriptPath().string());
       }
@@ -302,7 +440,10 @@ namespace automation
    {
       try
       {
-         m_interpreterManager->deleteLog(id);
+         if (isNativeInterpreter(m_ruleRequester->getRule(id)->Interpreter()))
+            boost::filesystem::remove(m_interpreterManager->getScriptLogFilename(id));
+         else
+            m_interpreterManager->deleteLog(id);
       }
       catch (shared::exception::CException& e)
       {
@@ -315,6 +456,9 @@ namespace automation
    {
       try
       {
+         if (isNativeInterpreter(interpreterName))
+            return native::CEngine::templateCode();
+
          return m_interpreterManager->getScriptTemplateContent(interpreterName);
       }
       catch (shared::exception::CEmptyResult& e)
@@ -341,11 +485,23 @@ namespace automation
       if (ruleWasStarted)
          stopRuleAndWaitForStopped(id);
 
-      // Update script file
-      const auto ruleProperties(boost::make_shared<script::CProperties>(m_ruleRequester->getRule(id)));
-      m_interpreterManager->updateScriptFile(ruleProperties->interpreterName(),
-                                             ruleProperties->scriptPath().string(),
-                                             code);
+      const auto ruleData(m_ruleRequester->getRule(id));
+      if (isNativeInterpreter(ruleData->Interpreter()))
+      {
+         // Update native rule definition
+         auto ruleContent(boost::make_shared<database::entities::CRule>());
+         ruleContent->Id = id;
+         ruleContent->Content = code;
+         m_ruleRequester->updateRule(ruleContent);
+      }
+      else
+      {
+         // Update script file
+         const auto ruleProperties(boost::make_shared<script::CProperties>(ruleData));
+         m_interpreterManager->updateScriptFile(ruleProperties->interpreterName(),
+                                                ruleProperties->scriptPath().string(),
+                                                code);
+      }
 
       // Restart rule
       if (ruleWasStarted)
@@ -364,10 +520,13 @@ namespace automation
          // Remove in database
          m_ruleRequester->deleteRule(id);
 
-         // Remove script file
-         const auto ruleProperties(boost::make_shared<script::CProperties>(ruleData));
-         m_interpreterManager->deleteScriptFile(ruleProperties->interpreterName(),
-                                                ruleProperties->scriptPath().string());
+         // Remove script file (native rule definition is in database)
+         if (!isNativeInterpreter(ruleData->Interpreter()))
+         {
+            const auto ruleProperties(boost::make_shared<script::CProperties>(ruleData));
+            m_interpreterManager->deleteScriptFile(ruleProperties->interpreterName(),
+                                                   ruleProperties->scriptPath().string());
+         }
       }
       catch (shared::exception::CException& e)
       {
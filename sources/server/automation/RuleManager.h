@@ -2,6 +2,7 @@
 #include "IRuleManager.h"
 #include "IRule.h"
 #include "../communication/ISendMessageAsync.h"
+#include "../pluginSystem/IInstancesStartup.h"
 #include "database/IAcquisitionRequester.h"
 #include "database/IDeviceRequester.h"
 #include "database/IRecipientRequester.h"
@@ -14,6 +15,7 @@
 #include "database/IDataProvider.h"
 #include "dataAccessLayer/IEventLogger.h"
 #include "dateTime/ITimeZoneProvider.h"
+#include "native/IEngine.h"
 
 namespace automation
 {
@@ -26,6 +28,7 @@ namespace automation
       CRuleManager(boost::shared_ptr<interpreter::IManager> interpreterManager,
                    boost::shared_ptr<database::IDataProvider> dataProvider,
                    boost::shared_ptr<communication::ISendMessageAsync> pluginGateway,
+                   boost::shared_ptr<const pluginSystem::IInstancesStartup> pluginsStartup,
                    boost::shared_ptr<dataAccessLayer::IKeywordManager> keywordAccessLayer,
                    boost::shared_ptr<dataAccessLayer::IEventLogger> eventLogger,
                    boost::shared_ptr<shared::ILocation> location,
@@ -69,6 +72,36 @@ namespace automation
       //-----------------------------------------------------
       bool startRules(const std::vector<boost::shared_ptr<database::entities::CRule>>& rules);
 
+      //-----------------------------------------------------
+      ///\brief               A rule waiting for the plugin instances it references to be started
+      //-----------------------------------------------------
+      struct DeferredRule
+      {
+         int ruleId;
+         bool waitAllPlugins; ///< Referenced instances are unknown (script rule)
+         std::set<int> pluginInstances;
+      };
+
+      //-----------------------------------------------------
+      ///\brief               Get the rule start dependencies
+      ///\param[in] rule      The rule
+      ///\return              The rule start dependencies
+      //-----------------------------------------------------
+      DeferredRule getStartDependencies(const database::entities::CRule& rule) const;
+
+      //-----------------------------------------------------
+      ///\brief               Check if the plugin instances referenced by a rule are started
+      ///\param[in] rule      The rule start dependencies
+      ///\return              true if rule can be started
+      //-----------------------------------------------------
+      bool arePluginsStarted(const DeferredRule& rule) const;
+
+      //-----------------------------------------------------
+      ///\brief               Start the deferred rules as soon as the plugins they reference are started (deferred start thread)
+      ///\param[in] rules     The deferred rules
+      //-----------------------------------------------------
+      void doStartDeferredRules(std::vector<DeferredRule> rules);
+
       //-----------------------------------------------------
       ///\brief               Check if a rule is started
       ///\param[in] ruleId    The rule ID
@@ -103,9 +136,17 @@ namespace automation
       void recordRuleStopped(int ruleId,
                              const std::string& error = std::string()) const;
 
+      //-----------------------------------------------------
+      ///\brief               Check if an interpreter is the native rules interpreter
+      ///\param[in] interpreterName The interpreter name
+      ///\return              true if rules of this interpreter are run by the native rules engine
+      //-----------------------------------------------------
+      static bool isNativeInterpreter(const std::string& interpreterName);
+
    private:
       boost::shared_ptr<interpreter::IManager> m_interpreterManager;
       boost::shared_ptr<communication::ISendMessageAsync> m_pluginGateway;
+      boost::shared_ptr<const pluginSystem::IInstancesStartup> m_pluginsStartup;
       boost::shared_ptr<database::IAcquisitionRequester> m_dbAcquisitionRequester;
       boost::shared_ptr<database::IDeviceRequester> m_dbDeviceRequester;
       boost::shared_ptr<dataAccessLayer::IKeywordManager> m_keywordAccessLayer;
@@ -122,6 +163,16 @@ namespace automation
 
       mutable boost::recursive_mutex m_ruleStopNotifiersMutex;
       std::map<int, std::set<boost::shared_ptr<shared::event::CEventHandler>>> m_ruleStopNotifiers;
+
+      //-----------------------------------------------------
+      ///\brief               The thread starting rules waiting for plugins startup
+      //-----------------------------------------------------
+      boost::thread m_deferredRulesStartThread;
+
+      //-----------------------------------------------------
+      ///\brief               The native rules engine (declared last, to be stopped first)
+      //-----------------------------------------------------
+      boost::shared_ptr<native::IEngine> m_nativeEngine;
    };
 } // namespace automation	
 
@@ -129,16 +129,15 @@ namespace automation
             return;
          }
 
-         const auto pbMessageSize = pbMsg.ByteSize();
-         const auto serializedMessage = boost::make_shared<unsigned char[]>(pbMessageSize);
-         if (!pbMsg.SerializeWithCachedSizesToArray(serializedMessage.get()))
+         // Serialize in the reused send buffer (protected by m_sendMutex)
+         if (!m_sendBuffer.serialize(pbMsg))
          {
             YADOMS_LOG(error) << "CIpcAdapter::send : fail to serialize message ==> ignored";
             return;
          }
 
-         const auto cuttedMessage = m_messageCutter->cut(serializedMessage,
-                                                         pbMessageSize);
+         const auto cuttedMessage = m_messageCutter->cut(m_sendBuffer.data(),
+                                                         m_sendBuffer.size());
 
          if (!cuttedMessage->empty())
          {
@@ -188,10 +187,8 @@ namespace automation
          if (messageSize < 1)
             throw shared::exception::CInvalidParameter("messageSize");
 
-         // Unserialize message
-         interpreter_IPC::toYadoms::msg toYadomsProtoBuffer;
-         if (!toYadomsProtoBuffer.ParseFromArray(message.get(), messageSize))
-            throw shared::exception::CInvalidParameter("message : fail to parse received data into protobuf format");
+         // Unserialize message (in the receive arena, the message is released when next one is received)
+         const auto& toYadomsProtoBuffer = m_receiveArena.parse<interpreter_IPC::toYadoms::msg>(message.get(), messageSize);
 
          YADOMS_LOG(trace) << "[RECEIVE] message " << toYadomsProtoBuffer.OneOf_case() << " from interpreter " << m_interpreterName << (m_onReceiveHook ? " (onReceiveHook ENABLED)" : "");
 
@@ -5,6 +5,8 @@
 #include <interpreter_IPC/interpreterToYadoms.pb.h>
 #include <shared/script/yInterpreterApi/IYInterpreterApi.h>
 #include <shared/communication/IMessageCutter.h>
+#include "communication/ReceiveArena.hpp"
+#include "communication/SendBuffer.hpp"
 
 namespace automation
 {
@@ -116,11 +118,21 @@ namespace automation
          //-----------------------------------------------------
          mutable boost::recursive_mutex m_sendMutex;
 
+         //-----------------------------------------------------
+         ///\brief               The buffer in which sent messages are serialized
+         //-----------------------------------------------------
+         communication::CSendBuffer m_sendBuffer;
+
          //-----------------------------------------------------
          ///\brief               The message cutter, to manage oversized messages
          //-----------------------------------------------------
          boost::shared_ptr<shared::communication::IMessageCutter> m_messageCutter;
 
+         //-----------------------------------------------------
+         ///\brief               The arena in which received messages are parsed (used only by the receiving thread)
+         //-----------------------------------------------------
+         communication::CReceiveArena m_receiveArena;
+
          boost::thread m_messageQueueReceiveThread;
 
          mutable boost::recursive_mutex m_onReceiveHookMutex;
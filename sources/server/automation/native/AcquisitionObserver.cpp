@@ -0,0 +1,47 @@
+#include "stdafx.h"
+#include "AcquisitionObserver.h"
+#include "database/entities/Entities.h"
+#include "notification/acquisition/Notification.hpp"
+
+namespace automation
+{
+   namespace native
+   {
+      CAcquisitionObserver::CAcquisitionObserver(shared::event::CEventHandler& eventHandler,
+                                                 int eventId)
+         : m_eventHandler(eventHandler),
+           m_eventId(eventId)
+      {
+      }
+
+      CAcquisitionObserver::~CAcquisitionObserver()
+      {
+      }
+
+      void CAcquisitionObserver::setKeywords(const std::set<int>& keywords)
+      {
+         boost::lock_guard<boost::mutex> lock(m_keywordsMutex);
+         m_keywords = keywords;
+      }
+
+      void CAcquisitionObserver::observe(const boost::shared_ptr<notification::INotification> notification)
+      {
+         const auto acquisitionNotification = boost::dynamic_pointer_cast<notification::acquisition::CNotification>(notification);
+         if (!acquisitionNotification)
+            return;
+
+         const auto acquisition = acquisitionNotification->getAcquisition();
+         {
+            boost::lock_guard<boost::mutex> lock(m_keywordsMutex);
+            if (m_keywords.find(acquisition->KeywordId()) == m_keywords.end())
+               return;
+         }
+
+         AcquisitionEvent event;
+         event.keywordId = acquisition->KeywordId();
+         event.value = acquisition->Value();
+         event.received = std::chrono::steady_clock::now();
+         m_eventHandler.postEvent(m_eventId, event);
+      }
+   } // namespace native
+} // namespace automation
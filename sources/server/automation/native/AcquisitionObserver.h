@@ -0,0 +1,60 @@
+#pragma once
+#include "notification/IObserver.h"
+#include <shared/event/EventHandler.hpp>
+#include <chrono>
+
+namespace automation
+{
+   namespace native
+   {
+      //-----------------------------------------------------
+      ///\brief A new acquisition of an observed keyword
+      //-----------------------------------------------------
+      struct AcquisitionEvent
+      {
+         int keywordId;
+         std::string value;
+
+         //-----------------------------------------------------
+         ///\brief               When acquisition was notified (to measure trigger latency)
+         //-----------------------------------------------------
+         std::chrono::steady_clock::time_point received;
+      };
+
+      //-----------------------------------------------------
+      ///\brief Observe acquisitions of a set of keywords, and post them to an event handler
+      ///
+      /// Unlike notification::acquisition::CObserver, the observed keywords can be changed
+      /// while the observer is subscribed (observe is called from the acquisitions threads).
+      //-----------------------------------------------------
+      class CAcquisitionObserver : public notification::IObserver
+      {
+      public:
+         //-----------------------------------------------------
+         ///\brief               Constructor
+         ///\param[in] eventHandler The event handler where to post AcquisitionEvent
+         ///\param[in] eventId   The event ID to use
+         //-----------------------------------------------------
+         CAcquisitionObserver(shared::event::CEventHandler& eventHandler,
+                              int eventId);
+         virtual ~CAcquisitionObserver();
+
+         //-----------------------------------------------------
+         ///\brief               Set the observed keywords
+         ///\param[in] keywords  The keywords (if empty, no keyword is observed)
+         //-----------------------------------------------------
+         void setKeywords(const std::set<int>& keywords);
+
+         // IObserver implementation
+         void observe(const boost::shared_ptr<notification::INotification> notification) override;
+         // [END] IObserver implementation
+
+      private:
+         shared::event::CEventHandler& m_eventHandler;
+         const int m_eventId;
+
+         mutable boost::mutex m_keywordsMutex;
+         std::set<int> m_keywords;
+      };
+   } // namespace native
+} // namespace automation
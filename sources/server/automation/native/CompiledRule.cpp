@@ -0,0 +1,141 @@
+#include "stdafx.h"
+#include "CompiledRule.h"
+#include <shared/exception/InvalidParameter.hpp>
+#include <shared/exception/OutOfRange.hpp>
+
+namespace automation
+{
+   namespace native
+   {
+      CCompiledRule::CCompiledRule(int ruleId,
+                                   const shared::CDataContainer& definition)
+         : m_ruleId(ruleId),
+           m_condition(definition.get<shared::CDataContainer>("condition")),
+           m_stableResult(false)
+      {
+         try
+         {
+            const auto debounce = definition.getWithDefault<double>("debounce", 0.0);
+            if (debounce < 0.0)
+               throw shared::exception::CInvalidParameter("Invalid rule definition, negative debounce");
+            m_debounce = boost::posix_time::milliseconds(static_cast<long>(debounce * 1000.0));
+
+            m_onTrue = parseActions(definition, "onTrue");
+            m_onFalse = parseActions(definition, "onFalse");
+         }
+         catch (shared::exception::COutOfRange& e)
+         {
+            throw shared::exception::CInvalidParameter(std::string("Invalid rule definition, ") + e.what());
+         }
+
+         if (m_onTrue.empty() && m_onFalse.empty())
+            throw shared::exception::CInvalidParameter("Invalid rule definition, no action");
+      }
+
+      CCompiledRule::~CCompiledRule()
+      {
+      }
+
+      std::vector<CCompiledRule::Action> CCompiledRule::parseActions(const shared::CDataContainer& definition,
+                                                                     const std::string& name)
+      {
+         std::vector<Action> actions;
+         if (!definition.exists(name))
+            return actions;
+
+         for (const auto& actionDefinition : definition.get<std::vector<shared::CDataContainer>>(name))
+         {
+            Action action;
+            action.keywordId = actionDefinition.get<int>("keyword");
+            action.value = actionDefinition.get<std::string>("value");
+            actions.push_back(action);
+         }
+         return actions;
+      }
+
+      int CCompiledRule::id() const
+      {
+         return m_ruleId;
+      }
+
+      std::set<int> CCompiledRule::keywords() const
+      {
+         auto keywords = m_condition.keywords();
+         for (const auto& action : m_onTrue)
+            keywords.insert(action.keywordId);
+         for (const auto& action : m_onFalse)
+            keywords.insert(action.keywordId);
+         return keywords;
+      }
+
+      const std::set<int>& CCompiledRule::observedKeywords() const
+      {
+         return m_condition.keywords();
+      }
+
+      void CCompiledRule::start(const std::map<int, std::string>& lastValues,
+                                const boost::posix_time::ptime& now)
+      {
+         for (const auto& lastValue : lastValues)
+            m_condition.setKeywordValue(lastValue.first, lastValue.second);
+         m_condition.setTime(now);
+
+         m_stableResult = m_condition.result();
+         m_pendingChange = boost::posix_time::not_a_date_time;
+         m_nextTimeChange = m_condition.nextTimeChange(now);
+         updateNextDeadline();
+      }
+
+      void CCompiledRule::onKeywordValue(int keywordId,
+                                         const std::string& value,
+                                         const boost::posix_time::ptime& now)
+      {
+         if (m_condition.setKeywordValue(keywordId, value))
+            onConditionUpdated(now);
+      }
+
+      std::vector<CCompiledRule::Action> CCompiledRule::process(const boost::posix_time::ptime& now)
+      {
+         if (!m_nextTimeChange.is_not_a_date_time() && m_nextTimeChange <= now)
+         {
+            if (m_condition.setTime(now))
+               onConditionUpdated(now);
+            m_nextTimeChange = m_condition.nextTimeChange(now);
+            updateNextDeadline();
+         }
+
+         if (m_pendingChange.is_not_a_date_time() || m_pendingChange > now)
+            return std::vector<Action>();
+
+         m_pendingChange = boost::posix_time::not_a_date_time;
+         m_stableResult = m_condition.result();
+         updateNextDeadline();
+         return m_stableResult ? m_onTrue : m_onFalse;
+      }
+
+      const boost::posix_time::ptime& CCompiledRule::nextDeadline() const
+      {
+         return m_nextDeadline;
+      }
+
+      void CCompiledRule::onConditionUpdated(const boost::posix_time::ptime& now)
+      {
+         if (m_condition.result() == m_stableResult)
+            m_pendingChange = boost::posix_time::not_a_date_time; // Bounced back before debounce delay
+         else if (m_pendingChange.is_not_a_date_time())
+            m_pendingChange = now + m_debounce;
+
+         updateNextDeadline();
+      }
+
+      void CCompiledRule::updateNextDeadline()
+      {
+         if (m_pendingChange.is_not_a_date_time())
+            m_nextDeadline = m_nextTimeChange;
+         else if (m_nextTimeChange.is_not_a_date_time())
+            m_nextDeadline = m_pendingChange;
+         else
+            m_nextDeadline = std::min(m_pendingChange, m_nextTimeChange);
+      }
+   } // namespace native
+} // namespace automation
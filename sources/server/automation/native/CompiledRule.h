@@ -0,0 +1,132 @@
+#pragma once
+#include "PredicateGraph.h"
+
+namespace automation
+{
+   namespace native
+   {
+      //-----------------------------------------------------
+      ///\brief A native rule, compiled from its declarative definition
+      ///
+      /// Definition format (stored as rule content) :
+      ///   {
+      ///      "condition" : { ... },                          see CPredicateGraph
+      ///      "debounce" : 30,                                optional, in seconds
+      ///      "onTrue" : [ { "keyword" : 15, "value" : "1" } ],
+      ///      "onFalse" : [ { "keyword" : 15, "value" : "0" } ]
+      ///   }
+      ///
+      /// Actions are edge-triggered : they are run when the condition result changes
+      /// and stays stable during the debounce delay. Nothing is run at rule start.
+      /// This class is not thread-safe, it is used by the engine thread only.
+      //-----------------------------------------------------
+      class CCompiledRule
+      {
+      public:
+         //-----------------------------------------------------
+         ///\brief               An action to run (a keyword command)
+         //-----------------------------------------------------
+         struct Action
+         {
+            int keywordId;
+            std::string value;
+         };
+
+         //-----------------------------------------------------
+         ///\brief               Constructor
+         ///\param[in] ruleId    The rule ID
+         ///\param[in] definition The rule definition
+         ///\throw shared::exception::CInvalidParameter if definition is invalid
+         //-----------------------------------------------------
+         CCompiledRule(int ruleId,
+                       const shared::CDataContainer& definition);
+         virtual ~CCompiledRule();
+
+         //-----------------------------------------------------
+         ///\brief               Get the rule ID
+         //-----------------------------------------------------
+         int id() const;
+
+         //-----------------------------------------------------
+         ///\brief               Get the keywords used by the rule (condition and actions)
+         //-----------------------------------------------------
+         std::set<int> keywords() const;
+
+         //-----------------------------------------------------
+         ///\brief               Get the keywords observed by the rule condition
+         //-----------------------------------------------------
+         const std::set<int>& observedKeywords() const;
+
+         //-----------------------------------------------------
+         ///\brief               Start the rule
+         ///\param[in] lastValues The last known values of the observed keywords
+         ///\param[in] now       The current time
+         //-----------------------------------------------------
+         void start(const std::map<int, std::string>& lastValues,
+                    const boost::posix_time::ptime& now);
+
+         //-----------------------------------------------------
+         ///\brief               Process a new value of an observed keyword
+         ///\param[in] keywordId The keyword ID
+         ///\param[in] value     The keyword value
+         ///\param[in] now       The current time
+         //-----------------------------------------------------
+         void onKeywordValue(int keywordId,
+                             const std::string& value,
+                             const boost::posix_time::ptime& now);
+
+         //-----------------------------------------------------
+         ///\brief               Process time events (time windows and debounce)
+         ///\param[in] now       The current time
+         ///\return              The actions to run now (empty if none)
+         //-----------------------------------------------------
+         std::vector<Action> process(const boost::posix_time::ptime& now);
+
+         //-----------------------------------------------------
+         ///\brief               Get the next time when the rule must be processed
+         ///\return              The next deadline, or not_a_date_time if none
+         //-----------------------------------------------------
+         const boost::posix_time::ptime& nextDeadline() const;
+
+      protected:
+         //-----------------------------------------------------
+         ///\brief               Parse a list of actions
+         ///\param[in] definition The rule definition
+         ///\param[in] name      The actions list name
+         //-----------------------------------------------------
+         static std::vector<Action> parseActions(const shared::CDataContainer& definition,
+                                                 const std::string& name);
+
+         //-----------------------------------------------------
+         ///\brief               Update the pending change after the condition result may have changed
+         ///\param[in] now       The current time
+         //-----------------------------------------------------
+         void onConditionUpdated(const boost::posix_time::ptime& now);
+
+         //-----------------------------------------------------
+         ///\brief               Compute the next deadline
+         //-----------------------------------------------------
+         void updateNextDeadline();
+
+      private:
+         const int m_ruleId;
+         CPredicateGraph m_condition;
+         boost::posix_time::time_duration m_debounce;
+         std::vector<Action> m_onTrue;
+         std::vector<Action> m_onFalse;
+
+         //-----------------------------------------------------
+         ///\brief               The condition result for which actions were run (or initial result)
+         //-----------------------------------------------------
+         bool m_stableResult;
+
+         //-----------------------------------------------------
+         ///\brief               The time when the pending result change will be stable (not_a_date_time if none)
+         //-----------------------------------------------------
+         boost::posix_time::ptime m_pendingChange;
+
+         boost::posix_time::ptime m_nextTimeChange;
+         boost::posix_time::ptime m_nextDeadline;
+      };
+   } // namespace native
+} // namespace automation
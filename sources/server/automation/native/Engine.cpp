@@ -0,0 +1,248 @@
+#include "stdafx.h"
+#include "Engine.h"
+#include <shared/exception/InvalidParameter.hpp>
+#include <shared/metrics/MetricsRegistry.h>
+#include <shared/currentTime/Provider.h>
+#include <shared/Log.h>
+
+namespace automation
+{
+   namespace native
+   {
+      const std::string CEngine::InterpreterName("yNative");
+
+      std::string CEngine::templateCode()
+      {
+         return "{\n"
+            "   \"condition\": {\n"
+            "      \"all\": [\n"
+            "         { \"keyword\": 0, \"above\": 25, \"hysteresis\": 0.5 },\n"
+            "         { \"between\": { \"from\": \"08:00\", \"to\": \"22:00\" } }\n"
+            "      ]\n"
+            "   },\n"
+            "   \"debounce\": 0,\n"
+            "   \"onTrue\": [ { \"keyword\": 0, \"value\": \"1\" } ],\n"
+            "   \"onFalse\": [ { \"keyword\": 0, \"value\": \"0\" } ]\n"
+            "}\n";
+      }
+
+      CEngine::CEngine(boost::shared_ptr<communication::ISendMessageAsync> pluginGateway,
+                       boost::shared_ptr<dataAccessLayer::IKeywordManager> keywordAccessLayer,
+                       boost::function2<void, int, const std::string&> onRuleStoppedFct)
+         : m_pluginGateway(pluginGateway),
+           m_keywordAccessLayer(keywordAccessLayer),
+           m_onRuleStoppedFct(onRuleStoppedFct),
+           m_acquisitionObserver(boost::make_shared<CAcquisitionObserver>(m_eventHandler, kAcquisition)),
+           m_acquisitionSubscriber(boost::make_shared<notification::CHelpers::CCustomSubscriber>(m_acquisitionObserver)),
+           m_triggerLatency(shared::metrics::CMetricsRegistry::instance().histogram("yadoms_native_rule_trigger_duration_seconds",
+                                                                                     "Time from acquisition notification to keyword commands sent, for native rules")),
+           m_thread(&CEngine::doWork, this)
+      {
+      }
+
+      CEngine::~CEngine()
+      {
+         m_acquisitionSubscriber.reset();
+         m_eventHandler.postEvent(kStopEngine);
+         m_thread.join();
+      }
+
+      void CEngine::startRule(boost::shared_ptr<const database::entities::CRule> ruleData,
+                              const boost::filesystem::path& logFile)
+      {
+         // Compile the rule in caller thread, so errors are reported to caller
+         RunningRule runningRule;
+         try
+         {
+            runningRule.rule = boost::make_shared<CCompiledRule>(ruleData->Id(),
+                                                                 shared::CDataContainer(ruleData->Content()));
+         }
+         catch (shared::exception::CInvalidParameter&)
+         {
+            throw;
+         }
+         catch (shared::exception::CException& e)
+         {
+            throw shared::exception::CInvalidParameter(std::string("Invalid rule definition, ") + e.what());
+         }
+
+         for (const auto keywordId : runningRule.rule->keywords())
+         {
+            if (!m_keywordAccessLayer->keywordExists(keywordId))
+               throw shared::exception::CInvalidParameter((boost::format("Invalid rule definition, keyword %1% not found") % keywordId).str());
+         }
+
+         boost::filesystem::create_directories(logFile.parent_path());
+         runningRule.log = boost::make_shared<std::ofstream>(logFile.string().c_str(), std::ios::out | std::ios::app);
+
+         m_eventHandler.postEvent(kStartRule, runningRule);
+      }
+
+      void CEngine::stopRule(int ruleId)
+      {
+         m_eventHandler.postEvent(kStopRule, ruleId);
+      }
+
+      void CEngine::doWork()
+      {
+         YADOMS_LOG_CONFIGURE("NativeRulesEngine");
+
+         while (true)
+         {
+            const auto event = m_eventHandler.waitForEvents(nextTimeout(shared::currentTime::Provider().now()));
+            try
+            {
+               switch (event)
+               {
+               case kStartRule:
+                  onStartRule(m_eventHandler.getEventData<RunningRule>());
+                  break;
+               case kStopRule:
+                  onStopRule(m_eventHandler.getEventData<int>());
+                  break;
+               case kAcquisition:
+                  onAcquisition(m_eventHandler.getEventData<AcquisitionEvent>());
+                  break;
+               case kStopEngine:
+                  return;
+               default:
+                  break;
+               }
+
+               processElapsedRules(shared::currentTime::Provider().now());
+            }
+            catch (std::exception& e)
+            {
+               YADOMS_LOG(error) << "Native rules engine, error processing event " << event << " : " << e.what();
+            }
+         }
+      }
+
+      void CEngine::onStartRule(const RunningRule& runningRule)
+      {
+         const auto ruleId = runningRule.rule->id();
+         m_rules[ruleId] = runningRule;
+
+         // Observe keywords before reading their last values, so no acquisition is missed
+         updateObservedKeywords();
+
+         std::map<int, std::string> lastValues;
+         for (const auto keywordId : runningRule.rule->observedKeywords())
+         {
+            const auto lastValue = m_keywordAccessLayer->getKeywordLastData(keywordId, false);
+            if (!lastValue.empty())
+               lastValues[keywordId] = lastValue;
+         }
+
+         const auto now = shared::currentTime::Provider().now();
+         m_rules[ruleId].rule->start(lastValues, now);
+         log(m_rules[ruleId], now, "Rule started");
+      }
+
+      void CEngine::onStopRule(int ruleId)
+      {
+         const auto runningRule = m_rules.find(ruleId);
+         if (runningRule != m_rules.end())
+         {
+            log(runningRule->second, shared::currentTime::Provider().now(), "Rule stopped");
+            m_rules.erase(runningRule);
+            updateObservedKeywords();
+         }
+
+         if (m_onRuleStoppedFct)
+            m_onRuleStoppedFct(ruleId, std::string());
+      }
+
+      void CEngine::onAcquisition(const AcquisitionEvent& acquisition)
+      {
+         const auto rules = m_keywordRules.find(acquisition.keywordId);
+         if (rules == m_keywordRules.end())
+            return;
+
+         const auto now = shared::currentTime::Provider().now();
+         auto triggered = false;
+         for (const auto ruleId : rules->second)
+         {
+            auto& runningRule = m_rules[ruleId];
+            runningRule.rule->onKeywordValue(acquisition.keywordId, acquisition.value, now);
+            if (processRule(runningRule, now))
+               triggered = true;
+         }
+
+         if (triggered && shared::metrics::CMetricsSwitch::enabled())
+            m_triggerLatency.record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - acquisition.received).count());
+      }
+
+      void CEngine::processElapsedRules(const boost::posix_time::ptime& now)
+      {
+         for (auto& runningRule : m_rules)
+         {
+            const auto& deadline = runningRule.second.rule->nextDeadline();
+            if (!deadline.is_not_a_date_time() && deadline <= now)
+               processRule(runningRule.second, now);
+         }
+      }
+
+      bool CEngine::processRule(RunningRule& runningRule,
+                                const boost::posix_time::ptime& now) const
+      {
+         const auto actions = runningRule.rule->process(now);
+         for (const auto& action : actions)
+         {
+            try
+            {
+               m_pluginGateway->sendKeywordCommandAsync(action.keywordId, action.value);
+               log(runningRule, now, (boost::format("Set keyword %1% to %2%") % action.keywordId % action.value).str());
+            }
+            catch (std::exception& e)
+            {
+               log(runningRule, now, (boost::format("Fail to set keyword %1% to %2% : %3%") % action.keywordId % action.value % e.what()).str());
+               YADOMS_LOG(warning) << "Native rule #" << runningRule.rule->id() << ", fail to set keyword " << action.keywordId << " : " << e.what();
+            }
+         }
+         return !actions.empty();
+      }
+
+      boost::posix_time::time_duration CEngine::nextTimeout(const boost::posix_time::ptime& now) const
+      {
+         boost::posix_time::ptime nextDeadline;
+         for (const auto& runningRule : m_rules)
+         {
+            const auto& deadline = runningRule.second.rule->nextDeadline();
+            if (!deadline.is_not_a_date_time() && (nextDeadline.is_not_a_date_time() || deadline < nextDeadline))
+               nextDeadline = deadline;
+         }
+
+         if (nextDeadline.is_not_a_date_time())
+            return boost::date_time::pos_infin;
+         if (nextDeadline <= now)
+            return boost::posix_time::time_duration(0, 0, 0);
+         return nextDeadline - now;
+      }
+
+      void CEngine::updateObservedKeywords()
+      {
+         m_keywordRules.clear();
+         std::set<int> keywords;
+         for (const auto& runningRule : m_rules)
+         {
+            for (const auto keywordId : runningRule.second.rule->observedKeywords())
+            {
+               m_keywordRules[keywordId].push_back(runningRule.first);
+               keywords.insert(keywordId);
+            }
+         }
+         m_acquisitionObserver->setKeywords(keywords);
+      }
+
+      void CEngine::log(RunningRule& runningRule,
+                        const boost::posix_time::ptime& now,
+                        const std::string& line)
+      {
+         if (!runningRule.log || !runningRule.log->is_open())
+            return;
+
+         *runningRule.log << boost::posix_time::to_simple_string(now) << " : " << line << std::endl;
+      }
+   } // namespace native
+} // namespace automation
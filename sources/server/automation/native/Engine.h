@@ -0,0 +1,139 @@
+#pragma once
+#include "IEngine.h"
+#include "CompiledRule.h"
+#include "AcquisitionObserver.h"
+#include "communication/ISendMessageAsync.h"
+#include "dataAccessLayer/IKeywordManager.h"
+#include "notification/Helpers.hpp"
+#include <shared/event/EventHandler.hpp>
+#include <shared/metrics/LatencyHistogram.h>
+
+namespace automation
+{
+   namespace native
+   {
+      //-----------------------------------------------------
+      ///\brief The native rules engine
+      ///
+      /// All native rules are run by one thread : acquisitions of the observed keywords are
+      /// posted to this thread, which updates only the rules using the keyword, and sends
+      /// the keyword commands of the triggered rules.
+      //-----------------------------------------------------
+      class CEngine : public IEngine
+      {
+      public:
+         //-----------------------------------------------------
+         ///\brief               Name of the native rules interpreter
+         //-----------------------------------------------------
+         static const std::string InterpreterName;
+
+         //-----------------------------------------------------
+         ///\brief               Get the template of a new rule
+         //-----------------------------------------------------
+         static std::string templateCode();
+
+         //-----------------------------------------------------
+         ///\brief               Constructor
+         ///\param[in] pluginGateway      The plugin gateway, to send keyword commands
+         ///\param[in] keywordAccessLayer The keyword access layer
+         ///\param[in] onRuleStoppedFct   Called when a rule is stopped (from engine thread)
+         //-----------------------------------------------------
+         CEngine(boost::shared_ptr<communication::ISendMessageAsync> pluginGateway,
+                 boost::shared_ptr<dataAccessLayer::IKeywordManager> keywordAccessLayer,
+                 boost::function2<void, int, const std::string&> onRuleStoppedFct);
+         virtual ~CEngine();
+
+         // IEngine Implementation
+         void startRule(boost::shared_ptr<const database::entities::CRule> ruleData,
+                        const boost::filesystem::path& logFile) override;
+         void stopRule(int ruleId) override;
+         // [END] IEngine Implementation
+
+      protected:
+         //-----------------------------------------------------
+         ///\brief               A running rule
+         //-----------------------------------------------------
+         struct RunningRule
+         {
+            boost::shared_ptr<CCompiledRule> rule;
+            boost::shared_ptr<std::ofstream> log;
+         };
+
+         //-----------------------------------------------------
+         ///\brief               Engine thread
+         //-----------------------------------------------------
+         void doWork();
+
+         //-----------------------------------------------------
+         ///\brief               Process events posted to the engine thread
+         //-----------------------------------------------------
+         void onStartRule(const RunningRule& runningRule);
+         void onStopRule(int ruleId);
+         void onAcquisition(const AcquisitionEvent& acquisition);
+
+         //-----------------------------------------------------
+         ///\brief               Process the rules which reached their deadline
+         ///\param[in] now       The current time
+         //-----------------------------------------------------
+         void processElapsedRules(const boost::posix_time::ptime& now);
+
+         //-----------------------------------------------------
+         ///\brief               Process a rule, and run its triggered actions
+         ///\param[in] runningRule The rule
+         ///\param[in] now       The current time
+         ///\return              true if actions were run
+         //-----------------------------------------------------
+         bool processRule(RunningRule& runningRule,
+                          const boost::posix_time::ptime& now) const;
+
+         //-----------------------------------------------------
+         ///\brief               Get the delay until next rule deadline
+         ///\param[in] now       The current time
+         ///\return              The delay, pos_infin if no deadline
+         //-----------------------------------------------------
+         boost::posix_time::time_duration nextTimeout(const boost::posix_time::ptime& now) const;
+
+         //-----------------------------------------------------
+         ///\brief               Update the keywords to observe, and the keyword to rules index
+         //-----------------------------------------------------
+         void updateObservedKeywords();
+
+         //-----------------------------------------------------
+         ///\brief               Write a line in rule log
+         //-----------------------------------------------------
+         static void log(RunningRule& runningRule,
+                         const boost::posix_time::ptime& now,
+                         const std::string& line);
+
+      private:
+         //-----------------------------------------------------
+         ///\brief               Engine thread events
+         //-----------------------------------------------------
+         enum
+         {
+            kStartRule = shared::event::kUserFirstId,
+            kStopRule,
+            kAcquisition,
+            kStopEngine
+         };
+
+         boost::shared_ptr<communication::ISendMessageAsync> m_pluginGateway;
+         boost::shared_ptr<dataAccessLayer::IKeywordManager> m_keywordAccessLayer;
+         boost::function2<void, int, const std::string&> m_onRuleStoppedFct;
+
+         shared::event::CEventHandler m_eventHandler;
+         boost::shared_ptr<CAcquisitionObserver> m_acquisitionObserver;
+         boost::shared_ptr<notification::CHelpers::CCustomSubscriber> m_acquisitionSubscriber;
+
+         //-----------------------------------------------------
+         ///\brief               Running rules, and observed keywords index (engine thread only)
+         //-----------------------------------------------------
+         std::map<int, RunningRule> m_rules;
+         std::map<int, std::vector<int>> m_keywordRules;
+
+         shared::metrics::CLatencyHistogram& m_triggerLatency;
+
+         boost::thread m_thread;
+      };
+   } // namespace native
+} // namespace automation
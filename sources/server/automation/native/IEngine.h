@@ -0,0 +1,41 @@
+#pragma once
+#include "database/entities/Entities.h"
+
+namespace automation
+{
+   namespace native
+   {
+      //-----------------------------------------------------
+      ///\brief The native rules engine
+      ///
+      /// Native rules are evaluated directly in Yadoms, on acquisition notifications,
+      /// without any interpreter process.
+      //-----------------------------------------------------
+      class IEngine
+      {
+      public:
+         //-----------------------------------------------------
+         ///\brief               Destructor
+         //-----------------------------------------------------
+         virtual ~IEngine()
+         {
+         }
+
+         //-----------------------------------------------------
+         ///\brief               Start a rule
+         ///\param[in] ruleData  The rule (definition is the rule content)
+         ///\param[in] logFile   The rule log file
+         ///\throw shared::exception::CInvalidParameter if rule definition is invalid
+         //-----------------------------------------------------
+         virtual void startRule(boost::shared_ptr<const database::entities::CRule> ruleData,
+                                const boost::filesystem::path& logFile) = 0;
+
+         //-----------------------------------------------------
+         ///\brief               Request to stop a rule
+         ///\param[in] ruleId    The rule ID
+         ///\note                The rule stopped callback is called when rule is stopped
+         //-----------------------------------------------------
+         virtual void stopRule(int ruleId) = 0;
+      };
+   } // namespace native
+} // namespace automation
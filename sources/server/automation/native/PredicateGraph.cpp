@@ -0,0 +1,271 @@
+#include "stdafx.h"
+#include "PredicateGraph.h"
+#include <shared/exception/InvalidParameter.hpp>
+#include <shared/exception/OutOfRange.hpp>
+#include <limits>
+
+namespace automation
+{
+   namespace native
+   {
+      const std::size_t CPredicateGraph::NoParent = std::numeric_limits<std::size_t>::max();
+
+      CPredicateGraph::CPredicateGraph(const shared::CDataContainer& condition)
+      {
+         try
+         {
+            compile(condition);
+         }
+         catch (shared::exception::COutOfRange& e)
+         {
+            throw shared::exception::CInvalidParameter(std::string("Invalid rule condition, ") + e.what());
+         }
+      }
+
+      CPredicateGraph::~CPredicateGraph()
+      {
+      }
+
+      const std::set<int>& CPredicateGraph::keywords() const
+      {
+         return m_keywords;
+      }
+
+      bool CPredicateGraph::dependsOnTime() const
+      {
+         return !m_timeLeaves.empty();
+      }
+
+      bool CPredicateGraph::result() const
+      {
+         return m_nodes.back().value;
+      }
+
+      std::size_t CPredicateGraph::compile(const shared::CDataContainer& condition)
+      {
+         Node node;
+         node.value = false;
+         node.parent = NoParent;
+         node.keywordId = 0;
+         node.threshold = 0.0;
+         node.hysteresis = 0.0;
+
+         if (condition.exists("all"))
+         {
+            node.type = kAll;
+            return compileGroup(node, condition.get<std::vector<shared::CDataContainer>>("all"));
+         }
+
+         if (condition.exists("any"))
+         {
+            node.type = kAny;
+            return compileGroup(node, condition.get<std::vector<shared::CDataContainer>>("any"));
+         }
+
+         if (condition.exists("not"))
+         {
+            node.type = kNot;
+            node.children.push_back(compile(condition.get<shared::CDataContainer>("not")));
+            node.value = !m_nodes[node.children[0]].value;
+            const auto index = addNode(node);
+            m_nodes[node.children[0]].parent = index;
+            return index;
+         }
+
+         if (condition.exists("between"))
+         {
+            node.type = kTimeWindow;
+            node.from = parseTimeOfDay(condition.get<std::string>("between.from"));
+            node.to = parseTimeOfDay(condition.get<std::string>("between.to"));
+            if (node.from == node.to)
+               throw shared::exception::CInvalidParameter("Invalid rule condition, empty time window");
+            const auto index = addNode(node);
+            m_timeLeaves.push_back(index);
+            return index;
+         }
+
+         if (!condition.exists("keyword"))
+            throw shared::exception::CInvalidParameter("Invalid rule condition, unknown operator : " + condition.serialize());
+
+         node.keywordId = condition.get<int>("keyword");
+         if (condition.exists("above"))
+         {
+            node.type = kAbove;
+            node.threshold = condition.get<double>("above");
+         }
+         else if (condition.exists("below"))
+         {
+            node.type = kBelow;
+            node.threshold = condition.get<double>("below");
+         }
+         else if (condition.exists("equals"))
+         {
+            node.type = kEquals;
+            node.expected = condition.get<std::string>("equals");
+         }
+         else
+         {
+            throw shared::exception::CInvalidParameter("Invalid rule condition, no operator for keyword " + std::to_string(node.keywordId));
+         }
+         node.hysteresis = condition.getWithDefault<double>("hysteresis", 0.0);
+         if (node.hysteresis < 0.0)
+            throw shared::exception::CInvalidParameter("Invalid rule condition, negative hysteresis for keyword " + std::to_string(node.keywordId));
+
+         const auto index = addNode(node);
+         m_keywords.insert(node.keywordId);
+         m_keywordLeaves[node.keywordId].push_back(index);
+         return index;
+      }
+
+      std::size_t CPredicateGraph::compileGroup(Node& node,
+                                                const std::vector<shared::CDataContainer>& children)
+      {
+         if (children.empty())
+            throw shared::exception::CInvalidParameter("Invalid rule condition, empty group");
+
+         for (const auto& child : children)
+            node.children.push_back(compile(child));
+
+         node.value = evaluateGroup(node);
+         const auto index = addNode(node);
+         for (const auto child : node.children)
+            m_nodes[child].parent = index;
+         return index;
+      }
+
+      std::size_t CPredicateGraph::addNode(const Node& node)
+      {
+         m_nodes.push_back(node);
+         return m_nodes.size() - 1;
+      }
+
+      bool CPredicateGraph::evaluateGroup(const Node& node) const
+      {
+         switch (node.type)
+         {
+         case kAll:
+            for (const auto child : node.children)
+               if (!m_nodes[child].value)
+                  return false;
+            return true;
+         case kAny:
+            for (const auto child : node.children)
+               if (m_nodes[child].value)
+                  return true;
+            return false;
+         case kNot:
+            return !m_nodes[node.children[0]].value;
+         default:
+            return node.value;
+         }
+      }
+
+      bool CPredicateGraph::setKeywordValue(int keywordId,
+                                            const std::string& value)
+      {
+         const auto leaves = m_keywordLeaves.find(keywordId);
+         if (leaves == m_keywordLeaves.end())
+            return false;
+
+         auto changed = false;
+         for (const auto leaf : leaves->second)
+         {
+            const auto& node = m_nodes[leaf];
+            auto leafValue = false;
+            if (node.type == kEquals)
+            {
+               leafValue = value == node.expected;
+            }
+            else
+            {
+               double number;
+               if (boost::conversion::try_lexical_convert(value, number))
+               {
+                  // Hysteresis : once true, the leaf stays true until value goes back beyond the threshold minus hysteresis
+                  if (node.type == kAbove)
+                     leafValue = node.value ? number > node.threshold - node.hysteresis : number > node.threshold;
+                  else
+                     leafValue = node.value ? number < node.threshold + node.hysteresis : number < node.threshold;
+               }
+            }
+
+            // Keyword can be used by several leaves, each one can toggle the root
+            if (setLeafValue(leaf, leafValue))
+               changed = !changed;
+         }
+         return changed;
+      }
+
+      bool CPredicateGraph::setTime(const boost::posix_time::ptime& now)
+      {
+         const auto timeOfDay = now.time_of_day();
+
+         auto changed = false;
+         for (const auto leaf : m_timeLeaves)
+         {
+            const auto& node = m_nodes[leaf];
+            const auto inWindow = node.from < node.to
+                                     ? timeOfDay >= node.from && timeOfDay < node.to
+                                     : timeOfDay >= node.from || timeOfDay < node.to;
+            if (setLeafValue(leaf, inWindow))
+               changed = !changed;
+         }
+         return changed;
+      }
+
+      bool CPredicateGraph::setLeafValue(std::size_t leaf,
+                                         bool value)
+      {
+         if (m_nodes[leaf].value == value)
+            return false;
+         m_nodes[leaf].value = value;
+
+         auto node = m_nodes[leaf].parent;
+         while (node != NoParent)
+         {
+            const auto nodeValue = evaluateGroup(m_nodes[node]);
+            if (nodeValue == m_nodes[node].value)
+               return false;
+            m_nodes[node].value = nodeValue;
+            node = m_nodes[node].parent;
+         }
+
+         // Change was propagated up to the root
+         return true;
+      }
+
+      boost::posix_time::ptime CPredicateGraph::nextTimeChange(const boost::posix_time::ptime& now) const
+      {
+         boost::posix_time::ptime next;
+         const boost::posix_time::ptime today(now.date());
+         for (const auto leaf : m_timeLeaves)
+         {
+            for (const auto& bound : {m_nodes[leaf].from, m_nodes[leaf].to})
+            {
+               auto change = today + bound;
+               if (change <= now)
+                  change += boost::gregorian::days(1);
+               if (next.is_not_a_date_time() || change < next)
+                  next = change;
+            }
+         }
+         return next;
+      }
+
+      boost::posix_time::time_duration CPredicateGraph::parseTimeOfDay(const std::string& timeOfDay)
+      {
+         std::vector<std::string> fields;
+         boost::split(fields, timeOfDay, boost::is_any_of(":"));
+
+         int hours, minutes, seconds = 0;
+         if ((fields.size() != 2 && fields.size() != 3) ||
+            !boost::conversion::try_lexical_convert(fields[0], hours) ||
+            !boost::conversion::try_lexical_convert(fields[1], minutes) ||
+            (fields.size() == 3 && !boost::conversion::try_lexical_convert(fields[2], seconds)) ||
+            hours < 0 || hours > 23 || minutes < 0 || minutes > 59 || seconds < 0 || seconds > 59)
+            throw shared::exception::CInvalidParameter("Invalid rule condition, invalid time of day : " + timeOfDay);
+
+         return boost::posix_time::hours(hours) + boost::posix_time::minutes(minutes) + boost::posix_time::seconds(seconds);
+      }
+   } // namespace native
+} // namespace automation
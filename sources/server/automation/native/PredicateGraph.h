@@ -0,0 +1,162 @@
+#pragma once
+#include <shared/DataContainer.h>
+
+namespace automation
+{
+   namespace native
+   {
+      //-----------------------------------------------------
+      ///\brief The compiled condition of a native rule
+      ///
+      /// The condition is compiled once in a flat graph of nodes (children before their parent,
+      /// root node last). When a keyword value or the time changes, only the leaves using it
+      /// are evaluated again, then the change is propagated to their parents, until a node
+      /// doesn't change.
+      ///
+      /// Supported condition nodes :
+      ///   - { "keyword" : 12, "above" : 21.5, "hysteresis" : 0.5 }
+      ///   - { "keyword" : 12, "below" : 18, "hysteresis" : 0.5 }
+      ///   - { "keyword" : 12, "equals" : "1" }
+      ///   - { "between" : { "from" : "08:00", "to" : "22:00" } }  (local time, can wrap midnight)
+      ///   - { "all" : [ ... ] }, { "any" : [ ... ] }, { "not" : { ... } }
+      ///
+      /// A keyword leaf is false until its keyword has a value.
+      //-----------------------------------------------------
+      class CPredicateGraph
+      {
+      public:
+         //-----------------------------------------------------
+         ///\brief               Constructor
+         ///\param[in] condition The condition to compile
+         ///\throw shared::exception::CInvalidParameter if condition is invalid
+         //-----------------------------------------------------
+         explicit CPredicateGraph(const shared::CDataContainer& condition);
+         virtual ~CPredicateGraph();
+
+         //-----------------------------------------------------
+         ///\brief               Get the keywords used by the condition
+         //-----------------------------------------------------
+         const std::set<int>& keywords() const;
+
+         //-----------------------------------------------------
+         ///\brief               Check if the condition depends on time
+         //-----------------------------------------------------
+         bool dependsOnTime() const;
+
+         //-----------------------------------------------------
+         ///\brief               Set a new value of a keyword
+         ///\param[in] keywordId The keyword ID
+         ///\param[in] value     The keyword value
+         ///\return              true if the condition result changed
+         //-----------------------------------------------------
+         bool setKeywordValue(int keywordId,
+                              const std::string& value);
+
+         //-----------------------------------------------------
+         ///\brief               Set the current time (local time)
+         ///\param[in] now       The current time
+         ///\return              true if the condition result changed
+         //-----------------------------------------------------
+         bool setTime(const boost::posix_time::ptime& now);
+
+         //-----------------------------------------------------
+         ///\brief               Get the condition result
+         //-----------------------------------------------------
+         bool result() const;
+
+         //-----------------------------------------------------
+         ///\brief               Get the next time when a time window opens or closes
+         ///\param[in] now       The current time
+         ///\return              The next time, or not_a_date_time if condition doesn't depend on time
+         //-----------------------------------------------------
+         boost::posix_time::ptime nextTimeChange(const boost::posix_time::ptime& now) const;
+
+      protected:
+         //-----------------------------------------------------
+         ///\brief               Node types
+         //-----------------------------------------------------
+         enum ENodeType
+         {
+            kAbove,
+            kBelow,
+            kEquals,
+            kTimeWindow,
+            kAll,
+            kAny,
+            kNot
+         };
+
+         //-----------------------------------------------------
+         ///\brief               A node of the graph
+         //-----------------------------------------------------
+         struct Node
+         {
+            ENodeType type;
+            bool value;
+            std::size_t parent;
+            std::vector<std::size_t> children;
+
+            // Keyword leaves
+            int keywordId;
+            double threshold;
+            double hysteresis;
+            std::string expected;
+
+            // Time window leaves
+            boost::posix_time::time_duration from;
+            boost::posix_time::time_duration to;
+         };
+
+         //-----------------------------------------------------
+         ///\brief               Compile a condition node (and its children)
+         ///\param[in] condition The condition node
+         ///\return              The index of the compiled node
+         //-----------------------------------------------------
+         std::size_t compile(const shared::CDataContainer& condition);
+
+         //-----------------------------------------------------
+         ///\brief               Compile the children of an "all" or "any" node
+         ///\param[in] node      The node
+         ///\param[in] children  The children conditions
+         ///\return              The index of the compiled node
+         //-----------------------------------------------------
+         std::size_t compileGroup(Node& node,
+                                  const std::vector<shared::CDataContainer>& children);
+
+         //-----------------------------------------------------
+         ///\brief               Add a node to the graph
+         ///\param[in] node      The node
+         ///\return              The index of the node
+         //-----------------------------------------------------
+         std::size_t addNode(const Node& node);
+
+         //-----------------------------------------------------
+         ///\brief               Evaluate a group node from its children values
+         ///\param[in] node      The node
+         //-----------------------------------------------------
+         bool evaluateGroup(const Node& node) const;
+
+         //-----------------------------------------------------
+         ///\brief               Set the value of a leaf, and propagate it to parents
+         ///\param[in] leaf      The leaf index
+         ///\param[in] value     The new leaf value
+         ///\return              true if the root value changed
+         //-----------------------------------------------------
+         bool setLeafValue(std::size_t leaf,
+                           bool value);
+
+         //-----------------------------------------------------
+         ///\brief               Parse a time of day ("HH:MM" or "HH:MM:SS")
+         //-----------------------------------------------------
+         static boost::posix_time::time_duration parseTimeOfDay(const std::string& timeOfDay);
+
+      private:
+         static const std::size_t NoParent;
+
+         std::vector<Node> m_nodes;
+         std::set<int> m_keywords;
+         std::map<int, std::vector<std::size_t>> m_keywordLeaves;
+         std::vector<std::size_t> m_timeLeaves;
+      };
+   } // namespace native
+} // namespace automation
@@ -0,0 +1,27 @@
+#include "stdafx.h"
+#include "Rule.h"
+
+namespace automation
+{
+   namespace native
+   {
+      CRule::CRule(boost::shared_ptr<const database::entities::CRule> ruleData,
+                   boost::shared_ptr<IEngine> engine,
+                   const boost::filesystem::path& logFile)
+         : m_ruleId(ruleData->Id()),
+           m_engine(engine)
+      {
+         m_engine->startRule(ruleData,
+                             logFile);
+      }
+
+      CRule::~CRule()
+      {
+      }
+
+      void CRule::requestStop()
+      {
+         m_engine->stopRule(m_ruleId);
+      }
+   } // namespace native
+} // namespace automation
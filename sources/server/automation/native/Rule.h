@@ -0,0 +1,36 @@
+#pragma once
+#include "../IRule.h"
+#include "IEngine.h"
+
+namespace automation
+{
+   namespace native
+   {
+      //-----------------------------------------------------
+      ///\brief A native rule, run by the native rules engine
+      //-----------------------------------------------------
+      class CRule : public IRule
+      {
+      public:
+         //-----------------------------------------------------
+         ///\brief               Constructor, start the rule
+         ///\param[in] ruleData  The rule
+         ///\param[in] engine    The native rules engine
+         ///\param[in] logFile   The rule log file
+         ///\throw shared::exception::CInvalidParameter if rule definition is invalid
+         //-----------------------------------------------------
+         CRule(boost::shared_ptr<const database::entities::CRule> ruleData,
+               boost::shared_ptr<IEngine> engine,
+               const boost::filesystem::path& logFile);
+         virtual ~CRule();
+
+         // IRule Implementation
+         void requestStop() override;
+         // [END] IRule Implementation
+
+      private:
+         const int m_ruleId;
+         boost::shared_ptr<IEngine> m_engine;
+      };
+   } // namespace native
+} // namespace automation
@@ -0,0 +1,81 @@
+#include "stdafx.h"
+#include "AcquisitionSubscription.h"
+#include "notification/acquisition/Observer.hpp"
+#include "notification/action/FunctionPointerAction.hpp"
+#include <shared/Log.h>
+
+namespace automation
+{
+   namespace script
+   {
+      CAcquisitionSubscription::CAcquisitionSubscription(const std::vector<int>& keywordIdList,
+                                                         std::size_t maxQueueSize)
+         : m_maxQueueSize(maxQueueSize),
+           m_droppedAcquisitions(0)
+      {
+         //create the action (= what to do when notification is observed)
+         auto action(boost::make_shared<notification::action::CFunctionPointerNotifier<notification::acquisition::CNotification>>(
+            boost::bind(&CAcquisitionSubscription::onAcquisition, this, _1)));
+
+         //create the acquisition observer
+         auto observer(boost::make_shared<notification::acquisition::CObserver>(action));
+         observer->resetKeywordIdFilter(keywordIdList);
+
+         //register the observer
+         m_subscriber = boost::make_shared<notification::CHelpers::CCustomSubscriber>(observer);
+      }
+
+      CAcquisitionSubscription::~CAcquisitionSubscription()
+      {
+         m_subscriber.reset();
+      }
+
+      void CAcquisitionSubscription::onAcquisition(boost::shared_ptr<notification::acquisition::CNotification> notification)
+      {
+         if (!notification)
+            return;
+
+         {
+            boost::lock_guard<boost::mutex> lock(m_queueMutex);
+            if (m_queue.size() >= m_maxQueueSize)
+            {
+               m_queue.pop_front();
+               ++m_droppedAcquisitions;
+            }
+            m_queue.push_back(std::make_pair(notification->getAcquisition()->KeywordId(),
+                                             notification->getAcquisition()->Value()));
+         }
+         m_queueCondition.notify_one();
+      }
+
+      std::vector<std::pair<int, std::string>> CAcquisitionSubscription::wait(const boost::posix_time::time_duration& timeout)
+      {
+         boost::unique_lock<boost::mutex> lock(m_queueMutex);
+
+         if (timeout.is_pos_infinity())
+         {
+            while (m_queue.empty())
+               m_queueCondition.wait(lock);
+         }
+         else
+         {
+            const auto deadline = boost::get_system_time() + timeout;
+            while (m_queue.empty())
+            {
+               if (!m_queueCondition.timed_wait(lock, deadline))
+                  return std::vector<std::pair<int, std::string>>(); // Timeout
+            }
+         }
+
+         if (m_droppedAcquisitions != 0)
+         {
+            YADOMS_LOG(warning) << "Acquisitions subscription : " << m_droppedAcquisitions << " acquisitions dropped (script too slow)";
+            m_droppedAcquisitions = 0;
+         }
+
+         std::vector<std::pair<int, std::string>> acquisitions(m_queue.begin(), m_queue.end());
+         m_queue.clear();
+         return acquisitions;
+      }
+   }
+} // namespace automation::script
@@ -0,0 +1,65 @@
+#pragma once
+#include "database/entities/Entities.h"
+#include "notification/acquisition/Notification.hpp"
+#include "notification/Helpers.hpp"
+
+namespace automation
+{
+   namespace script
+   {
+      //-----------------------------------------------------
+      ///\brief A persistent subscription to the acquisitions of a keyword list
+      ///
+      /// Acquisitions are queued from construction to destruction, so a script waiting
+      /// for acquisitions in a loop doesn't miss values arriving between two waits.
+      /// The queue is bounded : when full, oldest acquisitions are dropped.
+      //-----------------------------------------------------
+      class CAcquisitionSubscription
+      {
+      public:
+         //-----------------------------------------------------
+         ///\brief               Constructor
+         ///\param[in] keywordIdList The keyword IDs list to observe
+         ///\param[in] maxQueueSize The maximum number of pending acquisitions
+         //-----------------------------------------------------
+         CAcquisitionSubscription(const std::vector<int>& keywordIdList,
+                                  std::size_t maxQueueSize);
+
+         //-----------------------------------------------------
+         ///\brief               Destructor (unsubscribe)
+         //-----------------------------------------------------
+         virtual ~CAcquisitionSubscription();
+
+         //-----------------------------------------------------
+         ///\brief               Wait for acquisitions
+         ///\param[in] timeout   Timeout (pos_infin for no timeout)
+         ///\return              All pending acquisitions (keyword ID and value), empty if timeout
+         //-----------------------------------------------------
+         std::vector<std::pair<int, std::string>> wait(const boost::posix_time::time_duration& timeout);
+
+      protected:
+         //-----------------------------------------------------
+         ///\brief               Called (from notification center) on new acquisition
+         ///\param[in] notification The acquisition notification
+         //-----------------------------------------------------
+         void onAcquisition(boost::shared_ptr<notification::acquisition::CNotification> notification);
+
+      private:
+         const std::size_t m_maxQueueSize;
+
+         boost::mutex m_queueMutex;
+         boost::condition_variable m_queueCondition;
+         std::deque<std::pair<int, std::string>> m_queue;
+
+         //-----------------------------------------------------
+         ///\brief               Number of dropped acquisitions since last wait
+         //-----------------------------------------------------
+         std::size_t m_droppedAcquisitions;
+
+         //-----------------------------------------------------
+         ///\brief               The subscriber (declared last to unsubscribe first)
+         //-----------------------------------------------------
+         boost::shared_ptr<notification::CHelpers::CCustomSubscriber> m_subscriber;
+      };
+   }
+} // namespace automation::script
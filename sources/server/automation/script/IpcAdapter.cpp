@@ -127,16 +127,15 @@ namespace automation
             return;
          }
 
-         const auto pbMessageSize = pbMsg.ByteSize();
-         const auto serializedMessage = boost::make_shared<unsigned char[]>(pbMessageSize);
-         if (!pbMsg.SerializeWithCachedSizesToArray(serializedMessage.get()))
+         // Serialize in the reused send buffer (protected by m_sendMutex)
+         if (!m_sendBuffer.serialize(pbMsg))
          {
             YADOMS_LOG(error) << "CIpcAdapter::send : fail to serialize message ==> ignored";
             return;
          }
 
-         const auto cuttedMessage = m_messageCutter->cut(serializedMessage,
-                                                         pbMessageSize);
+         const auto cuttedMessage = m_messageCutter->cut(m_sendBuffer.data(),
+                                                         m_sendBuffer.size());
 
          if (!cuttedMessage->empty())
          {
@@ -187,10 +186,8 @@ namespace automation
          if (messageSize < 1)
             throw shared::exception::CInvalidParameter("messageSize");
 
-         // Unserialize message
-         script_IPC::toYadoms::msg toYadomsProtoBuffer;
-         if (!toYadomsProtoBuffer.ParseFromArray(message.get(), messageSize))
-            throw shared::exception::CInvalidParameter("message : fail to parse received data into protobuf format");
+         // Unserialize message (in the receive arena, the message is released when next one is received)
+         const auto& toYadomsProtoBuffer = m_receiveArena.parse<script_IPC::toYadoms::msg>(message.get(), messageSize);
 
          YADOMS_LOG(trace) << "[RECEIVE] message " << toYadomsProtoBuffer.OneOf_case() << (m_onReceiveHook ? " (onReceiveHook ENABLED)" : "");
 
@@ -229,6 +226,16 @@ namespace automation
             break;
          case script_IPC::toYadoms::msg::kGetKeywordDeviceName: processGetKeywordDeviceName(toYadomsProtoBuffer.getkeyworddevicename());
             break;
+         case script_IPC::toYadoms::msg::kReadKeywords: processReadKeywords(toYadomsProtoBuffer.readkeywords());
+            break;
+         case script_IPC::toYadoms::msg::kWriteKeywords: processWriteKeywords(toYadomsProtoBuffer.writekeywords());
+            break;
+         case script_IPC::toYadoms::msg::kSubscribeAcquisitions: processSubscribeAcquisitions(toYadomsProtoBuffer.subscribeacquisitions());
+            break;
+         case script_IPC::toYadoms::msg::kWaitForSubscribedAcquisitions: processWaitForSubscribedAcquisitions(toYadomsProtoBuffer.waitforsubscribedacquisitions());
+            break;
+         case script_IPC::toYadoms::msg::kUnsubscribeAcquisitions: processUnsubscribeAcquisitions(toYadomsProtoBuffer.unsubscribeacquisitions());
+            break;
          default:
             throw std::invalid_argument((boost::format("message : unknown message type %1%") % toYadomsProtoBuffer.OneOf_case()).str());
          }
@@ -287,6 +294,25 @@ namespace automation
          send(ans);
       }
 
+      void CIpcAdapter::processReadKeywords(const script_IPC::toYadoms::ReadKeywords& request)
+      {
+         script_IPC::toScript::msg ans;
+         auto answer = ans.mutable_readkeywords();
+         try
+         {
+            const std::vector<int> keywordIdList(request.keywordid().begin(), request.keywordid().end());
+            for (const auto& value : m_scriptApi->readKeywords(keywordIdList))
+               answer->add_values(value);
+         }
+         catch (std::exception& ex)
+         {
+            ans.set_error(ex.what());
+            std::cout << "Error processing processReadKeywords request : " << ex.what() << std::endl;
+         }
+
+         send(ans);
+      }
+
       void CIpcAdapter::processWaitForNextAcquisition(const script_IPC::toYadoms::WaitForNextAcquisition& request)
       {
          script_IPC::toScript::msg ans;
@@ -404,6 +430,82 @@ namespace automation
          send(ans);
       }
 
+      void CIpcAdapter::processWriteKeywords(const script_IPC::toYadoms::WriteKeywords& request)
+      {
+         script_IPC::toScript::msg ans;
+         ans.mutable_writekeywords();
+         try
+         {
+            std::vector<std::pair<int, std::string>> newStates;
+            for (const auto& keyword : request.keywords())
+               newStates.push_back(std::make_pair(keyword.keywordid(), keyword.newstate()));
+            m_scriptApi->writeKeywords(newStates);
+         }
+         catch (std::exception& ex)
+         {
+            ans.set_error(ex.what());
+            std::cout << "Error processing processWriteKeywords request : " << ex.what() << std::endl;
+         }
+
+         send(ans);
+      }
+
+      void CIpcAdapter::processSubscribeAcquisitions(const script_IPC::toYadoms::SubscribeAcquisitions& request)
+      {
+         script_IPC::toScript::msg ans;
+         ans.mutable_subscribeacquisitions();
+         try
+         {
+            const std::vector<int> keywordIdList(request.keywordid().begin(), request.keywordid().end());
+            m_scriptApi->subscribeAcquisitions(keywordIdList);
+         }
+         catch (std::exception& ex)
+         {
+            ans.set_error(ex.what());
+            std::cout << "Error processing processSubscribeAcquisitions request : " << ex.what() << std::endl;
+         }
+
+         send(ans);
+      }
+
+      void CIpcAdapter::processWaitForSubscribedAcquisitions(const script_IPC::toYadoms::WaitForSubscribedAcquisitions& request)
+      {
+         script_IPC::toScript::msg ans;
+         auto answer = ans.mutable_waitforsubscribedacquisitions();
+         try
+         {
+            for (const auto& acquisition : m_scriptApi->waitForSubscribedAcquisitions(request.timeout()))
+            {
+               answer->add_keywordid(acquisition.first);
+               answer->add_acquisition(acquisition.second);
+            }
+         }
+         catch (std::exception& ex)
+         {
+            ans.set_error(ex.what());
+            std::cout << "Error processing processWaitForSubscribedAcquisitions request : " << ex.what() << std::endl;
+         }
+
+         send(ans);
+      }
+
+      void CIpcAdapter::processUnsubscribeAcquisitions(const script_IPC::toYadoms::UnsubscribeAcquisitions& request)
+      {
+         script_IPC::toScript::msg ans;
+         ans.mutable_unsubscribeacquisitions();
+         try
+         {
+            m_scriptApi->unsubscribeAcquisitions();
+         }
+         catch (std::exception& ex)
+         {
+            ans.set_error(ex.what());
+            std::cout << "Error processing processUnsubscribeAcquisitions request : " << ex.what() << std::endl;
+         }
+
+         send(ans);
+      }
+
       void CIpcAdapter::processSendNotification(const script_IPC::toYadoms::SendNotification& request)
       {
          script_IPC::toScript::msg ans;
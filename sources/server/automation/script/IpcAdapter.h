@@ -5,6 +5,8 @@
 #include <script_IPC/yadomsToScript.pb.h>
 #include "YScriptApiImplementation.h"
 #include <shared/communication/IMessageCutter.h>
+#include "communication/ReceiveArena.hpp"
+#include "communication/SendBuffer.hpp"
 
 namespace automation
 {
@@ -69,10 +71,15 @@ namespace automation
          void processGetKeywordId(const script_IPC::toYadoms::GetKeywordId& request);
          void processGetRecipientId(const script_IPC::toYadoms::GetRecipientId& request);
          void processReadKeyword(const script_IPC::toYadoms::ReadKeyword& request);
+         void processReadKeywords(const script_IPC::toYadoms::ReadKeywords& request);
          void processWaitForNextAcquisition(const script_IPC::toYadoms::WaitForNextAcquisition& request);
          void processWaitForNextAcquisitions(const script_IPC::toYadoms::WaitForNextAcquisitions& request);
          void processWaitForEvent(const script_IPC::toYadoms::WaitForEvent& request);
          void processWriteKeyword(const script_IPC::toYadoms::WriteKeyword& request);
+         void processWriteKeywords(const script_IPC::toYadoms::WriteKeywords& request);
+         void processSubscribeAcquisitions(const script_IPC::toYadoms::SubscribeAcquisitions& request);
+         void processWaitForSubscribedAcquisitions(const script_IPC::toYadoms::WaitForSubscribedAcquisitions& request);
+         void processUnsubscribeAcquisitions(const script_IPC::toYadoms::UnsubscribeAcquisitions& request);
          void processSendNotification(const script_IPC::toYadoms::SendNotification& request);
          void processGetInfo(const script_IPC::toYadoms::GetInfo& requestueue);
          void processGetKeywordsByCapacity(const script_IPC::toYadoms::GetKeywordsByCapacity& request);
@@ -108,11 +115,21 @@ namespace automation
          //-----------------------------------------------------
          mutable boost::recursive_mutex m_sendMutex;
 
+         //-----------------------------------------------------
+         ///\brief               The buffer in which sent messages are serialized
+         //-----------------------------------------------------
+         communication::CSendBuffer m_sendBuffer;
+
          //-----------------------------------------------------
          ///\brief               The message cutter, to manage oversized messages
          //-----------------------------------------------------
          boost::shared_ptr<shared::communication::IMessageCutter> m_messageCutter;
 
+         //-----------------------------------------------------
+         ///\brief               The arena in which received messages are parsed (used only by the receiving thread)
+         //-----------------------------------------------------
+         communication::CReceiveArena m_receiveArena;
+
          boost::thread m_messageQueueReceiveThread;
 
          mutable boost::recursive_mutex m_onReceiveHookMutex;
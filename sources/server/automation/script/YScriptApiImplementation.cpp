@@ -10,6 +10,8 @@ namespace automation
 {
    namespace script
    {
+      const std::size_t CYScriptApiImplementation::MaxSubscribedAcquisitions(1000);
+
       CYScriptApiImplementation::CYScriptApiImplementation(boost::shared_ptr<communication::ISendMessageAsync> pluginGateway,
                                                            boost::shared_ptr<database::IAcquisitionRequester> dbAcquisitionRequester,
                                                            boost::shared_ptr<database::IDeviceRequester> dbDeviceRequester,
@@ -94,6 +96,18 @@ namespace automation
          return m_keywordAccessLayer->getKeywordLastData(keywordId);
       }
 
+      std::vector<std::string> CYScriptApiImplementation::readKeywords(const std::vector<int>& keywordIdList) const
+      {
+         for (const auto& kwId : keywordIdList)
+            assertExistingKeyword(kwId);
+
+         std::vector<std::string> values;
+         values.reserve(keywordIdList.size());
+         for (const auto& kwId : keywordIdList)
+            values.push_back(m_keywordAccessLayer->getKeywordLastData(kwId, false));
+         return values;
+      }
+
       boost::shared_ptr<notification::acquisition::CNotification> CYScriptApiImplementation::waitForAction(boost::shared_ptr<notification::action::CWaitAction<notification::acquisition::CNotification>> action,
                                                                                                            const std::string& timeout)
       {
@@ -326,6 +340,42 @@ namespace automation
          m_pluginGateway->sendKeywordCommandAsync(keywordId, newState);
       }
 
+      void CYScriptApiImplementation::writeKeywords(const std::vector<std::pair<int, std::string>>& newStates)
+      {
+         // Check all keywords before sending any command
+         for (const auto& newState : newStates)
+            assertExistingKeyword(newState.first);
+
+         for (const auto& newState : newStates)
+            m_pluginGateway->sendKeywordCommandAsync(newState.first, newState.second);
+      }
+
+      void CYScriptApiImplementation::subscribeAcquisitions(const std::vector<int>& keywordIdList)
+      {
+         for (const auto& kwId : keywordIdList)
+            assertExistingKeyword(kwId);
+
+         // Unsubscribe first, to not observe twice during replacement
+         m_acquisitionSubscription.reset();
+         m_acquisitionSubscription = boost::make_shared<CAcquisitionSubscription>(keywordIdList,
+                                                                                  MaxSubscribedAcquisitions);
+      }
+
+      std::vector<std::pair<int, std::string>> CYScriptApiImplementation::waitForSubscribedAcquisitions(const std::string& timeout)
+      {
+         if (!m_acquisitionSubscription)
+            throw std::out_of_range("waitForSubscribedAcquisitions : no acquisitions subscription, call subscribeAcquisitions first");
+
+         return m_acquisitionSubscription->wait(timeout.empty()
+                                                   ? boost::posix_time::time_duration(boost::posix_time::pos_infin)
+                                                   : boost::posix_time::duration_from_string(timeout));
+      }
+
+      void CYScriptApiImplementation::unsubscribeAcquisitions()
+      {
+         m_acquisitionSubscription.reset();
+      }
+
       void CYScriptApiImplementation::sendNotification(int keywordId, int recipientId, const std::string& message)
       {
          assertExistingKeyword(keywordId);
@@ -8,6 +8,7 @@
 #include "notification/action/WaitAction.hpp"
 #include "notification/acquisition/Notification.hpp"
 #include "dataAccessLayer/IKeywordManager.h"
+#include "AcquisitionSubscription.h"
 
 namespace automation
 {
@@ -46,6 +47,7 @@ namespace automation
          int getRecipientId(const std::string& firstName,
                             const std::string& lastName) const override;
          std::string readKeyword(int keywordId) const override;
+         std::vector<std::string> readKeywords(const std::vector<int>& keywordIdList) const override;
          std::string waitForNextAcquisition(int keywordId,
                                             const std::string& timeout = std::string()) const override;
          std::pair<int, std::string> waitForNextAcquisitions(const std::vector<int>& keywordIdList,
@@ -56,6 +58,10 @@ namespace automation
          std::vector<int> getKeywordsByCapacity(const std::string& capacity) const override;
          void writeKeyword(int keywordId,
                            const std::string& newState) override;
+         void writeKeywords(const std::vector<std::pair<int, std::string>>& newStates) override;
+         void subscribeAcquisitions(const std::vector<int>& keywordIdList) override;
+         std::vector<std::pair<int, std::string>> waitForSubscribedAcquisitions(const std::string& timeout = std::string()) override;
+         void unsubscribeAcquisitions() override;
          void sendNotification(int keywordId,
                                int recipientId, const std::string& message) override;
          std::string getInfo(EInfoKeys key) const override;
@@ -97,6 +103,11 @@ namespace automation
                                                       boost::posix_time::time_duration& timeoutDuration);
 
       private:
+         //-----------------------------------------------------
+         ///\brief               Maximum number of pending acquisitions in the acquisitions subscription
+         //-----------------------------------------------------
+         static const std::size_t MaxSubscribedAcquisitions;
+
          //-----------------------------------------------------
          ///\brief               The plugin access (to send commands to plugins)
          //-----------------------------------------------------
@@ -126,6 +137,11 @@ namespace automation
          ///\brief               General information requester
          //-----------------------------------------------------
          boost::shared_ptr<IGeneralInfo> m_generalInfo;
+
+         //-----------------------------------------------------
+         ///\brief               The acquisitions subscription (null if not subscribed)
+         //-----------------------------------------------------
+         boost::shared_ptr<CAcquisitionSubscription> m_acquisitionSubscription;
       };
    }
 } // namespace automation::script
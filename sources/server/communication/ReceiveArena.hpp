@@ -0,0 +1,81 @@
+#pragma once
+#include <google/protobuf/arena.h>
+#include <shared/exception/InvalidParameter.hpp>
+
+namespace communication
+{
+   //----------------------------------------------
+   ///\brief Arena in which the messages received by an IPC adapter are parsed
+   ///
+   /// The arena memory is kept between messages : parsing a message only releases the
+   /// previous one, so a receive loop doesn't allocate for messages up to the initial block size.
+   /// Not thread-safe : to be used only by the receiving thread.
+   //----------------------------------------------
+   class CReceiveArena
+   {
+   public:
+      //----------------------------------------------
+      ///\brief                     Constructor
+      ///\param [in] blockSize      Size of the memory block kept between messages
+      //----------------------------------------------
+      explicit CReceiveArena(size_t blockSize = 64 * 1024)
+         : m_block(new char[blockSize]),
+           m_arena(arenaOptions(m_block.get(), blockSize))
+      {
+      }
+
+      //----------------------------------------------
+      ///\brief Destructor
+      //----------------------------------------------
+      virtual ~CReceiveArena()
+      {
+      }
+
+      //----------------------------------------------
+      ///\brief                     Parse a message (the previously parsed message is released)
+      ///\param [in] message        The serialized message
+      ///\param [in] messageSize    The serialized message size
+      ///\return                    The message, valid until next call
+      ///\throw shared::exception::CInvalidParameter if message can not be parsed
+      ///\template TMessage         The Protobuf message type
+      //----------------------------------------------
+      template <class TMessage>
+      const TMessage& parse(const unsigned char* message, size_t messageSize)
+      {
+         m_arena.Reset();
+
+         auto parsedMessage = google::protobuf::Arena::CreateMessage<TMessage>(&m_arena);
+         if (!parsedMessage->ParseFromArray(message, static_cast<int>(messageSize)))
+            throw shared::exception::CInvalidParameter("message : fail to parse received data into protobuf format");
+         return *parsedMessage;
+      }
+
+      //----------------------------------------------
+      ///\brief                     Get the memory allocated by the arena (initial block included)
+      ///\return                    The allocated size, in bytes
+      //----------------------------------------------
+      size_t spaceAllocated() const
+      {
+         return static_cast<size_t>(m_arena.SpaceAllocated());
+      }
+
+   private:
+      static google::protobuf::ArenaOptions arenaOptions(char* block, size_t blockSize)
+      {
+         google::protobuf::ArenaOptions options;
+         options.initial_block = block;
+         options.initial_block_size = blockSize;
+         return options;
+      }
+
+      //----------------------------------------------
+      ///\brief The memory block kept between messages (must outlive the arena)
+      //----------------------------------------------
+      boost::scoped_array<char> m_block;
+
+      //----------------------------------------------
+      ///\brief The arena
+      //----------------------------------------------
+      google::protobuf::Arena m_arena;
+   };
+} // namespace communication
@@ -0,0 +1,72 @@
+#pragma once
+
+namespace communication
+{
+   //----------------------------------------------
+   ///\brief Buffer in which the messages sent by an IPC adapter are serialized
+   ///
+   /// The buffer grows up to the biggest sent message and is kept, so sending a message
+   /// doesn't allocate a new serialization buffer.
+   /// Not thread-safe : to be protected by the send mutex.
+   //----------------------------------------------
+   class CSendBuffer
+   {
+   public:
+      //----------------------------------------------
+      ///\brief Constructor
+      //----------------------------------------------
+      CSendBuffer()
+         : m_capacity(0),
+           m_size(0)
+      {
+      }
+
+      //----------------------------------------------
+      ///\brief Destructor
+      //----------------------------------------------
+      virtual ~CSendBuffer()
+      {
+      }
+
+      //----------------------------------------------
+      ///\brief                     Serialize a message
+      ///\param [in] message        The Protobuf message
+      ///\return                    false if serialization failed
+      ///\template TMessage         The Protobuf message type
+      //----------------------------------------------
+      template <class TMessage>
+      bool serialize(const TMessage& message)
+      {
+         m_size = static_cast<size_t>(message.ByteSize());
+         if (!m_buffer || m_size > m_capacity)
+         {
+            m_buffer = boost::make_shared<unsigned char[]>(m_size);
+            m_capacity = m_size;
+         }
+
+         return message.SerializeWithCachedSizesToArray(m_buffer.get()) != nullptr;
+      }
+
+      //----------------------------------------------
+      ///\brief                     Get the serialized message
+      ///\return                    The buffer (valid until next serialization)
+      //----------------------------------------------
+      boost::shared_ptr<unsigned char[]> data() const
+      {
+         return m_buffer;
+      }
+
+      //----------------------------------------------
+      ///\brief                     Get the serialized message size
+      //----------------------------------------------
+      size_t size() const
+      {
+         return m_size;
+      }
+
+   private:
+      boost::shared_ptr<unsigned char[]> m_buffer;
+      size_t m_capacity;
+      size_t m_size;
+   };
+} // namespace communication
@@ -6,9 +6,19 @@
 #include "notification/acquisition/Notification.hpp"
 #include "notification/summary/Notification.hpp"
 #include "notification/Helpers.hpp"
+#include <shared/metrics/MetricsRegistry.h>
+#include <shared/metrics/ScopedLatency.h>
 
 namespace dataAccessLayer
 {
+   namespace
+   {
+      const std::string SaveDataLatencyName("yadoms_acquisition_save_duration_seconds");
+      const std::string SaveDataLatencyHelp("Time to historize data (transaction included), by call kind");
+      const std::string SavedAcquisitionsName("yadoms_acquisitions_saved_total");
+      const std::string SavedAcquisitionsHelp("Number of historized acquisitions");
+   }
+
 	CAcquisitionHistorizer::CAcquisitionHistorizer(boost::shared_ptr<database::IDataProvider> dataProvider)
 		:m_dataProvider(dataProvider)
 	{
@@ -16,12 +26,16 @@ namespace dataAccessLayer
 
 	void CAcquisitionHistorizer::saveData(int keywordId, const shared::plugin::yPluginApi::historization::IHistorizable & data)
 	{
+	   static auto& SaveDataLatency = shared::metrics::CMetricsRegistry::instance().histogram(SaveDataLatencyName, SaveDataLatencyHelp, {{"kind", "single"}});
+	   shared::metrics::CScopedLatency latency(SaveDataLatency);
+
 		//use ptime as variable, because saveData needs a reference
 	   auto currentDate = shared::currentTime::Provider().now();
 
 		//get current transactional engine
 	   auto transactionalEngine = m_dataProvider->getTransactionalEngine();
 
+	   std::vector<SavedAcquisition> savedAcquisitions;
 		try
 		{
 			//if possible create transaction
@@ -29,7 +43,7 @@ namespace dataAccessLayer
 				transactionalEngine->transactionBegin();
 
 			//save data
-			saveData(keywordId, data, currentDate);
+			saveData(keywordId, data, currentDate, savedAcquisitions);
 
 			//if possible commit transaction
 			if (transactionalEngine)
@@ -42,26 +56,51 @@ namespace dataAccessLayer
 				transactionalEngine->transactionRollback();
 			throw; // rethrow exception, catch is just here to handle transaction
 		}
+
+	   postNotifications(savedAcquisitions);
 	}
 
 	void CAcquisitionHistorizer::saveData(std::vector<int> keywordIdVect, const std::vector<boost::shared_ptr<const shared::plugin::yPluginApi::historization::IHistorizable> > & dataVect)
 	{
+	   static auto& SaveDataLatency = shared::metrics::CMetricsRegistry::instance().histogram(SaveDataLatencyName, SaveDataLatencyHelp, {{"kind", "batch"}});
+	   shared::metrics::CScopedLatency latency(SaveDataLatency);
+
 		//use ptime as variable, because saveData needs a reference
 	   auto currentDate = shared::currentTime::Provider().now();
 
 		//get current transactional engine
 	   auto transactionalEngine = m_dataProvider->getTransactionalEngine();
 
+	   std::vector<SavedAcquisition> savedAcquisitions;
 		try
 		{
 			//if possible create transaction
 			if (transactionalEngine)
 				transactionalEngine->transactionBegin();
 
-			//save all data
+			//save all data : increments one by one, other data all at once
+			std::vector<int> bulkKeywordIds;
+			std::vector<std::string> bulkData;
 			for (unsigned int keywordIdCount = 0; keywordIdCount < keywordIdVect.size(); ++keywordIdCount)
 			{
-				saveData(keywordIdVect[keywordIdCount], *dataVect[keywordIdCount], currentDate);
+				if (dataVect[keywordIdCount]->getMeasureType() == shared::plugin::yPluginApi::historization::EMeasureType::kIncrement)
+				{
+					saveData(keywordIdVect[keywordIdCount], *dataVect[keywordIdCount], currentDate, savedAcquisitions);
+				}
+				else
+				{
+					bulkKeywordIds.push_back(keywordIdVect[keywordIdCount]);
+					bulkData.push_back(dataVect[keywordIdCount]->formatValue());
+				}
+			}
+
+			if (!bulkKeywordIds.empty())
+			{
+			   static auto& SavedAcquisitions = shared::metrics::CMetricsRegistry::instance().counter(SavedAcquisitionsName, SavedAcquisitionsHelp);
+			   SavedAcquisitions.increment(bulkKeywordIds.size());
+
+				for (const auto& acq : m_dataProvider->getAcquisitionRequester()->saveData(bulkKeywordIds, bulkData, currentDate))
+					savedAcquisitions.push_back(onAcquisitionSaved(acq, currentDate));
 			}
 
 			//if possible commit transaction
@@ -75,10 +114,23 @@ namespace dataAccessLayer
 				transactionalEngine->transactionRollback();
 			throw; // rethrow exception, catch is just here to handle transaction
 		}
+
+	   postNotifications(savedAcquisitions);
 	}
 
 	void CAcquisitionHistorizer::saveData(int keywordId, const shared::plugin::yPluginApi::historization::IHistorizable & data, boost::posix_time::ptime & dataTime)
 	{
+	   std::vector<SavedAcquisition> savedAcquisitions;
+	   saveData(keywordId, data, dataTime, savedAcquisitions);
+	   postNotifications(savedAcquisitions);
+	}
+
+	void CAcquisitionHistorizer::saveData(int keywordId, const shared::plugin::yPluginApi::historization::IHistorizable & data, boost::posix_time::ptime & dataTime,
+	                                      std::vector<SavedAcquisition>& savedAcquisitions)
+	{
+	   static auto& SavedAcquisitions = shared::metrics::CMetricsRegistry::instance().counter(SavedAcquisitionsName, SavedAcquisitionsHelp);
+	   SavedAcquisitions.increment();
+
 		boost::shared_ptr<database::entities::CAcquisition> acq;
 
 		//save data
@@ -88,28 +140,41 @@ namespace dataAccessLayer
 			acq = m_dataProvider->getAcquisitionRequester()->saveData(keywordId, data.formatValue(), dataTime);
 
       if (acq)
+         savedAcquisitions.push_back(onAcquisitionSaved(acq, dataTime));
+	}
+
+	CAcquisitionHistorizer::SavedAcquisition CAcquisitionHistorizer::onAcquisitionSaved(boost::shared_ptr<database::entities::CAcquisition> acq, boost::posix_time::ptime& dataTime)
+	{
+	   const auto keywordId = acq->KeywordId();
+
+      //only update summary data if already exists
+      //if not exists it will be created by SQLiteSummaryDataTask
+      SavedAcquisition savedAcquisition;
+      savedAcquisition.acquisition = acq;
+      auto& acquisitionSummary = savedAcquisition.summaries;
+
+      if (m_dataProvider->getAcquisitionRequester()->summaryDataExists(keywordId, database::entities::EAcquisitionSummaryType::kHour, dataTime))
+         acquisitionSummary.push_back(m_dataProvider->getAcquisitionRequester()->saveSummaryData(keywordId, database::entities::EAcquisitionSummaryType::kHour, dataTime));
+      if (m_dataProvider->getAcquisitionRequester()->summaryDataExists(keywordId, database::entities::EAcquisitionSummaryType::kDay, dataTime))
+         acquisitionSummary.push_back(m_dataProvider->getAcquisitionRequester()->saveSummaryData(keywordId, database::entities::EAcquisitionSummaryType::kDay, dataTime));
+      if (m_dataProvider->getAcquisitionRequester()->summaryDataExists(keywordId, database::entities::EAcquisitionSummaryType::kMonth, dataTime))
+         acquisitionSummary.push_back(m_dataProvider->getAcquisitionRequester()->saveSummaryData(keywordId, database::entities::EAcquisitionSummaryType::kMonth, dataTime));
+      if (m_dataProvider->getAcquisitionRequester()->summaryDataExists(keywordId, database::entities::EAcquisitionSummaryType::kYear, dataTime))
+         acquisitionSummary.push_back(m_dataProvider->getAcquisitionRequester()->saveSummaryData(keywordId, database::entities::EAcquisitionSummaryType::kYear, dataTime));
+
+      return savedAcquisition;
+	}
+
+	void CAcquisitionHistorizer::postNotifications(const std::vector<SavedAcquisition>& savedAcquisitions)
+	{
+      for (const auto& savedAcquisition : savedAcquisitions)
       {
-         //only update summary data if already exists
-         //if not exists it will be created by SQLiteSummaryDataTask
-         std::vector< boost::shared_ptr<database::entities::CAcquisitionSummary> > acquisitionSummary;
-
-         if (m_dataProvider->getAcquisitionRequester()->summaryDataExists(keywordId, database::entities::EAcquisitionSummaryType::kHour, dataTime))
-            acquisitionSummary.push_back(m_dataProvider->getAcquisitionRequester()->saveSummaryData(keywordId, database::entities::EAcquisitionSummaryType::kHour, dataTime));
-         if (m_dataProvider->getAcquisitionRequester()->summaryDataExists(keywordId, database::entities::EAcquisitionSummaryType::kDay, dataTime))
-            acquisitionSummary.push_back(m_dataProvider->getAcquisitionRequester()->saveSummaryData(keywordId, database::entities::EAcquisitionSummaryType::kDay, dataTime));
-         if (m_dataProvider->getAcquisitionRequester()->summaryDataExists(keywordId, database::entities::EAcquisitionSummaryType::kMonth, dataTime))
-            acquisitionSummary.push_back(m_dataProvider->getAcquisitionRequester()->saveSummaryData(keywordId, database::entities::EAcquisitionSummaryType::kMonth, dataTime));
-         if (m_dataProvider->getAcquisitionRequester()->summaryDataExists(keywordId, database::entities::EAcquisitionSummaryType::kYear, dataTime))
-            acquisitionSummary.push_back(m_dataProvider->getAcquisitionRequester()->saveSummaryData(keywordId, database::entities::EAcquisitionSummaryType::kYear, dataTime));
-
-         //post notification
-
-         //post notification
-         auto notificationData = boost::make_shared<notification::acquisition::CNotification>(acq);
+         auto notificationData = boost::make_shared<notification::acquisition::CNotification>(savedAcquisition.acquisition);
          notification::CHelpers::postNotification(notificationData);
 
-         if (!acquisitionSummary.empty())
+         if (!savedAcquisition.summaries.empty())
          {
+            auto acquisitionSummary = savedAcquisition.summaries;
             auto notificationDataSummary = boost::make_shared<notification::summary::CNotification>(acquisitionSummary);
             notification::CHelpers::postNotification(notificationDataSummary);
          }
@@ -15,6 +15,39 @@ namespace dataAccessLayer
       void saveData(int keywordId, const shared::plugin::yPluginApi::historization::IHistorizable & data, boost::posix_time::ptime & dataTime) override;
 
    private:
+      //--------------------------------------------------------------
+      /// \brief           A saved acquisition, with its updated summary data (to notify)
+      //--------------------------------------------------------------
+      struct SavedAcquisition
+      {
+         boost::shared_ptr<database::entities::CAcquisition> acquisition;
+         std::vector<boost::shared_ptr<database::entities::CAcquisitionSummary>> summaries;
+      };
+
+      //--------------------------------------------------------------
+      /// \brief           Save a data, without notifying it
+      /// \param [in]      keywordId            The keyword id
+      /// \param [in]      data                 The data
+      /// \param [in]      dataTime             The datetime of the data
+      /// \param [in,out]  savedAcquisitions    The saved acquisitions, to notify
+      //--------------------------------------------------------------
+      void saveData(int keywordId, const shared::plugin::yPluginApi::historization::IHistorizable & data, boost::posix_time::ptime & dataTime,
+                    std::vector<SavedAcquisition>& savedAcquisitions);
+
+      //--------------------------------------------------------------
+      /// \brief           Update existing summary data of a saved acquisition
+      /// \param [in]      acq         The saved acquisition
+      /// \param [in]      dataTime    The datetime of the data
+      /// \return          The saved acquisition, with its updated summary data
+      //--------------------------------------------------------------
+      SavedAcquisition onAcquisitionSaved(boost::shared_ptr<database::entities::CAcquisition> acq, boost::posix_time::ptime& dataTime);
+
+      //--------------------------------------------------------------
+      /// \brief           Notify the saved acquisitions (once committed : a rollback must not be seen by observers)
+      /// \param [in]      savedAcquisitions    The saved acquisitions
+      //--------------------------------------------------------------
+      static void postNotifications(const std::vector<SavedAcquisition>& savedAcquisitions);
+
       boost::shared_ptr<database::IDataProvider> m_dataProvider;
    };
  
@@ -151,11 +151,17 @@ namespace dataAccessLayer
 
       stateKeywords = m_keywordRequester->getDeviceKeywordsWithCapacity(deviceId, ds.getCapacity().getName(), shared::plugin::yPluginApi::EKeywordAccessMode::kGet);
       for (auto i = stateKeywords.begin(); i != stateKeywords.end(); ++i)
+      {
          m_acquisitionRequester->saveData((*i)->Id, ds.formatValue(), currentDate);
+         m_keywordManager->onLastValueChanged((*i)->Id);
+      }
 
       stateMessageKeywords = m_keywordRequester->getDeviceKeywordsWithCapacity(deviceId, dsm.getCapacity().getName(), shared::plugin::yPluginApi::EKeywordAccessMode::kGet);
       for (auto i = stateMessageKeywords.begin(); i != stateMessageKeywords.end(); ++i)
+      {
          m_acquisitionRequester->saveData((*i)->Id, dsm.formatValue(), currentDate);
+         m_keywordManager->onLastValueChanged((*i)->Id);
+      }
    }
 
    void CDeviceManager::removeDevice(int deviceId)
@@ -189,6 +195,9 @@ namespace dataAccessLayer
    {
       auto keywords = m_keywordRequester->getKeywords(deviceId);
       for (auto keyword = keywords.begin(); keyword != keywords.end(); ++keyword)
+      {
          m_acquisitionRequester->removeKeywordData((*keyword)->Id);
+         m_keywordManager->onLastValueChanged((*keyword)->Id);
+      }
    }
 } //namespace dataAccessLayer 
\ No newline at end of file
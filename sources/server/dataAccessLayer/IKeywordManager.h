@@ -66,6 +66,19 @@ namespace dataAccessLayer
       //--------------------------------------------------------------
       virtual std::vector<boost::shared_ptr<database::entities::CKeyword>> getKeywords(int deviceId) const = 0;
 
+      //--------------------------------------------------------------
+      /// \brief           List all keywords, serialized without building entities
+      /// \return          The keywords as a JSON array
+      //--------------------------------------------------------------
+      virtual std::string getAllKeywordsAsJson() const = 0;
+
+      //--------------------------------------------------------------
+      /// \brief           List all keywords for a device, serialized without building entities
+      /// \param [in]      deviceId   the device which own the keyword
+      /// \return          The keywords as a JSON array
+      //--------------------------------------------------------------
+      virtual std::string getKeywordsAsJson(int deviceId) const = 0;
+
       //--------------------------------------------------------------
       /// \brief           List all keywords which match a capacity
       /// \param [in]      capacity   the capacity
@@ -104,6 +117,19 @@ namespace dataAccessLayer
       virtual std::string getKeywordLastData(const int keywordId,
                                              bool throwIfNotExists = true) = 0;
 
+      //-----------------------------------------
+      ///\brief      Get the last acquisitions of several keywords, all read at the same time
+      ///\param [in] keywordIds  The keywords ids
+      ///\return     the last acquisition of each existing keyword (keywords which don't exist are not in result)
+      //-----------------------------------------
+      virtual std::map<int, boost::shared_ptr<database::entities::CAcquisition>> getKeywordsLastAcquisition(const std::vector<int>& keywordIds) = 0;
+
+      //-----------------------------------------
+      ///\brief      Notify that the last value of a keyword was changed out of the acquisitions historization
+      ///\param [in] keywordId  The keyword id
+      //-----------------------------------------
+      virtual void onLastValueChanged(int keywordId) = 0;
+
       //--------------------------------------------------------------
       /// \brief                    Add new keyword
       /// \param [in] deviceId      ID of device owner
@@ -9,7 +9,8 @@ namespace dataAccessLayer
 {
    CKeywordManager::CKeywordManager(boost::shared_ptr<database::IDataProvider> dataProvider)
       : m_dataProvider(dataProvider),
-        m_keywordRequester(dataProvider->getKeywordRequester())
+        m_keywordRequester(dataProvider->getKeywordRequester()),
+        m_lastValues(m_keywordRequester)
    {
    }
 
@@ -68,6 +69,16 @@ namespace dataAccessLayer
       return m_keywordRequester->getKeywords(deviceId);
    }
 
+   std::string CKeywordManager::getAllKeywordsAsJson() const
+   {
+      return m_keywordRequester->getAllKeywordsAsJson();
+   }
+
+   std::string CKeywordManager::getKeywordsAsJson(int deviceId) const
+   {
+      return m_keywordRequester->getKeywordsAsJson(deviceId);
+   }
+
    std::vector<boost::shared_ptr<database::entities::CKeyword>> CKeywordManager::getKeywordsMatchingCapacity(const std::string& capacity) const
    {
       return m_keywordRequester->getKeywordsMatchingCapacity(capacity);
@@ -80,12 +91,37 @@ namespace dataAccessLayer
 
    boost::shared_ptr<database::entities::CAcquisition> CKeywordManager::getKeywordLastAcquisition(const int keywordId, bool throwIfNotExists)
    {
-      return m_keywordRequester->getKeywordLastAcquisition(keywordId, throwIfNotExists);
+      CLastValueCache::LastValue lastValue;
+      if (m_lastValues.get(keywordId, lastValue))
+         return makeAcquisitionEntity(keywordId, lastValue);
+
+      if (throwIfNotExists)
+         throw shared::exception::CEmptyResult((boost::format("Cannot retrieve any acquisition for the keyword id=%1% in database") % keywordId).str());
+      return boost::shared_ptr<database::entities::CAcquisition>();
    }
 
    std::string CKeywordManager::getKeywordLastData(const int keywordId, bool throwIfNotExists)
    {
-      return m_keywordRequester->getKeywordLastData(keywordId, throwIfNotExists);
+      CLastValueCache::LastValue lastValue;
+      if (m_lastValues.get(keywordId, lastValue))
+         return lastValue.value;
+
+      if (throwIfNotExists)
+         throw shared::exception::CEmptyResult((boost::format("Cannot retrieve any acquisition for the keyword id=%1% in database") % keywordId).str());
+      return std::string();
+   }
+
+   std::map<int, boost::shared_ptr<database::entities::CAcquisition>> CKeywordManager::getKeywordsLastAcquisition(const std::vector<int>& keywordIds)
+   {
+      std::map<int, boost::shared_ptr<database::entities::CAcquisition>> acquisitions;
+      for (const auto& lastValue : m_lastValues.snapshot(keywordIds))
+         acquisitions[lastValue.first] = makeAcquisitionEntity(lastValue.first, lastValue.second);
+      return acquisitions;
+   }
+
+   void CKeywordManager::onLastValueChanged(int keywordId)
+   {
+      m_lastValues.invalidate(keywordId);
    }
 
    void CKeywordManager::addKeyword(const database::entities::CKeyword& newKeyword) const
@@ -150,6 +186,7 @@ namespace dataAccessLayer
       if(blacklist)
          m_dataProvider->getAcquisitionRequester()->removeKeywordData(keywordId);
       m_keywordRequester->updateKeywordBlacklistState(keywordId, blacklist);
+      m_lastValues.invalidate(keywordId);
 
       //post notification
       notification::CHelpers::postChangeNotification(keywordToBlacklist, notification::change::EChangeType::kDelete);
@@ -169,6 +206,7 @@ namespace dataAccessLayer
      auto keywordToDelete = getKeyword(keywordId);
      m_dataProvider->getAcquisitionRequester()->removeKeywordData(keywordId);
      m_keywordRequester->removeKeyword(keywordId);
+     m_lastValues.invalidate(keywordId);
 
      //post notification
      notification::CHelpers::postChangeNotification(keywordToDelete, notification::change::EChangeType::kDelete);
@@ -209,4 +247,13 @@ namespace dataAccessLayer
 
       return keywordEntity;
    }
+
+   boost::shared_ptr<database::entities::CAcquisition> CKeywordManager::makeAcquisitionEntity(int keywordId, const CLastValueCache::LastValue& lastValue)
+   {
+      auto acquisition = boost::make_shared<database::entities::CAcquisition>();
+      acquisition->KeywordId = keywordId;
+      acquisition->Date = lastValue.date;
+      acquisition->Value = lastValue.value;
+      return acquisition;
+   }
 } //namespace dataAccessLayer
\ No newline at end of file
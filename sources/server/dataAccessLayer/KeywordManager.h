@@ -1,6 +1,7 @@
 #pragma once
 #include "IKeywordManager.h"
 #include "database/IDataProvider.h"
+#include "LastValueCache.h"
 
 namespace dataAccessLayer
 {
@@ -26,10 +27,14 @@ namespace dataAccessLayer
       std::vector<boost::shared_ptr<database::entities::CKeyword> > getKeywordIdFromFriendlyName(int deviceId, const std::string& friendlyName) const override;
       std::vector<boost::shared_ptr<database::entities::CKeyword> > getAllKeywords() const override;
       std::vector<boost::shared_ptr<database::entities::CKeyword> > getKeywords(int deviceId) const override;
+      std::string getAllKeywordsAsJson() const override;
+      std::string getKeywordsAsJson(int deviceId) const override;
       std::vector<boost::shared_ptr<database::entities::CKeyword> > getKeywordsMatchingCapacity(const std::string& capacity) const override;
       std::vector<boost::shared_ptr<database::entities::CKeyword> > getDeviceKeywordsWithCapacity(int deviceId, const std::string& capacityName, const shared::plugin::yPluginApi::EKeywordAccessMode& capacityAccessMode) const override;
       boost::shared_ptr<database::entities::CAcquisition> getKeywordLastAcquisition(const int keywordId, bool throwIfNotExists = true) override;
       std::string getKeywordLastData(const int keywordId, bool throwIfNotExists = true) override;
+      std::map<int, boost::shared_ptr<database::entities::CAcquisition>> getKeywordsLastAcquisition(const std::vector<int>& keywordIds) override;
+      void onLastValueChanged(int keywordId) override;
       void addKeyword(int deviceId, const shared::plugin::yPluginApi::historization::IHistorizable& keyword, const shared::CDataContainer& details = shared::CDataContainer::EmptyContainer) override;
       void addKeywords(int deviceId, const std::vector<boost::shared_ptr<const shared::plugin::yPluginApi::historization::IHistorizable> >& keywords) override;
       void updateKeywordFriendlyName(int deviceId, const std::string& keyword, const std::string& newFriendlyName) override;
@@ -44,10 +49,16 @@ namespace dataAccessLayer
       static boost::shared_ptr<database::entities::CKeyword> makeKeywordEntity(int deviceId,
                                                                                const shared::plugin::yPluginApi::historization::IHistorizable& keyword,
                                                                                const shared::CDataContainer& details = shared::CDataContainer::EmptyContainer);
+      static boost::shared_ptr<database::entities::CAcquisition> makeAcquisitionEntity(int keywordId, const CLastValueCache::LastValue& lastValue);
 
 
       boost::shared_ptr<database::IDataProvider> m_dataProvider;
       boost::shared_ptr<database::IKeywordRequester> m_keywordRequester;
+
+      //--------------------------------------------------------------
+      /// \brief       The keywords last values (read without database query)
+      //--------------------------------------------------------------
+      CLastValueCache m_lastValues;
    };
 } //namespace dataAccessLayer 
 
@@ -0,0 +1,111 @@
+#include "stdafx.h"
+#include "LastValueCache.h"
+#include "notification/acquisition/Observer.hpp"
+
+namespace dataAccessLayer
+{
+   CLastValueCache::CLastValueCache(boost::shared_ptr<database::IKeywordRequester> keywordRequester,
+                                    boost::shared_ptr<notification::CNotificationCenter> notificationCenter)
+      : m_keywordRequester(keywordRequester)
+   {
+      // Observe acquisitions before loading the table, so no acquisition is missed
+      auto observer(boost::make_shared<notification::acquisition::CObserver>(
+         boost::make_shared<notification::action::CFunctionPointerNotifier<notification::acquisition::CNotification>>(
+            boost::bind(&CLastValueCache::onAcquisition, this, _1))));
+      m_acquisitionSubscriber = boost::make_shared<notification::CHelpers::CCustomSubscriber>(observer, notificationCenter);
+
+      const auto keywords = m_keywordRequester->getAllKeywords();
+
+      boost::unique_lock<boost::shared_mutex> lock(m_mutex);
+      m_lastValues.reserve(keywords.size());
+      for (const auto& keyword : keywords)
+      {
+         LastValue lastValue;
+         lastValue.date = keyword->LastAcquisitionDate();
+         lastValue.value = keyword->LastAcquisitionValue();
+
+         // a value already notified is more recent
+         m_lastValues.insert(std::make_pair(keyword->Id(), lastValue));
+      }
+   }
+
+   CLastValueCache::~CLastValueCache()
+   {
+      m_acquisitionSubscriber.reset();
+   }
+
+   bool CLastValueCache::get(int keywordId, LastValue& lastValue)
+   {
+      {
+         boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+         const auto found = m_lastValues.find(keywordId);
+         if (found != m_lastValues.end())
+         {
+            lastValue = found->second;
+            return true;
+         }
+      }
+
+      return load(keywordId, lastValue);
+   }
+
+   std::map<int, CLastValueCache::LastValue> CLastValueCache::snapshot(const std::vector<int>& keywordIds)
+   {
+      std::map<int, LastValue> lastValues;
+      std::vector<int> missingKeywordIds;
+      {
+         boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+         for (const auto keywordId : keywordIds)
+         {
+            const auto found = m_lastValues.find(keywordId);
+            if (found != m_lastValues.end())
+               lastValues[keywordId] = found->second;
+            else
+               missingKeywordIds.push_back(keywordId);
+         }
+      }
+
+      // keywords not in table (new or unknown ones) are read out of the lock
+      for (const auto keywordId : missingKeywordIds)
+      {
+         LastValue lastValue;
+         if (load(keywordId, lastValue))
+            lastValues[keywordId] = lastValue;
+      }
+      return lastValues;
+   }
+
+   void CLastValueCache::invalidate(int keywordId)
+   {
+      boost::unique_lock<boost::shared_mutex> lock(m_mutex);
+      m_lastValues.erase(keywordId);
+   }
+
+   void CLastValueCache::onAcquisition(boost::shared_ptr<notification::acquisition::CNotification> notification)
+   {
+      const auto acquisition = notification->getAcquisition();
+
+      LastValue lastValue;
+      lastValue.date = acquisition->Date();
+      lastValue.value = acquisition->Value();
+
+      boost::unique_lock<boost::shared_mutex> lock(m_mutex);
+      m_lastValues[acquisition->KeywordId()] = lastValue;
+   }
+
+   bool CLastValueCache::load(int keywordId, LastValue& lastValue)
+   {
+      const auto acquisition = m_keywordRequester->getKeywordLastAcquisition(keywordId, false);
+      if (!acquisition)
+         return false;
+
+      lastValue.date = acquisition->Date();
+      lastValue.value = acquisition->Value();
+
+      // an acquisition notified meanwhile is more recent
+      boost::unique_lock<boost::shared_mutex> lock(m_mutex);
+      const auto inserted = m_lastValues.insert(std::make_pair(keywordId, lastValue));
+      lastValue = inserted.first->second;
+      return true;
+   }
+} //namespace dataAccessLayer 
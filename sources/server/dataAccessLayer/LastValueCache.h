@@ -0,0 +1,95 @@
+#pragma once
+#include <unordered_map>
+#include <boost/thread/shared_mutex.hpp>
+#include "database/IKeywordRequester.h"
+#include "notification/Helpers.hpp"
+#include "notification/acquisition/Notification.hpp"
+
+namespace dataAccessLayer
+{
+   //--------------------------------------------------------------
+   /// \brief       In-memory table of the keywords last values
+   ///
+   /// The table is loaded at startup, then updated by the acquisition notifications, so last values
+   /// are read without any database query. A keyword missing in the table is read from the database
+   /// (and added to the table if it exists).
+   //--------------------------------------------------------------
+   class CLastValueCache
+   {
+   public:
+      //--------------------------------------------------------------
+      /// \brief       The last value of a keyword
+      //--------------------------------------------------------------
+      struct LastValue
+      {
+         boost::posix_time::ptime date;
+         std::string value;
+      };
+
+      //--------------------------------------------------------------
+      /// \brief                          Constructor (load the table)
+      /// \param [in] keywordRequester    The keyword requester
+      /// \param [in] notificationCenter  The notification center (if not specified, the service located one)
+      //--------------------------------------------------------------
+      explicit CLastValueCache(boost::shared_ptr<database::IKeywordRequester> keywordRequester,
+                               boost::shared_ptr<notification::CNotificationCenter> notificationCenter = boost::shared_ptr<notification::CNotificationCenter>());
+
+      //--------------------------------------------------------------
+      /// \brief       Destructor
+      //--------------------------------------------------------------
+      virtual ~CLastValueCache();
+
+      //--------------------------------------------------------------
+      /// \brief                 Get the last value of a keyword
+      /// \param [in] keywordId  The keyword id
+      /// \param [out] lastValue The keyword last value
+      /// \return                false if keyword doesn't exist
+      //--------------------------------------------------------------
+      bool get(int keywordId, LastValue& lastValue);
+
+      //--------------------------------------------------------------
+      /// \brief                  Get the last values of several keywords, all read at the same time
+      /// \param [in] keywordIds  The keywords ids
+      /// \return                 The last value of each existing keyword
+      //--------------------------------------------------------------
+      std::map<int, LastValue> snapshot(const std::vector<int>& keywordIds);
+
+      //--------------------------------------------------------------
+      /// \brief                 Forget the last value of a keyword (it will be read again from the database).
+      ///                        To call when a keyword is removed, or when its last value is changed without notification.
+      /// \param [in] keywordId  The keyword id
+      //--------------------------------------------------------------
+      void invalidate(int keywordId);
+
+   private:
+      //--------------------------------------------------------------
+      /// \brief                    Called for each new acquisition
+      /// \param [in] notification  The acquisition notification
+      //--------------------------------------------------------------
+      void onAcquisition(boost::shared_ptr<notification::acquisition::CNotification> notification);
+
+      //--------------------------------------------------------------
+      /// \brief                 Read the last value of a keyword from the database, and add it to the table
+      /// \param [in] keywordId  The keyword id
+      /// \param [out] lastValue The keyword last value
+      /// \return                false if keyword doesn't exist
+      //--------------------------------------------------------------
+      bool load(int keywordId, LastValue& lastValue);
+
+      //--------------------------------------------------------------
+      /// \brief       The keyword requester
+      //--------------------------------------------------------------
+      boost::shared_ptr<database::IKeywordRequester> m_keywordRequester;
+
+      //--------------------------------------------------------------
+      /// \brief       The last values, by keyword id (shared lock for readers)
+      //--------------------------------------------------------------
+      mutable boost::shared_mutex m_mutex;
+      std::unordered_map<int, LastValue> m_lastValues;
+
+      //--------------------------------------------------------------
+      /// \brief       The acquisition notifications subscription (unsubscribed first at destruction)
+      //--------------------------------------------------------------
+      boost::shared_ptr<notification::CHelpers::CCustomSubscriber> m_acquisitionSubscriber;
+   };
+} //namespace dataAccessLayer 
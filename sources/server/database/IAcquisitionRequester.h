@@ -19,6 +19,17 @@ namespace database
                                                                  const std::string& data,
                                                                  boost::posix_time::ptime& dataTime) = 0;
 
+      //--------------------------------------------------------------
+      /// \brief           Save several data at once into base
+      /// \param [in]      keywordIds  The keywords id
+      /// \param [in]      data        The data (one for each keyword)
+      /// \param [in]      dataTime    The datetime of the data
+      /// \return          The inserted acquisitions (blacklisted keywords are omitted)
+      //--------------------------------------------------------------
+      virtual std::vector<boost::shared_ptr<entities::CAcquisition>> saveData(const std::vector<int>& keywordIds,
+                                                                              const std::vector<std::string>& data,
+                                                                              boost::posix_time::ptime& dataTime) = 0;
+
       //--------------------------------------------------------------
       /// \brief           Increment a data into base
       /// \param [in]      keywordId   The keyword id
@@ -49,6 +60,19 @@ namespace database
                                                                                database::entities::EAcquisitionSummaryType curType,
                                                                                boost::posix_time::ptime& dataTime) = 0;
 
+      //--------------------------------------------------------------
+      /// \brief           Compute and save summary data of several keywords at once
+      /// \param [in]      keywordIds  The keywords id (must be numeric keywords)
+      /// \param [in]      curType     The type of summary data to save
+      /// \param [in]      dataTime    Any datetime of the summary period
+      /// \return          The saved acquisition summaries (keywords without data in the period are omitted)
+      /// \note            Existing summaries of the period are recomputed. All keywords are processed
+      ///                  by a single set-based query, in one transaction
+      //--------------------------------------------------------------
+      virtual std::vector<boost::shared_ptr<entities::CAcquisitionSummary> > saveSummaryData(const std::vector<int>& keywordIds,
+                                                                                             database::entities::EAcquisitionSummaryType curType,
+                                                                                             const boost::posix_time::ptime& dataTime) = 0;
+
       //--------------------------------------------------------------
       /// \brief           Get the keywords id which have at least one acquisition between dates
       /// \param [in]      timeFrom    The time from (inclusive)
@@ -193,11 +217,26 @@ namespace database
                                                    boost::posix_time::ptime timeTo) = 0;
 
       //--------------------------------------------------------------
-      /// \brief                 Delete old acquisition
-      /// \param [in] purgeDate  The date of purge (any data prior ro his date will be deleted)
-      /// \return                Number of deleted rows
+      /// \brief                       Delete a batch of the oldest acquisitions
+      /// \param [in] purgeDate        The date of purge (any data prior ro his date will be deleted)
+      /// \param [in] keptKeywordIds   Keywords which acquisitions must not be deleted
+      /// \param [in] maxRows          Number of acquisitions to delete by batch (acquisitions sharing the date of the last one are also deleted)
+      /// \return                      Number of deleted acquisitions, dropped partitions included (less than maxRows when nothing is left to purge)
+      //--------------------------------------------------------------
+      virtual int purgeAcquisitions(const boost::posix_time::ptime& purgeDate,
+                                    const std::vector<int>& keptKeywordIds,
+                                    int maxRows) = 0;
+
+      //--------------------------------------------------------------
+      /// \brief                       Delete a batch of the oldest acquisitions of a keyword
+      /// \param [in] keywordId        The keyword id
+      /// \param [in] purgeDate        The date of purge (any data prior ro his date will be deleted)
+      /// \param [in] maxRows          Number of acquisitions to delete by batch
+      /// \return                      Number of deleted rows (less than maxRows when nothing is left to purge)
       //--------------------------------------------------------------
-      virtual int purgeAcquisitions(boost::posix_time::ptime purgeDate) = 0;
+      virtual int purgeKeywordAcquisitions(int keywordId,
+                                           const boost::posix_time::ptime& purgeDate,
+                                           int maxRows) = 0;
 
       //--------------------------------------------------------------
       /// \brief       Destructor
@@ -29,6 +29,14 @@ namespace database {
       //---------------------------------
       virtual void backupData(const std::string & backupFolder, ProgressFunc reporter) = 0;
 
+      //---------------------------------
+      ///\brief Backup only the acquisitions recorded since a date (incremental backup)
+      ///\param [in] backupFolder : the backup folder
+      ///\param [in] since : the date of the previous backup (older acquisitions are not saved)
+      ///\param [in] reporter : a function pointer for reporting progression
+      //---------------------------------
+      virtual void backupAcquisitionsSince(const std::string & backupFolder, const boost::posix_time::ptime& since, ProgressFunc reporter) = 0;
+
       //--------------------------------------------------------------
       /// \brief       Destructor
       //--------------------------------------------------------------
@@ -6,6 +6,7 @@
 #include "IDataBackup.h"
 #include "IDatabaseEngine.h"
 #include "ITableCreationScriptProvider.h"
+#include "entities/Entities.h"
 
 namespace database
 {
@@ -27,6 +28,16 @@ namespace database
       //--------------------------------------------------------------
       typedef std::vector<QueryRow> QueryResults;
 
+      //--------------------------------------------------------------
+      /// \brief	A prepared statement call
+      //--------------------------------------------------------------
+      struct PreparedStatement
+      {
+         std::string name;                      ///< the statement unique name
+         std::string statement;                 ///< the sql statement, parameters are noted $1, $2...
+         std::vector<std::string> parameters;   ///< the parameters values ($1 is the first one)
+      };
+
       //--------------------------------------------------------------
       /// \Brief  Create a new CQuery object
       /// \return The created CQuery
@@ -72,6 +83,51 @@ namespace database
       //--------------------------------------------------------------  
       virtual QueryResults query(const common::CQuery& querytoExecute) = 0;
 
+      //--------------------------------------------------------------
+      /// \Brief		    query for entities with a prepared statement
+      ///                The statement is prepared once by the database, then only executed
+      ///                (to use for the most frequent queries)
+      /// \param [in]	 adapter:  pointer to the adapter to use to map raw values to a new entity
+      /// \param [in]	 statementName: the statement unique name
+      /// \param [in]	 statement: the sql statement, parameters are noted $1, $2...
+      /// \param [in]	 parameters: the parameters values ($1 is the first one)
+      //--------------------------------------------------------------
+      virtual void queryPreparedEntities(common::adapters::IResultAdapter* adapter,
+                                         const std::string& statementName,
+                                         const std::string& statement,
+                                         const std::vector<std::string>& parameters) = 0;
+
+      //--------------------------------------------------------------
+      /// \brief		      execute a prepared statement (create, update, delete) which returns the number of affected lines
+      /// \param [in]	   statementName The statement unique name
+      /// \param [in]	   statement The sql statement, parameters are noted $1, $2...
+      /// \param [in]	   parameters The parameters values ($1 is the first one)
+      /// \param [in]	   throwIfFails If true, generate an exception when it fails; else return -1 (= number of afected rows)
+      /// \return 	      the number of affected lines
+      //--------------------------------------------------------------  
+      virtual int queryPreparedStatement(const std::string& statementName,
+                                         const std::string& statement,
+                                         const std::vector<std::string>& parameters,
+                                         bool throwIfFails = true) = 0;
+
+      //--------------------------------------------------------------
+      /// \brief		      execute several independent prepared statements (create, update, delete)
+      ///                  Database may send them all before waiting for results (if supported)
+      /// \param [in]	   statements The statements, executed in order
+      /// \return 	      the number of affected lines of each statement
+      /// \throws          CDatabaseException if a statement fails (following ones are not executed)
+      //--------------------------------------------------------------  
+      virtual std::vector<int> queryPreparedStatements(const std::vector<PreparedStatement>& statements) = 0;
+
+      //--------------------------------------------------------------
+      /// \brief		      insert several acquisitions at once, by the fastest way supported by the database
+      /// \param [in]	   partition The acquisitions partition to fill
+      /// \param [in]	   acquisitions The acquisitions to insert
+      /// \return 	      true if all acquisitions were inserted, false if one already exists (none is inserted)
+      //--------------------------------------------------------------  
+      virtual bool bulkInsertAcquisitions(const common::CDatabaseTable& partition,
+                                          const std::vector<boost::shared_ptr<entities::CAcquisition>>& acquisitions) = 0;
+
 
       //--------------------------------------------------------------
       /// \Brief	Check if a table already exists in database
@@ -113,16 +169,35 @@ namespace database
       virtual void createIndex(const common::CDatabaseTable& tableName,
                                const std::string& indexScript) = 0;
 
+      //--------------------------------------------------------------
+      /// \Brief	      Get the names of the tables starting with a prefix
+      /// \param [in]   namePrefix:  the tables name prefix (case insensitive)
+      /// \return	      the tables names
+      //--------------------------------------------------------------
+      virtual std::vector<std::string> getTablesNames(const std::string& namePrefix) = 0;
+
       //--------------------------------------------------------------
       /// \Brief	      Vacuum the database (compact it)
       //--------------------------------------------------------------
       virtual void vacuum() = 0;
 
+      //--------------------------------------------------------------
+      /// \Brief	      Give free space back to the system, without blocking the database
+      ///               like a full vacuum does (used after purges)
+      //--------------------------------------------------------------
+      virtual void releaseFreeSpace() = 0;
+
       //--------------------------------------------------------------
       /// \Brief	      Tells if database support insert or update statement
       //--------------------------------------------------------------
       virtual bool supportInsertOrUpdateStatement() = 0;
 
+      //--------------------------------------------------------------
+      /// \Brief	      Tells if database natively support partitioned tables
+      ///               (if not, partitions are gathered by a view which must be rebuilt at each partition change)
+      //--------------------------------------------------------------
+      virtual bool supportPartitionedTables() = 0;
+
       // ITransactionalProvider implementation
       bool transactionSupport() override = 0;
       void transactionBegin() override = 0;
@@ -133,6 +208,7 @@ namespace database
 
       // IDataBackup implementation
       void backupData(const std::string & backupFolder, ProgressFunc reporter) override = 0;
+      void backupAcquisitionsSince(const std::string & backupFolder, const boost::posix_time::ptime& since, ProgressFunc reporter) override = 0;
       // [END] IDataBackup implementation
 
       // IDatabaseEngine implementation
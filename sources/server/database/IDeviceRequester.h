@@ -8,6 +8,31 @@ namespace database
    class IDeviceRequester
    {
    public:
+      //--------------------------------------------------------------
+      /// \brief           Criteria of a devices (with their keywords) listing
+      //--------------------------------------------------------------
+      struct DevicesWithKeywordsQuery
+      {
+         DevicesWithKeywordsQuery()
+            : afterDeviceId(0),
+              maxDevices(100),
+              pluginId(0),
+              blacklistedIncluded(true),
+              lastValues(false)
+         {
+         }
+
+         int afterDeviceId;                                                         ///< the page cursor : only devices with a greater id are listed (0 for the first page)
+         int maxDevices;                                                            ///< the page size (in devices)
+         int pluginId;                                                              ///< only the devices of this plugin instance (0 for all)
+         std::string capacityName;                                                  ///< only the keywords of this capacity, and their devices (empty for all)
+         boost::optional<shared::plugin::yPluginApi::EKeywordAccessMode> accessMode; ///< only the keywords with this access mode, and their devices
+         bool blacklistedIncluded;                                                  ///< list also blacklisted devices and keywords
+         bool lastValues;                                                           ///< give the keywords last values
+         std::vector<std::string> deviceFields;                                     ///< the devices fields to give (all if empty)
+         std::vector<std::string> keywordFields;                                    ///< the keywords fields to give (all if empty)
+      };
+
 
       //--------------------------------------------------------------
       /// \brief                          Check if device exists
@@ -112,6 +137,14 @@ namespace database
       //--------------------------------------------------------------
       virtual std::vector<std::string> getDevicesNames(int pluginId, bool blacklistedIncluded = false) const = 0;
 
+      //--------------------------------------------------------------
+      /// \brief           List a page of devices, each one with its keywords (in one query)
+      /// \param [in] query          The listing criteria
+      /// \param [out] nextDeviceId  The cursor of the next page (0 if this page is the last one)
+      /// \return          The devices, serialized as a JSON array ("" if no device)
+      //--------------------------------------------------------------
+      virtual std::string getDevicesWithKeywordsAsJson(const DevicesWithKeywordsQuery& query, int& nextDeviceId) const = 0;
+
       //--------------------------------------------------------------
       /// \brief                          Update a device friendly name
       /// \param [in] deviceId            The device id
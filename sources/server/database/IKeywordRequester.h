@@ -59,6 +59,19 @@ namespace database
       //--------------------------------------------------------------
       virtual std::vector<boost::shared_ptr<entities::CKeyword>> getKeywords(int deviceId) const = 0;
 
+      //--------------------------------------------------------------
+      /// \brief           List all keywords, serialized without building entities
+      /// \return          The keywords as a JSON array (same content as the serialized entities)
+      //--------------------------------------------------------------
+      virtual std::string getAllKeywordsAsJson() const = 0;
+
+      //--------------------------------------------------------------
+      /// \brief           List all keywords for a device, serialized without building entities
+      /// \param [in]      deviceId   the device which own the keyword
+      /// \return          The keywords as a JSON array (same content as the serialized entities)
+      //--------------------------------------------------------------
+      virtual std::string getKeywordsAsJson(int deviceId) const = 0;
+
       //--------------------------------------------------------------
       /// \brief           List all keywords which match a capacity
       /// \param [in]      capacity   the capacity
@@ -125,6 +138,12 @@ namespace database
       /// \param [in] value               The new value
       //--------------------------------------------------------------
       virtual void updateLastValue(int keywordId, const boost::posix_time::ptime& valueDatetime, const std::string& value) = 0;
+
+      //--------------------------------------------------------------
+      /// \brief                          Update the last value of several keywords at once
+      /// \param [in] acquisitions        The new last acquisitions (one by keyword)
+      //--------------------------------------------------------------
+      virtual void updateLastValues(const std::vector<boost::shared_ptr<entities::CAcquisition>>& acquisitions) = 0;
    };
 } //namespace database 
 
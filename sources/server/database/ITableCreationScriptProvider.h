@@ -89,6 +89,30 @@ namespace database {
       //--------------------------------------------------------------
       virtual void getTableAcquisitionIndexes(std::vector<std::string> & indexScripts) = 0;
 
+      //--------------------------------------------------------------
+      /// \brief                       Get the creation script for the Acquisition partitions parent
+      ///                              (partitioned table, or view gathering the partitions if not natively supported)
+      /// \param [in] partitionNames   The existing partitions
+      /// \return                      The creation script
+      //--------------------------------------------------------------
+      virtual std::string getTableAcquisitionPartitionsParent(const std::vector<std::string> & partitionNames) = 0;
+
+      //--------------------------------------------------------------
+      /// \brief                       Get the creation script for an Acquisition partition
+      /// \param [in] partitionName    The partition name
+      /// \param [in] fromDate         The partition first date (included, ISO format)
+      /// \param [in] toDate           The partition last date (excluded, ISO format)
+      /// \return                      The creation script
+      //--------------------------------------------------------------
+      virtual std::string getTableAcquisitionPartition(const std::string & partitionName, const std::string & fromDate, const std::string & toDate) = 0;
+
+      //--------------------------------------------------------------
+      /// \brief                       Get the indexes creation scripts for an Acquisition partition
+      /// \param [in] partitionName    The partition name
+      /// \param [out] indexScripts    The indexes creation scripts
+      //--------------------------------------------------------------
+      virtual void getTableAcquisitionPartitionIndexes(const std::string & partitionName, std::vector<std::string> & indexScripts) = 0;
+
 
       //--------------------------------------------------------------
       /// \brief       Destructor
@@ -0,0 +1,184 @@
+#include "stdafx.h"
+#include "AcquisitionPartitions.h"
+#include "DatabaseTables.h"
+#include "Query.h"
+#include "database/DatabaseException.hpp"
+#include <shared/Log.h>
+
+namespace database {
+namespace common {
+
+   CAcquisitionPartitions::CAcquisitionPartitions(boost::shared_ptr<IDatabaseRequester> databaseRequester)
+      : m_databaseRequester(databaseRequester), m_partitionsLoaded(false)
+   {
+   }
+
+   CAcquisitionPartitions::~CAcquisitionPartitions()
+   {
+   }
+
+   void CAcquisitionPartitions::createParent()
+   {
+      boost::lock_guard<boost::recursive_mutex> lock(m_partitionsMutex);
+      loadPartitions();
+
+      const auto script = m_databaseRequester->getTableCreationScriptProvider()->getTableAcquisitionPartitionsParent(partitionsNames());
+      m_databaseRequester->queryStatement(CQuery::CustomQuery(script, CQuery::kCreate));
+   }
+
+   CDatabaseTable CAcquisitionPartitions::partitionFor(const boost::posix_time::ptime& date)
+   {
+      const auto month = monthOf(date);
+
+      boost::lock_guard<boost::recursive_mutex> lock(m_partitionsMutex);
+      loadPartitions();
+      if (m_partitions.find(month) == m_partitions.end())
+         createPartition(month);
+      return partitionTable(month);
+   }
+
+   CDatabaseTable CAcquisitionPartitions::tableFor(const boost::posix_time::ptime& from, const boost::posix_time::ptime& to)
+   {
+      if (from.is_not_a_date_time() || to.is_not_a_date_time())
+         return CAcquisitionTable::getTableName();
+
+      const auto month = monthOf(from);
+      if (month != monthOf(to))
+         return CAcquisitionTable::getTableName();
+
+      boost::lock_guard<boost::recursive_mutex> lock(m_partitionsMutex);
+      loadPartitions();
+      if (m_partitions.find(month) == m_partitions.end())
+         return CAcquisitionTable::getTableName();
+      return partitionTable(month);
+   }
+
+   std::vector<boost::gregorian::date> CAcquisitionPartitions::partitions()
+   {
+      boost::lock_guard<boost::recursive_mutex> lock(m_partitionsMutex);
+      loadPartitions();
+      return std::vector<boost::gregorian::date>(m_partitions.begin(), m_partitions.end());
+   }
+
+   void CAcquisitionPartitions::dropPartition(const boost::gregorian::date& month)
+   {
+      boost::lock_guard<boost::recursive_mutex> lock(m_partitionsMutex);
+      loadPartitions();
+
+      const auto table = partitionTable(month);
+      YADOMS_LOG(information) << "Drop acquisition partition " << table.GetName();
+
+      const auto ownTransaction = m_databaseRequester->transactionSupport() && !m_databaseRequester->transactionIsAlreadyCreated();
+      if (ownTransaction)
+         m_databaseRequester->transactionBegin();
+
+      try
+      {
+         //view must not reference the partition anymore when dropped (some databases refuse to drop a table used by a view)
+         m_partitions.erase(month);
+         rebuildParentView();
+         if (!m_databaseRequester->dropTableIfExists(table))
+            throw CDatabaseException("Fail to drop acquisition partition " + table.GetName());
+
+         if (ownTransaction)
+            m_databaseRequester->transactionCommit();
+      }
+      catch (std::exception&)
+      {
+         if (ownTransaction)
+            m_databaseRequester->transactionRollback();
+         m_partitionsLoaded = false;
+         m_partitions.clear();
+         throw;
+      }
+   }
+
+   CDatabaseTable CAcquisitionPartitions::partitionTable(const boost::gregorian::date& month)
+   {
+      return CDatabaseTable((boost::format("%1%_%2%%3$02d") % CAcquisitionTable::getTableName().GetName() % month.year() % static_cast<int>(month.month())).str());
+   }
+
+   boost::gregorian::date CAcquisitionPartitions::monthOf(const boost::posix_time::ptime& date)
+   {
+      return boost::gregorian::date(date.date().year(), date.date().month(), 1);
+   }
+
+   void CAcquisitionPartitions::loadPartitions()
+   {
+      if (m_partitionsLoaded)
+         return;
+
+      //partitions names are "Acquisition_YYYYMM" (lower case with some databases)
+      const auto prefix = CAcquisitionTable::getTableName().GetName() + "_";
+      const boost::regex partitionNamePattern(prefix + "([0-9]{4})([0-9]{2})", boost::regex::icase);
+
+      m_partitions.clear();
+      for (const auto& tableName : m_databaseRequester->getTablesNames(prefix))
+      {
+         boost::smatch match;
+         if (boost::regex_match(tableName, match, partitionNamePattern))
+            m_partitions.insert(boost::gregorian::date(std::stoi(match[1]), std::stoi(match[2]), 1));
+      }
+      m_partitionsLoaded = true;
+   }
+
+   void CAcquisitionPartitions::createPartition(const boost::gregorian::date& month)
+   {
+      const auto table = partitionTable(month);
+      YADOMS_LOG(information) << "Create acquisition partition " << table.GetName();
+
+      const auto scriptProvider = m_databaseRequester->getTableCreationScriptProvider();
+      const auto fromDate = boost::posix_time::to_iso_string(boost::posix_time::ptime(month));
+      const auto toDate = boost::posix_time::to_iso_string(boost::posix_time::ptime(month + boost::gregorian::months(1)));
+
+      const auto ownTransaction = m_databaseRequester->transactionSupport() && !m_databaseRequester->transactionIsAlreadyCreated();
+      if (ownTransaction)
+         m_databaseRequester->transactionBegin();
+
+      try
+      {
+         if (!m_databaseRequester->createTableIfNotExists(table, scriptProvider->getTableAcquisitionPartition(table.GetName(), fromDate, toDate)))
+            throw CDatabaseException("Fail to create acquisition partition " + table.GetName());
+
+         std::vector<std::string> indexScripts;
+         scriptProvider->getTableAcquisitionPartitionIndexes(table.GetName(), indexScripts);
+         for (const auto& indexScript : indexScripts)
+            m_databaseRequester->createIndex(table, indexScript);
+
+         m_partitions.insert(month);
+         rebuildParentView();
+
+         if (ownTransaction)
+            m_databaseRequester->transactionCommit();
+      }
+      catch (std::exception&)
+      {
+         if (ownTransaction)
+            m_databaseRequester->transactionRollback();
+         m_partitionsLoaded = false;
+         m_partitions.clear();
+         throw;
+      }
+   }
+
+   void CAcquisitionPartitions::rebuildParentView()
+   {
+      //partitioned tables find their partitions by themselves
+      if (m_databaseRequester->supportPartitionedTables())
+         return;
+
+      m_databaseRequester->queryStatement(CQuery::CustomQuery("DROP VIEW IF EXISTS " + CAcquisitionTable::getTableName().GetName(), CQuery::kDrop));
+      const auto script = m_databaseRequester->getTableCreationScriptProvider()->getTableAcquisitionPartitionsParent(partitionsNames());
+      m_databaseRequester->queryStatement(CQuery::CustomQuery(script, CQuery::kCreate));
+   }
+
+   std::vector<std::string> CAcquisitionPartitions::partitionsNames() const
+   {
+      std::vector<std::string> names;
+      for (const auto& month : m_partitions)
+         names.push_back(partitionTable(month).GetName());
+      return names;
+   }
+
+} //namespace common
+} //namespace database
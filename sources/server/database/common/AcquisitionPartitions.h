@@ -0,0 +1,121 @@
+#pragma once
+
+#include <set>
+#include "database/IDatabaseRequester.h"
+#include "DatabaseColumn.h"
+
+namespace database {
+namespace common {
+
+   //--------------------------------------------------------------
+   /// \Brief		   Handle the monthly partitions of the Acquisition table
+   ///
+   /// Acquisitions are stored in one table by month (Acquisition_YYYYMM).
+   /// The Acquisition table is the partitions parent : a partitioned table if database natively
+   /// supports it, or a view gathering all partitions. It is used for reading only.
+   //--------------------------------------------------------------
+   class CAcquisitionPartitions
+   {
+   public:
+      //--------------------------------------------------------------
+      /// \brief	Constructor
+      /// \param [in]	databaseRequester: the database requester
+      //--------------------------------------------------------------
+      explicit CAcquisitionPartitions(boost::shared_ptr<IDatabaseRequester> databaseRequester);
+
+      //--------------------------------------------------------------
+      /// \brief	Destructor
+      //--------------------------------------------------------------
+      virtual ~CAcquisitionPartitions();
+
+      //--------------------------------------------------------------
+      /// \brief	Create the partitions parent (must not exist)
+      //--------------------------------------------------------------
+      void createParent();
+
+      //--------------------------------------------------------------
+      /// \brief	Get the partition storing a date, create it if not exists
+      /// \param [in]	date: the acquisition date
+      /// \return       The partition table
+      //--------------------------------------------------------------
+      CDatabaseTable partitionFor(const boost::posix_time::ptime& date);
+
+      //--------------------------------------------------------------
+      /// \brief	Get the table to query for a date range
+      /// \param [in]	from: the range first date (included)
+      /// \param [in]	to: the range last date (included)
+      /// \return       The partition if the whole range is in one partition, the partitions parent if not
+      //--------------------------------------------------------------
+      CDatabaseTable tableFor(const boost::posix_time::ptime& from, const boost::posix_time::ptime& to);
+
+      //--------------------------------------------------------------
+      /// \brief	Get the existing partitions
+      /// \return       The first day of month of each partition, oldest first
+      //--------------------------------------------------------------
+      std::vector<boost::gregorian::date> partitions();
+
+      //--------------------------------------------------------------
+      /// \brief	Drop a partition (and all its acquisitions)
+      /// \param [in]	month: the first day of month of the partition
+      //--------------------------------------------------------------
+      void dropPartition(const boost::gregorian::date& month);
+
+      //--------------------------------------------------------------
+      /// \brief	Get the partition table of a month
+      /// \param [in]	month: the first day of month of the partition
+      /// \return       The partition table
+      //--------------------------------------------------------------
+      static CDatabaseTable partitionTable(const boost::gregorian::date& month);
+
+      //--------------------------------------------------------------
+      /// \brief	Get the month of a date
+      /// \param [in]	date: the date
+      /// \return       The first day of month of the date
+      //--------------------------------------------------------------
+      static boost::gregorian::date monthOf(const boost::posix_time::ptime& date);
+
+   private:
+      //--------------------------------------------------------------
+      /// \brief	Load existing partitions from database (only once)
+      //--------------------------------------------------------------
+      void loadPartitions();
+
+      //--------------------------------------------------------------
+      /// \brief	Create a partition
+      /// \param [in]	month: the first day of month of the partition
+      //--------------------------------------------------------------
+      void createPartition(const boost::gregorian::date& month);
+
+      //--------------------------------------------------------------
+      /// \brief	Recreate the view gathering partitions (only if database doesn't support partitioned tables)
+      //--------------------------------------------------------------
+      void rebuildParentView();
+
+      //--------------------------------------------------------------
+      /// \brief	Get the names of the existing partitions, oldest first
+      //--------------------------------------------------------------
+      std::vector<std::string> partitionsNames() const;
+
+      //--------------------------------------------------------------
+      /// \brief	The database requester
+      //--------------------------------------------------------------
+      boost::shared_ptr<IDatabaseRequester> m_databaseRequester;
+
+      //--------------------------------------------------------------
+      /// \brief	Mutex protecting partitions list
+      //--------------------------------------------------------------
+      mutable boost::recursive_mutex m_partitionsMutex;
+
+      //--------------------------------------------------------------
+      /// \brief	true when partitions list is loaded from database
+      //--------------------------------------------------------------
+      bool m_partitionsLoaded;
+
+      //--------------------------------------------------------------
+      /// \brief	The existing partitions (first day of month)
+      //--------------------------------------------------------------
+      std::set<boost::gregorian::date> m_partitions;
+   };
+
+} //namespace common
+} //namespace database
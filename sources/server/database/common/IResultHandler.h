@@ -13,7 +13,11 @@ namespace common {
 
       virtual int getColumnCount() = 0;
       virtual std::string getColumnName(const int columnIndex) = 0;
+      // number of rows, or -1 if not known before stepping through the results
+      virtual int getRowCount() = 0;
       virtual bool next_step() = 0;
+      // view on the column text, owned by the handler and valid until next step
+      virtual const char* extractValueAsCString(const int columnIndex) = 0;
       virtual std::string extractValueAsString(const int columnIndex) = 0;
       virtual int extractValueAsInt(const int columnIndex) = 0;
       virtual float extractValueAsFloat(const int columnIndex) = 0;
@@ -10,6 +10,9 @@ namespace database
 {
    namespace common
    {
+      const int CPurgeTask::BatchSize = 5000;
+      const boost::posix_time::time_duration CPurgeTask::PauseBetweenBatches(boost::posix_time::milliseconds(100));
+
       CPurgeTask::CPurgeTask(boost::shared_ptr<IAcquisitionRequester> acquisitionRequester, boost::shared_ptr<IDatabaseRequester> sqlRequester)
          : m_acquisitionRequester(acquisitionRequester), m_sqlRequester(sqlRequester)
       {
@@ -17,6 +20,7 @@ namespace database
          auto startupOptions = shared::CServiceLocator::instance().get<const startupOptions::IStartupOptions>();
 
          m_acquisitionLifetimeDays = startupOptions->getDatabaseAcquisitionLifetime();
+         m_acquisitionLifetimeDaysByKeyword = startupOptions->getDatabaseAcquisitionLifetimeByKeyword();
       }
 
       CPurgeTask::~CPurgeTask()
@@ -27,21 +31,43 @@ namespace database
       {
          try
          {
+            YADOMS_LOG_CONFIGURE("Database purge task");
+            auto count = 0;
+
+            //keywords having their own lifetime are excluded from the global purge
+            std::vector<int> keptKeywords;
+            for (const auto& keywordLifetime : m_acquisitionLifetimeDaysByKeyword)
+               keptKeywords.push_back(keywordLifetime.first);
+
             if (m_acquisitionLifetimeDays > 0)
             {
-               YADOMS_LOG_CONFIGURE("Database purge task");
+               const auto globalPurgeDate = purgeDate(m_acquisitionLifetimeDays);
+               YADOMS_LOG(information) << "Purging database : removing acquisition of more than " << m_acquisitionLifetimeDays << " days : prior to " << globalPurgeDate;
+               count += purgeByBatches([this, &globalPurgeDate, &keptKeywords](int maxRows)
+               {
+                  return m_acquisitionRequester->purgeAcquisitions(globalPurgeDate, keptKeywords, maxRows);
+               });
+            }
 
-               //determine minimum datetime
-               boost::posix_time::ptime now(shared::currentTime::Provider().now().date());
-               boost::posix_time::time_duration realDuration = boost::posix_time::hours(24 * m_acquisitionLifetimeDays);
-               boost::posix_time::ptime purgeDate = now - realDuration;
+            for (const auto& keywordLifetime : m_acquisitionLifetimeDaysByKeyword)
+            {
+               if (keywordLifetime.second <= 0)
+                  continue;
 
-               YADOMS_LOG(information) << "Purging database : removing acquisition of more than " << m_acquisitionLifetimeDays << " days : prior to " << purgeDate;
-               int count = m_acquisitionRequester->purgeAcquisitions(purgeDate);
+               const auto keywordId = keywordLifetime.first;
+               const auto keywordPurgeDate = purgeDate(keywordLifetime.second);
+               YADOMS_LOG(information) << "Purging database : removing acquisition of keyword " << keywordId << " of more than " << keywordLifetime.second << " days : prior to " << keywordPurgeDate;
+               count += purgeByBatches([this, keywordId, &keywordPurgeDate](int maxRows)
+               {
+                  return m_acquisitionRequester->purgeKeywordAcquisitions(keywordId, keywordPurgeDate, maxRows);
+               });
+            }
 
-               //if any data have been deleted, then call vacuum to free disk space
-               if (count > 0)
-                  m_sqlRequester->vacuum();
+            //if any data have been deleted, then free disk space
+            if (count > 0)
+            {
+               YADOMS_LOG(information) << count << " acquisitions removed";
+               m_sqlRequester->releaseFreeSpace();
             }
          }
          catch (std::exception& ex)
@@ -49,6 +75,27 @@ namespace database
             YADOMS_LOG(error) << "Error in purging database :" << ex.what();
          }
       }
+
+      int CPurgeTask::purgeByBatches(boost::function<int(int)> purgeBatch)
+      {
+         auto total = 0;
+         while (true)
+         {
+            const auto count = purgeBatch(BatchSize);
+            total += count;
+            if (count < BatchSize)
+               return total;
+
+            boost::this_thread::sleep(PauseBetweenBatches);
+         }
+      }
+
+      boost::posix_time::ptime CPurgeTask::purgeDate(int lifetimeDays)
+      {
+         //determine minimum datetime
+         boost::posix_time::ptime now(shared::currentTime::Provider().now().date());
+         return now - boost::posix_time::hours(24 * lifetimeDays);
+      }
    } //namespace common
 } //namespace database 
 
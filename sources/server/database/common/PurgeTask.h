@@ -28,6 +28,30 @@ namespace database
          // [END] Poco::Util::TimerTask implementation 
 
       private:
+         //--------------------------------------------------------------
+         /// \Brief		   Purge by batches until nothing is left to purge
+         /// \param [in]	purgeBatch  Function deleting one batch, returning the deleted rows count
+         /// \return       The total deleted rows count
+         //--------------------------------------------------------------
+         static int purgeByBatches(boost::function<int(int)> purgeBatch);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Get the purge date for a lifetime
+         /// \param [in]	lifetimeDays  The acquisition lifetime (in days)
+         /// \return       The purge date (any data prior to this date will be deleted)
+         //--------------------------------------------------------------
+         static boost::posix_time::ptime purgeDate(int lifetimeDays);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Number of acquisitions deleted by each batch
+         //--------------------------------------------------------------
+         static const int BatchSize;
+
+         //--------------------------------------------------------------
+         /// \Brief		   Pause between batches, to let other writers access the database
+         //--------------------------------------------------------------
+         static const boost::posix_time::time_duration PauseBetweenBatches;
+
          //--------------------------------------------------------------
          /// \Brief		   Acquisition requester
          //--------------------------------------------------------------
@@ -42,6 +66,11 @@ namespace database
          /// \Brief		   Acquisition lifetime (in days)
          //--------------------------------------------------------------
          int m_acquisitionLifetimeDays;
+
+         //--------------------------------------------------------------
+         /// \Brief		   Acquisition lifetime (in days, 0 for unlimited) of specific keywords
+         //--------------------------------------------------------------
+         std::map<int, int> m_acquisitionLifetimeDaysByKeyword;
       };
    } //namespace common
 } //namespace database 
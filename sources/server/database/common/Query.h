@@ -17,6 +17,7 @@ namespace database
 #define CQUERY_OP_EQUAL "="
 #define CQUERY_OP_LIKE " LIKE "
 #define CQUERY_OP_IN " IN "
+#define CQUERY_OP_NOT_IN " NOT IN "
 #define CQUERY_OP_SUP ">"
 #define CQUERY_OP_INF "<"
 #define CQUERY_OP_NOT_EQUAL "<>"
@@ -816,6 +817,14 @@ namespace database
          template <class T>
          inline const CFunction distinct(const T& fieldOrQuery);
 
+         //--------------------------------------------------------------
+         ///\brief	generate a values list, to be used with CQUERY_OP_IN ( ie: (value1, value2, value3) )
+         ///\param [in]	values       The values (must not be empty)
+         ///\return The query function
+         //--------------------------------------------------------------
+         template <class T>
+         inline const CFunction valuesList(const std::vector<T>& values);
+
 
          //--------------------------------------------------------------
          ///\brief	generate column naming sql
@@ -659,6 +659,19 @@ inline const CQuery::CFunction CQuery::distinct(const T & fieldOrQuery)
 
 
 
+template<class T>
+inline const CQuery::CFunction CQuery::valuesList(const std::vector<T> & values)
+{
+   std::string list;
+   for (const auto& value : values)
+   {
+      if (!list.empty())
+         list += ",";
+      list += queryhelper<T>::format(this, value);
+   }
+   return CFunction("(" + list + ")");
+}
+
 template<class T1, class T2>
 inline const CQuery::CFunction CQuery::math(const T1 & value1, const std::string & op, const T2 & value2)
 {
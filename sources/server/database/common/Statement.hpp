@@ -0,0 +1,176 @@
+#pragma once
+
+#include "StatementBuilder.h"
+#include "database/IDatabaseRequester.h"
+#include <shared/enumeration/IExtendedEnum.h>
+
+namespace database
+{
+   namespace common
+   {
+      //--------------------------------------------------------------
+      /// \brief	    Helper structure for converting a value to a statement parameter
+      ///            (parameters are bound, so strings are never quoted nor escaped)
+      //--------------------------------------------------------------
+      template <typename T, class Enable = void>
+      struct statementParameter
+      {
+         static std::string format(const T& value)
+         {
+            return boost::lexical_cast<std::string>(value);
+         }
+      };
+
+      template <>
+      struct statementParameter<std::string>
+      {
+         static const std::string& format(const std::string& value)
+         {
+            return value;
+         }
+      };
+
+      template <>
+      struct statementParameter<bool>
+      {
+         static std::string format(const bool& value)
+         {
+            return value ? "1" : "0";
+         }
+      };
+
+      template <typename T>
+      struct statementParameter<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type>
+      {
+         static std::string format(const T& value)
+         {
+            return std::to_string(value);
+         }
+      };
+
+      template <>
+      struct statementParameter<boost::posix_time::ptime>
+      {
+         static std::string format(const boost::posix_time::ptime& value)
+         {
+            return boost::posix_time::to_iso_string(value);
+         }
+      };
+
+      template <typename T>
+      struct statementParameter<T, typename std::enable_if<std::is_base_of<shared::enumeration::IExtendedEnum, T>::value>::type>
+      {
+         static std::string format(const T& value)
+         {
+            return value.toString();
+         }
+      };
+
+
+      //--------------------------------------------------------------
+      /// \Brief		   A typed statement template
+      ///
+      /// The statement text is built once (typically as a function static) and prepared by the
+      /// database at first execution. Each execution only binds the values.
+      /// Values types are checked at compile time, and are converted without any SQL formatting.
+      ///\template      TParameters : the types of the statement parameters, in placeholders order
+      ///
+      /// Example :
+      ///   static const CStatement<int, std::string> Statement("getDeviceInPlugin",
+      ///      CStatementBuilder().Select().From(CDeviceTable::getTableName()).
+      ///         Where(CDeviceTable::getPluginIdColumnName(), CQUERY_OP_EQUAL).
+      ///         And(CDeviceTable::getNameColumnName(), CQUERY_OP_EQUAL));
+      ///   Statement.queryEntities(*m_databaseRequester, &adapter, pluginId, name);
+      //--------------------------------------------------------------
+      template <typename... TParameters>
+      class CStatement
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \Brief		   Constructor
+         /// \param [in]	name     The statement unique name
+         /// \param [in]	builder  The statement text builder
+         //--------------------------------------------------------------
+         CStatement(const std::string& name, const CStatementBuilder& builder)
+            : m_name(name),
+              m_text(builder.str())
+         {
+            BOOST_ASSERT_MSG(builder.parametersCount() == sizeof...(TParameters), "Statement parameters count doesn't match its placeholders");
+         }
+
+         //--------------------------------------------------------------
+         /// \Brief		   Destructor
+         //--------------------------------------------------------------
+         virtual ~CStatement()
+         {
+         }
+
+         //--------------------------------------------------------------
+         /// \Brief		   Get the statement name
+         //--------------------------------------------------------------
+         const std::string& name() const
+         {
+            return m_name;
+         }
+
+         //--------------------------------------------------------------
+         /// \Brief		   Get the statement text
+         //--------------------------------------------------------------
+         const std::string& str() const
+         {
+            return m_text;
+         }
+
+         //--------------------------------------------------------------
+         /// \Brief		   Bind values to the statement (to be executed later or in a batch)
+         /// \param [in]	values   The parameters values
+         /// \return       The statement call
+         //--------------------------------------------------------------
+         IDatabaseRequester::PreparedStatement bind(const TParameters&... values) const
+         {
+            IDatabaseRequester::PreparedStatement statement;
+            statement.name = m_name;
+            statement.statement = m_text;
+            statement.parameters = {statementParameter<TParameters>::format(values)...};
+            return statement;
+         }
+
+         //--------------------------------------------------------------
+         /// \Brief		   Execute the statement, and adapt the resulting rows
+         /// \param [in]	requester   The database requester
+         /// \param [in]	adapter     The adapter to use to map raw values to entities
+         /// \param [in]	values      The parameters values
+         //--------------------------------------------------------------
+         void queryEntities(IDatabaseRequester& requester,
+                            adapters::IResultAdapter* adapter,
+                            const TParameters&... values) const
+         {
+            requester.queryPreparedEntities(adapter, m_name, m_text, {statementParameter<TParameters>::format(values)...});
+         }
+
+         //--------------------------------------------------------------
+         /// \Brief		   Execute the statement (create, update, delete)
+         /// \param [in]	requester   The database requester
+         /// \param [in]	values      The parameters values
+         /// \return       The number of affected lines
+         /// \throws       CDatabaseException if the statement fails
+         //--------------------------------------------------------------
+         int execute(IDatabaseRequester& requester,
+                     const TParameters&... values) const
+         {
+            return requester.queryPreparedStatement(m_name, m_text, {statementParameter<TParameters>::format(values)...});
+         }
+
+      private:
+         //--------------------------------------------------------------
+         /// \Brief		   The statement unique name
+         //--------------------------------------------------------------
+         const std::string m_name;
+
+         //--------------------------------------------------------------
+         /// \Brief		   The statement text
+         //--------------------------------------------------------------
+         const std::string m_text;
+      };
+   } //namespace common
+} //namespace database
@@ -0,0 +1,236 @@
+#include "stdafx.h"
+#include "StatementBuilder.h"
+
+namespace database
+{
+   namespace common
+   {
+      CStatementBuilder::CStatementBuilder()
+         : m_parametersCount(0),
+           m_setStarted(false)
+      {
+      }
+
+      CStatementBuilder::~CStatementBuilder()
+      {
+      }
+
+      CStatementBuilder& CStatementBuilder::Select()
+      {
+         m_text += "SELECT *";
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::Select(Columns columns)
+      {
+         m_text += "SELECT ";
+         auto first = true;
+         for (const auto& column : columns)
+         {
+            if (!first)
+               m_text += ", ";
+            m_text += column.get().GetName();
+            first = false;
+         }
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::Select(const CDatabaseTable& table, Columns columns, const std::string& aliasPrefix)
+      {
+         m_text += "SELECT ";
+         appendColumns(table, columns, aliasPrefix);
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::AndSelect(const CDatabaseTable& table, Columns columns, const std::string& aliasPrefix)
+      {
+         m_text += ", ";
+         appendColumns(table, columns, aliasPrefix);
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::From(const CDatabaseTable& table)
+      {
+         m_text += " FROM ";
+         m_text += table.GetName();
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::LeftJoin(const CDatabaseTable& table, const CDatabaseColumn& column,
+                                                     const CDatabaseTable& joinedTable, const CDatabaseColumn& joinedColumn)
+      {
+         m_text += " LEFT JOIN ";
+         m_text += table.GetName();
+         m_text += " ON ";
+         m_text += qualified(table, column).GetName();
+         m_text += " = ";
+         m_text += qualified(joinedTable, joinedColumn).GetName();
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::InsertInto(const CDatabaseTable& table, Columns columns)
+      {
+         m_text += "INSERT INTO ";
+         m_text += table.GetName();
+         m_text += " (";
+         auto first = true;
+         for (const auto& column : columns)
+         {
+            if (!first)
+               m_text += ", ";
+            m_text += column.get().GetName();
+            first = false;
+         }
+         m_text += ") VALUES (";
+         for (std::size_t index = 0; index < columns.size(); ++index)
+         {
+            if (index != 0)
+               m_text += ", ";
+            appendParameter();
+         }
+         m_text += ")";
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::Update(const CDatabaseTable& table)
+      {
+         m_text += "UPDATE ";
+         m_text += table.GetName();
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::Set(const CDatabaseColumn& column)
+      {
+         m_text += m_setStarted ? ", " : " SET ";
+         m_setStarted = true;
+         m_text += column.GetName();
+         m_text += " = ";
+         appendParameter();
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::DeleteFrom(const CDatabaseTable& table)
+      {
+         m_text += "DELETE FROM ";
+         m_text += table.GetName();
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::Where(const CDatabaseColumn& column, const std::string& op)
+      {
+         appendCondition(" WHERE ", column, op);
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::And(const CDatabaseColumn& column, const std::string& op)
+      {
+         appendCondition(" AND ", column, op);
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::WhereIn(const CDatabaseColumn& column)
+      {
+         m_text += " WHERE ";
+         m_text += column.GetName();
+         m_text += " IN (";
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::AndIn(const CDatabaseColumn& column)
+      {
+         m_text += " AND ";
+         m_text += column.GetName();
+         m_text += " IN (";
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::EndIn()
+      {
+         m_text += ")";
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::OrderBy(const CDatabaseColumn& column, bool descending)
+      {
+         m_text += " ORDER BY ";
+         m_text += column.GetName();
+         if (descending)
+            m_text += " DESC";
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::ThenBy(const CDatabaseColumn& column, bool descending)
+      {
+         m_text += ", ";
+         m_text += column.GetName();
+         if (descending)
+            m_text += " DESC";
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::Limit(int count)
+      {
+         m_text += " LIMIT ";
+         m_text += std::to_string(count);
+         return *this;
+      }
+
+      CStatementBuilder& CStatementBuilder::Limit()
+      {
+         m_text += " LIMIT ";
+         appendParameter();
+         return *this;
+      }
+
+      CDatabaseColumn CStatementBuilder::qualified(const CDatabaseTable& table, const CDatabaseColumn& column)
+      {
+         return CDatabaseColumn(table.GetName() + "." + column.GetName());
+      }
+
+      const std::string& CStatementBuilder::str() const
+      {
+         return m_text;
+      }
+
+      int CStatementBuilder::parametersCount() const
+      {
+         return m_parametersCount;
+      }
+
+      void CStatementBuilder::appendCondition(const char* keyword, const CDatabaseColumn& column, const std::string& op)
+      {
+         m_text += keyword;
+         m_text += column.GetName();
+         m_text += ' ';
+         m_text += boost::trim_copy(op);
+         m_text += ' ';
+         appendParameter();
+      }
+
+      void CStatementBuilder::appendParameter()
+      {
+         m_text += '$';
+         m_text += std::to_string(++m_parametersCount);
+      }
+
+      void CStatementBuilder::appendColumns(const CDatabaseTable& table, Columns columns, const std::string& aliasPrefix)
+      {
+         auto first = true;
+         for (const auto& column : columns)
+         {
+            if (!first)
+               m_text += ", ";
+            m_text += table.GetName();
+            m_text += '.';
+            m_text += column.get().GetName();
+            if (!aliasPrefix.empty())
+            {
+               m_text += " AS ";
+               m_text += aliasPrefix;
+               m_text += column.get().GetName();
+            }
+            first = false;
+         }
+      }
+   } //namespace common
+} //namespace database
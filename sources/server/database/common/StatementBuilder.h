@@ -0,0 +1,214 @@
+#pragma once
+
+#include "DatabaseColumn.h"
+
+namespace database
+{
+   namespace common
+   {
+      //--------------------------------------------------------------
+      /// \Brief		   Builder of the SQL text of a statement template
+      ///
+      /// Values are never written in the text : each value is a placeholder ($1, $2... numbered
+      /// in order of appearance, understood by all database engines), bound at execution.
+      /// So a statement text is built once, and the statement is then executed with any values
+      /// (see CStatement).
+      ///
+      /// Example :
+      ///   CStatementBuilder().Select().From(CDeviceTable::getTableName()).Where(CDeviceTable::getIdColumnName(), CQUERY_OP_EQUAL)
+      ///   gives "SELECT * FROM Device WHERE id = $1"
+      //--------------------------------------------------------------
+      class CStatementBuilder
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \Brief		   A list of columns
+         //--------------------------------------------------------------
+         typedef std::initializer_list<std::reference_wrapper<const CDatabaseColumn>> Columns;
+
+         //--------------------------------------------------------------
+         /// \Brief		   Constructor
+         //--------------------------------------------------------------
+         CStatementBuilder();
+
+         //--------------------------------------------------------------
+         /// \Brief		   Destructor
+         //--------------------------------------------------------------
+         virtual ~CStatementBuilder();
+
+         //--------------------------------------------------------------
+         /// \Brief		   Start a query "SELECT *"
+         //--------------------------------------------------------------
+         CStatementBuilder& Select();
+
+         //--------------------------------------------------------------
+         /// \Brief		   Start a query "SELECT column1, column2..."
+         /// \param [in]	columns  The selected columns
+         //--------------------------------------------------------------
+         CStatementBuilder& Select(Columns columns);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Start a query "SELECT table.column1 AS prefixcolumn1, table.column2 AS prefixcolumn2..."
+         /// \param [in]	table       The table of the columns
+         /// \param [in]	columns     The selected columns
+         /// \param [in]	aliasPrefix The prefix of the result columns names (no alias if empty)
+         //--------------------------------------------------------------
+         CStatementBuilder& Select(const CDatabaseTable& table, Columns columns, const std::string& aliasPrefix = std::string());
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add columns to the selected ones ", table.column1 AS prefixcolumn1..."
+         /// \param [in]	table       The table of the columns
+         /// \param [in]	columns     The selected columns
+         /// \param [in]	aliasPrefix The prefix of the result columns names (no alias if empty)
+         //--------------------------------------------------------------
+         CStatementBuilder& AndSelect(const CDatabaseTable& table, Columns columns, const std::string& aliasPrefix = std::string());
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add "FROM table"
+         /// \param [in]	table  The table
+         //--------------------------------------------------------------
+         CStatementBuilder& From(const CDatabaseTable& table);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add "LEFT JOIN table ON table.column = joinedTable.joinedColumn"
+         ///               (the join condition can be completed by And)
+         /// \param [in]	table          The joined table
+         /// \param [in]	column         The column of the joined table
+         /// \param [in]	joinedTable    The table already in the query
+         /// \param [in]	joinedColumn   The column of the table already in the query
+         //--------------------------------------------------------------
+         CStatementBuilder& LeftJoin(const CDatabaseTable& table, const CDatabaseColumn& column,
+                                     const CDatabaseTable& joinedTable, const CDatabaseColumn& joinedColumn);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Start a query "INSERT INTO table (column1, column2...) VALUES ($n, $n+1...)"
+         /// \param [in]	table    The table
+         /// \param [in]	columns  The inserted columns (one parameter per column)
+         //--------------------------------------------------------------
+         CStatementBuilder& InsertInto(const CDatabaseTable& table, Columns columns);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Start a query "UPDATE table"
+         /// \param [in]	table  The table
+         //--------------------------------------------------------------
+         CStatementBuilder& Update(const CDatabaseTable& table);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add "SET column = $n" (or ", column = $n" after the first one)
+         /// \param [in]	column  The updated column
+         //--------------------------------------------------------------
+         CStatementBuilder& Set(const CDatabaseColumn& column);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Start a query "DELETE FROM table"
+         /// \param [in]	table  The table
+         //--------------------------------------------------------------
+         CStatementBuilder& DeleteFrom(const CDatabaseTable& table);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add "WHERE column op $n"
+         /// \param [in]	column  The column
+         /// \param [in]	op      The operator (CQUERY_OP_EQUAL, CQUERY_OP_LIKE...)
+         //--------------------------------------------------------------
+         CStatementBuilder& Where(const CDatabaseColumn& column, const std::string& op);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add "AND column op $n"
+         /// \param [in]	column  The column
+         /// \param [in]	op      The operator (CQUERY_OP_EQUAL, CQUERY_OP_LIKE...)
+         //--------------------------------------------------------------
+         CStatementBuilder& And(const CDatabaseColumn& column, const std::string& op);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add "WHERE column IN (" : the subquery follows, and is closed by EndIn
+         /// \param [in]	column  The column
+         //--------------------------------------------------------------
+         CStatementBuilder& WhereIn(const CDatabaseColumn& column);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add "AND column IN (" : the subquery follows, and is closed by EndIn
+         /// \param [in]	column  The column
+         //--------------------------------------------------------------
+         CStatementBuilder& AndIn(const CDatabaseColumn& column);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Close the subquery started by WhereIn or AndIn
+         //--------------------------------------------------------------
+         CStatementBuilder& EndIn();
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add "ORDER BY column [DESC]"
+         /// \param [in]	column      The column
+         /// \param [in]	descending  true to sort in descending order
+         //--------------------------------------------------------------
+         CStatementBuilder& OrderBy(const CDatabaseColumn& column, bool descending = false);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add a secondary sort column ", column [DESC]" (after OrderBy)
+         /// \param [in]	column      The column
+         /// \param [in]	descending  true to sort in descending order
+         //--------------------------------------------------------------
+         CStatementBuilder& ThenBy(const CDatabaseColumn& column, bool descending = false);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add "LIMIT count" (count is a constant of the statement)
+         /// \param [in]	count  The maximum number of rows
+         //--------------------------------------------------------------
+         CStatementBuilder& Limit(int count);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Add "LIMIT $n" (count is a parameter)
+         //--------------------------------------------------------------
+         CStatementBuilder& Limit();
+
+         //--------------------------------------------------------------
+         /// \Brief		   Get a column qualified by its table name ("table.column"), to be used
+         ///               when several tables of the query have the same column
+         /// \param [in]	table    The table
+         /// \param [in]	column   The column
+         //--------------------------------------------------------------
+         static CDatabaseColumn qualified(const CDatabaseTable& table, const CDatabaseColumn& column);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Get the statement text
+         //--------------------------------------------------------------
+         const std::string& str() const;
+
+         //--------------------------------------------------------------
+         /// \Brief		   Get the number of parameters of the statement
+         //--------------------------------------------------------------
+         int parametersCount() const;
+
+      private:
+         //--------------------------------------------------------------
+         /// \Brief		   Append a condition "keyword column op $n"
+         //--------------------------------------------------------------
+         void appendCondition(const char* keyword, const CDatabaseColumn& column, const std::string& op);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Append the next placeholder
+         //--------------------------------------------------------------
+         void appendParameter();
+
+         //--------------------------------------------------------------
+         /// \Brief		   Append a list of qualified (and optionally aliased) columns
+         //--------------------------------------------------------------
+         void appendColumns(const CDatabaseTable& table, Columns columns, const std::string& aliasPrefix);
+
+         //--------------------------------------------------------------
+         /// \Brief		   The statement text
+         //--------------------------------------------------------------
+         std::string m_text;
+
+         //--------------------------------------------------------------
+         /// \Brief		   The number of placeholders in the statement
+         //--------------------------------------------------------------
+         int m_parametersCount;
+
+         //--------------------------------------------------------------
+         /// \Brief		   true when a SET clause is already started
+         //--------------------------------------------------------------
+         bool m_setStarted;
+      };
+   } //namespace common
+} //namespace database
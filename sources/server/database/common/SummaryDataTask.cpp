@@ -13,6 +13,7 @@
 namespace database { 
 namespace common { 
 
+   const std::size_t CSummaryDataTask::KeywordsChunkSize = 500;
 
    CSummaryDataTask::CSummaryDataTask(boost::shared_ptr<IAcquisitionRequester> acquisitionRequester, boost::shared_ptr<IKeywordRequester> keywordRequester)
       :m_acquisitionRequester(acquisitionRequester), m_keywordRequester(keywordRequester), m_firstRun(true)
@@ -74,120 +75,92 @@ namespace common {
 
       //check all keyword last date value
       //foreach
-      //    if SummaryHour don't exist, then compute it
-      //    if SummaryDay don't exist, then compute it
-      std::vector<boost::shared_ptr<entities::CKeyword> > keywords = m_keywordRequester->getAllKeywords();
-      std::vector<boost::shared_ptr<entities::CKeyword> >::iterator i;
-      for (i = keywords.begin(); i != keywords.end(); ++i)
+      //    determine the summary periods to compute
+      //then compute each period for all its keywords at once
+      const auto now = shared::currentTime::Provider().now();
+      std::map<boost::posix_time::ptime, std::vector<int> > hours, days, months, years;
+
+      const auto keywords = m_keywordRequester->getAllKeywords();
+      for (const auto& keyword : keywords)
+      {
+         if (keyword->Type() != shared::plugin::yPluginApi::EKeywordDataType::kNumeric)
+            continue;
+
+         //the last acquisition is stored with the keyword, no need to query it
+         if (!keyword->LastAcquisitionDate.isDefined() || keyword->LastAcquisitionDate().is_not_a_date_time())
+            continue;
+
+         //if current day
+         //    if NOT same hour
+         //       compute HOUR
+         //else
+         //    compute hour
+         //    compute day
+         const auto acqDate = keyword->LastAcquisitionDate();
+         const auto computeYearValue = acqDate.date().year() != now.date().year();
+         const auto computeMonthValue = computeYearValue || acqDate.date().month() != now.date().month();
+         const auto computeDayValue = computeMonthValue || acqDate.date().day() != now.date().day();
+         const auto computeHourValue = computeDayValue || acqDate.time_of_day().hours() != now.time_of_day().hours();
+
+         if (computeHourValue)
+            hours[boost::posix_time::ptime(acqDate.date(), boost::posix_time::hours(acqDate.time_of_day().hours()))].push_back(keyword->Id());
+         if (computeDayValue)
+            days[boost::posix_time::ptime(acqDate.date())].push_back(keyword->Id());
+         if (computeMonthValue)
+            months[boost::posix_time::ptime(boost::gregorian::date(acqDate.date().year(), acqDate.date().month(), 1))].push_back(keyword->Id());
+         if (computeYearValue)
+            years[boost::posix_time::ptime(boost::gregorian::date(acqDate.date().year(), 1, 1))].push_back(keyword->Id());
+      }
+
+      //each summary level is computed from the previous one, so keep hour -> day -> month -> year order
+      std::vector<boost::shared_ptr<entities::CAcquisitionSummary> > summaryAcquisitions;
+      for (const auto& period : hours)
+         computeSummaryData(period.second, entities::EAcquisitionSummaryType::kHour, period.first, summaryAcquisitions);
+      for (const auto& period : days)
+         computeSummaryData(period.second, entities::EAcquisitionSummaryType::kDay, period.first, summaryAcquisitions);
+      for (const auto& period : months)
+         computeSummaryData(period.second, entities::EAcquisitionSummaryType::kMonth, period.first, summaryAcquisitions);
+      for (const auto& period : years)
+         computeSummaryData(period.second, entities::EAcquisitionSummaryType::kYear, period.first, summaryAcquisitions);
+   }
+
+   std::set<int> CSummaryDataTask::getNumericKeywords() const
+   {
+      std::set<int> numericKeywords;
+      const auto keywords = m_keywordRequester->getAllKeywords();
+      for (const auto& keyword : keywords)
       {
-         if (i->get()->Type() == shared::plugin::yPluginApi::EKeywordDataType::kNumeric)
+         if (keyword->Type() == shared::plugin::yPluginApi::EKeywordDataType::kNumeric)
+            numericKeywords.insert(keyword->Id());
+      }
+      return numericKeywords;
+   }
+
+   void CSummaryDataTask::computeSummaryData(const std::vector<int>& keywordIds,
+                                             const entities::EAcquisitionSummaryType& type,
+                                             const boost::posix_time::ptime& dataTime,
+                                             std::vector<boost::shared_ptr<entities::CAcquisitionSummary> >& results) const
+   {
+      for (std::size_t chunkBegin = 0; chunkBegin < keywordIds.size(); chunkBegin += KeywordsChunkSize)
+      {
+         const auto chunkEnd = std::min(chunkBegin + KeywordsChunkSize, keywordIds.size());
+         const std::vector<int> chunk(keywordIds.begin() + chunkBegin, keywordIds.begin() + chunkEnd);
+
+         try
+         {
+            const auto computed = m_acquisitionRequester->saveSummaryData(chunk, type, dataTime);
+            results.insert(results.end(), computed.begin(), computed.end());
+         }
+         catch (shared::exception::CEmptyResult& ex)
+         {
+            YADOMS_LOG(information) << "Cannot compute " << type.toString() << " summary values : " << ex.what();
+         }
+         catch (std::exception& ex)
          {
-            try
-            {
-               boost::shared_ptr<entities::CAcquisition> lastData = m_keywordRequester->getKeywordLastAcquisition(i->get()->Id);
-
-               //if current day
-               //    if NOT same hour
-               //       compute HOUR
-               //else
-               //    compute hour
-               //    compute day
-
-
-               tm acqDate = boost::posix_time::to_tm(lastData->Date());
-               tm now = boost::posix_time::to_tm(boost::posix_time::second_clock::local_time());
-
-               bool computeHourValue = false, computeDayValue = false, computeMonthValue = false, computeYearValue = false;
-
-               if (acqDate.tm_year != now.tm_year)
-               {
-                  //the year changed, , so compute everything
-                  computeYearValue = true;
-                  computeMonthValue = true;
-                  computeDayValue = true;
-                  computeHourValue = true;
-               }
-               else
-               {
-                  //same year
-                  if (acqDate.tm_mon != now.tm_mon)
-                  {
-                     //month changes, so compute (month, day and hour)
-                     computeMonthValue = true;
-                     computeDayValue = true;
-                     computeHourValue = true;
-                  }
-                  else
-                  {
-                     //same month, same year, do not compute year and month summary values
-                     if (acqDate.tm_yday != now.tm_yday)
-                     {
-                        //day changes, so compute (day and hour)
-                        computeDayValue = true;
-                        computeHourValue = true;
-                     }
-                     else
-                     {
-                        //same year, month and day
-                        if (acqDate.tm_hour != now.tm_hour)
-                        {
-                           //the hour have changed, compute hour summary data
-                           computeHourValue = true;
-                        }
-                     }
-                  }
-               }
-
-               if (computeHourValue)
-               {
-                  if (!m_acquisitionRequester->summaryDataExists(i->get()->Id(), database::entities::EAcquisitionSummaryType::kHour, lastData->Date()))
-                  {
-                     YADOMS_LOG(debug) << "    Computing HOUR : " << i->get()->FriendlyName() << " @ " << lastData->Date() << " ...";
-                     m_acquisitionRequester->saveSummaryData(i->get()->Id(), database::entities::EAcquisitionSummaryType::kHour, lastData->Date());
-                     YADOMS_LOG(debug) << "    Computing HOUR : " << i->get()->FriendlyName() << " @ " << lastData->Date() << " done";
-                  }
-               }
-
-               if (computeDayValue)
-               {
-                  if (!m_acquisitionRequester->summaryDataExists(i->get()->Id(), database::entities::EAcquisitionSummaryType::kDay, lastData->Date()))
-                  {
-                     YADOMS_LOG(debug) << "    Computing DAY : " << i->get()->FriendlyName() << " @ " << lastData->Date() << " ...";
-                     m_acquisitionRequester->saveSummaryData(i->get()->Id(), database::entities::EAcquisitionSummaryType::kDay, lastData->Date());
-                     YADOMS_LOG(debug) << "    Computing DAY : " << i->get()->FriendlyName() << " @ " << lastData->Date() << " done";
-                  }
-               }
-
-               if (computeMonthValue)
-               {
-                  if (!m_acquisitionRequester->summaryDataExists(i->get()->Id(), database::entities::EAcquisitionSummaryType::kMonth, lastData->Date()))
-                  {
-                     YADOMS_LOG(debug) << "    Computing MONTH : " << i->get()->FriendlyName() << " @ " << lastData->Date() << " ...";
-                     m_acquisitionRequester->saveSummaryData(i->get()->Id(), database::entities::EAcquisitionSummaryType::kMonth, lastData->Date());
-                     YADOMS_LOG(debug) << "    Computing MONTH : " << i->get()->FriendlyName() << " @ " << lastData->Date() << " done";
-                  }
-               }
-
-
-               if (computeYearValue)
-               {
-                  if (!m_acquisitionRequester->summaryDataExists(i->get()->Id(), database::entities::EAcquisitionSummaryType::kYear, lastData->Date()))
-                  {
-                     YADOMS_LOG(debug) << "    Computing YEAR : " << i->get()->FriendlyName() << " @ " << lastData->Date() << " ...";
-                     m_acquisitionRequester->saveSummaryData(i->get()->Id(), database::entities::EAcquisitionSummaryType::kYear, lastData->Date());
-                     YADOMS_LOG(debug) << "    Computing YEAR : " << i->get()->FriendlyName() << " @ " << lastData->Date() << " done";
-                  }
-               }
-            }
-            catch (shared::exception::CEmptyResult & ex)
-            {
-               YADOMS_LOG(debug) << "Cannot compute summary values : " << ex.what();
-            }
-            catch (std::exception & ex)
-            {
-               YADOMS_LOG(error) << "Error in computing summary values :" << ex.what();
-            }
+            YADOMS_LOG(error) << "Error in computing " << type.toString() << " summary values :" << ex.what();
          }
+
+         YADOMS_LOG(debug) << "    Computing " << type.toString() << " @ " << dataTime << " : " << chunkEnd << "/" << keywordIds.size() << " keywords";
       }
    }
 
@@ -212,31 +185,14 @@ namespace common {
       boost::posix_time::ptime currentHour(now.date(), boost::posix_time::hours(now.time_of_day().hours()));
       boost::posix_time::ptime previousHour = currentHour - oneHour;
 
+      const auto numericKeywords = getNumericKeywords();
       std::vector<int> keywordToTreat;
       std::vector< boost::shared_ptr< database::entities::CAcquisitionSummary> > summaryAcquisitions;
 
       m_acquisitionRequester->getKeywordsHavingDate(previousHour, currentHour, keywordToTreat);
-      for (std::vector<int>::iterator i = keywordToTreat.begin(); i != keywordToTreat.end(); ++i)
-      {
-         try
-         {
-            if (!m_acquisitionRequester->summaryDataExists(*i, database::entities::EAcquisitionSummaryType::kHour, previousHour))
-            {
-               YADOMS_LOG(debug) << "    Computing HOUR : " << *i << " @ " << previousHour << " ...";
-               boost::shared_ptr< database::entities::CAcquisitionSummary> insertedValue = m_acquisitionRequester->saveSummaryData(*i, database::entities::EAcquisitionSummaryType::kHour, previousHour);
-               summaryAcquisitions.push_back(insertedValue);
-               YADOMS_LOG(debug) << "    Computing HOUR : " << *i << " @ " << previousHour << " done";
-            }
-         }
-         catch (shared::exception::CEmptyResult & ex)
-         {
-            YADOMS_LOG(information) << "Cannot compute HOUR summary value : " << ex.what();
-         }
-         catch (std::exception & ex)
-         {
-            YADOMS_LOG(error) << "Error in computing HOUR summary values :" << ex.what();
-         }
-      }
+      keywordToTreat.erase(std::remove_if(keywordToTreat.begin(), keywordToTreat.end(), [&numericKeywords](int id) { return numericKeywords.find(id) == numericKeywords.end(); }),
+                           keywordToTreat.end());
+      computeSummaryData(keywordToTreat, database::entities::EAcquisitionSummaryType::kHour, previousHour, summaryAcquisitions);
 
       //check if day have changed
       if (currentHour.date() != previousHour.date())
@@ -248,27 +204,9 @@ namespace common {
 
          keywordToTreat.clear();
          m_acquisitionRequester->getKeywordsHavingDate(previousDay, currentDay, keywordToTreat);
-         for (std::vector<int>::iterator i = keywordToTreat.begin(); i != keywordToTreat.end(); ++i)
-         {
-            try
-            {
-               if (!m_acquisitionRequester->summaryDataExists(*i, database::entities::EAcquisitionSummaryType::kDay, previousDay))
-               {
-                  YADOMS_LOG(debug) << "    Computing DAY : " << *i << " @ " << previousDay << " ...";
-                  boost::shared_ptr< database::entities::CAcquisitionSummary> insertedValue = m_acquisitionRequester->saveSummaryData(*i, database::entities::EAcquisitionSummaryType::kDay, previousDay);
-                  summaryAcquisitions.push_back(insertedValue);
-                  YADOMS_LOG(debug) << "    Computing DAY : " << *i << " @ " << previousDay << " done";
-               }
-            }
-            catch (shared::exception::CEmptyResult & ex)
-            {
-               YADOMS_LOG(information) << "Cannot compute DAY summary value : " << ex.what();
-            }
-            catch (std::exception & ex)
-            {
-               YADOMS_LOG(error) << "Error in computing DAY summary values :" << ex.what();
-            }
-         }
+         keywordToTreat.erase(std::remove_if(keywordToTreat.begin(), keywordToTreat.end(), [&numericKeywords](int id) { return numericKeywords.find(id) == numericKeywords.end(); }),
+                              keywordToTreat.end());
+         computeSummaryData(keywordToTreat, database::entities::EAcquisitionSummaryType::kDay, previousDay, summaryAcquisitions);
       }
 
       //post notification
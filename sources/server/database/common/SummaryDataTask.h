@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Poco/Util/TimerTask.h>
+#include <set>
 #include "database/IAcquisitionRequester.h"
 #include "database/IKeywordRequester.h"
 
@@ -31,6 +32,31 @@ namespace common {
       //--------------------------------------------------------------
       void executeFirstRunPass() const;
 
+      //--------------------------------------------------------------
+      /// \Brief		   Get the ids of all numeric keywords
+      /// \return       The numeric keywords id
+      //--------------------------------------------------------------
+      std::set<int> getNumericKeywords() const;
+
+      //--------------------------------------------------------------
+      /// \Brief		   Compute summary values of keywords, by chunks of KeywordsChunkSize keywords
+      /// \param [in]	keywordIds  The keywords to compute (numeric keywords only)
+      /// \param [in]	type        The summary type to compute
+      /// \param [in]	dataTime    Any datetime of the summary period
+      /// \param [out]	results     The computed summary values (appended)
+      /// \note         Each chunk is computed by one set-based query in its own transaction.
+      ///               A failing chunk is logged and does not prevent the other ones from being computed
+      //--------------------------------------------------------------
+      void computeSummaryData(const std::vector<int>& keywordIds,
+                              const entities::EAcquisitionSummaryType& type,
+                              const boost::posix_time::ptime& dataTime,
+                              std::vector<boost::shared_ptr<entities::CAcquisitionSummary> >& results) const;
+
+      //--------------------------------------------------------------
+      /// \Brief		   Maximum number of keywords computed by one query (keeps transactions and IN lists bounded)
+      //--------------------------------------------------------------
+      static const std::size_t KeywordsChunkSize;
+
       //--------------------------------------------------------------
       /// \Brief		   Method for implementing common process (not first run)
       //--------------------------------------------------------------
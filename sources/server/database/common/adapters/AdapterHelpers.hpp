@@ -168,18 +168,30 @@
 #define ADAPT_COLUMN_GET_REAL_TYPE(_elem) \
    BOOST_PP_IF(BOOST_PP_EQUAL(BOOST_PP_SEQ_SIZE(_elem), 4 ), BOOST_PP_SEQ_ELEM(ADAPTER_COLUMN_TYPE, _elem), BOOST_PP_EMPTY())
 
+//-------------------------------------------------------------------
+/// \brief  Macro which is called for each entity member and find the entity member of a column
+//-------------------------------------------------------------------
+#define ADAPT_COLUMN_INDEX(r, data, idx, elem) \
+   BOOST_PP_IF(BOOST_PP_EQUAL(idx,0), BOOST_PP_EMPTY(), else) \
+   if(boost::iequals(BOOST_PP_CAT(C##data##Table::get,BOOST_PP_CAT(BOOST_PP_SEQ_ELEM(ADAPTER_COLUMN_ID, elem), ColumnName().GetName())), columnName)) \
+      columnsMembers[nCol] = idx;
+
+//-------------------------------------------------------------------
+/// \brief  Macro which calls ADAPT_COLUMN_INDEX for each value in input set
+//-------------------------------------------------------------------
+#define ADAPT_COLUMNS_INDEXES(_tablename, _seq) \
+   BOOST_PP_SEQ_FOR_EACH_I(ADAPT_COLUMN_INDEX, _tablename, _seq)
+
 //-------------------------------------------------------------------
 /// \brief  Macro which is called for each entity member and provide setter implementation
 //-------------------------------------------------------------------
 #define ADAPT_COLUMN(r, data, idx, elem) \
-   BOOST_PP_IF(BOOST_PP_EQUAL(idx,0), BOOST_PP_EMPTY(), else) \
-   if(boost::iequals(BOOST_PP_CAT(C##data##Table::get,BOOST_PP_CAT(BOOST_PP_SEQ_ELEM(ADAPTER_COLUMN_ID, elem), ColumnName().GetName())), cols[nCol])) \
-	{ \
+   case idx: \
       if(resultHandler->isValueNull(nCol)) \
-   	newEntity-> BOOST_PP_SEQ_ELEM(ADAPTER_COLUMN_ID, elem) = BOOST_PP_SEQ_ELEM(ADAPTER_COLUMN_DEFAULT, elem); \
+         newEntity. BOOST_PP_SEQ_ELEM(ADAPTER_COLUMN_ID, elem) = BOOST_PP_SEQ_ELEM(ADAPTER_COLUMN_DEFAULT, elem); \
       else \
-         newEntity-> BOOST_PP_SEQ_ELEM(ADAPTER_COLUMN_ID, elem) = ADAPT_COLUMN_GET_REAL_TYPE(elem)( CSqlExtension::extractData< ADAPT_COLUMN_GET_INTERNAL_TYPE(elem) >(resultHandler, nCol) ); \
-   }
+         newEntity. BOOST_PP_SEQ_ELEM(ADAPTER_COLUMN_ID, elem) = ADAPT_COLUMN_GET_REAL_TYPE(elem)( CSqlExtension::extractData< ADAPT_COLUMN_GET_INTERNAL_TYPE(elem) >(resultHandler, nCol) ); \
+      break;
 
 //-------------------------------------------------------------------
 /// \brief  Macro which calls ADAPT_COLUMN for each value in input set
@@ -228,6 +240,8 @@
 
 //-------------------------------------------------------------------
 /// \brief  Declare the entity adapter class adapt method implementation
+///         Columns are matched to entity members once for the whole resultset,
+///         and entities are constructed in a few contiguous blocks (see CEntityStorage)
 //-------------------------------------------------------------------
 #define DECLARE_ADAPTER_IMPLEMENTATION_ADAPT(_tablename, _seq)\
    bool ADAPTER_CLASS(_tablename)::adapt(boost::shared_ptr<IResultHandler> resultHandler) \
@@ -235,22 +249,31 @@
       int nCols = resultHandler->getColumnCount(); \
       if (nCols) \
       { \
-         std::vector<std::string> cols; \
+         std::vector<int> columnsMembers(nCols, -1); \
          for (int nCol = 0; nCol < nCols; nCol++) \
-            cols.push_back(resultHandler->getColumnName(nCol)); \
+         { \
+            const auto columnName = resultHandler->getColumnName(nCol); \
+            ADAPT_COLUMNS_INDEXES(_tablename, _seq) \
+            else \
+            { \
+               YADOMS_LOG(warning) << "Unknown column Name= " << columnName; \
+            } \
+         } \
+         CEntityStorage<ENTITY_CLASS(_tablename)> entities(resultHandler->getRowCount()); \
          while (resultHandler->next_step()) \
          { \
-            boost::shared_ptr<ENTITY_CLASS(_tablename)> newEntity(new ENTITY_CLASS(_tablename)()); \
+            auto& newEntity = entities.emplace(); \
             for (int nCol = 0; nCol < nCols; nCol++) \
             { \
-               ADAPT_COLUMNS(_tablename, _seq) \
-               else \
+               switch (columnsMembers[nCol]) \
                { \
-                  YADOMS_LOG(warning) << "Unknown column Name= " << cols[nCol] << " Value=" << CSqlExtension::extractData<std::string>(resultHandler, nCol); \
+               ADAPT_COLUMNS(_tablename, _seq) \
+               default: \
+                  break; \
                } \
             } \
-            m_results.push_back(newEntity); \
          } \
+         entities.share(m_results); \
          return true; \
       } \
       return false; \
@@ -1,6 +1,7 @@
 #include "stdafx.h"
 #include "DatabaseAdapters.h"
 #include "SqlExtension.hpp"
+#include "EntityStorage.hpp"
 #include "../IResultHandler.h"
 #include "database/common/DatabaseTables.h"
 #include <shared/currentTime/Provider.h>
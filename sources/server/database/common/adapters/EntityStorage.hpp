@@ -0,0 +1,101 @@
+#pragma once
+
+namespace database
+{
+   namespace common
+   {
+      namespace adapters
+      {
+         //--------------------------------------------------------------
+         /// \Brief		Storage of the entities built from a resultset
+         ///
+         /// Entities are constructed in place in a few contiguous blocks (only one if the
+         /// row count is known in advance) instead of one allocation per entity.
+         /// Shared entities keep their whole block alive.
+         ///\template   TEntity : the entity type
+         //--------------------------------------------------------------
+         template <class TEntity>
+         class CEntityStorage
+         {
+         public:
+            //--------------------------------------------------------------
+            /// \Brief		Constructor
+            /// \param [in]	expectedSize   The expected entities count (-1 if not known)
+            //--------------------------------------------------------------
+            explicit CEntityStorage(int expectedSize)
+               : m_nextBlockSize(expectedSize > 0 ? static_cast<std::size_t>(expectedSize) : FirstBlockSize),
+                 m_size(0)
+            {
+            }
+
+            //--------------------------------------------------------------
+            /// \Brief		Destructor
+            //--------------------------------------------------------------
+            virtual ~CEntityStorage()
+            {
+            }
+
+            //--------------------------------------------------------------
+            /// \Brief		Construct a new entity
+            /// \return    The default constructed entity, to be filled
+            //--------------------------------------------------------------
+            TEntity& emplace()
+            {
+               //a block is never reallocated, so already constructed entities never move
+               if (m_blocks.empty() || m_blocks.back()->size() == m_blocks.back()->capacity())
+               {
+                  auto block = boost::make_shared<std::vector<TEntity>>();
+                  block->reserve(m_nextBlockSize);
+                  m_blocks.push_back(block);
+                  m_nextBlockSize *= 2;
+               }
+
+               m_blocks.back()->emplace_back();
+               ++m_size;
+               return m_blocks.back()->back();
+            }
+
+            //--------------------------------------------------------------
+            /// \Brief		Get the entities count
+            //--------------------------------------------------------------
+            std::size_t size() const
+            {
+               return m_size;
+            }
+
+            //--------------------------------------------------------------
+            /// \Brief		Append shared pointers on the stored entities
+            /// \param [out]	results  The entities list to complete
+            //--------------------------------------------------------------
+            void share(std::vector<boost::shared_ptr<TEntity>>& results) const
+            {
+               results.reserve(results.size() + m_size);
+               for (const auto& block : m_blocks)
+                  for (auto& entity : *block)
+                     results.push_back(boost::shared_ptr<TEntity>(block, &entity));
+            }
+
+         private:
+            //--------------------------------------------------------------
+            /// \Brief		Size of the first block, when row count is not known
+            //--------------------------------------------------------------
+            static const std::size_t FirstBlockSize = 8;
+
+            //--------------------------------------------------------------
+            /// \Brief		The blocks of entities
+            //--------------------------------------------------------------
+            std::vector<boost::shared_ptr<std::vector<TEntity>>> m_blocks;
+
+            //--------------------------------------------------------------
+            /// \Brief		The capacity of the next block (doubled for each new block)
+            //--------------------------------------------------------------
+            std::size_t m_nextBlockSize;
+
+            //--------------------------------------------------------------
+            /// \Brief		The entities count
+            //--------------------------------------------------------------
+            std::size_t m_size;
+         };
+      } //namespace adapters
+   } //namespace common
+} //namespace database
@@ -23,15 +23,21 @@ namespace database
             if (nCols)
             {
                std::vector<std::string> cols;
+               cols.reserve(nCols);
                for (auto nCol = 0; nCol < nCols; nCol++)
-                  cols.push_back(std::string(resultHandler->getColumnName(nCol)));
+                  cols.push_back(resultHandler->getColumnName(nCol));
+
+               const auto rowCount = resultHandler->getRowCount();
+               if (rowCount > 0)
+                  m_results.reserve(m_results.size() + rowCount);
 
                while (resultHandler->next_step())
                {
-                  std::map<std::string, std::string> newRow;
+                  //build the row in place, values are read directly from the column text
+                  m_results.emplace_back();
+                  auto& newRow = m_results.back();
                   for (auto nCol = 0; nCol < nCols; nCol++)
-                     newRow.insert(std::make_pair(cols[nCol], CSqlExtension::extractData<std::string>(resultHandler, nCol)));
-                  m_results.push_back(newRow);
+                     newRow.emplace(cols[nCol], resultHandler->extractValueAsCString(nCol));
                }
                return true;
             }
@@ -0,0 +1,268 @@
+#include "stdafx.h"
+#include "JsonCollectionAdapter.h"
+
+
+namespace database
+{
+   namespace common
+   {
+      namespace adapters
+      {
+         CJsonCollectionAdapter::CJsonCollectionAdapter()
+            : m_rawResults("\"\""),
+              m_count(0)
+         {
+         }
+
+         CJsonCollectionAdapter::~CJsonCollectionAdapter()
+         {
+         }
+
+         void CJsonCollectionAdapter::addField(const CDatabaseColumn& column,
+                                               const std::string& fieldName,
+                                               EValueFormat format,
+                                               const std::string& defaultValue)
+         {
+            Field field;
+            field.columnName = column.GetName();
+            field.key = "\"" + fieldName + "\":";
+            field.format = format;
+            field.defaultValue = defaultValue;
+            m_fields.push_back(field);
+         }
+
+         void CJsonCollectionAdapter::restrictFields(const std::vector<std::string>& fieldNames)
+         {
+            if (fieldNames.empty())
+               return;
+
+            m_fields.erase(std::remove_if(m_fields.begin(), m_fields.end(),
+                                          [&fieldNames](const Field& field)
+                                          {
+                                             for (const auto& fieldName : fieldNames)
+                                             {
+                                                if (field.key == "\"" + fieldName + "\":")
+                                                   return false;
+                                             }
+                                             return true;
+                                          }),
+                           m_fields.end());
+         }
+
+         void CJsonCollectionAdapter::setChildren(const CDatabaseColumn& groupColumn,
+                                                  const std::string& childrenName,
+                                                  boost::shared_ptr<CJsonCollectionAdapter> children,
+                                                  const CDatabaseColumn& childColumn)
+         {
+            m_groupColumnName = groupColumn.GetName();
+            m_childrenKey = "\"" + childrenName + "\":";
+            m_children = children;
+            m_childColumnName = childColumn.GetName();
+         }
+
+         bool CJsonCollectionAdapter::adapt(boost::shared_ptr<IResultHandler> resultHandler)
+         {
+            const auto nCols = resultHandler->getColumnCount();
+            if (!nCols)
+               return false;
+
+            //find the column of each field once for the whole resultset
+            mapColumns(*resultHandler);
+            auto groupColumn = -1;
+            auto childColumn = -1;
+            if (m_children)
+            {
+               m_children->mapColumns(*resultHandler);
+               for (auto nCol = 0; nCol < nCols; ++nCol)
+               {
+                  const auto columnName = resultHandler->getColumnName(nCol);
+                  if (boost::iequals(m_groupColumnName, columnName))
+                     groupColumn = nCol;
+                  if (boost::iequals(m_childColumnName, columnName))
+                     childColumn = nCol;
+               }
+            }
+
+            m_rawResults.clear();
+            m_count = 0;
+            m_lastGroupValue.clear();
+            const auto rowCount = resultHandler->getRowCount();
+            if (rowCount > 0)
+               m_rawResults.reserve(rowCount * (m_fields.size() + (m_children ? m_children->m_fields.size() : 0)) * 32);
+
+            auto childrenCount = 0;
+            while (resultHandler->next_step())
+            {
+               if (!m_children)
+               {
+                  m_rawResults += m_count == 0 ? "[{" : ",{";
+                  appendFields(*resultHandler, m_rawResults);
+                  m_rawResults += '}';
+                  ++m_count;
+                  continue;
+               }
+
+               //a new object starts when the group value changes
+               const auto groupValue = (groupColumn < 0 || resultHandler->isValueNull(groupColumn)) ? "" : resultHandler->extractValueAsCString(groupColumn);
+               if (m_count == 0 || m_lastGroupValue != groupValue)
+               {
+                  if (m_count != 0)
+                     m_rawResults += childrenCount == 0 ? "\"\"}" : "]}";
+                  m_rawResults += m_count == 0 ? "[{" : ",{";
+                  appendFields(*resultHandler, m_rawResults);
+                  if (!m_fields.empty())
+                     m_rawResults += ',';
+                  m_rawResults += m_childrenKey;
+                  m_lastGroupValue = groupValue;
+                  childrenCount = 0;
+                  ++m_count;
+               }
+
+               if (childColumn >= 0 && !resultHandler->isValueNull(childColumn))
+               {
+                  m_rawResults += childrenCount == 0 ? "[{" : ",{";
+                  m_children->appendFields(*resultHandler, m_rawResults);
+                  m_rawResults += '}';
+                  ++childrenCount;
+               }
+            }
+
+            if (m_children && m_count != 0)
+               m_rawResults += childrenCount == 0 ? "\"\"}" : "]}";
+
+            //an empty collection is serialized as an empty string
+            m_rawResults += m_count == 0 ? "\"\"" : "]";
+            return true;
+         }
+
+         const std::string& CJsonCollectionAdapter::getRawResults() const
+         {
+            return m_rawResults;
+         }
+
+         int CJsonCollectionAdapter::getCount() const
+         {
+            return m_count;
+         }
+
+         const std::string& CJsonCollectionAdapter::getLastGroupValue() const
+         {
+            return m_lastGroupValue;
+         }
+
+         void CJsonCollectionAdapter::mapColumns(IResultHandler& resultHandler)
+         {
+            m_fieldsColumns.assign(m_fields.size(), -1);
+            const auto nCols = resultHandler.getColumnCount();
+            for (auto nCol = 0; nCol < nCols; ++nCol)
+            {
+               const auto columnName = resultHandler.getColumnName(nCol);
+               for (std::size_t field = 0; field < m_fields.size(); ++field)
+               {
+                  if (boost::iequals(m_fields[field].columnName, columnName))
+                     m_fieldsColumns[field] = nCol;
+               }
+            }
+         }
+
+         void CJsonCollectionAdapter::appendFields(IResultHandler& resultHandler, std::string& output) const
+         {
+            for (std::size_t field = 0; field < m_fields.size(); ++field)
+            {
+               if (field != 0)
+                  output += ',';
+               output += m_fields[field].key;
+
+               const auto nCol = m_fieldsColumns[field];
+               if (nCol < 0 || resultHandler.isValueNull(nCol))
+                  appendValue(output, m_fields[field].format, m_fields[field].defaultValue.c_str());
+               else
+                  appendValue(output, m_fields[field].format, resultHandler.extractValueAsCString(nCol));
+            }
+         }
+
+         void CJsonCollectionAdapter::appendValue(std::string& output, EValueFormat format, const char* value)
+         {
+            switch (format)
+            {
+            case kBoolean:
+               output += (value[0] == '1' || value[0] == 't') ? "\"true\"" : "\"false\"";
+               break;
+
+            case kJson:
+               {
+                  //an empty container is serialized as an empty string
+                  auto content = value;
+                  while (std::isspace(static_cast<unsigned char>(*content)))
+                     ++content;
+                  if (*content != '{' && *content != '[')
+                  {
+                     output += "\"\"";
+                     break;
+                  }
+                  auto inner = content + 1;
+                  while (std::isspace(static_cast<unsigned char>(*inner)))
+                     ++inner;
+                  if (*inner == '}' || *inner == ']')
+                  {
+                     output += "\"\"";
+                     break;
+                  }
+                  auto end = content + std::strlen(content);
+                  while (std::isspace(static_cast<unsigned char>(*(end - 1))))
+                     --end;
+                  output.append(content, end);
+                  break;
+               }
+
+            default:
+               output += '"';
+               appendEscaped(output, value);
+               output += '"';
+               break;
+            }
+         }
+
+         void CJsonCollectionAdapter::appendEscaped(std::string& output, const char* value)
+         {
+            //same escaping as boost::property_tree JSON writer
+            static const char* hexDigits = "0123456789ABCDEF";
+            for (auto current = value; *current != '\0'; ++current)
+            {
+               const auto c = static_cast<unsigned char>(*current);
+               switch (c)
+               {
+               case '"': output += "\\\"";
+                  break;
+               case '\\': output += "\\\\";
+                  break;
+               case '/': output += "\\/";
+                  break;
+               case '\b': output += "\\b";
+                  break;
+               case '\f': output += "\\f";
+                  break;
+               case '\n': output += "\\n";
+                  break;
+               case '\r': output += "\\r";
+                  break;
+               case '\t': output += "\\t";
+                  break;
+               default:
+                  if (c < 0x20)
+                  {
+                     output += "\\u00";
+                     output += hexDigits[c >> 4];
+                     output += hexDigits[c & 0x0F];
+                  }
+                  else
+                  {
+                     output += static_cast<char>(c);
+                  }
+                  break;
+               }
+            }
+         }
+      } //namespace adapters
+   } //namespace common
+} //namespace database
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "IResultAdapter.h"
+#include "database/common/DatabaseColumn.h"
+
+namespace database
+{
+   namespace common
+   {
+      namespace adapters
+      {
+         //--------------------------------------------------------------
+         /// \Brief		Adapter which serializes a resultset directly as a JSON array of objects
+         ///
+         /// Values are read from the column text and written to the output without building
+         /// any entity. The output is the same as the serialization of the matching entities
+         /// through a shared::CDataContainer (all values as strings, "" for an empty collection).
+         ///
+         /// Rows of a joined query can be grouped : consecutive rows with the same group column value
+         /// give one object, with the child objects (written by the children adapter) as an array.
+         //--------------------------------------------------------------
+         class CJsonCollectionAdapter : public IResultAdapter
+         {
+         public:
+            //--------------------------------------------------------------
+            /// \Brief		The way a column value is written
+            //--------------------------------------------------------------
+            enum EValueFormat
+            {
+               kText = 0,  //the value as a JSON string
+               kBoolean,   //"true" or "false" (from an integer or boolean column)
+               kJson       //the value is a serialized shared::CDataContainer, written as is
+            };
+
+            //--------------------------------------------------------------
+            /// \Brief		Constructor
+            //--------------------------------------------------------------
+            CJsonCollectionAdapter();
+
+            //--------------------------------------------------------------
+            /// \Brief		Destructor
+            //--------------------------------------------------------------
+            virtual ~CJsonCollectionAdapter();
+
+            //--------------------------------------------------------------
+            /// \Brief		Add a field to the output objects
+            /// \param [in]	column         The database column
+            /// \param [in]	fieldName      The field name in the output objects
+            /// \param [in]	format         The way the value is written
+            /// \param [in]	defaultValue   The value to write if column is null or missing
+            //--------------------------------------------------------------
+            void addField(const CDatabaseColumn& column,
+                          const std::string& fieldName,
+                          EValueFormat format = kText,
+                          const std::string& defaultValue = std::string());
+
+            //--------------------------------------------------------------
+            /// \Brief		Keep only some of the added fields
+            /// \param [in]	fieldNames     The names of the fields to keep (all fields are kept if empty)
+            //--------------------------------------------------------------
+            void restrictFields(const std::vector<std::string>& fieldNames);
+
+            //--------------------------------------------------------------
+            /// \Brief		Group the rows, with a children array in each object
+            /// \param [in]	groupColumn    The column identifying an object (rows must be sorted on it)
+            /// \param [in]	childrenName   The name of the children array in the output objects
+            /// \param [in]	children       The adapter defining the children fields
+            /// \param [in]	childColumn    The column identifying a child (a row has no child if it
+            ///                            is null, as in a left join)
+            //--------------------------------------------------------------
+            void setChildren(const CDatabaseColumn& groupColumn,
+                             const std::string& childrenName,
+                             boost::shared_ptr<CJsonCollectionAdapter> children,
+                             const CDatabaseColumn& childColumn);
+
+            // IResultAdapter implementation
+            bool adapt(boost::shared_ptr<IResultHandler> resultHandler) override;
+            // [END] IResultAdapter implementation
+
+            //--------------------------------------------------------------
+            /// \Brief		Get the result (raw format)
+            /// \return		The JSON array, or "" if resultset is empty
+            //--------------------------------------------------------------
+            const std::string& getRawResults() const;
+
+            //--------------------------------------------------------------
+            /// \Brief		Get the number of objects of the result
+            //--------------------------------------------------------------
+            int getCount() const;
+
+            //--------------------------------------------------------------
+            /// \Brief		Get the group column value of the last object (when rows are grouped)
+            /// \return		The value, empty if result is empty
+            //--------------------------------------------------------------
+            const std::string& getLastGroupValue() const;
+
+         private:
+            //--------------------------------------------------------------
+            /// \Brief		Find the column of each field in a resultset
+            /// \param [in]	resultHandler  The resultset
+            //--------------------------------------------------------------
+            void mapColumns(IResultHandler& resultHandler);
+
+            //--------------------------------------------------------------
+            /// \Brief		Append the fields of the current row to an object
+            /// \param [in]	resultHandler  The resultset
+            /// \param [out]	output         The output
+            //--------------------------------------------------------------
+            void appendFields(IResultHandler& resultHandler, std::string& output) const;
+
+            //--------------------------------------------------------------
+            /// \Brief		Append a value to the output
+            /// \param [out]	output   The output
+            /// \param [in]	format   The way the value is written
+            /// \param [in]	value    The column text
+            //--------------------------------------------------------------
+            static void appendValue(std::string& output, EValueFormat format, const char* value);
+
+            //--------------------------------------------------------------
+            /// \Brief		Append a string to the output, escaped as a JSON string content
+            /// \param [out]	output   The output
+            /// \param [in]	value    The string
+            //--------------------------------------------------------------
+            static void appendEscaped(std::string& output, const char* value);
+
+            struct Field
+            {
+               std::string columnName;
+               std::string key;
+               EValueFormat format;
+               std::string defaultValue;
+            };
+
+            //--------------------------------------------------------------
+            /// \Brief		The output objects fields
+            //--------------------------------------------------------------
+            std::vector<Field> m_fields;
+
+            //--------------------------------------------------------------
+            /// \Brief		The column of each field in the current resultset (-1 if missing)
+            //--------------------------------------------------------------
+            std::vector<int> m_fieldsColumns;
+
+            //--------------------------------------------------------------
+            /// \Brief		The group column name, the children array key, the children adapter and
+            ///            the child column name (if grouped)
+            //--------------------------------------------------------------
+            std::string m_groupColumnName;
+            std::string m_childrenKey;
+            boost::shared_ptr<CJsonCollectionAdapter> m_children;
+            std::string m_childColumnName;
+
+            //--------------------------------------------------------------
+            /// \Brief		The number of objects, and the group value of the last one
+            //--------------------------------------------------------------
+            int m_count;
+            std::string m_lastGroupValue;
+
+            //--------------------------------------------------------------
+            /// \Brief		The JSON output
+            //--------------------------------------------------------------
+            std::string m_rawResults;
+         };
+      } //namespace adapters
+   } //namespace common
+} //namespace database
@@ -1,6 +1,7 @@
 #include "stdafx.h"
 #include "Acquisition.h"
 #include <shared/exception/EmptyResult.hpp>
+#include <shared/exception/InvalidParameter.hpp>
 #include "database/common/DatabaseTables.h"
 #include "database/common/Query.h"
 #include "database/common/adapters/DatabaseAdapters.h"
@@ -17,7 +18,7 @@ namespace database
       namespace requesters
       {
          CAcquisition::CAcquisition(boost::shared_ptr<IDatabaseRequester> databaseRequester, boost::shared_ptr<CKeyword> keywordRequester)
-            : m_keywordRequester(keywordRequester), m_databaseRequester(databaseRequester)
+            : m_keywordRequester(keywordRequester), m_databaseRequester(databaseRequester), m_partitions(databaseRequester)
          {
          }
 
@@ -33,38 +34,21 @@ namespace database
             {
                if (!keywordEntity->Blacklist())
                {
-                  auto q = m_databaseRequester->newQuery();
-                  q->InsertInto(CAcquisitionTable::getTableName(), CAcquisitionTable::getDateColumnName(), CAcquisitionTable::getKeywordIdColumnName(), CAcquisitionTable::getValueColumnName()).
-                     Values(dataTime, keywordId, data);
-
-                  try
-                  {
-                     if (m_databaseRequester->queryStatement(*q) <= 0)
-                        throw shared::exception::CEmptyResult("Fail to insert new data");
-                  }
-                  catch (CDatabaseException& e)
-                  {
-                     if (e.returnCode() == CDatabaseException::kConstraintViolation)
-                     {
-                        // Maybe 2 acquisitions were recorded at same time for same keyword. In this case, we prefer to keep last value
-                        q->Clear().Update(CAcquisitionTable::getTableName())
-                           .Set(CAcquisitionTable::getValueColumnName(), data)
-                           .Where(CAcquisitionTable::getDateColumnName(), CQUERY_OP_EQUAL, dataTime)
-                           .And(CAcquisitionTable::getKeywordIdColumnName(), CQUERY_OP_EQUAL, keywordId);
-                        m_databaseRequester->queryStatement(*q);
-                     }
-                     else
-                     {
-                        throw;
-                     }
-                  }
+                  //insert directly in partition (the Acquisition table is only used for reading)
+                  insertOrUpdateData(m_partitions.partitionFor(dataTime), keywordId, data, dataTime);
+                  updateLastPartition(keywordId, CAcquisitionPartitions::monthOf(dataTime));
 
                   // Update also last value in keyword table
                   m_keywordRequester->updateLastValue(keywordId,
                                                       dataTime,
                                                       data);
 
-                  return getAcquisitionByKeywordAndDate(keywordId, dataTime);
+                  //stored acquisition is exactly the saved one, no need to read it back
+                  auto acquisition = boost::make_shared<entities::CAcquisition>();
+                  acquisition->KeywordId = keywordId;
+                  acquisition->Date = dataTime;
+                  acquisition->Value = data;
+                  return acquisition;
                }
 
                //blacklisted keyword
@@ -73,6 +57,73 @@ namespace database
             throw shared::exception::CEmptyResult("The keyword do not exists, cannot add data");
          }
 
+         std::vector<boost::shared_ptr<entities::CAcquisition>> CAcquisition::saveData(const std::vector<int>& keywordIds,
+                                                                                       const std::vector<std::string>& data,
+                                                                                       boost::posix_time::ptime& dataTime)
+         {
+            if (keywordIds.size() != data.size())
+               throw shared::exception::CInvalidParameter("data");
+
+            std::vector<boost::shared_ptr<entities::CAcquisition>> acquisitions;
+            for (unsigned int index = 0; index < keywordIds.size(); ++index)
+            {
+               if (m_keywordRequester->getKeyword(keywordIds[index])->Blacklist())
+                  continue;
+
+               auto acquisition = boost::make_shared<entities::CAcquisition>();
+               acquisition->KeywordId = keywordIds[index];
+               acquisition->Date = dataTime;
+               acquisition->Value = data[index];
+               acquisitions.push_back(acquisition);
+            }
+
+            //insert all acquisitions at once (insert them one by one if some already exist, to keep the last values)
+            const auto partition = m_partitions.partitionFor(dataTime);
+            if (!m_databaseRequester->bulkInsertAcquisitions(partition, acquisitions))
+            {
+               for (const auto& acquisition : acquisitions)
+                  insertOrUpdateData(partition, acquisition->KeywordId(), acquisition->Value(), dataTime);
+            }
+            for (const auto& acquisition : acquisitions)
+               updateLastPartition(acquisition->KeywordId(), CAcquisitionPartitions::monthOf(dataTime));
+
+            // Update also last values in keyword table
+            m_keywordRequester->updateLastValues(acquisitions);
+
+            return acquisitions;
+         }
+
+         void CAcquisition::insertOrUpdateData(const CDatabaseTable& partition, int keywordId, const std::string& data, const boost::posix_time::ptime& dataTime) const
+         {
+            //called for each acquisition, so statements are prepared (one per partition)
+            const auto insertStatement = (boost::format("INSERT INTO %1% (%2%, %3%, %4%) VALUES ($1, $2, $3)")
+               % partition.GetName()
+               % CAcquisitionTable::getDateColumnName().GetName()
+               % CAcquisitionTable::getKeywordIdColumnName().GetName()
+               % CAcquisitionTable::getValueColumnName().GetName()).str();
+            const auto date = boost::posix_time::to_iso_string(dataTime);
+            const auto keyword = std::to_string(keywordId);
+
+            try
+            {
+               if (m_databaseRequester->queryPreparedStatement("insert" + partition.GetName(), insertStatement, {date, keyword, data}) <= 0)
+                  throw shared::exception::CEmptyResult("Fail to insert new data");
+            }
+            catch (CDatabaseException& e)
+            {
+               if (e.returnCode() != CDatabaseException::kConstraintViolation)
+                  throw;
+
+               // Maybe 2 acquisitions were recorded at same time for same keyword. In this case, we prefer to keep last value
+               const auto updateStatement = (boost::format("UPDATE %1% SET %2% = $1 WHERE %3% = $2 AND %4% = $3")
+                  % partition.GetName()
+                  % CAcquisitionTable::getValueColumnName().GetName()
+                  % CAcquisitionTable::getDateColumnName().GetName()
+                  % CAcquisitionTable::getKeywordIdColumnName().GetName()).str();
+               m_databaseRequester->queryPreparedStatement("update" + partition.GetName(), updateStatement, {data, date, keyword});
+            }
+         }
+
          boost::shared_ptr<entities::CAcquisition> CAcquisition::incrementData(const int keywordId, const std::string& increment, boost::posix_time::ptime& dataTime)
          {
             auto keywordEntity = m_keywordRequester->getKeyword(keywordId);
@@ -86,9 +137,13 @@ namespace database
             if (keywordEntity->Blacklist())
                return boost::shared_ptr<entities::CAcquisition>(); //return null instead of exception for performances
 
+            //last value is searched only in the most recent partition containing data of the keyword
+            const auto partition = m_partitions.partitionFor(dataTime);
+            const auto lastValuePartition = lastPartitionOf(keywordId);
+
             auto qLastKeywordValue = m_databaseRequester->newQuery();
             qLastKeywordValue->Select(qLastKeywordValue->castNumeric(CAcquisitionTable::getValueColumnName())).
-               From(CAcquisitionTable::getTableName()).
+               From(lastValuePartition ? *lastValuePartition : partition).
                Where(CAcquisitionTable::getKeywordIdColumnName(), CQUERY_OP_EQUAL, keywordId).
                OrderBy(CAcquisitionTable::getDateColumnName(), CQuery::kDesc).
                Limit(1);
@@ -97,13 +152,13 @@ namespace database
 
 
             //insert first (if fails, update )
-            q->InsertInto(CAcquisitionTable::getTableName(), CAcquisitionTable::getDateColumnName(), CAcquisitionTable::getKeywordIdColumnName(), CAcquisitionTable::getValueColumnName()).
+            q->InsertInto(partition, CAcquisitionTable::getDateColumnName(), CAcquisitionTable::getKeywordIdColumnName(), CAcquisitionTable::getValueColumnName()).
                Values(dataTime, keywordId, q->math(q->coalesce(*qLastKeywordValue, 0), CQUERY_OP_PLUS, increment));
 
             if (m_databaseRequester->queryStatement(*q, false) <= 0)
             {
                //update
-               q->Clear().Update(CAcquisitionTable::getTableName())
+               q->Clear().Update(partition)
                   .Set(CAcquisitionTable::getValueColumnName(), q->math(q->coalesce(*qLastKeywordValue, 0), CQUERY_OP_PLUS, increment)).
                   Where(CAcquisitionTable::getKeywordIdColumnName(), CQUERY_OP_EQUAL, keywordId).
                   And(CAcquisitionTable::getDateColumnName(), CQUERY_OP_EQUAL, dataTime);
@@ -111,6 +166,7 @@ namespace database
                if (m_databaseRequester->queryStatement(*q) <= 0)
                   throw shared::exception::CEmptyResult("Fail to insert new incremental data");
             }
+            updateLastPartition(keywordId, CAcquisitionPartitions::monthOf(dataTime));
 
             auto newData = getAcquisitionByKeywordAndDate(keywordId, dataTime);
 
@@ -126,16 +182,21 @@ namespace database
          {
             if (m_keywordRequester->getKeyword(keywordId))
             {
-               auto q = m_databaseRequester->newQuery();
-               q->DeleteFrom(CAcquisitionTable::getTableName()).
-                  Where(CAcquisitionTable::getKeywordIdColumnName(), CQUERY_OP_EQUAL, keywordId);
+               for (const auto& month : m_partitions.partitions())
+               {
+                  auto q = m_databaseRequester->newQuery();
+                  q->DeleteFrom(CAcquisitionPartitions::partitionTable(month)).
+                     Where(CAcquisitionTable::getKeywordIdColumnName(), CQUERY_OP_EQUAL, keywordId);
 
-               m_databaseRequester->queryStatement(*q);
+                  m_databaseRequester->queryStatement(*q);
+               }
 
                auto qSummary = m_databaseRequester->newQuery();
                qSummary->DeleteFrom(CAcquisitionSummaryTable::getTableName()).
                   Where(CAcquisitionSummaryTable::getKeywordIdColumnName(), CQUERY_OP_EQUAL, keywordId);
                m_databaseRequester->queryStatement(*qSummary);
+
+               forgetLastPartitions(keywordId);
             }
             else
             {
@@ -147,7 +208,7 @@ namespace database
          {
             auto qSelect = m_databaseRequester->newQuery();
             qSelect->Select().
-               From(CAcquisitionTable::getTableName()).
+               From(m_partitions.tableFor(time, time)).
                Where(CAcquisitionTable::getKeywordIdColumnName(), CQUERY_OP_EQUAL, keywordId).
                And(CAcquisitionTable::getDateColumnName(), CQUERY_OP_EQUAL, time);
 
@@ -166,7 +227,7 @@ namespace database
          {
             auto qSelect = m_databaseRequester->newQuery();
             qSelect->Select(CAcquisitionTable::getDateColumnName(), CAcquisitionTable::getValueColumnName()).
-               From(CAcquisitionTable::getTableName()).
+               From(m_partitions.tableFor(timeFrom, timeTo)).
                Where(CAcquisitionTable::getKeywordIdColumnName(), CQUERY_OP_EQUAL, keywordId);
 
             if (!timeFrom.is_not_a_date_time())
@@ -286,7 +347,7 @@ namespace database
             */
             auto q = m_databaseRequester->newQuery();
             q->Select(q->distinct(CAcquisitionTable::getKeywordIdColumnName()))
-               .From(CAcquisitionTable::getTableName())
+               .From(m_partitions.tableFor(timeFrom, timeTo - boost::posix_time::time_duration::unit()))
                .Where(CAcquisitionTable::getDateColumnName(), CQUERY_OP_SUP_EQUAL, timeFrom)
                .And(CAcquisitionTable::getDateColumnName(), CQUERY_OP_INF, timeTo);
 
@@ -338,6 +399,7 @@ namespace database
                   {
                      fromDate = boost::posix_time::ptime(dataTime.date(), boost::posix_time::hours(pt_tm.tm_hour));
                      toDate = boost::posix_time::ptime(dataTime.date(), boost::posix_time::hours(pt_tm.tm_hour) + boost::posix_time::minutes(59) + boost::posix_time::seconds(59));
+                     const auto acquisitionTable = m_partitions.tableFor(fromDate, toDate);
 
                      if (m_databaseRequester->supportInsertOrUpdateStatement())
                      {
@@ -347,7 +409,7 @@ namespace database
                            Select(curType, fromDate, keywordId, q->averageWithCast(q->fromSubquery("acq", CAcquisitionTable::getValueColumnName())),
                                   q->minWithCast(q->fromSubquery("acq", CAcquisitionTable::getValueColumnName())),
                                   q->maxWithCast(q->fromSubquery("acq", CAcquisitionTable::getValueColumnName()))).
-                           From(q->as(CAcquisitionTable::getTableName(), "acq")).
+                           From(q->as(acquisitionTable, "acq")).
                            Where(q->fromSubquery("acq", CAcquisitionTable::getKeywordIdColumnName()), CQUERY_OP_EQUAL, keywordId).
                            And(q->fromSubquery("acq", CAcquisitionTable::getDateColumnName()), CQUERY_OP_SUP_EQUAL, fromDate).
                            And(q->fromSubquery("acq", CAcquisitionTable::getDateColumnName()), CQUERY_OP_INF_EQUAL, toDate);
@@ -362,7 +424,7 @@ namespace database
                         compute->Select(compute->as(compute->averageWithCast(CAcquisitionTable::getValueColumnName()), "avg"),
                                         compute->as(compute->minWithCast(CAcquisitionTable::getValueColumnName()), "min"),
                                         compute->as(compute->maxWithCast(CAcquisitionTable::getValueColumnName()), "max")).
-                           From(CAcquisitionTable::getTableName()).
+                           From(acquisitionTable).
                            Where(CAcquisitionTable::getKeywordIdColumnName(), CQUERY_OP_EQUAL, keywordId).
                            And(CAcquisitionTable::getDateColumnName(), CQUERY_OP_SUP_EQUAL, fromDate).
                            And(CAcquisitionTable::getDateColumnName(), CQUERY_OP_INF_EQUAL, toDate);
@@ -389,7 +451,7 @@ namespace database
                               Select(curType, fromDate, keywordId, q->averageWithCast(q->fromSubquery("acq", CAcquisitionTable::getValueColumnName())),
                                      q->minWithCast(q->fromSubquery("acq", CAcquisitionTable::getValueColumnName())),
                                      q->maxWithCast(q->fromSubquery("acq", CAcquisitionTable::getValueColumnName()))).
-                              From(q->as(CAcquisitionTable::getTableName(), "acq")).
+                              From(q->as(acquisitionTable, "acq")).
                               Where(q->fromSubquery("acq", CAcquisitionTable::getKeywordIdColumnName()), CQUERY_OP_EQUAL, keywordId).
                               And(q->fromSubquery("acq", CAcquisitionTable::getDateColumnName()), CQUERY_OP_SUP_EQUAL, fromDate).
                               And(q->fromSubquery("acq", CAcquisitionTable::getDateColumnName()), CQUERY_OP_INF_EQUAL, toDate);
@@ -530,6 +592,136 @@ namespace database
             throw shared::exception::CEmptyResult("The keyword do not exists, cannot add summary data");
          }
 
+         std::vector<boost::shared_ptr<entities::CAcquisitionSummary> > CAcquisition::saveSummaryData(const std::vector<int>& keywordIds, entities::EAcquisitionSummaryType curType, const boost::posix_time::ptime& dataTime)
+         {
+            /*
+            DELETE FROM AcquisitionSummary WHERE type = "Hour" AND date = "startDate" AND keywordId IN (38, 39, ...)
+
+            INSERT INTO AcquisitionSummary (type, date, keywordId, mean, min, max)
+            SELECT "Hour", "startDate", acq.keywordId, avg(cast(value as real)), min(cast(value as real)), max(cast(value as real))
+            FROM Acquisition acq
+            where acq.keywordId IN (38, 39, ...)
+            and acq.date>= "startDate"
+            and acq.date<= "endDate"
+            GROUP BY acq.keywordId
+            */
+            if (keywordIds.empty())
+               return std::vector<boost::shared_ptr<entities::CAcquisitionSummary> >();
+
+            boost::posix_time::ptime fromDate, toDate;
+            entities::EAcquisitionSummaryType toQuery;
+            getSummaryPeriod(curType, dataTime, fromDate, toDate, toQuery);
+
+            const auto ownTransaction = m_databaseRequester->transactionSupport() && !m_databaseRequester->transactionIsAlreadyCreated();
+            if (ownTransaction)
+               m_databaseRequester->transactionBegin();
+
+            try
+            {
+               //delete then insert is supported by all databases, and allows recomputing summaries in one statement
+               auto qDelete = m_databaseRequester->newQuery();
+               qDelete->DeleteFrom(CAcquisitionSummaryTable::getTableName()).
+                  Where(CAcquisitionSummaryTable::getTypeColumnName(), CQUERY_OP_EQUAL, curType).
+                  And(CAcquisitionSummaryTable::getDateColumnName(), CQUERY_OP_EQUAL, fromDate).
+                  And(CAcquisitionSummaryTable::getKeywordIdColumnName(), CQUERY_OP_IN, qDelete->valuesList(keywordIds));
+               if (m_databaseRequester->queryStatement(*qDelete) < 0)
+                  throw CDatabaseException("Fail to delete " + curType.toString() + " summary values");
+
+               //Hour summary data are commputed from raw acquisitions
+               //Other ones, are taken from summarydata (really simplify calculous, and queries)
+               auto q = m_databaseRequester->newQuery();
+               q->InsertInto(CAcquisitionSummaryTable::getTableName(), CAcquisitionSummaryTable::getTypeColumnName(), CAcquisitionSummaryTable::getDateColumnName(), CAcquisitionSummaryTable::getKeywordIdColumnName(), CAcquisitionSummaryTable::getAvgColumnName(), CAcquisitionSummaryTable::getMinColumnName(), CAcquisitionSummaryTable::getMaxColumnName());
+               if (curType == entities::EAcquisitionSummaryType::kHour)
+               {
+                  const auto acquisitionTable = m_partitions.tableFor(fromDate, toDate);
+                  q->Select(curType, fromDate, q->fromSubquery("acq", CAcquisitionTable::getKeywordIdColumnName()),
+                            q->averageWithCast(q->fromSubquery("acq", CAcquisitionTable::getValueColumnName())),
+                            q->minWithCast(q->fromSubquery("acq", CAcquisitionTable::getValueColumnName())),
+                            q->maxWithCast(q->fromSubquery("acq", CAcquisitionTable::getValueColumnName()))).
+                     From(q->as(acquisitionTable, "acq")).
+                     Where(q->fromSubquery("acq", CAcquisitionTable::getKeywordIdColumnName()), CQUERY_OP_IN, q->valuesList(keywordIds)).
+                     And(q->fromSubquery("acq", CAcquisitionTable::getDateColumnName()), CQUERY_OP_SUP_EQUAL, fromDate).
+                     And(q->fromSubquery("acq", CAcquisitionTable::getDateColumnName()), CQUERY_OP_INF_EQUAL, toDate).
+                     GroupBy(q->fromSubquery("acq", CAcquisitionTable::getKeywordIdColumnName()));
+               }
+               else
+               {
+                  q->Select(curType, fromDate, q->fromSubquery("acq", CAcquisitionSummaryTable::getKeywordIdColumnName()),
+                            q->average(q->fromSubquery("acq", CAcquisitionSummaryTable::getAvgColumnName())),
+                            q->min(q->fromSubquery("acq", CAcquisitionSummaryTable::getMinColumnName())),
+                            q->max(q->fromSubquery("acq", CAcquisitionSummaryTable::getMaxColumnName()))).
+                     From(q->as(CAcquisitionSummaryTable::getTableName(), "acq")).
+                     Where(q->fromSubquery("acq", CAcquisitionSummaryTable::getKeywordIdColumnName()), CQUERY_OP_IN, q->valuesList(keywordIds)).
+                     And(q->fromSubquery("acq", CAcquisitionSummaryTable::getTypeColumnName()), CQUERY_OP_EQUAL, toQuery.toString()).
+                     And(q->fromSubquery("acq", CAcquisitionSummaryTable::getDateColumnName()), CQUERY_OP_SUP_EQUAL, fromDate).
+                     And(q->fromSubquery("acq", CAcquisitionSummaryTable::getDateColumnName()), CQUERY_OP_INF_EQUAL, toDate).
+                     GroupBy(q->fromSubquery("acq", CAcquisitionSummaryTable::getKeywordIdColumnName()));
+               }
+               if (m_databaseRequester->queryStatement(*q) < 0)
+                  throw CDatabaseException("Fail to insert " + curType.toString() + " summary values");
+
+               if (ownTransaction)
+                  m_databaseRequester->transactionCommit();
+            }
+            catch (std::exception&)
+            {
+               if (ownTransaction)
+                  m_databaseRequester->transactionRollback();
+               throw;
+            }
+
+            //get the result
+            auto qSelect = m_databaseRequester->newQuery();
+            qSelect->Select().
+               From(CAcquisitionSummaryTable::getTableName()).
+               Where(CAcquisitionSummaryTable::getTypeColumnName(), CQUERY_OP_EQUAL, curType).
+               And(CAcquisitionSummaryTable::getDateColumnName(), CQUERY_OP_EQUAL, fromDate).
+               And(CAcquisitionSummaryTable::getKeywordIdColumnName(), CQUERY_OP_IN, qSelect->valuesList(keywordIds));
+
+            adapters::CAcquisitionSummaryAdapter adapter;
+            m_databaseRequester->queryEntities(&adapter, *qSelect);
+            return adapter.getResults();
+         }
+
+         void CAcquisition::getSummaryPeriod(const entities::EAcquisitionSummaryType& curType,
+                                             const boost::posix_time::ptime& dataTime,
+                                             boost::posix_time::ptime& fromDate,
+                                             boost::posix_time::ptime& toDate,
+                                             entities::EAcquisitionSummaryType& toQuery)
+         {
+            const auto endOfDay = boost::posix_time::hours(23) + boost::posix_time::minutes(59) + boost::posix_time::seconds(59);
+
+            switch (curType)
+            {
+            case entities::EAcquisitionSummaryType::kHourValue:
+               fromDate = boost::posix_time::ptime(dataTime.date(), boost::posix_time::hours(dataTime.time_of_day().hours()));
+               toDate = fromDate + boost::posix_time::minutes(59) + boost::posix_time::seconds(59);
+               toQuery = entities::EAcquisitionSummaryType::kHour;
+               break;
+
+            case entities::EAcquisitionSummaryType::kDayValue:
+               fromDate = boost::posix_time::ptime(dataTime.date());
+               toDate = boost::posix_time::ptime(dataTime.date(), endOfDay);
+               toQuery = entities::EAcquisitionSummaryType::kHour;
+               break;
+
+            case entities::EAcquisitionSummaryType::kMonthValue:
+               fromDate = boost::posix_time::ptime(boost::gregorian::date(dataTime.date().year(), dataTime.date().month(), 1));
+               toDate = boost::posix_time::ptime(dataTime.date().end_of_month(), endOfDay);
+               toQuery = entities::EAcquisitionSummaryType::kDay;
+               break;
+
+            case entities::EAcquisitionSummaryType::kYearValue:
+               fromDate = boost::posix_time::ptime(boost::gregorian::date(dataTime.date().year(), 1, 1));
+               toDate = boost::posix_time::ptime(boost::gregorian::date(dataTime.date().year(), 12, 31), endOfDay);
+               toQuery = entities::EAcquisitionSummaryType::kMonth;
+               break;
+
+            default:
+               throw shared::exception::CException("Unsupported summary type " + curType.toString());
+            }
+         }
+
          bool CAcquisition::summaryDataExists(const int keywordId, entities::EAcquisitionSummaryType curType, boost::posix_time::ptime& dataTime)
          {
             //determine the real date of summary data 
@@ -554,11 +746,61 @@ namespace database
             return (m_databaseRequester->queryCount(*checkq) > 0);
          }
 
-         int CAcquisition::purgeAcquisitions(boost::posix_time::ptime purgeDate)
+         int CAcquisition::purgeAcquisitions(const boost::posix_time::ptime& purgeDate, const std::vector<int>& keptKeywordIds, int maxRows)
+         {
+            //whole expired partitions are dropped, only the remaining acquisitions are deleted
+            //(both are counted in acquisitions, so caller continues while a full batch is purged)
+            const auto droppedAcquisitions = dropExpiredPartitions(purgeDate, keptKeywordIds);
+            return droppedAcquisitions + purgeAcquisitionsBatch(purgeDate, CQUERY_OP_NOT_IN, keptKeywordIds, maxRows);
+         }
+
+         int CAcquisition::purgeKeywordAcquisitions(int keywordId, const boost::posix_time::ptime& purgeDate, int maxRows)
+         {
+            return purgeAcquisitionsBatch(purgeDate, CQUERY_OP_IN, std::vector<int>(1, keywordId), maxRows);
+         }
+
+         int CAcquisition::purgeAcquisitionsBatch(const boost::posix_time::ptime& purgeDate, const std::string& keywordOperator, const std::vector<int>& keywordIds, int maxRows)
+         {
+            auto count = 0;
+            for (const auto& month : m_partitions.partitions())
+            {
+               //partitions are sorted, oldest first
+               if (boost::posix_time::ptime(month) >= purgeDate || count >= maxRows)
+                  break;
+
+               count += purgeTableBatch(CAcquisitionPartitions::partitionTable(month), purgeDate, keywordOperator, keywordIds, maxRows - count);
+            }
+            return count;
+         }
+
+         int CAcquisition::purgeTableBatch(const CDatabaseTable& table, const boost::posix_time::ptime& purgeDate, const std::string& keywordOperator, const std::vector<int>& keywordIds, int maxRows) const
          {
+            /*
+            SELECT date FROM Acquisition WHERE date < "purgeDate" AND keywordId NOT IN (...) ORDER BY date LIMIT 1 OFFSET maxRows-1
+            DELETE FROM Acquisition WHERE date < "purgeDate" AND date <= "lastBatchDate" AND keywordId NOT IN (...)
+
+            Both queries walk the date index (or keywordId/date index), so the delete never scans the whole table
+            and the write lock is held only for the batch
+            */
+            auto qLastDate = m_databaseRequester->newQuery();
+            qLastDate->Select(CAcquisitionTable::getDateColumnName()).
+               From(table).
+               Where(CAcquisitionTable::getDateColumnName(), CQUERY_OP_INF, purgeDate);
+            if (!keywordIds.empty())
+               qLastDate->And(CAcquisitionTable::getKeywordIdColumnName(), keywordOperator, qLastDate->valuesList(keywordIds));
+            qLastDate->OrderBy(CAcquisitionTable::getDateColumnName()).
+               Limit(1, maxRows - 1);
+
+            adapters::CSingleValueAdapter<boost::posix_time::ptime> lastDateAdapter;
+            m_databaseRequester->queryEntities(&lastDateAdapter, *qLastDate);
+
             auto q = m_databaseRequester->newQuery();
-            q->DeleteFrom(CAcquisitionTable::getTableName()).
+            q->DeleteFrom(table).
                Where(CAcquisitionTable::getDateColumnName(), CQUERY_OP_INF, purgeDate);
+            if (!lastDateAdapter.getResults().empty())
+               q->And(CAcquisitionTable::getDateColumnName(), CQUERY_OP_INF_EQUAL, lastDateAdapter.getResults()[0]);
+            if (!keywordIds.empty())
+               q->And(CAcquisitionTable::getKeywordIdColumnName(), keywordOperator, q->valuesList(keywordIds));
 
             auto count = m_databaseRequester->queryStatement(*q);
             if (count < 0)
@@ -566,6 +808,104 @@ namespace database
             return count;
          }
 
+         int CAcquisition::dropExpiredPartitions(const boost::posix_time::ptime& purgeDate, const std::vector<int>& keptKeywordIds)
+         {
+            auto droppedAcquisitions = 0;
+            for (const auto& month : m_partitions.partitions())
+            {
+               //partitions are sorted, oldest first
+               if (boost::posix_time::ptime(month + boost::gregorian::months(1)) > purgeDate)
+                  break;
+
+               const auto partition = CAcquisitionPartitions::partitionTable(month);
+               if (!keptKeywordIds.empty())
+               {
+                  //partition still contains data to keep, expired data are deleted by batches
+                  auto qKept = m_databaseRequester->newQuery();
+                  qKept->SelectCount().
+                     From(partition).
+                     Where(CAcquisitionTable::getKeywordIdColumnName(), CQUERY_OP_IN, qKept->valuesList(keptKeywordIds));
+                  if (m_databaseRequester->queryCount(*qKept) > 0)
+                     continue;
+               }
+
+               auto qCount = m_databaseRequester->newQuery();
+               qCount->SelectCount().
+                  From(partition);
+               droppedAcquisitions += m_databaseRequester->queryCount(*qCount);
+
+               m_partitions.dropPartition(month);
+
+               //some keywords may have their most recent data in the dropped partition
+               forgetLastPartitions();
+            }
+            return droppedAcquisitions;
+         }
+
+         boost::optional<CDatabaseTable> CAcquisition::lastPartitionOf(int keywordId)
+         {
+            {
+               boost::lock_guard<boost::mutex> lock(m_lastPartitionsMutex);
+               const auto lastPartition = m_lastPartitions.find(keywordId);
+               if (lastPartition != m_lastPartitions.end())
+                  return CAcquisitionPartitions::partitionTable(lastPartition->second);
+               m_lastPartitionsSearches.insert(keywordId);
+            }
+
+            //not known yet, the last acquisition date is searched once through the partitions parent
+            //(each partition is searched using its keywordId/date index)
+            auto q = m_databaseRequester->newQuery();
+            q->Select(q->max(CAcquisitionTable::getDateColumnName())).
+               From(CAcquisitionTable::getTableName()).
+               Where(CAcquisitionTable::getKeywordIdColumnName(), CQUERY_OP_EQUAL, keywordId);
+
+            //read as string, as max() is NULL when keyword has no data
+            adapters::CSingleValueAdapter<std::string> adapter;
+            m_databaseRequester->queryEntities(&adapter, *q);
+            const auto found = !adapter.getResults().empty() && !adapter.getResults()[0].empty();
+            const auto month = found ? CAcquisitionPartitions::monthOf(boost::posix_time::from_iso_string(adapter.getResults()[0])) : boost::gregorian::date();
+            {
+               //not kept if data were inserted meanwhile (the search result may be older than them)
+               boost::lock_guard<boost::mutex> lock(m_lastPartitionsMutex);
+               if (m_lastPartitionsSearches.erase(keywordId) > 0 && found)
+                  m_lastPartitions[keywordId] = month;
+            }
+
+            if (!found)
+               return boost::none;
+            return CAcquisitionPartitions::partitionTable(month);
+         }
+
+         void CAcquisition::updateLastPartition(int keywordId, const boost::gregorian::date& month)
+         {
+            boost::lock_guard<boost::mutex> lock(m_lastPartitionsMutex);
+            const auto lastPartition = m_lastPartitions.find(keywordId);
+            if (lastPartition == m_lastPartitions.end())
+            {
+               //keyword may have more recent data than this one (inserted in the past), so its last partition stays unknown
+               m_lastPartitionsSearches.erase(keywordId);
+               return;
+            }
+
+            if (lastPartition->second < month)
+               lastPartition->second = month;
+         }
+
+         void CAcquisition::forgetLastPartitions(const boost::optional<int>& keywordId)
+         {
+            boost::lock_guard<boost::mutex> lock(m_lastPartitionsMutex);
+            if (keywordId)
+            {
+               m_lastPartitions.erase(*keywordId);
+               m_lastPartitionsSearches.erase(*keywordId);
+            }
+            else
+            {
+               m_lastPartitions.clear();
+               m_lastPartitionsSearches.clear();
+            }
+         }
+
          // [END] IAcquisitionRequester implementation
       } //namespace requesters
    } //namespace common
@@ -2,6 +2,7 @@
 
 #include "database/IAcquisitionRequester.h"
 #include "database/IDatabaseRequester.h"
+#include "database/common/AcquisitionPartitions.h"
 
 namespace database
 {
@@ -33,12 +34,18 @@ namespace database
             boost::shared_ptr<entities::CAcquisition> saveData(const int keywordId,
                                                                const std::string& data,
                                                                boost::posix_time::ptime& dataTime) override;
+            std::vector<boost::shared_ptr<entities::CAcquisition>> saveData(const std::vector<int>& keywordIds,
+                                                                            const std::vector<std::string>& data,
+                                                                            boost::posix_time::ptime& dataTime) override;
             boost::shared_ptr<entities::CAcquisition> incrementData(const int keywordId,
                                                                     const std::string& increment,
                                                                     boost::posix_time::ptime& dataTime) override;
             boost::shared_ptr<entities::CAcquisitionSummary> saveSummaryData(const int keywordId,
                                                                              database::entities::EAcquisitionSummaryType curType,
                                                                              boost::posix_time::ptime& dataTime) override;
+            std::vector<boost::shared_ptr<entities::CAcquisitionSummary> > saveSummaryData(const std::vector<int>& keywordIds,
+                                                                                           database::entities::EAcquisitionSummaryType curType,
+                                                                                           const boost::posix_time::ptime& dataTime) override;
             void getKeywordsHavingDate(const boost::posix_time::ptime& timeFrom,
                                        const boost::posix_time::ptime& timeTo,
                                        std::vector<int>& results) override;
@@ -77,11 +84,100 @@ namespace database
                                                  boost::posix_time::ptime timeFrom,
                                                  boost::posix_time::ptime timeTo) override;
 
-            int purgeAcquisitions(boost::posix_time::ptime purgeDate) override;
+            int purgeAcquisitions(const boost::posix_time::ptime& purgeDate,
+                                  const std::vector<int>& keptKeywordIds,
+                                  int maxRows) override;
+            int purgeKeywordAcquisitions(int keywordId,
+                                         const boost::posix_time::ptime& purgeDate,
+                                         int maxRows) override;
             // [END] IAcquisitionRequester implementation
 
          private:
 
+            //--------------------------------------------------------------
+            /// \brief                       Insert an acquisition, or update it if already exists (keep the last value)
+            /// \param [in] partition        The partition storing the acquisition
+            /// \param [in] keywordId        The keyword id
+            /// \param [in] data             The data
+            /// \param [in] dataTime         The datetime of the data
+            //--------------------------------------------------------------
+            void insertOrUpdateData(const CDatabaseTable& partition,
+                                    int keywordId,
+                                    const std::string& data,
+                                    const boost::posix_time::ptime& dataTime) const;
+
+            //--------------------------------------------------------------
+            /// \brief                       Delete a batch of the oldest acquisitions, in partitions prior to purge date
+            /// \param [in] purgeDate        The date of purge (any data prior ro his date will be deleted)
+            /// \param [in] keywordOperator  CQUERY_OP_IN or CQUERY_OP_NOT_IN, to filter on keywordIds
+            /// \param [in] keywordIds       The keywords to filter (no filter if empty)
+            /// \param [in] maxRows          Number of acquisitions to delete by batch
+            /// \return                      Number of deleted rows
+            //--------------------------------------------------------------
+            int purgeAcquisitionsBatch(const boost::posix_time::ptime& purgeDate,
+                                       const std::string& keywordOperator,
+                                       const std::vector<int>& keywordIds,
+                                       int maxRows);
+
+            //--------------------------------------------------------------
+            /// \brief                       Delete a batch of the oldest acquisitions of a table
+            /// \param [in] table            The acquisitions table (or partition)
+            /// \param [in] purgeDate        The date of purge (any data prior ro his date will be deleted)
+            /// \param [in] keywordOperator  CQUERY_OP_IN or CQUERY_OP_NOT_IN, to filter on keywordIds
+            /// \param [in] keywordIds       The keywords to filter (no filter if empty)
+            /// \param [in] maxRows          Number of acquisitions to delete by batch
+            /// \return                      Number of deleted rows
+            //--------------------------------------------------------------
+            int purgeTableBatch(const CDatabaseTable& table,
+                                const boost::posix_time::ptime& purgeDate,
+                                const std::string& keywordOperator,
+                                const std::vector<int>& keywordIds,
+                                int maxRows) const;
+
+            //--------------------------------------------------------------
+            /// \brief                       Drop the partitions entirely prior to purge date
+            /// \param [in] purgeDate        The date of purge (any data prior ro his date will be deleted)
+            /// \param [in] keptKeywordIds   The keywords to keep (partitions containing data of these keywords are not dropped)
+            /// \return                      Number of deleted acquisitions (rows of the dropped partitions)
+            //--------------------------------------------------------------
+            int dropExpiredPartitions(const boost::posix_time::ptime& purgeDate,
+                                      const std::vector<int>& keptKeywordIds);
+
+            //--------------------------------------------------------------
+            /// \brief                       Get the most recent partition containing data of a keyword
+            /// \param [in] keywordId        The keyword
+            /// \return                      The partition (boost::none if no data for this keyword)
+            /// \note                        Searched in database only at first call for a keyword, then kept up to date by inserts
+            //--------------------------------------------------------------
+            boost::optional<CDatabaseTable> lastPartitionOf(int keywordId);
+
+            //--------------------------------------------------------------
+            /// \brief                       Record that a partition contains data of a keyword (if its last partition is known)
+            /// \param [in] keywordId        The keyword
+            /// \param [in] month            The first day of month of the partition
+            //--------------------------------------------------------------
+            void updateLastPartition(int keywordId, const boost::gregorian::date& month);
+
+            //--------------------------------------------------------------
+            /// \brief                       Forget the most recent partitions of the keywords (to search them again in database)
+            /// \param [in] keywordId        The keyword (all keywords if boost::none)
+            //--------------------------------------------------------------
+            void forgetLastPartitions(const boost::optional<int>& keywordId = boost::none);
+
+            //--------------------------------------------------------------
+            /// \brief                    Get the period covered by a summary data
+            /// \param [in] curType       The summary type
+            /// \param [in] dataTime      Any datetime of the period
+            /// \param [out] fromDate     The start of the period
+            /// \param [out] toDate       The end of the period (inclusive)
+            /// \param [out] toQuery      The type of data the summary is computed from (hour for hour means raw acquisitions)
+            //--------------------------------------------------------------
+            static void getSummaryPeriod(const entities::EAcquisitionSummaryType& curType,
+                                         const boost::posix_time::ptime& dataTime,
+                                         boost::posix_time::ptime& fromDate,
+                                         boost::posix_time::ptime& toDate,
+                                         entities::EAcquisitionSummaryType& toQuery);
+
             //--------------------------------------------------------------
             /// \brief                    Get the data  by type (avg, min, max)
             /// \param [in] keywordId     keywordId Id
@@ -115,6 +211,27 @@ namespace database
             /// \Brief		   Reference to IDatabaseRequester
             //--------------------------------------------------------------
             boost::shared_ptr<IDatabaseRequester> m_databaseRequester;
+
+            //--------------------------------------------------------------
+            /// \Brief		   The acquisition partitions
+            //--------------------------------------------------------------
+            CAcquisitionPartitions m_partitions;
+
+            //--------------------------------------------------------------
+            /// \Brief		   The most recent partition containing data of each keyword (first day of month)
+            //--------------------------------------------------------------
+            std::map<int, boost::gregorian::date> m_lastPartitions;
+
+            //--------------------------------------------------------------
+            /// \Brief		   The keywords which last partition is being searched in database
+            ///               (removed if data are saved meanwhile, then the search result is not kept)
+            //--------------------------------------------------------------
+            std::set<int> m_lastPartitionsSearches;
+
+            //--------------------------------------------------------------
+            /// \Brief		   Mutex protecting m_lastPartitions
+            //--------------------------------------------------------------
+            boost::mutex m_lastPartitionsMutex;
          };
       }
    }
@@ -5,6 +5,9 @@
 #include "database/common/adapters/SingleValueAdapter.hpp"
 #include "database/common/DatabaseTables.h"
 #include "database/common/Query.h"
+#include "database/common/Statement.hpp"
+#include "database/common/adapters/JsonCollectionAdapter.h"
+#include "Keyword.h"
 
 
 namespace database
@@ -50,20 +53,22 @@ namespace database
 
          boost::shared_ptr<entities::CDevice> CDevice::getDevice(int deviceId, bool blacklistedIncluded) const
          {
-            auto qSelect = m_databaseRequester->newQuery();
+            //called for each device existence check by plugins, so statements are prepared
+            static const CStatement<int> Statement("getDevice",
+                                                   CStatementBuilder().Select().
+                                                   From(CDeviceTable::getTableName()).
+                                                   Where(CDeviceTable::getIdColumnName(), CQUERY_OP_EQUAL));
+            static const CStatement<int, bool> NotBlacklistedStatement("getDeviceNotBlacklisted",
+                                                                       CStatementBuilder().Select().
+                                                                       From(CDeviceTable::getTableName()).
+                                                                       Where(CDeviceTable::getIdColumnName(), CQUERY_OP_EQUAL).
+                                                                       And(CDeviceTable::getBlacklistColumnName(), CQUERY_OP_EQUAL));
 
+            adapters::CDeviceAdapter adapter;
             if (blacklistedIncluded)
-               qSelect->Select().
-                  From(CDeviceTable::getTableName()).
-                  Where(CDeviceTable::getIdColumnName(), CQUERY_OP_EQUAL, deviceId);
+               Statement.queryEntities(*m_databaseRequester, &adapter, deviceId);
             else
-               qSelect->Select().
-                  From(CDeviceTable::getTableName()).
-                  Where(CDeviceTable::getIdColumnName(), CQUERY_OP_EQUAL, deviceId).
-                  And(CDeviceTable::getBlacklistColumnName(), CQUERY_OP_EQUAL, 0);
-
-            adapters::CDeviceAdapter adapter;
-            m_databaseRequester->queryEntities(&adapter, *qSelect);
+               NotBlacklistedStatement.queryEntities(*m_databaseRequester, &adapter, deviceId, false);
             if (adapter.getResults().empty())
                throw shared::exception::CEmptyResult((boost::format("Cannot retrieve Device Id=%1% in database") % deviceId).str());
 
@@ -73,22 +78,23 @@ namespace database
          boost::shared_ptr<entities::CDevice> CDevice::getDeviceInPlugin(int pluginId, const std::string& name, bool blacklistedIncluded) const
          {
             //search for such a device
-            auto qSelect = m_databaseRequester->newQuery();
+            static const CStatement<int, std::string> Statement("getDeviceInPlugin",
+                                                                CStatementBuilder().Select().
+                                                                From(CDeviceTable::getTableName()).
+                                                                Where(CDeviceTable::getPluginIdColumnName(), CQUERY_OP_EQUAL).
+                                                                And(CDeviceTable::getNameColumnName(), CQUERY_OP_EQUAL));
+            static const CStatement<int, std::string, bool> NotBlacklistedStatement("getDeviceInPluginNotBlacklisted",
+                                                                                    CStatementBuilder().Select().
+                                                                                    From(CDeviceTable::getTableName()).
+                                                                                    Where(CDeviceTable::getPluginIdColumnName(), CQUERY_OP_EQUAL).
+                                                                                    And(CDeviceTable::getNameColumnName(), CQUERY_OP_EQUAL).
+                                                                                    And(CDeviceTable::getBlacklistColumnName(), CQUERY_OP_EQUAL));
 
+            adapters::CDeviceAdapter adapter;
             if (blacklistedIncluded)
-               qSelect->Select().
-                  From(CDeviceTable::getTableName()).
-                  Where(CDeviceTable::getPluginIdColumnName(), CQUERY_OP_EQUAL, pluginId).
-                  And(CDeviceTable::getNameColumnName(), CQUERY_OP_EQUAL, name);
+               Statement.queryEntities(*m_databaseRequester, &adapter, pluginId, name);
             else
-               qSelect->Select().
-                  From(CDeviceTable::getTableName()).
-                  Where(CDeviceTable::getPluginIdColumnName(), CQUERY_OP_EQUAL, pluginId).
-                  And(CDeviceTable::getNameColumnName(), CQUERY_OP_EQUAL, name).
-                  And(CDeviceTable::getBlacklistColumnName(), CQUERY_OP_EQUAL, 0);
-
-            adapters::CDeviceAdapter adapter;
-            m_databaseRequester->queryEntities(&adapter, *qSelect);
+               NotBlacklistedStatement.queryEntities(*m_databaseRequester, &adapter, pluginId, name, false);
             if (adapter.getResults().empty())
                throw shared::exception::CEmptyResult((boost::format("Cannot retrieve Device Id=%1% in database") % name).str());
 
@@ -332,6 +338,145 @@ namespace database
             return adapter.getResults();
          }
 
+         std::string CDevice::getDevicesWithKeywordsAsJson(const DevicesWithKeywordsQuery& query, int& nextDeviceId) const
+         {
+            //device columns are aliased, as device and keyword tables have columns with the same names
+            static const std::string DeviceAlias("device_");
+
+            //statement text depends on the used criteria, each variant is prepared once
+            std::string statementName("getDevicesWithKeywords");
+            std::vector<std::string> parameters;
+            CStatementBuilder builder;
+
+            builder.Select(CDeviceTable::getTableName(),
+                           {
+                              CDeviceTable::getIdColumnName(), CDeviceTable::getPluginIdColumnName(), CDeviceTable::getNameColumnName(),
+                              CDeviceTable::getFriendlyNameColumnName(), CDeviceTable::getModelColumnName(), CDeviceTable::getDetailsColumnName(),
+                              CDeviceTable::getConfigurationColumnName(), CDeviceTable::getTypeColumnName(), CDeviceTable::getBlacklistColumnName()
+                           },
+                           DeviceAlias).
+                    AndSelect(CKeywordTable::getTableName(),
+                              {
+                                 CKeywordTable::getIdColumnName(), CKeywordTable::getDeviceIdColumnName(), CKeywordTable::getCapacityNameColumnName(),
+                                 CKeywordTable::getAccessModeColumnName(), CKeywordTable::getNameColumnName(), CKeywordTable::getFriendlyNameColumnName(),
+                                 CKeywordTable::getTypeColumnName(), CKeywordTable::getUnitsColumnName(), CKeywordTable::getTypeInfoColumnName(),
+                                 CKeywordTable::getMeasureColumnName(), CKeywordTable::getDetailsColumnName(), CKeywordTable::getBlacklistColumnName()
+                              });
+            if (query.lastValues)
+            {
+               statementName += "_v";
+               builder.AndSelect(CKeywordTable::getTableName(),
+                                 {CKeywordTable::getLastAcquisitionValueColumnName(), CKeywordTable::getLastAcquisitionDateColumnName()});
+            }
+
+            //the keywords criteria, in the join condition and to select the devices
+            const auto addKeywordCriteria = [&query, &parameters](CStatementBuilder& statement, const CDatabaseTable* qualifyingTable)
+            {
+               auto first = qualifyingTable == nullptr;
+               const auto addCriterion = [&statement, &first, qualifyingTable](const CDatabaseColumn& column)
+               {
+                  if (qualifyingTable == nullptr)
+                  {
+                     if (first)
+                        statement.Where(column, CQUERY_OP_EQUAL);
+                     else
+                        statement.And(column, CQUERY_OP_EQUAL);
+                  }
+                  else
+                  {
+                     statement.And(CStatementBuilder::qualified(*qualifyingTable, column), CQUERY_OP_EQUAL);
+                  }
+                  first = false;
+               };
+
+               if (!query.capacityName.empty())
+               {
+                  addCriterion(CKeywordTable::getCapacityNameColumnName());
+                  parameters.push_back(statementParameter<std::string>::format(query.capacityName));
+               }
+               if (query.accessMode)
+               {
+                  addCriterion(CKeywordTable::getAccessModeColumnName());
+                  parameters.push_back(statementParameter<shared::plugin::yPluginApi::EKeywordAccessMode>::format(query.accessMode.get()));
+               }
+               if (!query.blacklistedIncluded)
+               {
+                  addCriterion(CKeywordTable::getBlacklistColumnName());
+                  parameters.push_back(statementParameter<bool>::format(false));
+               }
+            };
+
+            builder.From(CDeviceTable::getTableName()).
+                    LeftJoin(CKeywordTable::getTableName(), CKeywordTable::getDeviceIdColumnName(),
+                             CDeviceTable::getTableName(), CDeviceTable::getIdColumnName());
+            addKeywordCriteria(builder, &CKeywordTable::getTableName());
+
+            //the devices of the page
+            builder.WhereIn(CStatementBuilder::qualified(CDeviceTable::getTableName(), CDeviceTable::getIdColumnName())).
+                    Select({CDeviceTable::getIdColumnName()}).
+                    From(CDeviceTable::getTableName()).
+                    Where(CDeviceTable::getIdColumnName(), CQUERY_OP_SUP);
+            parameters.push_back(statementParameter<int>::format(query.afterDeviceId));
+
+            if (query.pluginId != 0)
+            {
+               statementName += "_p";
+               builder.And(CDeviceTable::getPluginIdColumnName(), CQUERY_OP_EQUAL);
+               parameters.push_back(statementParameter<int>::format(query.pluginId));
+            }
+            if (!query.blacklistedIncluded)
+            {
+               statementName += "_b";
+               builder.And(CDeviceTable::getBlacklistColumnName(), CQUERY_OP_EQUAL);
+               parameters.push_back(statementParameter<bool>::format(false));
+            }
+            if (!query.capacityName.empty() || query.accessMode)
+            {
+               //only the devices having matching keywords
+               statementName += query.capacityName.empty() ? "" : "_c";
+               statementName += query.accessMode ? "_a" : "";
+               builder.AndIn(CDeviceTable::getIdColumnName()).
+                       Select({CKeywordTable::getDeviceIdColumnName()}).
+                       From(CKeywordTable::getTableName());
+               addKeywordCriteria(builder, nullptr);
+               builder.EndIn();
+            }
+
+            builder.OrderBy(CDeviceTable::getIdColumnName()).
+                    Limit().
+                    EndIn().
+                    OrderBy(CStatementBuilder::qualified(CDeviceTable::getTableName(), CDeviceTable::getIdColumnName())).
+                    ThenBy(CStatementBuilder::qualified(CKeywordTable::getTableName(), CKeywordTable::getIdColumnName()));
+            parameters.push_back(statementParameter<int>::format(query.maxDevices));
+
+            //same fields and default values than entities::CDevice read by adapters::CDeviceAdapter
+            const auto deviceColumn = [](const CDatabaseColumn& column)
+            {
+               return CDatabaseColumn(DeviceAlias + column.GetName());
+            };
+            adapters::CJsonCollectionAdapter adapter;
+            adapter.addField(deviceColumn(CDeviceTable::getIdColumnName()), "id", adapters::CJsonCollectionAdapter::kText, "0");
+            adapter.addField(deviceColumn(CDeviceTable::getPluginIdColumnName()), "pluginId", adapters::CJsonCollectionAdapter::kText, "0");
+            adapter.addField(deviceColumn(CDeviceTable::getNameColumnName()), "name");
+            adapter.addField(deviceColumn(CDeviceTable::getFriendlyNameColumnName()), "friendlyName");
+            adapter.addField(deviceColumn(CDeviceTable::getModelColumnName()), "model");
+            adapter.addField(deviceColumn(CDeviceTable::getDetailsColumnName()), "details", adapters::CJsonCollectionAdapter::kJson);
+            adapter.addField(deviceColumn(CDeviceTable::getConfigurationColumnName()), "configuration", adapters::CJsonCollectionAdapter::kJson);
+            adapter.addField(deviceColumn(CDeviceTable::getTypeColumnName()), "type");
+            adapter.addField(deviceColumn(CDeviceTable::getBlacklistColumnName()), "blacklist", adapters::CJsonCollectionAdapter::kBoolean, "0");
+            adapter.restrictFields(query.deviceFields);
+
+            auto keywordsAdapter = boost::make_shared<adapters::CJsonCollectionAdapter>();
+            CKeyword::addKeywordFields(*keywordsAdapter, query.lastValues);
+            keywordsAdapter->restrictFields(query.keywordFields);
+            adapter.setChildren(deviceColumn(CDeviceTable::getIdColumnName()), "keywords", keywordsAdapter, CKeywordTable::getIdColumnName());
+
+            m_databaseRequester->queryPreparedEntities(&adapter, statementName, builder.str(), parameters);
+
+            nextDeviceId = adapter.getCount() < query.maxDevices ? 0 : boost::lexical_cast<int>(adapter.getLastGroupValue());
+            return adapter.getRawResults();
+         }
+
          std::vector<std::string> CDevice::getDevicesNames(int pluginId,
                                                            bool blacklistedIncluded) const
          {
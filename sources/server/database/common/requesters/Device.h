@@ -34,6 +34,7 @@ namespace database
             boost::shared_ptr<entities::CDevice> createDevice(int pluginId, const std::string& name, const std::string& friendlyName, const std::string& type, const std::string& model, const shared::CDataContainer& details) override;
             std::vector<boost::shared_ptr<entities::CDevice>> getDevices(bool blacklistedIncluded = false) const override;
             std::vector<std::string> getDevicesNames(int pluginId, bool blacklistedIncluded = false) const override;
+            std::string getDevicesWithKeywordsAsJson(const DevicesWithKeywordsQuery& query, int& nextDeviceId) const override;
             std::vector<boost::shared_ptr<entities::CDevice>> getDevices(int pluginId, bool blacklistedIncluded = false) const override;
             std::vector<boost::shared_ptr<entities::CDevice>> getDevicesIdFromFriendlyName(const std::string& friendlyName) const override;
             std::vector<boost::shared_ptr<entities::CDevice>> getDeviceWithCapacity(const std::string& capacityName, const shared::plugin::yPluginApi::EKeywordAccessMode& accessMode) const override;
@@ -4,6 +4,8 @@
 #include <shared/exception/EmptyResult.hpp>
 #include "database/common/DatabaseTables.h"
 #include "database/common/Query.h"
+#include "database/common/Statement.hpp"
+#include <shared/currentTime/Provider.h>
 
 namespace database
 {
@@ -94,16 +96,15 @@ namespace database
 
          boost::shared_ptr<entities::CKeyword> CKeyword::getKeyword(int deviceId, const std::string& keyword) const
          {
-            adapters::CKeywordAdapter adapter;
-
-            auto qSelect = m_databaseRequester->newQuery();
-
-            qSelect->Select().
-               From(CKeywordTable::getTableName()).
-               Where(CKeywordTable::getDeviceIdColumnName(), CQUERY_OP_EQUAL, deviceId).
-               And(CKeywordTable::getNameColumnName(), CQUERY_OP_EQUAL, keyword);
+            //called for each keyword declaration or existence check by plugins, so statement is prepared
+            static const CStatement<int, std::string> Statement("getKeywordInDevice",
+                                                                CStatementBuilder().Select().
+                                                                From(CKeywordTable::getTableName()).
+                                                                Where(CKeywordTable::getDeviceIdColumnName(), CQUERY_OP_EQUAL).
+                                                                And(CKeywordTable::getNameColumnName(), CQUERY_OP_EQUAL));
 
-            m_databaseRequester->queryEntities(&adapter, *qSelect);
+            adapters::CKeywordAdapter adapter;
+            Statement.queryEntities(*m_databaseRequester, &adapter, deviceId, keyword);
             if (adapter.getResults().empty())
                throw shared::exception::CEmptyResult((boost::format("Keyword name %1% for device %2% not found in database") % keyword % deviceId).str());
 
@@ -112,14 +113,14 @@ namespace database
 
          boost::shared_ptr<entities::CKeyword> CKeyword::getKeyword(int keywordId) const
          {
-            adapters::CKeywordAdapter adapter;
+            //called for each acquisition, so statement is prepared
+            static const CStatement<int> Statement("getKeyword",
+                                                   CStatementBuilder().Select().
+                                                   From(CKeywordTable::getTableName()).
+                                                   Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL));
 
-            auto qSelect = m_databaseRequester->newQuery();
-            qSelect->Select().
-               From(CKeywordTable::getTableName()).
-               Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL, keywordId);
-
-            m_databaseRequester->queryEntities(&adapter, *qSelect);
+            adapters::CKeywordAdapter adapter;
+            Statement.queryEntities(*m_databaseRequester, &adapter, keywordId);
             if (adapter.getResults().empty())
                throw shared::exception::CEmptyResult((boost::format("Keyword id %1% not found in database") % keywordId).str());
 
@@ -150,6 +151,18 @@ namespace database
             return adapter.getResults();
          }
 
+         std::string CKeyword::getKeywordsAsJson(int deviceId) const
+         {
+            adapters::CJsonCollectionAdapter adapter;
+            addKeywordFields(adapter);
+            auto qSelect = m_databaseRequester->newQuery();
+            qSelect->Select().
+               From(CKeywordTable::getTableName()).
+               Where(CKeywordTable::getDeviceIdColumnName(), CQUERY_OP_EQUAL, deviceId);
+            m_databaseRequester->queryEntities(&adapter, *qSelect);
+            return adapter.getRawResults();
+         }
+
          std::vector<boost::shared_ptr<entities::CKeyword>> CKeyword::getKeywordsMatchingCapacity(const std::string& capacity) const
          {
             adapters::CKeywordAdapter adapter;
@@ -170,6 +183,16 @@ namespace database
             return adapter.getResults();
          }
 
+         std::string CKeyword::getAllKeywordsAsJson() const
+         {
+            adapters::CJsonCollectionAdapter adapter;
+            addKeywordFields(adapter);
+            auto qSelect = m_databaseRequester->newQuery();
+            qSelect->Select().From(CKeywordTable::getTableName());
+            m_databaseRequester->queryEntities(&adapter, *qSelect);
+            return adapter.getRawResults();
+         }
+
          std::vector<boost::shared_ptr<entities::CKeyword>> CKeyword::getDeviceKeywordsWithCapacity(int deviceId, const std::string& capacityName, const shared::plugin::yPluginApi::EKeywordAccessMode& accessMode) const
          {
             adapters::CKeywordAdapter adapter;
@@ -186,13 +209,13 @@ namespace database
 
          boost::shared_ptr<entities::CAcquisition> CKeyword::getKeywordLastAcquisition(const int keywordId, bool throwIfNotExists)
          {
-            auto qSelect = m_databaseRequester->newQuery();
-            qSelect->Select(CKeywordTable::getLastAcquisitionValueColumnName(), CKeywordTable::getLastAcquisitionDateColumnName()).
-               From(CKeywordTable::getTableName()).
-               Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL, keywordId);
+            static const CStatement<int> Statement("getKeywordLastAcquisition",
+                                                   CStatementBuilder().Select({CKeywordTable::getLastAcquisitionValueColumnName(), CKeywordTable::getLastAcquisitionDateColumnName()}).
+                                                   From(CKeywordTable::getTableName()).
+                                                   Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL));
 
             adapters::CKeywordAdapter adapter;
-            m_databaseRequester->queryEntities(&adapter, *qSelect);
+            Statement.queryEntities(*m_databaseRequester, &adapter, keywordId);
 
             if (adapter.getResults().size() >= 1)
             {
@@ -214,13 +237,13 @@ namespace database
 
          std::string CKeyword::getKeywordLastData(const int keywordId, bool throwIfNotExists)
          {
-            auto qSelect = m_databaseRequester->newQuery();
-            qSelect->Select(CKeywordTable::getLastAcquisitionValueColumnName()).
-               From(CKeywordTable::getTableName()).
-               Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL, keywordId);
+            static const CStatement<int> Statement("getKeywordLastData",
+                                                   CStatementBuilder().Select({CKeywordTable::getLastAcquisitionValueColumnName()}).
+                                                   From(CKeywordTable::getTableName()).
+                                                   Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL));
 
             adapters::CKeywordAdapter adapter;
-            m_databaseRequester->queryEntities(&adapter, *qSelect);
+            Statement.queryEntities(*m_databaseRequester, &adapter, keywordId);
 
             if (adapter.getResults().size() >= 1)
             {
@@ -282,15 +305,61 @@ namespace database
 
          void CKeyword::updateLastValue(int keywordId, const boost::posix_time::ptime& valueDatetime, const std::string& value)
          {
-            auto qUpdate = m_databaseRequester->newQuery();
-            qUpdate->Update(CKeywordTable::getTableName())
-               .Set(CKeywordTable::getLastAcquisitionDateColumnName(), valueDatetime,
-                    CKeywordTable::getLastAcquisitionValueColumnName(), value)
-               .Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL, keywordId);
-
-            if (m_databaseRequester->queryStatement(*qUpdate) <= 0)
+            const auto update = updateLastValueStatement(keywordId, valueDatetime, value);
+            if (m_databaseRequester->queryPreparedStatement(update.name, update.statement, update.parameters) <= 0)
                throw shared::exception::CEmptyResult("Fail to update keyword last value");
          }
+
+         void CKeyword::updateLastValues(const std::vector<boost::shared_ptr<entities::CAcquisition>>& acquisitions)
+         {
+            //updates are independent, so they are all sent at once
+            std::vector<IDatabaseRequester::PreparedStatement> updates;
+            for (const auto& acquisition : acquisitions)
+               updates.push_back(updateLastValueStatement(acquisition->KeywordId(), acquisition->Date(), acquisition->Value()));
+
+            for (const auto& affectedRows : m_databaseRequester->queryPreparedStatements(updates))
+            {
+               if (affectedRows <= 0)
+                  throw shared::exception::CEmptyResult("Fail to update keyword last value");
+            }
+         }
+
+         void CKeyword::addKeywordFields(adapters::CJsonCollectionAdapter& adapter, bool lastValue)
+         {
+            //same fields and default values than entities::CKeyword read by adapters::CKeywordAdapter
+            adapter.addField(CKeywordTable::getIdColumnName(), "id", adapters::CJsonCollectionAdapter::kText, "0");
+            adapter.addField(CKeywordTable::getDeviceIdColumnName(), "deviceId", adapters::CJsonCollectionAdapter::kText, "0");
+            adapter.addField(CKeywordTable::getCapacityNameColumnName(), "capacityName");
+            adapter.addField(CKeywordTable::getAccessModeColumnName(), "accessMode", adapters::CJsonCollectionAdapter::kText,
+                             shared::plugin::yPluginApi::EKeywordAccessMode::kNoAccess.toString());
+            adapter.addField(CKeywordTable::getNameColumnName(), "name");
+            adapter.addField(CKeywordTable::getFriendlyNameColumnName(), "friendlyName");
+            adapter.addField(CKeywordTable::getTypeColumnName(), "type", adapters::CJsonCollectionAdapter::kText,
+                             shared::plugin::yPluginApi::EKeywordDataType::kString.toString());
+            adapter.addField(CKeywordTable::getUnitsColumnName(), "units");
+            adapter.addField(CKeywordTable::getTypeInfoColumnName(), "typeInfo", adapters::CJsonCollectionAdapter::kJson);
+            adapter.addField(CKeywordTable::getMeasureColumnName(), "measure", adapters::CJsonCollectionAdapter::kText,
+                             shared::plugin::yPluginApi::historization::EMeasureType::kAbsolute.toString());
+            adapter.addField(CKeywordTable::getDetailsColumnName(), "details", adapters::CJsonCollectionAdapter::kJson);
+            adapter.addField(CKeywordTable::getBlacklistColumnName(), "blacklist", adapters::CJsonCollectionAdapter::kBoolean, "0");
+            if (!lastValue)
+               return;
+            adapter.addField(CKeywordTable::getLastAcquisitionValueColumnName(), "lastAcquisitionValue");
+            adapter.addField(CKeywordTable::getLastAcquisitionDateColumnName(), "lastAcquisitionDate", adapters::CJsonCollectionAdapter::kText,
+                             boost::posix_time::to_iso_string(shared::currentTime::Provider().now()));
+         }
+
+         IDatabaseRequester::PreparedStatement CKeyword::updateLastValueStatement(int keywordId, const boost::posix_time::ptime& valueDatetime, const std::string& value)
+         {
+            //called for each acquisition, so statement is prepared
+            static const CStatement<boost::posix_time::ptime, std::string, int> Statement("updateKeywordLastValue",
+                                                                                          CStatementBuilder().Update(CKeywordTable::getTableName()).
+                                                                                          Set(CKeywordTable::getLastAcquisitionDateColumnName()).
+                                                                                          Set(CKeywordTable::getLastAcquisitionValueColumnName()).
+                                                                                          Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL));
+
+            return Statement.bind(valueDatetime, value, keywordId);
+         }
       } //namespace requesters
    } //namespace common
 } //namespace database 
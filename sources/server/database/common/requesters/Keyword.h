@@ -2,6 +2,7 @@
 #include "database/IDataProvider.h"
 #include "database/IDatabaseRequester.h"
 #include "database/IKeywordRequester.h"
+#include "database/common/adapters/JsonCollectionAdapter.h"
 
 namespace database
 {
@@ -36,6 +37,8 @@ namespace database
             std::vector<boost::shared_ptr<entities::CKeyword>> getKeywordIdFromFriendlyName(int deviceId, const std::string& friendlyName) const override;
             std::vector<boost::shared_ptr<entities::CKeyword>> getKeywords(int deviceId) const override;
             std::vector<boost::shared_ptr<entities::CKeyword>> getAllKeywords() const override;
+            std::string getAllKeywordsAsJson() const override;
+            std::string getKeywordsAsJson(int deviceId) const override;
             std::vector<boost::shared_ptr<entities::CKeyword>> getDeviceKeywordsWithCapacity(int deviceId, const std::string& capacityName, const shared::plugin::yPluginApi::EKeywordAccessMode& accessMode) const override;
             boost::shared_ptr<entities::CAcquisition> getKeywordLastAcquisition(const int keywordId, bool throwIfNotExists = true) override;
             std::string getKeywordLastData(const int keywordId, bool throwIfNotExists = true) override;
@@ -43,9 +46,27 @@ namespace database
             void removeKeyword(int keywordId) override;
             void updateKeywordFriendlyName(int keywordId, const std::string& newFriendlyName) override;
             void updateLastValue(int keywordId, const boost::posix_time::ptime& valueDatetime, const std::string& value) override;
+            void updateLastValues(const std::vector<boost::shared_ptr<entities::CAcquisition>>& acquisitions) override;
             // [END] IKeywordRequester implementation
 
+            //--------------------------------------------------------------
+            /// \Brief		   Declare the keyword fields (as serialized by entities::CKeyword) to a JSON adapter
+            /// \param [in]	adapter     The adapter to configure
+            /// \param [in]	lastValue   Declare also the last acquisition fields
+            //--------------------------------------------------------------
+            static void addKeywordFields(adapters::CJsonCollectionAdapter& adapter, bool lastValue = true);
+
          private:
+
+            //--------------------------------------------------------------
+            /// \Brief		   Build the statement updating the last value of a keyword
+            /// \param [in]	keywordId      The keyword id
+            /// \param [in]	valueDatetime  The new value date time
+            /// \param [in]	value          The new value
+            /// \return       The prepared statement call
+            //--------------------------------------------------------------
+            static IDatabaseRequester::PreparedStatement updateLastValueStatement(int keywordId, const boost::posix_time::ptime& valueDatetime, const std::string& value);
+
             //--------------------------------------------------------------
             /// \Brief		   The database requester
             //--------------------------------------------------------------
@@ -1,6 +1,6 @@
 #include "stdafx.h"
 #include "VersionUpgraderFactory.h"
-#include "Version_4_2_0.h"
+#include "Version_4_3_0.h"
 
 namespace database
 {
@@ -19,7 +19,7 @@ namespace database
          boost::shared_ptr<IVersionUpgrade> CVersionUpgraderFactory::GetUpgrader()
          {
             //change this line when a new database version is released
-            return boost::make_shared<CVersion_4_2_0>();
+            return boost::make_shared<CVersion_4_3_0>();
          }
       } //namespace versioning
    } //namespace common
@@ -0,0 +1,134 @@
+#include "stdafx.h"
+#include "Version_4_3_0.h"
+#include "database/common/Query.h"
+#include "database/common/DatabaseTables.h"
+#include "database/common/AcquisitionPartitions.h"
+#include <shared/versioning/Version.h>
+#include "VersionException.h"
+#include <shared/Log.h>
+#include "database/common/adapters/SingleValueAdapter.hpp"
+
+namespace database
+{
+   namespace common
+   {
+      namespace versioning
+      {
+         // Modify this version to a greater value, to force update of current version
+         const shared::versioning::CVersion CVersion_4_3_0::Version(4, 3, 0);
+
+         CVersion_4_3_0::CVersion_4_3_0()
+         {
+         }
+
+         CVersion_4_3_0::~CVersion_4_3_0()
+         {
+         }
+
+         void CVersion_4_3_0::checkForUpgrade(const boost::shared_ptr<IDatabaseRequester>& requester,
+                                              const shared::versioning::CVersion& currentVersion)
+         {
+            if (currentVersion < Version)
+            {
+               //bad version, check base class version
+               CVersion_4_2_0::checkForUpgrade(requester, currentVersion);
+
+               //do update stuff
+               updateFrom4_2_0(requester);
+            }
+            else
+            {
+               //good version
+            }
+         }
+
+         void CVersion_4_3_0::updateFrom4_2_0(const boost::shared_ptr<IDatabaseRequester>& requester)
+         {
+            try
+            {
+               YADOMS_LOG(information) << "Upgrading database (4.2.0 -> 4.3.0)...";
+
+               // Acquisitions are now stored in monthly partitions (Acquisition_YYYYMM),
+               // the Acquisition table becomes the partitions parent (partitioned table or view)
+               const CDatabaseTable legacyTable("AcquisitionLegacy");
+
+               if (requester->transactionSupport())
+                  requester->transactionBegin();
+
+               // Keep current acquisitions aside
+               requester->queryStatement(CQuery::CustomQuery("ALTER TABLE " + CAcquisitionTable::getTableName().GetName() + " RENAME TO " + legacyTable.GetName(),
+                                                             CQuery::kAlter));
+
+               CAcquisitionPartitions partitions(requester);
+               partitions.createParent();
+
+               // Move acquisitions, month by month
+               auto qCount = requester->newQuery();
+               qCount->SelectCount().
+                       From(legacyTable);
+               if (requester->queryCount(*qCount) > 0)
+               {
+                  auto qFirstDate = requester->newQuery();
+                  qFirstDate->Select(qFirstDate->min(CAcquisitionTable::getDateColumnName())).
+                              From(legacyTable);
+                  adapters::CSingleValueAdapter<boost::posix_time::ptime> firstDateAdapter;
+                  requester->queryEntities(&firstDateAdapter, *qFirstDate);
+
+                  auto qLastDate = requester->newQuery();
+                  qLastDate->Select(qLastDate->max(CAcquisitionTable::getDateColumnName())).
+                             From(legacyTable);
+                  adapters::CSingleValueAdapter<boost::posix_time::ptime> lastDateAdapter;
+                  requester->queryEntities(&lastDateAdapter, *qLastDate);
+
+                  if (firstDateAdapter.getResults().empty() || lastDateAdapter.getResults().empty())
+                     throw CVersionException("Fail to get acquisitions dates");
+
+                  const auto lastMonth = CAcquisitionPartitions::monthOf(lastDateAdapter.getResults()[0]);
+                  for (auto month = CAcquisitionPartitions::monthOf(firstDateAdapter.getResults()[0]); month <= lastMonth; month += boost::gregorian::months(1))
+                  {
+                     const boost::posix_time::ptime fromDate(month);
+                     const boost::posix_time::ptime toDate(month + boost::gregorian::months(1));
+
+                     auto qMonthCount = requester->newQuery();
+                     qMonthCount->SelectCount().
+                                  From(legacyTable).
+                                  Where(CAcquisitionTable::getDateColumnName(), CQUERY_OP_SUP_EQUAL, fromDate).
+                                  And(CAcquisitionTable::getDateColumnName(), CQUERY_OP_INF, toDate);
+                     if (requester->queryCount(*qMonthCount) == 0)
+                        continue;
+
+                     YADOMS_LOG(information) << "  Move acquisitions of " << month.year() << "-" << static_cast<int>(month.month());
+                     auto qMove = requester->newQuery();
+                     qMove->InsertInto(partitions.partitionFor(fromDate), CAcquisitionTable::getDateColumnName(), CAcquisitionTable::getKeywordIdColumnName(), CAcquisitionTable::getValueColumnName()).
+                            Select(CAcquisitionTable::getDateColumnName(), CAcquisitionTable::getKeywordIdColumnName(), CAcquisitionTable::getValueColumnName()).
+                            From(legacyTable).
+                            Where(CAcquisitionTable::getDateColumnName(), CQUERY_OP_SUP_EQUAL, fromDate).
+                            And(CAcquisitionTable::getDateColumnName(), CQUERY_OP_INF, toDate);
+                     requester->queryStatement(*qMove);
+                  }
+               }
+
+               if (!requester->dropTableIfExists(legacyTable))
+                  throw CVersionException("Failed to delete AcquisitionLegacy table");
+
+               updateDatabaseVersion(requester, Version);
+
+               // Commit transaction
+               if (requester->transactionSupport())
+                  requester->transactionCommit();
+
+               // Compact database
+               requester->vacuum();
+            }
+            catch (std::exception& ex)
+            {
+               YADOMS_LOG(fatal) << "Failed to upgrade database (4.2.0 -> 4.3.0) : " << ex.what();
+               YADOMS_LOG(fatal) << "Rollback transaction";
+               if (requester->transactionSupport())
+                  requester->transactionRollback();
+               throw CVersionException("Failed to update database");
+            }
+         }
+      } //namespace versioning
+   } //namespace common
+} //namespace database
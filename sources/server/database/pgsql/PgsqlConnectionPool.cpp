@@ -0,0 +1,201 @@
+#include "stdafx.h"
+#include "PgsqlConnectionPool.h"
+#include "database/DatabaseException.hpp"
+#include <shared/currentTime/Provider.h>
+#include <shared/Log.h>
+
+namespace database
+{
+   namespace pgsql
+   {
+      const boost::posix_time::time_duration CPgsqlConnectionPool::HealthCheckIdleDelay(boost::posix_time::seconds(30));
+
+      CPgsqlConnectionPool::CPgsqlConnectionPool(boost::shared_ptr<CPgsqlLibrary> pgsqlLibrary,
+                                                 const std::string& connectionString,
+                                                 unsigned int maxConnections,
+                                                 const boost::posix_time::time_duration& acquireTimeout)
+         : m_pgsqlLibrary(pgsqlLibrary),
+           m_connectionString(connectionString),
+           m_maxConnections(maxConnections),
+           m_acquireTimeout(acquireTimeout),
+           m_openedConnections(0)
+      {
+      }
+
+      CPgsqlConnectionPool::~CPgsqlConnectionPool()
+      {
+         clear();
+      }
+
+      boost::shared_ptr<PGconn> CPgsqlConnectionPool::acquire()
+      {
+         const auto deadline = boost::get_system_time() + m_acquireTimeout;
+         boost::unique_lock<boost::mutex> lock(m_mutex);
+
+         while (true)
+         {
+            if (!m_idleConnections.empty())
+            {
+               //reuse the most recently released connection (the most likely to be still alive)
+               const auto idle = m_idleConnections.back();
+               m_idleConnections.pop_back();
+
+               lock.unlock();
+               if (checkHealth(idle.first, idle.second))
+                  return boost::shared_ptr<PGconn>(idle.first, [this](PGconn* connection) { release(connection); });
+               close(idle.first);
+               lock.lock();
+               continue;
+            }
+
+            if (m_openedConnections < m_maxConnections)
+            {
+               ++m_openedConnections;
+               lock.unlock();
+
+               PGconn* connection;
+               try
+               {
+                  connection = connect();
+               }
+               catch (std::exception&)
+               {
+                  lock.lock();
+                  --m_openedConnections;
+                  m_connectionReleased.notify_one();
+                  throw;
+               }
+               return boost::shared_ptr<PGconn>(connection, [this](PGconn* pConnection) { release(pConnection); });
+            }
+
+            //all connections are in use, wait for one to be given back
+            if (!m_connectionReleased.timed_wait(lock, deadline))
+               throw CDatabaseException((boost::format("No PostgreSQL connection available (%1% connections in use)") % m_openedConnections).str());
+         }
+      }
+
+      void CPgsqlConnectionPool::clear()
+      {
+         std::deque<std::pair<PGconn*, boost::posix_time::ptime>> idleConnections;
+         {
+            boost::lock_guard<boost::mutex> lock(m_mutex);
+            idleConnections.swap(m_idleConnections);
+         }
+
+         for (const auto& idle : idleConnections)
+            close(idle.first);
+      }
+
+      bool CPgsqlConnectionPool::isStatementPrepared(PGconn* connection, const std::string& statementName) const
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         const auto connectionStatements = m_preparedStatements.find(connection);
+         return connectionStatements != m_preparedStatements.end() && connectionStatements->second.find(statementName) != connectionStatements->second.end();
+      }
+
+      void CPgsqlConnectionPool::setStatementPrepared(PGconn* connection, const std::string& statementName)
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         m_preparedStatements[connection].insert(statementName);
+      }
+
+      void CPgsqlConnectionPool::release(PGconn* connection)
+      {
+#ifdef LIBPQ_HAS_PIPELINING
+         //a connection left in pipeline mode (broken pipeline) can't be used for synchronous queries anymore
+         if (m_pgsqlLibrary->pipelineSupported() && m_pgsqlLibrary->PQpipelineStatus(connection) != PQ_PIPELINE_OFF)
+         {
+            YADOMS_LOG(warning) << "PostgreSQL connection given back in pipeline mode, close it";
+            close(connection);
+            return;
+         }
+#endif
+
+         //a connection must be given back out of any transaction
+         switch (m_pgsqlLibrary->PQtransactionStatus(connection))
+         {
+         case PQTRANS_IDLE:
+            break;
+         case PQTRANS_INTRANS:
+         case PQTRANS_INERROR:
+            {
+               YADOMS_LOG(warning) << "PostgreSQL connection given back with an unfinished transaction, rollback it";
+               const auto res = m_pgsqlLibrary->PQexec(connection, "ROLLBACK");
+               m_pgsqlLibrary->PQclear(res);
+               break;
+            }
+         default:
+            //connection is busy or broken
+            close(connection);
+            return;
+         }
+
+         {
+            boost::lock_guard<boost::mutex> lock(m_mutex);
+            m_idleConnections.push_back(std::make_pair(connection, shared::currentTime::Provider().now()));
+         }
+         m_connectionReleased.notify_one();
+      }
+
+      PGconn* CPgsqlConnectionPool::connect() const
+      {
+         const auto connection = m_pgsqlLibrary->PQconnectdb(m_connectionString.c_str());
+
+         //Check to see that the backend connection was successfully made
+         if (m_pgsqlLibrary->PQstatus(connection) != CONNECTION_OK)
+         {
+            //save the error message
+            const std::string error(m_pgsqlLibrary->PQerrorMessage(connection));
+
+            //clear connection
+            m_pgsqlLibrary->PQfinish(connection);
+
+            throw CDatabaseException("Fail to connect database", error);
+         }
+         return connection;
+      }
+
+      bool CPgsqlConnectionPool::checkHealth(PGconn* connection, const boost::posix_time::ptime& idleSince)
+      {
+         if (m_pgsqlLibrary->PQstatus(connection) == CONNECTION_OK)
+         {
+            if (shared::currentTime::Provider().now() - idleSince < HealthCheckIdleDelay)
+               return true;
+
+            //the server may have closed the connection while it was idle
+            const auto res = m_pgsqlLibrary->PQexec(connection, "SELECT 1");
+            const auto alive = m_pgsqlLibrary->PQresultStatus(res) == PGRES_TUPLES_OK;
+            m_pgsqlLibrary->PQclear(res);
+            if (alive)
+               return true;
+         }
+
+         YADOMS_LOG(information) << "PostgreSQL connection is broken, reset it";
+
+         //prepared statements are lost with the server session
+         {
+            boost::lock_guard<boost::mutex> lock(m_mutex);
+            m_preparedStatements.erase(connection);
+         }
+
+         m_pgsqlLibrary->PQreset(connection);
+         return m_pgsqlLibrary->PQstatus(connection) == CONNECTION_OK;
+      }
+
+      void CPgsqlConnectionPool::close(PGconn* connection)
+      {
+         {
+            boost::lock_guard<boost::mutex> lock(m_mutex);
+            m_preparedStatements.erase(connection);
+         }
+
+         m_pgsqlLibrary->PQfinish(connection);
+
+         {
+            boost::lock_guard<boost::mutex> lock(m_mutex);
+            --m_openedConnections;
+         }
+         m_connectionReleased.notify_one();
+      }
+   } //namespace pgsql
+} //namespace database
@@ -0,0 +1,125 @@
+#pragma once
+#include "PgsqlLibrary.h"
+
+namespace database
+{
+   namespace pgsql
+   {
+      //--------------------------------------------------------------
+      /// \Brief		   Bounded pool of PostgreSQL connections
+      ///
+      /// Connections are leased for one query (or one transaction), and given back to the pool
+      /// when the lease is released. Connections are checked (and reset if broken) before being reused.
+      //--------------------------------------------------------------
+      class CPgsqlConnectionPool
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \Brief		   Constructor
+         /// \param [in]	pgsqlLibrary      The PostgreSQL library
+         /// \param [in]	connectionString  The connection string
+         /// \param [in]	maxConnections    The maximum number of opened connections
+         /// \param [in]	acquireTimeout    The maximum time to wait for a free connection
+         //--------------------------------------------------------------
+         CPgsqlConnectionPool(boost::shared_ptr<CPgsqlLibrary> pgsqlLibrary,
+                              const std::string& connectionString,
+                              unsigned int maxConnections,
+                              const boost::posix_time::time_duration& acquireTimeout);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Destructor (all connections must have been released)
+         //--------------------------------------------------------------
+         virtual ~CPgsqlConnectionPool();
+
+         //--------------------------------------------------------------
+         /// \Brief		   Lease a connection (wait if all connections are in use)
+         /// \return       The connection, given back to the pool when last reference is released
+         /// \throws       CDatabaseException If no connection could be obtained
+         //--------------------------------------------------------------
+         boost::shared_ptr<PGconn> acquire();
+
+         //--------------------------------------------------------------
+         /// \Brief		   Close all idle connections (leased ones are checked when given back)
+         //--------------------------------------------------------------
+         void clear();
+
+         //--------------------------------------------------------------
+         /// \Brief		   Check if a statement was already prepared on a connection
+         /// \param [in]	connection     The connection
+         /// \param [in]	statementName  The statement name
+         /// \return       true if statement is already prepared
+         //--------------------------------------------------------------
+         bool isStatementPrepared(PGconn* connection, const std::string& statementName) const;
+
+         //--------------------------------------------------------------
+         /// \Brief		   Remember that a statement was prepared on a connection
+         /// \param [in]	connection     The connection
+         /// \param [in]	statementName  The statement name
+         //--------------------------------------------------------------
+         void setStatementPrepared(PGconn* connection, const std::string& statementName);
+
+      private:
+         //--------------------------------------------------------------
+         /// \Brief		   Give back a connection to the pool
+         /// \param [in]	connection  The connection
+         //--------------------------------------------------------------
+         void release(PGconn* connection);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Open a new connection
+         /// \return       The connection
+         /// \throws       CDatabaseException If connection fails
+         //--------------------------------------------------------------
+         PGconn* connect() const;
+
+         //--------------------------------------------------------------
+         /// \Brief		   Check an idle connection before reusing it, try to reset it if broken
+         /// \param [in]	connection  The connection
+         /// \param [in]	idleSince   The time the connection was given back
+         /// \return       true if connection can be used
+         //--------------------------------------------------------------
+         bool checkHealth(PGconn* connection, const boost::posix_time::ptime& idleSince);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Close a connection
+         /// \param [in]	connection  The connection
+         //--------------------------------------------------------------
+         void close(PGconn* connection);
+
+         //--------------------------------------------------------------
+         /// \Brief		   Idle connections older than this are pinged before being reused
+         //--------------------------------------------------------------
+         static const boost::posix_time::time_duration HealthCheckIdleDelay;
+
+         boost::shared_ptr<CPgsqlLibrary> m_pgsqlLibrary;
+         const std::string m_connectionString;
+         const unsigned int m_maxConnections;
+         const boost::posix_time::time_duration m_acquireTimeout;
+
+         //--------------------------------------------------------------
+         /// \Brief		   Mutex protecting the pool state
+         //--------------------------------------------------------------
+         mutable boost::mutex m_mutex;
+
+         //--------------------------------------------------------------
+         /// \Brief		   Signaled when a connection is given back
+         //--------------------------------------------------------------
+         boost::condition_variable m_connectionReleased;
+
+         //--------------------------------------------------------------
+         /// \Brief		   The idle connections, with the time they were given back (most recent last)
+         //--------------------------------------------------------------
+         std::deque<std::pair<PGconn*, boost::posix_time::ptime>> m_idleConnections;
+
+         //--------------------------------------------------------------
+         /// \Brief		   The number of opened connections (idle and leased)
+         //--------------------------------------------------------------
+         unsigned int m_openedConnections;
+
+         //--------------------------------------------------------------
+         /// \Brief		   The statements prepared on each opened connection
+         //--------------------------------------------------------------
+         std::map<PGconn*, std::set<std::string>> m_preparedStatements;
+      };
+   } //namespace pgsql
+} //namespace database
@@ -136,6 +136,82 @@ namespace database
          return m_PQfsizeFct(res, field_num);
       }
 
+      void CPgsqlLibrary::PQreset(PGconn* conn) const
+      {
+         m_PQresetFct(conn);
+      }
+
+      PGTransactionStatusType CPgsqlLibrary::PQtransactionStatus(const PGconn* conn) const
+      {
+         return m_PQtransactionStatusFct(conn);
+      }
+
+      PGresult* CPgsqlLibrary::PQprepare(PGconn* conn, const char* stmtName, const char* query, int nParams, const Oid* paramTypes) const
+      {
+         return m_PQprepareFct(conn, stmtName, query, nParams, paramTypes);
+      }
+
+      PGresult* CPgsqlLibrary::PQexecPrepared(PGconn* conn, const char* stmtName, int nParams, const char* const* paramValues, const int* paramLengths, const int* paramFormats, int resultFormat) const
+      {
+         return m_PQexecPreparedFct(conn, stmtName, nParams, paramValues, paramLengths, paramFormats, resultFormat);
+      }
+
+      int CPgsqlLibrary::PQputCopyData(PGconn* conn, const char* buffer, int nbytes) const
+      {
+         return m_PQputCopyDataFct(conn, buffer, nbytes);
+      }
+
+      int CPgsqlLibrary::PQputCopyEnd(PGconn* conn, const char* errormsg) const
+      {
+         return m_PQputCopyEndFct(conn, errormsg);
+      }
+
+      PGresult* CPgsqlLibrary::PQgetResult(PGconn* conn) const
+      {
+         return m_PQgetResultFct(conn);
+      }
+
+      int CPgsqlLibrary::PQsendPrepare(PGconn* conn, const char* stmtName, const char* query, int nParams, const Oid* paramTypes) const
+      {
+         return m_PQsendPrepareFct(conn, stmtName, query, nParams, paramTypes);
+      }
+
+      int CPgsqlLibrary::PQsendQueryPrepared(PGconn* conn, const char* stmtName, int nParams, const char* const* paramValues, const int* paramLengths, const int* paramFormats, int resultFormat) const
+      {
+         return m_PQsendQueryPreparedFct(conn, stmtName, nParams, paramValues, paramLengths, paramFormats, resultFormat);
+      }
+
+      int CPgsqlLibrary::PQenterPipelineMode(PGconn* conn) const
+      {
+         return m_PQenterPipelineModeFct(conn);
+      }
+
+      int CPgsqlLibrary::PQexitPipelineMode(PGconn* conn) const
+      {
+         return m_PQexitPipelineModeFct(conn);
+      }
+
+      int CPgsqlLibrary::PQpipelineSync(PGconn* conn) const
+      {
+         return m_PQpipelineSyncFct(conn);
+      }
+
+#ifdef LIBPQ_HAS_PIPELINING
+      PGpipelineStatus CPgsqlLibrary::PQpipelineStatus(const PGconn* conn) const
+      {
+         return m_PQpipelineStatusFct(conn);
+      }
+#endif
+
+      bool CPgsqlLibrary::pipelineSupported() const
+      {
+#ifdef LIBPQ_HAS_PIPELINING
+         return m_PQenterPipelineModeFct != nullptr && m_PQexitPipelineModeFct != nullptr && m_PQpipelineSyncFct != nullptr && m_PQpipelineStatusFct != nullptr;
+#else
+         return m_PQenterPipelineModeFct != nullptr && m_PQexitPipelineModeFct != nullptr && m_PQpipelineSyncFct != nullptr;
+#endif
+      }
+
       void CPgsqlLibrary::loadSymbols()
       {
          m_PQconnectdbFct = m_lib.get<PQconnectdbFctType>("PQconnectdb");
@@ -161,6 +237,23 @@ namespace database
          m_PQbinaryTuplesFct = m_lib.get<PQbinaryTuplesFctType>("PQbinaryTuples");
          m_PQgetisnullFct = m_lib.get<PQgetisnullFctType>("PQgetisnull");
          m_PQfsizeFct = m_lib.get<PQfsizeType>("PQfsize");
+         m_PQresetFct = m_lib.get<PQresetFctType>("PQreset");
+         m_PQtransactionStatusFct = m_lib.get<PQtransactionStatusFctType>("PQtransactionStatus");
+         m_PQprepareFct = m_lib.get<PQprepareFctType>("PQprepare");
+         m_PQexecPreparedFct = m_lib.get<PQexecPreparedFctType>("PQexecPrepared");
+         m_PQputCopyDataFct = m_lib.get<PQputCopyDataFctType>("PQputCopyData");
+         m_PQputCopyEndFct = m_lib.get<PQputCopyEndFctType>("PQputCopyEnd");
+         m_PQgetResultFct = m_lib.get<PQgetResultFctType>("PQgetResult");
+         m_PQsendPrepareFct = m_lib.get<PQsendPrepareFctType>("PQsendPrepare");
+         m_PQsendQueryPreparedFct = m_lib.get<PQsendQueryPreparedFctType>("PQsendQueryPrepared");
+
+         //pipeline mode is only available since libpq 14
+         m_PQenterPipelineModeFct = m_lib.has("PQenterPipelineMode") ? m_lib.get<PQenterPipelineModeFctType>("PQenterPipelineMode") : nullptr;
+         m_PQexitPipelineModeFct = m_lib.has("PQexitPipelineMode") ? m_lib.get<PQexitPipelineModeFctType>("PQexitPipelineMode") : nullptr;
+         m_PQpipelineSyncFct = m_lib.has("PQpipelineSync") ? m_lib.get<PQpipelineSyncFctType>("PQpipelineSync") : nullptr;
+#ifdef LIBPQ_HAS_PIPELINING
+         m_PQpipelineStatusFct = m_lib.has("PQpipelineStatus") ? m_lib.get<PQpipelineStatusFctType>("PQpipelineStatus") : nullptr;
+#endif
       }
    } //namespace pgsql
 } //namespace database 
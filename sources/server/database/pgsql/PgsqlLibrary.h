@@ -36,8 +36,28 @@ namespace database
          int PQbinaryTuples(const PGresult* res) const;
          int PQgetisnull(const PGresult* res, int tup_num, int field_num) const;
          int PQfsize(const PGresult* res, int field_num) const;
+         void PQreset(PGconn* conn) const;
+         PGTransactionStatusType PQtransactionStatus(const PGconn* conn) const;
+         PGresult* PQprepare(PGconn* conn, const char* stmtName, const char* query, int nParams, const Oid* paramTypes) const;
+         PGresult* PQexecPrepared(PGconn* conn, const char* stmtName, int nParams, const char* const* paramValues, const int* paramLengths, const int* paramFormats, int resultFormat) const;
+         int PQputCopyData(PGconn* conn, const char* buffer, int nbytes) const;
+         int PQputCopyEnd(PGconn* conn, const char* errormsg) const;
+         PGresult* PQgetResult(PGconn* conn) const;
+         int PQsendPrepare(PGconn* conn, const char* stmtName, const char* query, int nParams, const Oid* paramTypes) const;
+         int PQsendQueryPrepared(PGconn* conn, const char* stmtName, int nParams, const char* const* paramValues, const int* paramLengths, const int* paramFormats, int resultFormat) const;
+         int PQenterPipelineMode(PGconn* conn) const;
+         int PQexitPipelineMode(PGconn* conn) const;
+         int PQpipelineSync(PGconn* conn) const;
+#ifdef LIBPQ_HAS_PIPELINING
+         PGpipelineStatus PQpipelineStatus(const PGconn* conn) const;
+#endif
          // [END] Imported functions from offical PostgreSql library
 
+         //--------------------------------------------------------------
+         /// \Brief		Tells if loaded library supports pipeline mode (libpq 14 and later)
+         //--------------------------------------------------------------
+         bool pipelineSupported() const;
+
       private:
          void loadSymbols();
 
@@ -112,6 +132,48 @@ namespace database
 
          typedef int (PQfsizeType)(const PGresult* res, int field_num);
          PQfsizeType* m_PQfsizeFct;
+
+         typedef void (PQresetFctType)(PGconn* conn);
+         PQresetFctType* m_PQresetFct;
+
+         typedef PGTransactionStatusType (PQtransactionStatusFctType)(const PGconn* conn);
+         PQtransactionStatusFctType* m_PQtransactionStatusFct;
+
+         typedef PGresult* (PQprepareFctType)(PGconn* conn, const char* stmtName, const char* query, int nParams, const Oid* paramTypes);
+         PQprepareFctType* m_PQprepareFct;
+
+         typedef PGresult* (PQexecPreparedFctType)(PGconn* conn, const char* stmtName, int nParams, const char* const* paramValues, const int* paramLengths, const int* paramFormats, int resultFormat);
+         PQexecPreparedFctType* m_PQexecPreparedFct;
+
+         typedef int (PQputCopyDataFctType)(PGconn* conn, const char* buffer, int nbytes);
+         PQputCopyDataFctType* m_PQputCopyDataFct;
+
+         typedef int (PQputCopyEndFctType)(PGconn* conn, const char* errormsg);
+         PQputCopyEndFctType* m_PQputCopyEndFct;
+
+         typedef PGresult* (PQgetResultFctType)(PGconn* conn);
+         PQgetResultFctType* m_PQgetResultFct;
+
+         typedef int (PQsendPrepareFctType)(PGconn* conn, const char* stmtName, const char* query, int nParams, const Oid* paramTypes);
+         PQsendPrepareFctType* m_PQsendPrepareFct;
+
+         typedef int (PQsendQueryPreparedFctType)(PGconn* conn, const char* stmtName, int nParams, const char* const* paramValues, const int* paramLengths, const int* paramFormats, int resultFormat);
+         PQsendQueryPreparedFctType* m_PQsendQueryPreparedFct;
+
+         // Pipeline functions (optional, null if library is older than libpq 14)
+         typedef int (PQenterPipelineModeFctType)(PGconn* conn);
+         PQenterPipelineModeFctType* m_PQenterPipelineModeFct;
+
+         typedef int (PQexitPipelineModeFctType)(PGconn* conn);
+         PQexitPipelineModeFctType* m_PQexitPipelineModeFct;
+
+         typedef int (PQpipelineSyncFctType)(PGconn* conn);
+         PQpipelineSyncFctType* m_PQpipelineSyncFct;
+
+#ifdef LIBPQ_HAS_PIPELINING
+         typedef PGpipelineStatus (PQpipelineStatusFctType)(const PGconn* conn);
+         PQpipelineStatusFctType* m_PQpipelineStatusFct;
+#endif
          // [END] PostgreSql library Functions
       };
    } //namespace pgsql
@@ -12,54 +12,69 @@
 #include <shared/ServiceLocator.h>
 #include "startupOptions/IStartupOptions.h"
 #include <shared/Log.h>
+#include <shared/exception/NullReference.hpp>
+#include "database/common/DatabaseTables.h"
+#include <Poco/ByteOrder.h>
 
 namespace database
 {
    namespace pgsql
    {
-      CPgsqlRequester::CPgsqlRequester(boost::shared_ptr<CPgsqlLibrary> pgsqlLibrary)
-         :m_pgsqlLibrary(pgsqlLibrary)
+      namespace
       {
-      }
+         //binary COPY format (see PostgreSQL COPY documentation)
+         const char CopyBinarySignature[] = "PGCOPY\n\377\r\n";
 
-      CPgsqlRequester::~CPgsqlRequester()
-      {
-      }
+         void appendInt16(std::string& buffer, Poco::Int16 value)
+         {
+            value = Poco::ByteOrder::toNetwork(value);
+            buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+         }
 
-      PGconn* CPgsqlRequester::createNewConnection()
-      {
-         //connect to postgresql engine
-         const auto result = m_pgsqlLibrary->PQconnectdb(createConnectionString().c_str());
+         void appendInt32(std::string& buffer, Poco::Int32 value)
+         {
+            value = Poco::ByteOrder::toNetwork(value);
+            buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+         }
 
-         //Check to see that the backend connection was successfully made
-         if (m_pgsqlLibrary->PQstatus(result) != CONNECTION_OK)
+         void appendText(std::string& buffer, const std::string& value)
          {
-            //save the error message
-            const auto error = getLastErrorMessage(result);
+            appendInt32(buffer, static_cast<Poco::Int32>(value.size()));
+            buffer.append(value);
+         }
+      }
 
-            //clear connection
-            m_pgsqlLibrary->PQfinish(result);
+      const unsigned int CPgsqlRequester::MaxConnections = 8;
+      const boost::posix_time::time_duration CPgsqlRequester::AcquireConnectionTimeout(boost::posix_time::seconds(30));
+      const int CPgsqlRequester::PipelineMaxStatements = 100;
+      const int CPgsqlRequester::PartitionedTablesMinServerVersion = 110000;
 
-            throw CDatabaseException("Fail to connect database", error);
-         }
-         return result;
+      CPgsqlRequester::CPgsqlRequester(boost::shared_ptr<CPgsqlLibrary> pgsqlLibrary)
+         :m_pgsqlLibrary(pgsqlLibrary),
+          m_serverVersion(0)
+      {
       }
 
-      PGconn* CPgsqlRequester::getConnection()
+      CPgsqlRequester::~CPgsqlRequester()
+      {
+      }
+
+      boost::shared_ptr<PGconn> CPgsqlRequester::getConnection()
       {
          try
          {
-            //obtain thread id
-            const auto threadId = boost::lexical_cast<std::string>(boost::this_thread::get_id());
-            unsigned long threadNumber = 0;
-            sscanf(threadId.c_str(), "%lx", &threadNumber);
+            //a thread in a transaction always uses the transaction connection
+            {
+               boost::lock_guard<boost::mutex> lock(m_transactionConnectionsMutex);
+               const auto transaction = m_transactionConnections.find(boost::this_thread::get_id());
+               if (transaction != m_transactionConnections.end())
+                  return transaction->second;
+            }
 
-            //if connection do not exists for this thread, then create a new one
-            if (m_connectionList.find(threadNumber) == m_connectionList.end())
-               m_connectionList[threadNumber] = createNewConnection();
+            if (!m_connectionPool)
+               throw CDatabaseException("PostgreSQL database is not initialized");
 
-            //return it
-            return m_connectionList[threadNumber];
+            return m_connectionPool->acquire();
          }
          catch (std::exception& ex)
          {
@@ -237,6 +252,17 @@ namespace database
                   }
                }
             }
+            else
+            {
+               //database is reachable, connections will now be taken from the pool
+               m_pgsqlLibrary->PQfinish(pConnection);
+            }
+
+            m_connectionPool = boost::make_shared<CPgsqlConnectionPool>(m_pgsqlLibrary, createConnectionString(), MaxConnections, AcquireConnectionTimeout);
+
+            m_serverVersion = m_pgsqlLibrary->PQserverVersion(getConnection().get());
+            if (!supportPartitionedTables())
+               YADOMS_LOG(warning) << "PostgreSQL server older than 11 : acquisitions partitions are gathered by a view, consider upgrading the server";
          }
          catch (...)
          {
@@ -256,7 +282,8 @@ namespace database
          {
             results.set("type", "PostgreSQL");
 
-            const auto pcon = getConnection();
+            const auto connection = getConnection();
+            const auto pcon = connection.get();
 
 
             auto version = m_pgsqlLibrary->PQserverVersion(pcon);
@@ -284,20 +311,60 @@ namespace database
       void CPgsqlRequester::closeAllConnections()
       {
          //clear transactions
-         //do not do anything, let pgsql engine manage it
-         m_activeTransactionsList.clear();
+         //do not do anything, let pgsql engine manage it (connections are given back to the pool when released)
+         {
+            boost::lock_guard<boost::mutex> lock(m_transactionConnectionsMutex);
+            m_transactionConnections.clear();
+         }
 
-         //close all connection
-         for (const auto& i : m_connectionList)
-            m_pgsqlLibrary->PQfinish(i.second);
-         m_connectionList.clear();
+         //close all idle connections
+         if (m_connectionPool)
+            m_connectionPool->clear();
       }
 
       PGresult* CPgsqlRequester::executeQuery(PGconn* pConnection, const std::string& querytoExecute, ExecStatusType expectedResultCode, bool throwIfFails)
       {
          YADOMS_LOG(debug) << "[REQUEST] executeQuery - " << querytoExecute;
-         auto res = m_pgsqlLibrary->PQexec(pConnection, querytoExecute.c_str());
+         return checkResult(pConnection, m_pgsqlLibrary->PQexec(pConnection, querytoExecute.c_str()), querytoExecute, expectedResultCode, throwIfFails);
+      }
 
+      PGresult* CPgsqlRequester::executePrepared(PGconn* pConnection,
+                                                 const std::string& statementName,
+                                                 const std::string& statement,
+                                                 const std::vector<std::string>& parameters,
+                                                 ExecStatusType expectedResultCode,
+                                                 bool throwIfFails)
+      {
+         YADOMS_LOG(debug) << "[REQUEST] executePrepared - " << statementName;
+
+         //statements are prepared by connection (server session)
+         if (!m_connectionPool->isStatementPrepared(pConnection, statementName))
+         {
+            const auto res = checkResult(pConnection,
+                                         m_pgsqlLibrary->PQprepare(pConnection, statementName.c_str(), statement.c_str(), 0, nullptr),
+                                         statement,
+                                         PGRES_COMMAND_OK,
+                                         throwIfFails);
+            if (res == nullptr)
+               return nullptr;
+            m_pgsqlLibrary->PQclear(res);
+            m_connectionPool->setStatementPrepared(pConnection, statementName);
+         }
+
+         std::vector<const char*> values;
+         values.reserve(parameters.size());
+         for (const auto& parameter : parameters)
+            values.push_back(parameter.c_str());
+
+         return checkResult(pConnection,
+                            m_pgsqlLibrary->PQexecPrepared(pConnection, statementName.c_str(), static_cast<int>(values.size()), values.data(), nullptr, nullptr, 0),
+                            statement,
+                            expectedResultCode,
+                            throwIfFails);
+      }
+
+      PGresult* CPgsqlRequester::checkResult(PGconn* pConnection, PGresult* res, const std::string& querytoExecute, ExecStatusType expectedResultCode, bool throwIfFails)
+      {
          const auto resultCode = m_pgsqlLibrary->PQresultStatus(res);
          if (resultCode != expectedResultCode)
          {
@@ -343,7 +410,10 @@ namespace database
                {
                   YADOMS_LOG(information) << "SQL ERROR " << realError.GetDescription() << " [" << realError.GetCode() << "]";
                   if (throwIfFails)
-                     throw CDatabaseException(errMessage);
+                     throw CDatabaseException(errMessage,
+                                              realError.GetClass() == ESqlErrorClass::kIntegrityConstraintViolation
+                                                 ? CDatabaseException::kConstraintViolation
+                                                 : CDatabaseException::kError);
                }
             }
             else
@@ -358,7 +428,8 @@ namespace database
 
       void CPgsqlRequester::queryEntities(common::adapters::IResultAdapter* adapter, const common::CQuery& querytoExecute)
       {
-         queryEntities(adapter, querytoExecute, getConnection());
+         const auto connection = getConnection();
+         queryEntities(adapter, querytoExecute, connection.get());
       }
 
       void CPgsqlRequester::queryEntities(common::adapters::IResultAdapter* adapter, const common::CQuery& querytoExecute, PGconn* pConnection)
@@ -402,7 +473,8 @@ namespace database
 
       int CPgsqlRequester::queryStatement(const common::CQuery& querytoExecute, bool throwIfFails)
       {
-         return queryStatement(querytoExecute, throwIfFails, getConnection());
+         const auto connection = getConnection();
+         return queryStatement(querytoExecute, throwIfFails, connection.get());
       }
 
       int CPgsqlRequester::queryStatement(const common::CQuery& querytoExecute, bool throwIfFails, PGconn* pConnection)
@@ -417,17 +489,23 @@ namespace database
          if (resultCode != PGRES_COMMAND_OK)
             return -1;
 
-         auto affectedRows = 0;
-         std::string affectedRowsString = m_pgsqlLibrary->PQcmdTuples(res);
-         if (!affectedRowsString.empty())
-            affectedRows = atoi(affectedRowsString.c_str());
+         const auto affectedRows = getAffectedRows(res);
          m_pgsqlLibrary->PQclear(res);
          return affectedRows;
       }
 
+      int CPgsqlRequester::getAffectedRows(PGresult* res) const
+      {
+         std::string affectedRowsString = m_pgsqlLibrary->PQcmdTuples(res);
+         if (affectedRowsString.empty())
+            return 0;
+         return atoi(affectedRowsString.c_str());
+      }
+
       int CPgsqlRequester::queryCount(const common::CQuery& querytoExecute)
       {
-         return queryCount(querytoExecute, getConnection());
+         const auto connection = getConnection();
+         return queryCount(querytoExecute, connection.get());
       }
 
       int CPgsqlRequester::queryCount(const common::CQuery& querytoExecute, PGconn* pConnection)
@@ -468,77 +546,328 @@ namespace database
          return genericAdapter.getResults();
       }
 
-
-      bool CPgsqlRequester::transactionSupport()
+      void CPgsqlRequester::queryPreparedEntities(common::adapters::IResultAdapter* adapter,
+                                                  const std::string& statementName,
+                                                  const std::string& statement,
+                                                  const std::vector<std::string>& parameters)
       {
-         return true;
+         BOOST_ASSERT(adapter != NULL);
+
+         if (adapter == nullptr)
+            throw shared::exception::CNullReference("adapter");
+
+         PGresult* res = nullptr;
+         try
+         {
+            const auto connection = getConnection();
+            res = executePrepared(connection.get(), statementName, statement, parameters, PGRES_TUPLES_OK, true);
+            const auto handler(boost::make_shared<CPgsqlResultHandler>(m_pgsqlLibrary, res));
+            if (!adapter->adapt(handler))
+            {
+               YADOMS_LOG(error) << "Fail to adapt values";
+            }
+         }
+         catch (std::exception& ex)
+         {
+            YADOMS_LOG(error) << "Exception: Fail to execute prepared statement " << statementName << " : " << ex.what();
+         }
+
+         //free memory
+         if (res != nullptr)
+            m_pgsqlLibrary->PQclear(res);
       }
 
-      void CPgsqlRequester::transactionBegin()
+      int CPgsqlRequester::queryPreparedStatement(const std::string& statementName,
+                                                  const std::string& statement,
+                                                  const std::vector<std::string>& parameters,
+                                                  bool throwIfFails)
       {
-         transactionBegin(getConnection());
+         const auto connection = getConnection();
+         const auto res = executePrepared(connection.get(), statementName, statement, parameters, PGRES_COMMAND_OK, throwIfFails);
+         if (res == nullptr)
+            return -1;
+
+         const auto affectedRows = getAffectedRows(res);
+         m_pgsqlLibrary->PQclear(res);
+         return affectedRows;
       }
 
-      void CPgsqlRequester::transactionBegin(PGconn* pConnection)
+      std::vector<int> CPgsqlRequester::queryPreparedStatements(const std::vector<PreparedStatement>& statements)
       {
-         if (!transactionIsAlreadyCreated(pConnection))
+         const auto connection = getConnection();
+         std::vector<int> affectedRows;
+
+#ifdef LIBPQ_HAS_PIPELINING
+         if (m_pgsqlLibrary->pipelineSupported() && statements.size() > 1)
          {
-            const auto res = executeQuery(pConnection, "BEGIN", PGRES_COMMAND_OK, false);
-            if (m_pgsqlLibrary->PQresultStatus(res) == PGRES_COMMAND_OK)
+            //statements are independent : send them without waiting each result (one network round trip)
+            for (auto first = statements.begin(); first != statements.end();)
             {
-               m_activeTransactionsList[pConnection] = true;
+               const auto last = std::distance(first, statements.end()) > PipelineMaxStatements ? first + PipelineMaxStatements : statements.end();
+               const auto pipelineAffectedRows = executePipeline(connection.get(), std::vector<PreparedStatement>(first, last));
+               affectedRows.insert(affectedRows.end(), pipelineAffectedRows.begin(), pipelineAffectedRows.end());
+               first = last;
             }
+            return affectedRows;
+         }
+#endif
+
+         //libpq too old for pipeline mode, one round trip by statement
+         for (const auto& statement : statements)
+         {
+            const auto res = executePrepared(connection.get(), statement.name, statement.statement, statement.parameters, PGRES_COMMAND_OK, true);
+            affectedRows.push_back(getAffectedRows(res));
             m_pgsqlLibrary->PQclear(res);
          }
+         return affectedRows;
       }
 
-      void CPgsqlRequester::transactionCommit()
+      std::vector<int> CPgsqlRequester::executePipeline(PGconn* pConnection, const std::vector<PreparedStatement>& statements)
       {
-         transactionCommit(getConnection());
+#ifdef LIBPQ_HAS_PIPELINING
+         YADOMS_LOG(debug) << "[REQUEST] executePipeline - " << statements.size() << " statements";
+
+         if (m_pgsqlLibrary->PQenterPipelineMode(pConnection) != 1)
+            throw CDatabaseException("Fail to enter pipeline mode", getLastErrorMessage(pConnection));
+
+         //the connection must leave pipeline mode whatever happens : in a transaction, next queries are done on it
+         std::vector<int> affectedRows;
+         std::string errMessage;
+         auto errCode = CDatabaseException::kOk;
+         auto syncSent = false;
+         try
+         {
+            //send all commands (statements never prepared on this connection are prepared first), then a synchronization point
+            std::vector<std::pair<bool, std::string>> sentCommands; //(is a preparation, statement name)
+            std::set<std::string> preparedStatements;
+            for (const auto& statement : statements)
+            {
+               if (!m_connectionPool->isStatementPrepared(pConnection, statement.name) && preparedStatements.insert(statement.name).second)
+               {
+                  if (m_pgsqlLibrary->PQsendPrepare(pConnection, statement.name.c_str(), statement.statement.c_str(), 0, nullptr) != 1)
+                     throw CDatabaseException("Fail to send statement preparation " + statement.name, getLastErrorMessage(pConnection));
+                  sentCommands.push_back(std::make_pair(true, statement.name));
+               }
+
+               std::vector<const char*> values;
+               values.reserve(statement.parameters.size());
+               for (const auto& parameter : statement.parameters)
+                  values.push_back(parameter.c_str());
+
+               if (m_pgsqlLibrary->PQsendQueryPrepared(pConnection, statement.name.c_str(), static_cast<int>(values.size()), values.data(), nullptr, nullptr, 0) != 1)
+                  throw CDatabaseException("Fail to send statement " + statement.name, getLastErrorMessage(pConnection));
+               sentCommands.push_back(std::make_pair(false, statement.name));
+            }
+
+            if (m_pgsqlLibrary->PQpipelineSync(pConnection) != 1)
+               throw CDatabaseException("Fail to send pipeline synchronization", getLastErrorMessage(pConnection));
+            syncSent = true;
+
+            //read results, in the sending order (after an error, following commands are aborted)
+            for (const auto& sentCommand : sentCommands)
+            {
+               const auto res = m_pgsqlLibrary->PQgetResult(pConnection);
+               if (res == nullptr)
+                  throw CDatabaseException("Fail to read pipeline results", getLastErrorMessage(pConnection));
+
+               switch (m_pgsqlLibrary->PQresultStatus(res))
+               {
+               case PGRES_COMMAND_OK:
+                  if (sentCommand.first)
+                     m_connectionPool->setStatementPrepared(pConnection, sentCommand.second);
+                  else
+                     affectedRows.push_back(getAffectedRows(res));
+                  break;
+               case PGRES_PIPELINE_ABORTED:
+                  break;
+               default:
+                  {
+                     errMessage = getLastErrorMessage(pConnection);
+                     const auto sqlState = m_pgsqlLibrary->PQresultErrorField(res, PG_DIAG_SQLSTATE);
+                     errCode = sqlState != nullptr && CPgsqlSqlState::Parse(sqlState).GetClass() == ESqlErrorClass::kIntegrityConstraintViolation
+                                  ? CDatabaseException::kConstraintViolation
+                                  : CDatabaseException::kError;
+                     YADOMS_LOG(error) << "Pipelined statement failed : " << sentCommand.second << std::endl << "Error : " << errMessage;
+                     break;
+                  }
+               }
+               m_pgsqlLibrary->PQclear(res);
+
+               //each command results end with a null result
+               m_pgsqlLibrary->PQgetResult(pConnection);
+            }
+
+            //synchronization point result
+            m_pgsqlLibrary->PQclear(m_pgsqlLibrary->PQgetResult(pConnection));
+         }
+         catch (std::exception&)
+         {
+            abortPipeline(pConnection, syncSent);
+            throw;
+         }
+
+         if (m_pgsqlLibrary->PQexitPipelineMode(pConnection) != 1)
+         {
+            abortPipeline(pConnection, true);
+            throw CDatabaseException("Fail to exit pipeline mode", getLastErrorMessage(pConnection));
+         }
+
+         if (errCode != CDatabaseException::kOk)
+            throw CDatabaseException(errMessage, errCode);
+
+         return affectedRows;
+#else
+         throw CDatabaseException("Pipeline mode is not supported by the libpq headers used at build time");
+#endif
       }
 
-      void CPgsqlRequester::transactionCommit(PGconn* pConnection)
+      void CPgsqlRequester::abortPipeline(PGconn* pConnection, bool syncSent) const
       {
-         if (transactionIsAlreadyCreated(pConnection))
+#ifdef LIBPQ_HAS_PIPELINING
+         //commands already sent must be ended by a synchronization point to get all their results
+         if (!syncSent && m_pgsqlLibrary->PQpipelineSync(pConnection) != 1)
+         {
+            YADOMS_LOG(error) << "Fail to send pipeline synchronization : " << getLastErrorMessage(pConnection);
+            return;
+         }
+
+         //discard pending results (a null result ends each command, two in a row when nothing is pending anymore)
+         auto nullResults = 0;
+         while (nullResults < 2 && m_pgsqlLibrary->PQstatus(pConnection) == CONNECTION_OK)
          {
-            const auto res = executeQuery(pConnection, "COMMIT", PGRES_COMMAND_OK, false);
-            if (m_pgsqlLibrary->PQresultStatus(res) == PGRES_COMMAND_OK)
+            const auto res = m_pgsqlLibrary->PQgetResult(pConnection);
+            if (res == nullptr)
             {
-               m_activeTransactionsList[pConnection] = false;
+               ++nullResults;
+               continue;
             }
+            nullResults = 0;
             m_pgsqlLibrary->PQclear(res);
          }
+
+         if (m_pgsqlLibrary->PQexitPipelineMode(pConnection) != 1)
+            YADOMS_LOG(error) << "Fail to exit pipeline mode : " << getLastErrorMessage(pConnection);
+#endif
       }
 
-      void CPgsqlRequester::transactionRollback()
+      bool CPgsqlRequester::bulkInsertAcquisitions(const common::CDatabaseTable& partition,
+                                                   const std::vector<boost::shared_ptr<entities::CAcquisition>>& acquisitions)
+      {
+         if (acquisitions.empty())
+            return true;
+
+         const auto connection = getConnection();
+
+         //in a transaction, a failed COPY must not abort the whole transaction
+         const auto inTransaction = transactionIsAlreadyCreated();
+         if (inTransaction)
+            m_pgsqlLibrary->PQclear(executeQuery(connection.get(), "SAVEPOINT bulkInsertAcquisitions", PGRES_COMMAND_OK, true));
+
+         const auto copyStatement = (boost::format("COPY %1% (%2%, %3%, %4%) FROM STDIN (FORMAT binary)")
+            % partition.GetName()
+            % common::CAcquisitionTable::getDateColumnName().GetName()
+            % common::CAcquisitionTable::getKeywordIdColumnName().GetName()
+            % common::CAcquisitionTable::getValueColumnName().GetName()).str();
+         m_pgsqlLibrary->PQclear(executeQuery(connection.get(), copyStatement, PGRES_COPY_IN, true));
+
+         //header, then one tuple by acquisition (date and value are text columns, keywordId is an integer column), then trailer
+         std::string buffer(CopyBinarySignature, sizeof(CopyBinarySignature));
+         appendInt32(buffer, 0);
+         appendInt32(buffer, 0);
+         for (const auto& acquisition : acquisitions)
+         {
+            appendInt16(buffer, 3);
+            appendText(buffer, boost::posix_time::to_iso_string(acquisition->Date()));
+            appendInt32(buffer, static_cast<Poco::Int32>(sizeof(Poco::Int32)));
+            appendInt32(buffer, acquisition->KeywordId());
+            appendText(buffer, acquisition->Value());
+         }
+         appendInt16(buffer, -1);
+
+         const auto sent = m_pgsqlLibrary->PQputCopyData(connection.get(), buffer.data(), static_cast<int>(buffer.size())) == 1;
+         m_pgsqlLibrary->PQputCopyEnd(connection.get(), sent ? nullptr : "Fail to send acquisitions");
+
+         auto res = m_pgsqlLibrary->PQgetResult(connection.get());
+         const auto inserted = m_pgsqlLibrary->PQresultStatus(res) == PGRES_COMMAND_OK;
+         const auto sqlState = inserted ? nullptr : m_pgsqlLibrary->PQresultErrorField(res, PG_DIAG_SQLSTATE);
+         const auto alreadyExists = sqlState != nullptr && CPgsqlSqlState::Parse(sqlState).GetClass() == ESqlErrorClass::kIntegrityConstraintViolation;
+         const auto errMessage = getLastErrorMessage(connection.get());
+         while (res != nullptr)
+         {
+            m_pgsqlLibrary->PQclear(res);
+            res = m_pgsqlLibrary->PQgetResult(connection.get());
+         }
+
+         if (inserted)
+         {
+            if (inTransaction)
+               m_pgsqlLibrary->PQclear(executeQuery(connection.get(), "RELEASE SAVEPOINT bulkInsertAcquisitions", PGRES_COMMAND_OK, true));
+            return true;
+         }
+
+         if (inTransaction)
+            m_pgsqlLibrary->PQclear(executeQuery(connection.get(), "ROLLBACK TO SAVEPOINT bulkInsertAcquisitions", PGRES_COMMAND_OK, true));
+
+         if (alreadyExists)
+            return false;
+
+         YADOMS_LOG(error) << "Fail to copy acquisitions into " << partition.GetName() << " : " << errMessage;
+         throw CDatabaseException("Fail to insert acquisitions", errMessage);
+      }
+
+
+      bool CPgsqlRequester::transactionSupport()
       {
-         transactionRollback(getConnection());
+         return true;
       }
 
-      void CPgsqlRequester::transactionRollback(PGconn* pConnection)
+      void CPgsqlRequester::transactionBegin()
       {
-         if (transactionIsAlreadyCreated(pConnection))
+         if (transactionIsAlreadyCreated())
+            return;
+
+         const auto connection = getConnection();
+         const auto res = executeQuery(connection.get(), "BEGIN", PGRES_COMMAND_OK, false);
+         if (m_pgsqlLibrary->PQresultStatus(res) == PGRES_COMMAND_OK)
          {
-            const auto res = executeQuery(pConnection, "ROLLBACK", PGRES_COMMAND_OK, false);
-            if (m_pgsqlLibrary->PQresultStatus(res) == PGRES_COMMAND_OK)
-            {
-               m_activeTransactionsList[pConnection] = false;
-            }
-            m_pgsqlLibrary->PQclear(res);
+            //the connection stays bound to this thread until the end of the transaction
+            boost::lock_guard<boost::mutex> lock(m_transactionConnectionsMutex);
+            m_transactionConnections[boost::this_thread::get_id()] = connection;
          }
+         m_pgsqlLibrary->PQclear(res);
       }
 
-      bool CPgsqlRequester::transactionIsAlreadyCreated(PGconn* pConnection)
+      void CPgsqlRequester::transactionCommit()
       {
-         const auto findIter = m_activeTransactionsList.find(pConnection);
-         if (findIter != m_activeTransactionsList.end())
-            return findIter->second;
-         return false;
+         endTransaction("COMMIT");
+      }
+
+      void CPgsqlRequester::transactionRollback()
+      {
+         endTransaction("ROLLBACK");
+      }
+
+      void CPgsqlRequester::endTransaction(const std::string& statement)
+      {
+         boost::shared_ptr<PGconn> connection;
+         {
+            boost::lock_guard<boost::mutex> lock(m_transactionConnectionsMutex);
+            const auto transaction = m_transactionConnections.find(boost::this_thread::get_id());
+            if (transaction == m_transactionConnections.end())
+               return;
+            connection = transaction->second;
+            m_transactionConnections.erase(transaction);
+         }
+
+         //even if it fails, the transaction is over (the pool rollbacks it if needed)
+         const auto res = executeQuery(connection.get(), statement, PGRES_COMMAND_OK, false);
+         m_pgsqlLibrary->PQclear(res);
       }
 
       bool CPgsqlRequester::transactionIsAlreadyCreated()
       {
-         return transactionIsAlreadyCreated(getConnection());
+         boost::lock_guard<boost::mutex> lock(m_transactionConnectionsMutex);
+         return m_transactionConnections.find(boost::this_thread::get_id()) != m_transactionConnections.end();
       }
 
       bool CPgsqlRequester::checkTableExists(const common::CDatabaseTable& tableName)
@@ -597,14 +926,32 @@ namespace database
          queryStatement(CPgsqlQuery::CustomQuery(indexScript, CPgsqlQuery::kCreate));
       }
 
+      std::vector<std::string> CPgsqlRequester::getTablesNames(const std::string& namePrefix)
+      {
+         CPgsqlQuery sTables;
+         sTables.Select(CPgsqlTablesTable::getTableColumnName()).
+            From(CPgsqlTablesTable::getTableName()).
+            Where(CPgsqlTablesTable::getTableColumnName(), CQUERY_OP_ILIKE, namePrefix + "%");
+
+         common::adapters::CSingleValueAdapter<std::string> namesAdapter;
+         queryEntities(&namesAdapter, sTables);
+         return namesAdapter.getResults();
+      }
+
       void CPgsqlRequester::vacuum()
       {
          queryStatement(CPgsqlQuery().Vacuum());
       }
 
+      void CPgsqlRequester::releaseFreeSpace()
+      {
+         //PostgreSQL plain VACUUM (not FULL) runs online, without locking tables
+         vacuum();
+      }
+
       boost::shared_ptr<ITableCreationScriptProvider> CPgsqlRequester::getTableCreationScriptProvider()
       {
-         return boost::make_shared<CPgsqlTableCreationScriptProvider>();
+         return boost::make_shared<CPgsqlTableCreationScriptProvider>(supportPartitionedTables());
       }
 
       bool CPgsqlRequester::backupSupported()
@@ -613,6 +960,11 @@ namespace database
       }
 
    void CPgsqlRequester::backupData(const std::string & backupFolder, IDataBackup::ProgressFunc reporter)
+   {
+      throw database::CDatabaseException("Unsupported backup for PostgreSQL");
+   }
+
+   void CPgsqlRequester::backupAcquisitionsSince(const std::string & backupFolder, const boost::posix_time::ptime& since, IDataBackup::ProgressFunc reporter)
    {
       throw database::CDatabaseException("Unsupported backup for PostgreSQL");
    }
@@ -621,6 +973,11 @@ namespace database
       {
          return false;
       }
+
+      bool CPgsqlRequester::supportPartitionedTables()
+      {
+         return m_serverVersion >= PartitionedTablesMinServerVersion;
+      }
    } //namespace pgsql
 } //namespace database 
 
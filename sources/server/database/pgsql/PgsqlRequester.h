@@ -3,6 +3,7 @@
 #include "database/IDatabaseRequester.h"
 #include <Poco/Nullable.h>
 #include "PgsqlLibrary.h"
+#include "PgsqlConnectionPool.h"
 
 namespace database
 {
@@ -27,14 +28,21 @@ namespace database
          int queryCount(const common::CQuery& querytoExecute) override;
          QueryRow querySingleLine(const common::CQuery& querytoExecute) override;
          QueryResults query(const common::CQuery& querytoExecute) override;
+         void queryPreparedEntities(common::adapters::IResultAdapter* adapter, const std::string& statementName, const std::string& statement, const std::vector<std::string>& parameters) override;
+         int queryPreparedStatement(const std::string& statementName, const std::string& statement, const std::vector<std::string>& parameters, bool throwIfFails = true) override;
+         std::vector<int> queryPreparedStatements(const std::vector<PreparedStatement>& statements) override;
+         bool bulkInsertAcquisitions(const common::CDatabaseTable& partition, const std::vector<boost::shared_ptr<entities::CAcquisition>>& acquisitions) override;
          bool checkTableExists(const common::CDatabaseTable& tableName) override;
          bool dropTableIfExists(const common::CDatabaseTable& tableName) override;
          bool createTableIfNotExists(const common::CDatabaseTable& tableName, const std::string& tableScript) override;
          bool addTableColumn(const common::CDatabaseTable& tableName, const std::string& columnDef) override;
          void createIndex(const common::CDatabaseTable& tableName, const std::string& indexScript) override;
+         std::vector<std::string> getTablesNames(const std::string& namePrefix) override;
          void vacuum() override;
+         void releaseFreeSpace() override;
          boost::shared_ptr<ITableCreationScriptProvider> getTableCreationScriptProvider() override;
          bool supportInsertOrUpdateStatement() override;
+         bool supportPartitionedTables() override;
          // [END] IDatabaseRequester implementation
 
          // ITransactionalProvider implementation
@@ -48,16 +56,19 @@ namespace database
       // IDataBackup implementation
       bool backupSupported() override;
       void backupData(const std::string & backupFolder, ProgressFunc reporter) override;
+      void backupAcquisitionsSince(const std::string & backupFolder, const boost::posix_time::ptime& since, ProgressFunc reporter) override;
       // [END] IDataBackup implementation
 
       private:
          void queryEntities(common::adapters::IResultAdapter* adapter, const common::CQuery& querytoExecute, PGconn* pConnection);
          int queryStatement(const common::CQuery& querytoExecute, bool throwIfFails, PGconn* pConnection);
          int queryCount(const common::CQuery& querytoExecute, PGconn* pConnection);
-         void transactionBegin(PGconn* pConnection);
-         void transactionCommit(PGconn* pConnection);
-         void transactionRollback(PGconn* pConnection);
-         bool transactionIsAlreadyCreated(PGconn* pConnection);
+
+         //--------------------------------------------------------------
+         /// \Brief		End the transaction of the current thread, and give back its connection to the pool
+         /// \param [in] statement  The ending statement (COMMIT or ROLLBACK)
+         //--------------------------------------------------------------
+         void endTransaction(const std::string& statement);
 
          //--------------------------------------------------------------
          /// \Brief		Close all active connections
@@ -75,6 +86,55 @@ namespace database
          //--------------------------------------------------------------
          PGresult* executeQuery(PGconn* pConnection, const std::string& querytoExecute, ExecStatusType expectedResultCode, bool throwIfFails);
 
+         //--------------------------------------------------------------
+         /// \Brief		Execute a prepared statement (prepare it if not already done on this connection)
+         /// \param [in] pConnection         The connection to use
+         /// \param [in] statementName       The statement unique name
+         /// \param [in] statement           The sql statement (parameters noted $1, $2...)
+         /// \param [in] parameters          The parameters values
+         /// \param [in] expectedResultCode  The expected result code (might differ depending on the statement type)
+         /// \param [in] throwIfFails        If true an exception is thrown on error, else the PGresult is returned
+         /// \return    The PGresult data (must be cleared)
+         /// \throws    CDatabaseException If failed. In case of disconnection, close any active connection
+         //--------------------------------------------------------------
+         PGresult* executePrepared(PGconn* pConnection, const std::string& statementName, const std::string& statement, const std::vector<std::string>& parameters, ExecStatusType expectedResultCode, bool throwIfFails);
+
+         //--------------------------------------------------------------
+         /// \Brief		Check a query result
+         /// \param [in] pConnection         The connection used
+         /// \param [in] res                 The query result
+         /// \param [in] querytoExecute      The executed query (for logs)
+         /// \param [in] expectedResultCode  The expected result code
+         /// \param [in] throwIfFails        If true an exception is thrown on error, else nullptr is returned
+         /// \return    The PGresult data (must be cleared)
+         /// \throws    CDatabaseException If failed. In case of disconnection, close any active connection
+         //--------------------------------------------------------------
+         PGresult* checkResult(PGconn* pConnection, PGresult* res, const std::string& querytoExecute, ExecStatusType expectedResultCode, bool throwIfFails);
+
+         //--------------------------------------------------------------
+         /// \Brief		Execute prepared statements in pipeline mode : all statements are sent, then results are read
+         /// \param [in] pConnection   The connection to use
+         /// \param [in] statements    The statements
+         /// \return    The number of affected lines of each statement
+         /// \throws    CDatabaseException If a statement fails (following ones are not executed)
+         //--------------------------------------------------------------
+         std::vector<int> executePipeline(PGconn* pConnection, const std::vector<PreparedStatement>& statements);
+
+         //--------------------------------------------------------------
+         /// \Brief		Leave pipeline mode after a failure, discarding pending results
+         ///            (if it fails, the connection stays in pipeline mode and is closed when given back to the pool)
+         /// \param [in] pConnection   The connection in pipeline mode
+         /// \param [in] syncSent      true if the synchronization point was already sent
+         //--------------------------------------------------------------
+         void abortPipeline(PGconn* pConnection, bool syncSent) const;
+
+         //--------------------------------------------------------------
+         /// \Brief		Get the number of rows affected by a statement
+         /// \param [in] res     The statement result
+         /// \return    The number of affected rows
+         //--------------------------------------------------------------
+         int getAffectedRows(PGresult* res) const;
+
          //--------------------------------------------------------------
          /// \Brief		Try to ping PostgreSQL server
          /// \throws    CDatabaseException If ping failed
@@ -113,16 +173,10 @@ namespace database
          }
 
          //--------------------------------------------------------------
-         /// \Brief		         Create a new connection (one for each thread; testing one for each request)
-         /// \return             A connection pointer
-         //--------------------------------------------------------------
-         PGconn* createNewConnection();
-
-         //--------------------------------------------------------------
-         /// \Brief		         Get the current thread connection (create it if necessary)
-         /// \return             A connection pointer
+         /// \Brief		         Get a connection : the current thread transaction one, or a connection leased from the pool
+         /// \return             The connection (given back to the pool when released)
          //--------------------------------------------------------------
-         PGconn* getConnection();
+         boost::shared_ptr<PGconn> getConnection();
 
          //--------------------------------------------------------------
          /// \Brief		         Terminate a connection (one for each thread; testing one for each request)
@@ -143,14 +197,45 @@ namespace database
          boost::shared_ptr<CPgsqlLibrary> m_pgsqlLibrary;
 
          //--------------------------------------------------------------
-         /// \Brief		List all connections (one per thread)
+         /// \Brief		The connection pool (created when database is initialized)
+         //--------------------------------------------------------------
+         boost::shared_ptr<CPgsqlConnectionPool> m_connectionPool;
+
+         //--------------------------------------------------------------
+         /// \Brief		The connections bound to a thread by an active transaction
+         //--------------------------------------------------------------
+         std::map<boost::thread::id, boost::shared_ptr<PGconn>> m_transactionConnections;
+
+         //--------------------------------------------------------------
+         /// \Brief		Mutex protecting the transactions connections
+         //--------------------------------------------------------------
+         mutable boost::mutex m_transactionConnectionsMutex;
+
+         //--------------------------------------------------------------
+         /// \Brief		The maximum number of opened connections
+         //--------------------------------------------------------------
+         static const unsigned int MaxConnections;
+
+         //--------------------------------------------------------------
+         /// \Brief		The maximum time to wait for a free connection
+         //--------------------------------------------------------------
+         static const boost::posix_time::time_duration AcquireConnectionTimeout;
+
+         //--------------------------------------------------------------
+         /// \Brief		The first server version supporting primary keys on partitioned tables (PostgreSQL 11)
+         //--------------------------------------------------------------
+         static const int PartitionedTablesMinServerVersion;
+
+         //--------------------------------------------------------------
+         /// \Brief		The server version, as returned by PQserverVersion (known when database is initialized)
          //--------------------------------------------------------------
-         std::map<unsigned long, PGconn*> m_connectionList;
+         int m_serverVersion;
 
          //--------------------------------------------------------------
-         /// \Brief		List all transactions (one per connection)
+         /// \Brief		The maximum number of statements sent at once in pipeline mode
+         ///            (results must be read before network buffers are full)
          //--------------------------------------------------------------
-         std::map<PGconn*, bool> m_activeTransactionsList;
+         static const int PipelineMaxStatements;
       };
    } //namespace pgsql
 } //namespace database 
@@ -33,15 +33,25 @@ namespace database
          return std::string(m_pgsqlLibrary->PQfname(m_res, columnIndex));
       }
 
+      int CPgsqlResultHandler::getRowCount()
+      {
+         return m_currentResultRowCount;
+      }
+
       bool CPgsqlResultHandler::next_step()
       {
          m_currentResultIndex++;
          return m_currentResultIndex < m_currentResultRowCount;
       }
 
+      const char* CPgsqlResultHandler::extractValueAsCString(const int columnIndex)
+      {
+         return m_pgsqlLibrary->PQgetvalue(m_res, m_currentResultIndex, columnIndex);
+      }
+
       std::string CPgsqlResultHandler::extractValueAsString(const int columnIndex)
       {
-         return std::string(m_pgsqlLibrary->PQgetvalue(m_res, m_currentResultIndex, columnIndex));
+         return std::string(extractValueAsCString(columnIndex));
       }
 
       int CPgsqlResultHandler::extractValueAsInt(const int columnIndex)
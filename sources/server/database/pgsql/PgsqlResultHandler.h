@@ -16,7 +16,9 @@ namespace database
          // database::common::IResultHandler implementation
          int getColumnCount() override;
          std::string getColumnName(const int columnIndex) override;
+         int getRowCount() override;
          bool next_step() override;
+         const char* extractValueAsCString(const int columnIndex) override;
          std::string extractValueAsString(const int columnIndex) override;
          int extractValueAsInt(const int columnIndex) override;
          float extractValueAsFloat(const int columnIndex) override;
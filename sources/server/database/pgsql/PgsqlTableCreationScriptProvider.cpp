@@ -5,7 +5,8 @@ namespace database
 {
    namespace pgsql
    {
-      CPgsqlTableCreationScriptProvider::CPgsqlTableCreationScriptProvider()
+      CPgsqlTableCreationScriptProvider::CPgsqlTableCreationScriptProvider(bool nativePartitioning)
+         : m_nativePartitioning(nativePartitioning)
       {
       }
 
@@ -180,6 +181,48 @@ namespace database
          //indexScripts.push_back("CREATE INDEX acqKeywordIdIndex ON Acquisition(keywordId)");
          //indexScripts.push_back("create index if not exists acqKeywordIdDateIndex on Acquisition(keywordId,date)");
       }
+
+      std::string CPgsqlTableCreationScriptProvider::getTableAcquisitionPartitionsParent(const std::vector<std::string>& partitionNames)
+      {
+         if (!m_nativePartitioning)
+         {
+            //before PostgreSQL 11, partitioned tables can't have primary key : partitions are gathered by a view
+            if (partitionNames.empty())
+               return "CREATE VIEW Acquisition AS SELECT NULL::TEXT AS date, NULL::INTEGER AS keywordId, NULL::TEXT AS value WHERE false";
+
+            std::vector<std::string> partitionsSelect;
+            for (const auto& partitionName : partitionNames)
+               partitionsSelect.push_back("SELECT date, keywordId, value FROM " + partitionName);
+            return "CREATE VIEW Acquisition AS " + boost::algorithm::join(partitionsSelect, " UNION ALL ");
+         }
+
+         //native partitioning : queries on parent only scan the partitions matching the date range
+         return " CREATE TABLE Acquisition                                 \
+               (  date TEXT NOT NULL,                                      \
+                  keywordId INTEGER NOT NULL,                              \
+                  value TEXT NOT NULL,                                     \
+                  PRIMARY KEY (date, keywordId)                            \
+               ) PARTITION BY RANGE (date)";
+      }
+
+      std::string CPgsqlTableCreationScriptProvider::getTableAcquisitionPartition(const std::string& partitionName, const std::string& fromDate, const std::string& toDate)
+      {
+         if (!m_nativePartitioning)
+            return (boost::format(" CREATE TABLE %1%                                                  \
+               (  date TEXT NOT NULL CHECK (date >= '%2%' AND date < '%3%'),              \
+                  keywordId INTEGER NOT NULL,                                             \
+                  value TEXT NOT NULL,                                                    \
+                  PRIMARY KEY (date, keywordId)                                           \
+               )") % partitionName % fromDate % toDate).str();
+
+         return (boost::format("CREATE TABLE %1% PARTITION OF Acquisition FOR VALUES FROM ('%2%') TO ('%3%')") % partitionName % fromDate % toDate).str();
+      }
+
+      void CPgsqlTableCreationScriptProvider::getTableAcquisitionPartitionIndexes(const std::string& partitionName, std::vector<std::string>& indexScripts)
+      {
+         indexScripts.clear();
+         indexScripts.push_back((boost::format("CREATE INDEX IF NOT EXISTS %1%KeywordIdDateIndex ON %1%(keywordId,date)") % partitionName).str());
+      }
    } //namespace pgsql
 } //namespace database 
 
@@ -12,8 +12,9 @@ namespace database
       public:
          //--------------------------------------------------------------
          /// \brief       Constructor
+         /// \param [in]  nativePartitioning  true if the server supports partitioned tables with primary key (PostgreSQL 11+)
          //--------------------------------------------------------------
-         CPgsqlTableCreationScriptProvider();
+         explicit CPgsqlTableCreationScriptProvider(bool nativePartitioning = true);
 
          //--------------------------------------------------------------
          /// \brief       Destructor
@@ -35,7 +36,16 @@ namespace database
          std::string getTableRecipient() override;
          std::string getTableRecipientField() override;
          void getTableAcquisitionIndexes(std::vector<std::string>& indexScripts) override;
+         std::string getTableAcquisitionPartitionsParent(const std::vector<std::string>& partitionNames) override;
+         std::string getTableAcquisitionPartition(const std::string& partitionName, const std::string& fromDate, const std::string& toDate) override;
+         void getTableAcquisitionPartitionIndexes(const std::string& partitionName, std::vector<std::string>& indexScripts) override;
          // [END] ITableCreationScriptProvider implementation
+
+      private:
+         //--------------------------------------------------------------
+         /// \brief       true if Acquisition is a partitioned table, false if it is a view on the partitions
+         //--------------------------------------------------------------
+         const bool m_nativePartitioning;
       };
    } //namespace pgsql
 } //namespace database 
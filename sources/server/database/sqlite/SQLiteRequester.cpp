@@ -11,15 +11,33 @@
 #include <shared/Log.h>
 #include <shared/exception/NullReference.hpp>
 #include "i18n/ClientStrings.h"
+#include <shared/metrics/MetricsRegistry.h>
+#include <shared/metrics/ScopedLatency.h>
+#include <shared/currentTime/Provider.h>
+#include "database/common/DatabaseTables.h"
 
 namespace database
 {
    namespace sqlite
    {
+      namespace
+      {
+         shared::metrics::CLatencyHistogram& queryLatency(const std::string& queryKind)
+         {
+            return shared::metrics::CMetricsRegistry::instance().histogram("yadoms_sqlite_query_duration_seconds",
+                                                                           "Time to execute a SQLite query (retries included), by query kind",
+                                                                           {{"kind", queryKind}});
+         }
+      }
+
       //---------------------------
       // Maximum tries
       //---------------------------
       int CSQLiteRequester::m_maxTries = 3;
+      const int CSQLiteRequester::IncrementalVacuumPages = 1024;
+      const int CSQLiteRequester::BackupPagesByStep = 256;
+      const boost::posix_time::time_duration CSQLiteRequester::PauseBetweenBackupSteps(boost::posix_time::milliseconds(10));
+      const boost::posix_time::time_duration CSQLiteRequester::BackupLockedTimeout(boost::posix_time::minutes(1));
 
 
       CSQLiteRequester::CSQLiteRequester(const std::string& dbFile)
@@ -44,6 +62,8 @@ namespace database
                YADOMS_LOG(information) << "Yadoms will create a blank one";
             }
 
+            const auto newDatabase = !boost::filesystem::exists(m_dbFile.c_str());
+
             auto rc = sqlite3_open(m_dbFile.c_str(), &m_pDatabaseHandler);
             if (rc)
             {
@@ -51,6 +71,10 @@ namespace database
                throw CDatabaseException(error);
             }
 
+            //auto_vacuum mode must be set before creating any table
+            if (newDatabase)
+               sqlite3_exec(m_pDatabaseHandler, "PRAGMA auto_vacuum = INCREMENTAL", nullptr, nullptr, nullptr);
+
             //extended sql engine
             registerExtendedFunctions();
          }
@@ -72,6 +96,14 @@ namespace database
 
       void CSQLiteRequester::finalize()
       {
+         //release prepared statements (database can not be closed while they exist)
+         {
+            boost::lock_guard<boost::mutex> lock(m_preparedStatementsMutex);
+            for (const auto& preparedStatement : m_preparedStatements)
+               sqlite3_finalize(preparedStatement.second);
+            m_preparedStatements.clear();
+         }
+
          //close database access
          if (m_pDatabaseHandler != nullptr)
             sqlite3_close(m_pDatabaseHandler);
@@ -140,6 +172,9 @@ namespace database
       {
          BOOST_ASSERT(adapter != NULL);
 
+         static auto& QueryEntitiesLatency = queryLatency("entities");
+         shared::metrics::CScopedLatency latency(QueryEntitiesLatency);
+
          if (adapter != nullptr)
          {
             try
@@ -206,6 +241,9 @@ namespace database
          BOOST_ASSERT(querytoExecute.GetQueryType() != common::CQuery::kNotYetDefined);
          BOOST_ASSERT(querytoExecute.GetQueryType() != common::CQuery::kSelect);
 
+         static auto& QueryStatementLatency = queryLatency("statement");
+         shared::metrics::CScopedLatency latency(QueryStatementLatency);
+
          //execute the query
          char* zErrMsg = nullptr;
          int remainingTries = m_maxTries;
@@ -301,6 +339,188 @@ namespace database
          return genericAdapter.getResults();
       }
 
+      sqlite3_stmt* CSQLiteRequester::bindPreparedStatement(const std::string& statementName,
+                                                            const std::string& statement,
+                                                            const std::vector<std::string>& parameters)
+      {
+         auto preparedStatement = m_preparedStatements.find(statementName);
+         if (preparedStatement == m_preparedStatements.end())
+         {
+            sqlite3_stmt* stmt;
+            const auto rc = sqlite3_prepare_v2(m_pDatabaseHandler, statement.c_str(), -1, &stmt, nullptr);
+            if (rc != SQLITE_OK)
+               throw CDatabaseException("Fail to prepare statement " + statementName + " : " + sqlite3_errmsg(m_pDatabaseHandler), fromSQLiteReturnCode(rc));
+            preparedStatement = m_preparedStatements.insert(std::make_pair(statementName, stmt)).first;
+         }
+
+         const auto stmt = preparedStatement->second;
+         sqlite3_reset(stmt);
+         sqlite3_clear_bindings(stmt);
+
+         //parameters are named $1, $2... (as PostgreSQL ones), they can appear in any order in the statement
+         for (auto index = 1; index <= sqlite3_bind_parameter_count(stmt); ++index)
+         {
+            const auto parameterName = sqlite3_bind_parameter_name(stmt, index);
+            const auto parameterNumber = parameterName != nullptr ? std::atoi(parameterName + 1) : 0;
+            if (parameterNumber < 1 || parameterNumber > static_cast<int>(parameters.size()))
+               throw CDatabaseException("Invalid parameter in prepared statement " + statementName);
+
+            const auto& value = parameters[parameterNumber - 1];
+            sqlite3_bind_text(stmt, index, value.c_str(), static_cast<int>(value.size()), SQLITE_TRANSIENT);
+         }
+         return stmt;
+      }
+
+      void CSQLiteRequester::forgetPreparedStatement(const std::string& statementName)
+      {
+         const auto preparedStatement = m_preparedStatements.find(statementName);
+         if (preparedStatement == m_preparedStatements.end())
+            return;
+
+         sqlite3_finalize(preparedStatement->second);
+         m_preparedStatements.erase(preparedStatement);
+      }
+
+      void CSQLiteRequester::queryPreparedEntities(common::adapters::IResultAdapter* adapter,
+                                                   const std::string& statementName,
+                                                   const std::string& statement,
+                                                   const std::vector<std::string>& parameters)
+      {
+         BOOST_ASSERT(adapter != NULL);
+
+         if (adapter == nullptr)
+            throw shared::exception::CNullReference("adapter");
+
+         static auto& QueryPreparedEntitiesLatency = queryLatency("preparedEntities");
+         shared::metrics::CScopedLatency latency(QueryPreparedEntitiesLatency);
+
+         boost::lock_guard<boost::mutex> lock(m_preparedStatementsMutex);
+         try
+         {
+            const auto stmt = bindPreparedStatement(statementName, statement, parameters);
+            const auto handler(boost::make_shared<CSQLiteResultHandler>(stmt));
+            if (!adapter->adapt(handler))
+            {
+               YADOMS_LOG(error) << "Fail to adapt values";
+            }
+            sqlite3_reset(stmt);
+         }
+         catch (std::exception& ex)
+         {
+            YADOMS_LOG(error) << "Exception: Fail to execute prepared statement " << statementName << " : " << ex.what();
+            forgetPreparedStatement(statementName);
+         }
+      }
+
+      int CSQLiteRequester::queryPreparedStatement(const std::string& statementName,
+                                                   const std::string& statement,
+                                                   const std::vector<std::string>& parameters,
+                                                   bool throwIfFails)
+      {
+         static auto& QueryPreparedStatementLatency = queryLatency("preparedStatement");
+         shared::metrics::CScopedLatency latency(QueryPreparedStatementLatency);
+
+         boost::lock_guard<boost::mutex> lock(m_preparedStatementsMutex);
+         try
+         {
+            const auto stmt = bindPreparedStatement(statementName, statement, parameters);
+            const auto rc = sqlite3_step(stmt);
+            if (rc != SQLITE_DONE)
+            {
+               const std::string errMessage(sqlite3_errmsg(m_pDatabaseHandler));
+               sqlite3_reset(stmt);
+               throw CDatabaseException(errMessage, fromSQLiteReturnCode(rc));
+            }
+            sqlite3_reset(stmt);
+         }
+         catch (CDatabaseException& ex)
+         {
+            YADOMS_LOG(error) << "Prepared statement failed : " << statementName << std::endl << "Error : " << ex.what();
+            if (ex.returnCode() != CDatabaseException::kConstraintViolation)
+               forgetPreparedStatement(statementName);
+
+            if (throwIfFails)
+               throw;
+            return -1;
+         }
+
+         return sqlite3_changes(m_pDatabaseHandler);
+      }
+
+      std::vector<int> CSQLiteRequester::queryPreparedStatements(const std::vector<PreparedStatement>& statements)
+      {
+         //no network round trip with SQLite, just execute them in order
+         std::vector<int> affectedRows;
+         for (const auto& statement : statements)
+            affectedRows.push_back(queryPreparedStatement(statement.name, statement.statement, statement.parameters));
+         return affectedRows;
+      }
+
+      bool CSQLiteRequester::bulkInsertAcquisitions(const common::CDatabaseTable& partition,
+                                                    const std::vector<boost::shared_ptr<entities::CAcquisition>>& acquisitions)
+      {
+         if (acquisitions.empty())
+            return true;
+
+         static auto& BulkInsertLatency = queryLatency("bulkInsert");
+         shared::metrics::CScopedLatency latency(BulkInsertLatency);
+
+         //one prepared insert, executed for each acquisition in a savepoint (all or nothing is inserted)
+         const auto statementName = "bulkInsert" + partition.GetName();
+         const auto statement = (boost::format("INSERT INTO %1% (%2%, %3%, %4%) VALUES ($1, $2, $3)")
+            % partition.GetName()
+            % common::CAcquisitionTable::getDateColumnName().GetName()
+            % common::CAcquisitionTable::getKeywordIdColumnName().GetName()
+            % common::CAcquisitionTable::getValueColumnName().GetName()).str();
+
+         //out of a transaction, the savepoint starts one : it must not be mixed with a transaction of another thread
+         boost::lock_guard<boost::recursive_mutex> transactionLock(m_transactionMutex);
+         boost::lock_guard<boost::mutex> lock(m_preparedStatementsMutex);
+         sqlite3_exec(m_pDatabaseHandler, "SAVEPOINT bulkInsertAcquisitions", nullptr, nullptr, nullptr);
+
+         auto rc = SQLITE_DONE;
+         std::string errMessage;
+         try
+         {
+            for (const auto& acquisition : acquisitions)
+            {
+               const auto stmt = bindPreparedStatement(statementName,
+                                                       statement,
+                                                       {
+                                                          boost::posix_time::to_iso_string(acquisition->Date()),
+                                                          std::to_string(acquisition->KeywordId()),
+                                                          acquisition->Value()
+                                                       });
+               rc = sqlite3_step(stmt);
+               if (rc != SQLITE_DONE)
+                  errMessage = sqlite3_errmsg(m_pDatabaseHandler);
+               sqlite3_reset(stmt);
+               if (rc != SQLITE_DONE)
+                  break;
+            }
+         }
+         catch (std::exception& ex)
+         {
+            rc = SQLITE_ERROR;
+            errMessage = ex.what();
+         }
+
+         if (rc == SQLITE_DONE)
+         {
+            sqlite3_exec(m_pDatabaseHandler, "RELEASE bulkInsertAcquisitions", nullptr, nullptr, nullptr);
+            return true;
+         }
+
+         sqlite3_exec(m_pDatabaseHandler, "ROLLBACK TO bulkInsertAcquisitions", nullptr, nullptr, nullptr);
+         sqlite3_exec(m_pDatabaseHandler, "RELEASE bulkInsertAcquisitions", nullptr, nullptr, nullptr);
+
+         if (fromSQLiteReturnCode(rc) == CDatabaseException::kConstraintViolation)
+            return false;
+
+         forgetPreparedStatement(statementName);
+         throw CDatabaseException("Fail to insert acquisitions : " + errMessage, fromSQLiteReturnCode(rc));
+      }
+
       bool CSQLiteRequester::transactionSupport()
       {
          return true;
@@ -308,28 +528,39 @@ namespace database
 
       void CSQLiteRequester::transactionBegin()
       {
+         //the lock is kept until the end of the transaction (waits for the transaction of another thread)
+         m_transactionMutex.lock();
          if (!m_bOneTransactionActive)
          {
             sqlite3_exec(m_pDatabaseHandler, "BEGIN", nullptr, nullptr, nullptr);
             m_bOneTransactionActive = true;
          }
+         else
+         {
+            //already begun by this thread
+            m_transactionMutex.unlock();
+         }
       }
 
       void CSQLiteRequester::transactionCommit()
       {
+         boost::lock_guard<boost::recursive_mutex> lock(m_transactionMutex);
          if (m_bOneTransactionActive)
          {
             sqlite3_exec(m_pDatabaseHandler, "COMMIT", nullptr, nullptr, nullptr);
             m_bOneTransactionActive = false;
+            m_transactionMutex.unlock();
          }
       }
 
       void CSQLiteRequester::transactionRollback()
       {
+         boost::lock_guard<boost::recursive_mutex> lock(m_transactionMutex);
          if (m_bOneTransactionActive)
          {
             sqlite3_exec(m_pDatabaseHandler, "ROLLBACK", nullptr, nullptr, nullptr);
             m_bOneTransactionActive = false;
+            m_transactionMutex.unlock();
          }
       }
 
@@ -391,6 +622,19 @@ namespace database
          queryStatement(common::CQuery::CustomQuery(indexScript, common::CQuery::kCreate));
       }
 
+      std::vector<std::string> CSQLiteRequester::getTablesNames(const std::string& namePrefix)
+      {
+         CSQLiteQuery sTables;
+         sTables.Select(CSqliteMasterTable::getNameColumnName()).
+                From(CSqliteMasterTable::getTableName()).
+                Where(CSqliteMasterTable::getTypeColumnName(), CQUERY_OP_EQUAL, SQLITEMASTER_TABLE).
+                And(CSqliteMasterTable::getNameColumnName(), CQUERY_OP_LIKE, namePrefix + "%");
+
+         common::adapters::CSingleValueAdapter<std::string> namesAdapter;
+         queryEntities(&namesAdapter, sTables);
+         return namesAdapter.getResults();
+      }
+
 
       bool CSQLiteRequester::backupSupported()
       {
@@ -443,24 +687,52 @@ namespace database
             sqlite3_backup* pBackup = sqlite3_backup_init(pFile, "main", m_pDatabaseHandler, "main");
             if (pBackup)
             {
-               //do the backup
-               (void)sqlite3_backup_step(pBackup, -1);
-               (void)sqlite3_backup_finish(pBackup);
-            }
-            rc = sqlite3_errcode(pFile);
-
-            //report
-            if (reporter)
-            {
-               if (rc == SQLITE_OK || rc == SQLITE_DONE)
+               //do the backup by small steps : the database is only locked during a step,
+               //so other threads can still use it during the backup
+               auto pageCount = 0;
+               boost::posix_time::time_duration lockedDuration;
+               do
                {
-                  reporter(sqlite3_backup_remaining(pBackup), sqlite3_backup_pagecount(pBackup), i18n::CClientStrings::DatabaseBackupSuccess, "");
+                  rc = sqlite3_backup_step(pBackup, BackupPagesByStep);
+                  pageCount = sqlite3_backup_pagecount(pBackup);
+                  if (reporter)
+                     reporter(sqlite3_backup_remaining(pBackup), pageCount, i18n::CClientStrings::DatabaseBackupInProgress, "");
+
+                  //a writer keeping the database locked must not block the backup forever (backup is retried later by backupData)
+                  if (rc == SQLITE_BUSY || rc == SQLITE_LOCKED)
+                  {
+                     lockedDuration += PauseBetweenBackupSteps;
+                     if (lockedDuration >= BackupLockedTimeout)
+                     {
+                        YADOMS_LOG(warning) << "Database is locked for more than " << BackupLockedTimeout << ", backup aborted";
+                        break;
+                     }
+                  }
+                  else
+                  {
+                     lockedDuration = boost::posix_time::time_duration();
+                  }
+
+                  if (rc == SQLITE_OK || rc == SQLITE_BUSY || rc == SQLITE_LOCKED)
+                     boost::this_thread::sleep(PauseBetweenBackupSteps);
                }
-               else
+               while (rc == SQLITE_OK || rc == SQLITE_BUSY || rc == SQLITE_LOCKED);
+
+               (void)sqlite3_backup_finish(pBackup);
+
+               //report
+               if (reporter)
                {
-                  reporter(sqlite3_backup_remaining(pBackup), sqlite3_backup_pagecount(pBackup), i18n::CClientStrings::DatabaseBackupFail, sqlite3_errstr(rc));
+                  if (rc == SQLITE_DONE)
+                     reporter(0, pageCount, i18n::CClientStrings::DatabaseBackupSuccess, "");
+                  else
+                     reporter(0, pageCount, i18n::CClientStrings::DatabaseBackupFail, sqlite3_errstr(rc));
                }
             }
+            else
+            {
+               rc = sqlite3_errcode(pFile);
+            }
 
          }
 
@@ -471,6 +743,70 @@ namespace database
          return rc;
       }
 
+      void CSQLiteRequester::backupAcquisitionsSince(const std::string & backupFolder, const boost::posix_time::ptime& since, ProgressFunc reporter)
+      {
+         sqlite3* pFile;
+
+         std::string backupfile = backupFolder + "/" + "yadoms-acquisitions.db3";
+
+         //remove backup file if already exists
+         if (boost::filesystem::exists(backupfile))
+            boost::filesystem::remove(backupfile);
+
+         auto rc = sqlite3_open(backupfile.c_str(), &pFile);
+         if (rc == SQLITE_OK)
+            rc = doBackupAcquisitionsSince(pFile, since, reporter);
+
+         (void)sqlite3_close(pFile);
+
+         if (rc != SQLITE_OK && rc != SQLITE_DONE)
+         {
+            if (reporter)
+               reporter(0, 100, i18n::CClientStrings::DatabaseBackupFail, sqlite3_errstr(rc));
+            throw shared::exception::CException(sqlite3_errstr(rc));
+         }
+
+         if (reporter)
+            reporter(0, 100, i18n::CClientStrings::DatabaseBackupSuccess, "");
+      }
+
+      int CSQLiteRequester::doBackupAcquisitionsSince(sqlite3* pFile, const boost::posix_time::ptime& since, ProgressFunc reporter)
+      {
+         //the backup connection reads the yadoms database by itself, so the main connection is never held
+         sqlite3_busy_timeout(pFile, 10000);
+
+         CSQLiteQuery attach;
+         auto rc = sqlite3_exec(pFile, ("ATTACH DATABASE " + attach.formatStringToSql(m_dbFile) + " AS source").c_str(), nullptr, nullptr, nullptr);
+         if (rc != SQLITE_OK)
+            return rc;
+
+         rc = sqlite3_exec(pFile, getTableCreationScriptProvider()->getTableAcquisition().c_str(), nullptr, nullptr, nullptr);
+
+         //copy acquisitions day by day, each day in its own (short) read transaction on yadoms database
+         const common::CDatabaseTable sourceTable("source." + common::CAcquisitionTable::getTableName().GetName());
+         const auto lastDay = shared::currentTime::Provider().now().date();
+         const auto dayCount = static_cast<int>((lastDay - since.date()).days()) + 1;
+         for (auto day = 0; rc == SQLITE_OK && day < dayCount; ++day)
+         {
+            CSQLiteQuery q;
+            q.InsertInto(common::CAcquisitionTable::getTableName(), common::CAcquisitionTable::getDateColumnName(), common::CAcquisitionTable::getKeywordIdColumnName(), common::CAcquisitionTable::getValueColumnName()).
+               Select(common::CAcquisitionTable::getDateColumnName(), common::CAcquisitionTable::getKeywordIdColumnName(), common::CAcquisitionTable::getValueColumnName()).
+               From(sourceTable).
+               Where(common::CAcquisitionTable::getDateColumnName(), CQUERY_OP_SUP_EQUAL, day == 0 ? since : boost::posix_time::ptime(since.date() + boost::gregorian::days(day)));
+            if (day < dayCount - 1)
+               q.And(common::CAcquisitionTable::getDateColumnName(), CQUERY_OP_INF, boost::posix_time::ptime(since.date() + boost::gregorian::days(day + 1)));
+
+            rc = sqlite3_exec(pFile, q.c_str(), nullptr, nullptr, nullptr);
+
+            if (reporter)
+               reporter(dayCount - day - 1, dayCount, i18n::CClientStrings::DatabaseBackupInProgress, "");
+            boost::this_thread::sleep(PauseBetweenBackupSteps);
+         }
+
+         (void)sqlite3_exec(pFile, "DETACH DATABASE source", nullptr, nullptr, nullptr);
+         return rc;
+      }
+
       CDatabaseException::EDatabaseReturnCodes CSQLiteRequester::fromSQLiteReturnCode(int rc)
       {
          switch(rc)
@@ -504,6 +840,34 @@ namespace database
             queryStatement(CSQLiteQuery().Vacuum());
       }
 
+      void CSQLiteRequester::releaseFreeSpace()
+      {
+         static const auto AutoVacuumIncremental = 2;
+         if (queryCount(common::CQuery::CustomQuery("PRAGMA auto_vacuum", common::CQuery::kSelect)) != AutoVacuumIncremental)
+         {
+            //database created before incremental vacuum support : switching mode needs a last full vacuum
+            YADOMS_LOG(information) << "Switch database to incremental vacuum mode, this is done only once and may take a while";
+            queryStatement(common::CQuery::CustomQuery("PRAGMA auto_vacuum = INCREMENTAL", common::CQuery::kVacuum));
+            vacuum();
+            return;
+         }
+
+         //release free pages by small steps, each one in its own transaction, so writers are never blocked for long
+         const auto freelistCountQuery = common::CQuery::CustomQuery("PRAGMA freelist_count", common::CQuery::kSelect);
+         auto freePages = queryCount(freelistCountQuery);
+         while (freePages > 0)
+         {
+            queryStatement(common::CQuery::CustomQuery((boost::format("PRAGMA incremental_vacuum(%1%)") % IncrementalVacuumPages).str(), common::CQuery::kVacuum));
+
+            const auto remainingFreePages = queryCount(freelistCountQuery);
+            if (remainingFreePages >= freePages)
+               break;
+            freePages = remainingFreePages;
+
+            boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+         }
+      }
+
       boost::shared_ptr<ITableCreationScriptProvider> CSQLiteRequester::getTableCreationScriptProvider()
       {
          return boost::make_shared<CSQLiteTableCreationScriptProvider>();
@@ -513,6 +877,11 @@ namespace database
       {
          return true;
       }
+
+      bool CSQLiteRequester::supportPartitionedTables()
+      {
+         return false;
+      }
    } //namespace sqlite
 } //namespace database 
 
@@ -28,14 +28,21 @@ namespace database
          int queryCount(const common::CQuery& querytoExecute) override;
          QueryRow querySingleLine(const common::CQuery& querytoExecute) override;
          QueryResults query(const common::CQuery& querytoExecute) override;
+         void queryPreparedEntities(common::adapters::IResultAdapter* adapter, const std::string& statementName, const std::string& statement, const std::vector<std::string>& parameters) override;
+         int queryPreparedStatement(const std::string& statementName, const std::string& statement, const std::vector<std::string>& parameters, bool throwIfFails = true) override;
+         std::vector<int> queryPreparedStatements(const std::vector<PreparedStatement>& statements) override;
+         bool bulkInsertAcquisitions(const common::CDatabaseTable& partition, const std::vector<boost::shared_ptr<entities::CAcquisition>>& acquisitions) override;
          bool checkTableExists(const common::CDatabaseTable& tableName) override;
          bool dropTableIfExists(const common::CDatabaseTable& tableName) override;
          bool createTableIfNotExists(const common::CDatabaseTable& tableName, const std::string& tableScript) override;
          void createIndex(const common::CDatabaseTable& tableName, const std::string& indexScript) override;
+         std::vector<std::string> getTablesNames(const std::string& namePrefix) override;
          bool addTableColumn(const common::CDatabaseTable& tableName, const std::string& columnDef) override;
          void vacuum() override;
+         void releaseFreeSpace() override;
          boost::shared_ptr<ITableCreationScriptProvider> getTableCreationScriptProvider() override;
          bool supportInsertOrUpdateStatement() override;
+         bool supportPartitionedTables() override;
          // [END] IDatabaseRequester implementation
 
          // ITransactionalProvider implementation
@@ -49,17 +56,40 @@ namespace database
          // IDataBackup implementation
          bool backupSupported() override;
          void backupData(const std::string & backupFolder, ProgressFunc reporter) override;
+         void backupAcquisitionsSince(const std::string & backupFolder, const boost::posix_time::ptime& since, ProgressFunc reporter) override;
          // [END] IDataBackup implementation
 
       protected:
          static CDatabaseException::EDatabaseReturnCodes fromSQLiteReturnCode(int rc);
 
       private:
+         //--------------------------------------------------------------
+         /// \Brief		Get a prepared statement (prepare it at first call) and bind its parameters
+         /// \param [in] statementName   The statement unique name
+         /// \param [in] statement       The sql statement (parameters noted $1, $2...)
+         /// \param [in] parameters      The parameters values
+         /// \return    The statement, ready to step (m_preparedStatementsMutex must be locked while using it)
+         /// \throws    CDatabaseException If statement can not be prepared
+         //--------------------------------------------------------------
+         sqlite3_stmt* bindPreparedStatement(const std::string& statementName, const std::string& statement, const std::vector<std::string>& parameters);
+
+         //--------------------------------------------------------------
+         /// \Brief		Finalize a prepared statement (will be prepared again at next call)
+         /// \param [in] statementName   The statement unique name
+         //--------------------------------------------------------------
+         void forgetPreparedStatement(const std::string& statementName);
+
          //--------------------------------------------------------------
          /// \Brief		Do the backup
          //--------------------------------------------------------------
          int doBackup(const std::string & backupFolder, ProgressFunc reporter);
 
+         //--------------------------------------------------------------
+         /// \Brief		Copy acquisitions since a date into the backup database (already opened)
+         /// \return    The SQLite result code
+         //--------------------------------------------------------------
+         int doBackupAcquisitionsSince(sqlite3* pFile, const boost::posix_time::ptime& since, ProgressFunc reporter);
+
          //--------------------------------------------------------------
          /// \Brief		Inject C functions in sqlite engine
          //--------------------------------------------------------------
@@ -80,10 +110,46 @@ namespace database
          //--------------------------------------------------------------
          bool m_bOneTransactionActive;
 
+         //--------------------------------------------------------------
+         /// \Brief		Mutex owned by the thread of the active transaction (from transactionBegin to its end),
+         ///            or by a thread using a savepoint out of any transaction (the connection is shared)
+         //--------------------------------------------------------------
+         boost::recursive_mutex m_transactionMutex;
+
+         //--------------------------------------------------------------
+         /// \Brief		The prepared statements, by name
+         //--------------------------------------------------------------
+         std::map<std::string, sqlite3_stmt*> m_preparedStatements;
+
+         //--------------------------------------------------------------
+         /// \Brief		Mutex protecting the prepared statements (a statement can not be used by several threads at once)
+         //--------------------------------------------------------------
+         boost::mutex m_preparedStatementsMutex;
+
          //--------------------------------------------------------------
          /// \Brief		In case of some errors, (database locked,...) the query may be retried
          //--------------------------------------------------------------
          static int m_maxTries;
+
+         //--------------------------------------------------------------
+         /// \Brief		Number of pages released by each incremental vacuum step
+         //--------------------------------------------------------------
+         static const int IncrementalVacuumPages;
+
+         //--------------------------------------------------------------
+         /// \Brief		Number of pages copied by each backup step (the database is available to other threads between steps)
+         //--------------------------------------------------------------
+         static const int BackupPagesByStep;
+
+         //--------------------------------------------------------------
+         /// \Brief		Pause between backup steps
+         //--------------------------------------------------------------
+         static const boost::posix_time::time_duration PauseBetweenBackupSteps;
+
+         //--------------------------------------------------------------
+         /// \Brief		Maximum time a backup waits for a locked database, before to fail
+         //--------------------------------------------------------------
+         static const boost::posix_time::time_duration BackupLockedTimeout;
       };
    } //namespace sqlite
 } //namespace database 
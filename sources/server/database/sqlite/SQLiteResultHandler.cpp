@@ -31,14 +31,26 @@ namespace database {
          return std::string(sqlite3_column_name(m_pStatement, columnIndex));
       }
 
+      int CSQLiteResultHandler::getRowCount()
+      {
+         //SQLite computes rows while stepping
+         return -1;
+      }
+
       bool CSQLiteResultHandler::next_step()
       {
          return sqlite3_step(m_pStatement) == SQLITE_ROW;
       }
 
+      const char* CSQLiteResultHandler::extractValueAsCString(const int columnIndex)
+      {
+         const auto value = reinterpret_cast<const char*>(sqlite3_column_text(m_pStatement, columnIndex));
+         return value != nullptr ? value : "";
+      }
+
       std::string CSQLiteResultHandler::extractValueAsString(const int columnIndex)
       {
-         return std::string((char*)sqlite3_column_text(m_pStatement, columnIndex));
+         return std::string(extractValueAsCString(columnIndex));
       }
 
       int CSQLiteResultHandler::extractValueAsInt(const int columnIndex)
@@ -15,7 +15,9 @@ namespace sqlite {
       // database::common::IResultHandler implementation
       virtual int getColumnCount();
       virtual std::string getColumnName(const int columnIndex);
+      virtual int getRowCount();
       virtual bool next_step();
+      virtual const char* extractValueAsCString(const int columnIndex);
       virtual std::string extractValueAsString(const int columnIndex);
       virtual int extractValueAsInt(const int columnIndex);
       virtual float extractValueAsFloat(const int columnIndex);
@@ -178,6 +178,35 @@ namespace database { namespace sqlite {
       indexScripts.push_back("CREATE INDEX acqKeywordIdIndex ON Acquisition(keywordId)");
       indexScripts.push_back("create index if not exists acqKeywordIdDateIndex on Acquisition(keywordId,date)");
    }
+
+   std::string CSQLiteTableCreationScriptProvider::getTableAcquisitionPartitionsParent(const std::vector<std::string> & partitionNames)
+   {
+      //SQLite has no partitioned table : partitions are gathered by a view
+      //(SQLite pushes the WHERE clauses down to each partition, so each one is searched using its own indexes)
+      if (partitionNames.empty())
+         return "CREATE VIEW Acquisition AS SELECT NULL AS date, NULL AS keywordId, NULL AS value WHERE 0";
+
+      std::vector<std::string> partitionsSelect;
+      for (const auto& partitionName : partitionNames)
+         partitionsSelect.push_back("SELECT date, keywordId, value FROM " + partitionName);
+      return "CREATE VIEW Acquisition AS " + boost::algorithm::join(partitionsSelect, " UNION ALL ");
+   }
+
+   std::string CSQLiteTableCreationScriptProvider::getTableAcquisitionPartition(const std::string & partitionName, const std::string & fromDate, const std::string & toDate)
+   {
+      return (boost::format(" CREATE TABLE %1%                                                  \
+               (  date TEXT NOT NULL CHECK (date >= '%2%' AND date < '%3%'),              \
+                  keywordId INTEGER NOT NULL,                                             \
+                  value TEXT NOT NULL,                                                    \
+                  PRIMARY KEY (date, keywordId)                                           \
+               )WITHOUT ROWID") % partitionName % fromDate % toDate).str();
+   }
+
+   void CSQLiteTableCreationScriptProvider::getTableAcquisitionPartitionIndexes(const std::string & partitionName, std::vector<std::string> & indexScripts)
+   {
+      indexScripts.clear();
+      indexScripts.push_back((boost::format("create index if not exists %1%KeywordIdDateIndex on %1%(keywordId,date)") % partitionName).str());
+   }
  
 } //namespace sqlite
 } //namespace database 
@@ -33,6 +33,9 @@ namespace database { namespace sqlite {
       virtual std::string getTableRecipient();
       virtual std::string getTableRecipientField();
       virtual void getTableAcquisitionIndexes(std::vector<std::string> & indexScripts);
+      virtual std::string getTableAcquisitionPartitionsParent(const std::vector<std::string> & partitionNames);
+      virtual std::string getTableAcquisitionPartition(const std::string & partitionName, const std::string & fromDate, const std::string & toDate);
+      virtual void getTableAcquisitionPartitionIndexes(const std::string & partitionName, std::vector<std::string> & indexScripts);
       // [END] ITableCreationScriptProvider implementation
    };
  
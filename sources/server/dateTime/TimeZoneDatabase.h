@@ -1,23 +1,85 @@
 #pragma once
 #include <boost/date_time/local_time/posix_time_zone.hpp>
-#include <boost/date_time/local_time/tz_database.hpp>
 
 namespace dateTime
 {
    //-----------------------------------------------------
    ///\brief The timezone database
-   ///\description It's just a copy/paste of \boost\libs\date_time\data\date_time_zonespec.csv file
+   ///\description Zones come from \boost\libs\date_time\data\date_time_zonespec.csv file,
+   ///             pre-parsed at generation time (see generateTimeZoneTable.py) so nothing is parsed at runtime.
+   ///             Lookup by id uses a perfect hash, zone objects are built on first use and shared.
    //-----------------------------------------------------
    class CTimeZoneDatabase
    {
    public:
       CTimeZoneDatabase();
       virtual ~CTimeZoneDatabase();
+
+      //-----------------------------------------------------
+      ///\brief Get a timezone
+      ///\param[in] timezoneId The timezone id (like "Europe/Paris")
+      ///\return The timezone, null if not found
+      //-----------------------------------------------------
       boost::shared_ptr<boost::local_time::posix_time_zone::base_type> fromId(const std::string& timezoneId) const;
+
+      //-----------------------------------------------------
+      ///\brief Get all timezone ids (sorted)
+      //-----------------------------------------------------
       std::vector<std::string> allIds() const;
 
    private:
-      static const std::string DateTimeZonespecCsvImport;
-      boost::local_time::tz_database m_tzDb;
+      //-----------------------------------------------------
+      ///\brief A pre-parsed zone (offsets in seconds)
+      //-----------------------------------------------------
+      struct TimeZoneRecord
+      {
+         const char* id;
+         const char* stdAbbreviation;
+         const char* stdName;
+         const char* dstAbbreviation;
+         const char* dstName;
+         int utcOffset;
+         int dstOffset;
+         int dstStartTime;
+         int dstEndTime;
+         //DST rules : nth (1 to 5, 5 meaning last) weekday (0 = sunday) of month, nth is 0 if no DST
+         int dstStartNth;
+         int dstStartWeekday;
+         int dstStartMonth;
+         int dstEndNth;
+         int dstEndWeekday;
+         int dstEndMonth;
+      };
+
+      //-----------------------------------------------------
+      ///\brief Find a zone in the table
+      ///\param[in] timezoneId The timezone id
+      ///\return The zone index in the table, -1 if not found
+      //-----------------------------------------------------
+      static int find(const std::string& timezoneId);
+
+      //-----------------------------------------------------
+      ///\brief The hash used by the perfect hash (FNV-1a)
+      //-----------------------------------------------------
+      static unsigned int hash(const std::string& value, unsigned int seed);
+
+      //-----------------------------------------------------
+      ///\brief Build a zone object
+      //-----------------------------------------------------
+      static boost::shared_ptr<boost::local_time::posix_time_zone::base_type> build(const TimeZoneRecord& record);
+
+      //-----------------------------------------------------
+      ///\brief The generated tables (see TimeZoneTable.inc)
+      //-----------------------------------------------------
+      static const TimeZoneRecord TimeZones[];
+      static const std::size_t TimeZonesCount;
+      static const unsigned int Displacements[];
+      static const short Slots[];
+
+      //-----------------------------------------------------
+      ///\brief The zones already built (by table index)
+      //-----------------------------------------------------
+      mutable boost::mutex m_zonesMutex;
+      mutable std::vector<boost::shared_ptr<boost::local_time::posix_time_zone::base_type>> m_zones;
    };
 } // namespace dateTime
@@ -2,50 +2,57 @@
 #include "TimeZoneProvider.h"
 #include "TimeZoneProviderFromId.h"
 #include <shared/Log.h>
-#include <shared/exception/EmptyResult.hpp>
 
 namespace dateTime
 {
    CTimeZoneProvider::CTimeZoneProvider(boost::shared_ptr<dataAccessLayer::IConfigurationManager> configurationManager,
                                         boost::shared_ptr<CTimeZoneDatabase> timezoneDatabase,
                                         const std::string& fallbackTimezoneId):
-      m_configurationManager(configurationManager),
       m_timezoneDatabase(timezoneDatabase),
       m_fallbackTimezoneId(fallbackTimezoneId)
-   {
-   }
-
-   CTimeZoneProvider::~CTimeZoneProvider()
-   {
-   }
-
-   boost::shared_ptr<boost::local_time::posix_time_zone::base_type> CTimeZoneProvider::get() const
    {
       std::string timezoneId;
       try
       {
-         const auto location = m_configurationManager->getLocation();
-         timezoneId = shared::CDataContainer(location).get<std::string>("timezone");
-
-         if (timezoneId == m_lastTimezoneId)
-            return m_lastTimezone;
+         timezoneId = configurationManager->getLocation().get<std::string>("timezone");
       }
       catch (std::exception&)
       {
          // Not found in database
       }
+      updateTimezone(timezoneId);
+
+      configurationManager->subscribeOnServerConfigurationChanged([this](boost::shared_ptr<const shared::CDataContainer> serverConfiguration)
+      {
+         updateTimezone(serverConfiguration->getWithDefault<std::string>("location.timezone", std::string()));
+      });
+   }
+
+   CTimeZoneProvider::~CTimeZoneProvider()
+   {
+   }
 
-      if (timezoneId.empty())
+   boost::shared_ptr<boost::local_time::posix_time_zone::base_type> CTimeZoneProvider::get() const
+   {
+      boost::lock_guard<boost::mutex> lock(m_timezoneMutex);
+      return m_timezone;
+   }
+
+   void CTimeZoneProvider::updateTimezone(const std::string& timezoneId)
+   {
+      auto newTimezoneId = timezoneId;
+      if (newTimezoneId.empty())
       {
          YADOMS_LOG(information) << "Timezone was not found in database, fallback to " << m_fallbackTimezoneId;
-         timezoneId = m_fallbackTimezoneId;
+         newTimezoneId = m_fallbackTimezoneId;
       }
 
-      m_lastTimezoneId = timezoneId;
-
-      m_lastTimezone = CTimeZoneProviderFromId(timezoneId,
-                                               m_timezoneDatabase).get();
+      boost::lock_guard<boost::mutex> lock(m_timezoneMutex);
+      if (newTimezoneId == m_timezoneId)
+         return;
 
-      return m_lastTimezone;
+      m_timezoneId = newTimezoneId;
+      m_timezone = CTimeZoneProviderFromId(newTimezoneId,
+                                           m_timezoneDatabase).get();
    }
 } // namespace dateTime
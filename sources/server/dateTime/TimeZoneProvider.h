@@ -7,6 +7,8 @@ namespace dateTime
 {
    //-----------------------------------------------------
    ///\brief The timezone provider
+   ///\description The timezone is resolved at startup and when server configuration changes,
+   ///             so get() doesn't access configuration.
    //-----------------------------------------------------
    class CTimeZoneProvider : public ITimeZoneProvider
    {
@@ -21,11 +23,13 @@ namespace dateTime
       // [END] ITimeZoneProvider Implementation
       
    private:
-      const boost::shared_ptr<const dataAccessLayer::IConfigurationManager> m_configurationManager;
+      void updateTimezone(const std::string& timezoneId);
+
       const boost::shared_ptr<const CTimeZoneDatabase> m_timezoneDatabase;
       const std::string m_fallbackTimezoneId;
 
-      mutable std::string m_lastTimezoneId;
-      mutable boost::shared_ptr<boost::local_time::posix_time_zone::base_type> m_lastTimezone;
+      mutable boost::mutex m_timezoneMutex;
+      std::string m_timezoneId;
+      boost::shared_ptr<boost::local_time::posix_time_zone::base_type> m_timezone;
    };
 } // namespace dateTime
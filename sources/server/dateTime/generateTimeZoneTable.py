@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+# Generates TimeZoneTable.inc from the boost date_time_zonespec.csv file
+# (boost/libs/date_time/data/date_time_zonespec.csv).
+#
+# Zones are stored pre-parsed (offsets in seconds, DST rules as numbers), sorted by id,
+# with a perfect hash (hash and displace) on the zone id for O(1) lookups.
+#
+# Usage : generateTimeZoneTable.py date_time_zonespec.csv TimeZoneTable.inc
+
+import csv
+import sys
+
+FNV_OFFSET_BASIS = 2166136261
+FNV_PRIME = 16777619
+
+
+def fnv1a(text, seed):
+    # Must match CTimeZoneDatabase::hash
+    value = FNV_OFFSET_BASIS ^ seed
+    for c in text.encode('ascii'):
+        value ^= c
+        value = (value * FNV_PRIME) & 0xFFFFFFFF
+    return value
+
+
+def seconds(duration):
+    if not duration:
+        return 0
+    sign = -1 if duration.startswith('-') else 1
+    hours, minutes, secs = (int(field) for field in duration.lstrip('+-').split(':'))
+    return sign * (hours * 3600 + minutes * 60 + secs)
+
+
+def rule(spec):
+    # "<nth>;<weekday>;<month>", nth = -1 means last weekday of month (handled as fifth, like boost)
+    nth, weekday, month = (int(field) for field in spec.split(';'))
+    return (5 if nth == -1 else nth), weekday, month
+
+
+def perfect_hash(ids, bucket_count, slot_count):
+    buckets = [[] for _ in range(bucket_count)]
+    for index, zone_id in enumerate(ids):
+        buckets[fnv1a(zone_id, 0) % bucket_count].append(index)
+
+    displacements = [0] * bucket_count
+    slots = [-1] * slot_count
+    for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            continue
+        displacement = 1
+        while True:
+            candidates = [fnv1a(ids[index], displacement) % slot_count for index in buckets[bucket]]
+            if len(set(candidates)) == len(candidates) and all(slots[slot] < 0 for slot in candidates):
+                break
+            displacement += 1
+        displacements[bucket] = displacement
+        for index, slot in zip(buckets[bucket], candidates):
+            slots[slot] = index
+    return displacements, slots
+
+
+def main(csv_path, output_path):
+    with open(csv_path, newline='') as csv_file:
+        rows = sorted((row for row in csv.reader(csv_file) if row and not row[0].startswith('ID')), key=lambda row: row[0])
+
+    slot_count = 1
+    while slot_count < len(rows):
+        slot_count *= 2
+    bucket_count = slot_count // 4
+    displacements, slots = perfect_hash([row[0] for row in rows], bucket_count, slot_count)
+
+    with open(output_path, 'w', newline='\n') as output:
+        output.write('// Generated by generateTimeZoneTable.py from boost date_time_zonespec.csv, do not edit\n\n')
+        output.write('const CTimeZoneDatabase::TimeZoneRecord CTimeZoneDatabase::TimeZones[] =\n{\n')
+        for row in rows:
+            zone_id, std_abbrev, std_name, dst_abbrev, dst_name, utc_offset, dst_offset, start_rule, start_time, end_rule, end_time = row
+            if dst_abbrev:
+                start = rule(start_rule)
+                end = rule(end_rule)
+                dst = (seconds(dst_offset), seconds(start_time), seconds(end_time)) + start + end
+            else:
+                dst = (0,) * 9
+            output.write('   {"%s", "%s", "%s", "%s", "%s", %d, %d, %d, %d, %d, %d, %d, %d, %d, %d},\n'
+                         % ((zone_id, std_abbrev, std_name, dst_abbrev, dst_name, seconds(utc_offset)) + dst))
+        output.write('};\n\n')
+
+        output.write('const std::size_t CTimeZoneDatabase::TimeZonesCount = %d;\n\n' % len(rows))
+
+        output.write('const unsigned int CTimeZoneDatabase::Displacements[%d] =\n{\n' % bucket_count)
+        for first in range(0, bucket_count, 16):
+            output.write('   ' + ', '.join(str(value) for value in displacements[first:first + 16]) + ',\n')
+        output.write('};\n\n')
+
+        output.write('const short CTimeZoneDatabase::Slots[%d] =\n{\n' % slot_count)
+        for first in range(0, slot_count, 16):
+            output.write('   ' + ', '.join(str(value) for value in slots[first:first + 16]) + ',\n')
+        output.write('};\n')
+
+
+if __name__ == '__main__':
+    main(sys.argv[1], sys.argv[2])
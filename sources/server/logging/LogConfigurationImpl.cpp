@@ -18,6 +18,11 @@ namespace logging
 
    CLogConfigurationImpl::~CLogConfigurationImpl()
    {
+      //write pending messages (loggers still referencing these channels will then write synchronously)
+      if (!m_asyncFileChannel.isNull())
+         m_asyncFileChannel->close();
+      if (!m_asyncFileChannelPlugin.isNull())
+         m_asyncFileChannelPlugin->close();
    }
 
    void CLogConfigurationImpl::configure(const std::string& logLevel,
@@ -36,9 +41,11 @@ namespace logging
       m_fileChannel->setProperty("compress", "true");
       m_fileChannel->setProperty("purgeCount", "7");
       m_formattingFileChannel.assign(new Poco::FormattingChannel(m_patternFormatter, m_fileChannel));
+      //file is written (and rotated) from a dedicated thread, to not slow down logging threads
+      m_asyncFileChannel.assign(new shared::logInternal::CBoundedAsyncChannel(m_formattingFileChannel));
 
       m_splitterChannel->addChannel(m_formattingConsoleChannel);
-      m_splitterChannel->addChannel(m_formattingFileChannel);
+      m_splitterChannel->addChannel(m_asyncFileChannel);
 
       //configre any already created loggers
       std::vector<std::string> loggerNames;
@@ -52,9 +59,10 @@ namespace logging
 
       m_patternFormatterPlugin->setProperty("pattern", "%t");
       m_formattingFileChannelPlugin.assign(new Poco::FormattingChannel(m_patternFormatterPlugin, m_fileChannel));
+      m_asyncFileChannelPlugin.assign(new shared::logInternal::CBoundedAsyncChannel(m_formattingFileChannelPlugin));
       m_formattingConsoleChannelPlugin.assign(new Poco::FormattingChannel(m_patternFormatterPlugin, m_consoleChannel));
       m_splitterChannelPlugin->addChannel(m_formattingConsoleChannelPlugin);
-      m_splitterChannelPlugin->addChannel(m_formattingFileChannelPlugin);
+      m_splitterChannelPlugin->addChannel(m_asyncFileChannelPlugin);
 
       //configure root logger
       Poco::Logger::root().setChannel(m_splitterChannel);
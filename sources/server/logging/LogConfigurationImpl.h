@@ -5,6 +5,7 @@
 #include <Poco/AutoPtr.h>
 #include <Poco/FormattingChannel.h>
 #include <Poco/PatternFormatter.h>
+#include <shared/logInternal/BoundedAsyncChannel.h>
 
 
 namespace logging
@@ -22,10 +23,12 @@ namespace logging
       Poco::AutoPtr<Poco::PatternFormatter> m_patternFormatter;
       Poco::AutoPtr<Poco::FormattingChannel> m_formattingConsoleChannel;
       Poco::AutoPtr<Poco::FormattingChannel> m_formattingFileChannel;
+      Poco::AutoPtr<shared::logInternal::CBoundedAsyncChannel> m_asyncFileChannel;
       Poco::AutoPtr<Poco::SplitterChannel> m_splitterChannel;
 
       Poco::AutoPtr<Poco::PatternFormatter> m_patternFormatterPlugin;
       Poco::AutoPtr<Poco::FormattingChannel> m_formattingFileChannelPlugin;
+      Poco::AutoPtr<shared::logInternal::CBoundedAsyncChannel> m_asyncFileChannelPlugin;
       Poco::AutoPtr<Poco::FormattingChannel> m_formattingConsoleChannelPlugin;
       Poco::AutoPtr<Poco::SplitterChannel> m_splitterChannelPlugin;
    };
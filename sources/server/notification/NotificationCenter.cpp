@@ -2,6 +2,8 @@
 #include "NotificationCenter.h"
 #include "basic/Notification.hpp"
 #include <shared/exception/NullReference.hpp>
+#include <shared/metrics/MetricsRegistry.h>
+#include <shared/metrics/ScopedLatency.h>
 
 namespace notification {
 
@@ -15,6 +17,10 @@ namespace notification {
 
    void CNotificationCenter::postNotification(const boost::shared_ptr<INotification> notification)
    {
+      static auto& PostNotificationLatency = shared::metrics::CMetricsRegistry::instance().histogram("yadoms_notification_post_duration_seconds",
+                                                                                                    "Time to post a notification to all observers");
+      shared::metrics::CScopedLatency latency(PostNotificationLatency);
+
       if (notification)
       {
          //make the observers list copy, and release mutex
@@ -5,34 +5,67 @@ namespace pluginSystem
 {
    CFromPluginHistorizer::CFromPluginHistorizer(const plugin_IPC::toYadoms::Historizable& historizable,
                                                 const std::string& formatValue)
-      : m_keyword(historizable.name()),
-        m_capacity(shared::plugin::yPluginApi::CStandardCapacity(historizable.capacity().name(),
-                                                                 historizable.capacity().unit(),
-                                                                 shared::plugin::yPluginApi::EKeywordDataType(historizable.capacity().type()))),
-        m_accessMode(shared::plugin::yPluginApi::EKeywordAccessMode(historizable.accessmode())),
-        m_measureType(shared::plugin::yPluginApi::historization::EMeasureType(historizable.measure())),
-        m_typeInfo(historizable.typeinfo().empty() ? shared::CDataContainer::EmptyContainer : shared::CDataContainer(historizable.typeinfo())),
+      : m_description(boost::make_shared<const CHistorizableDescriptionTable::Description>(historizable.name(),
+                                                                                          historizable.capacity().name(),
+                                                                                          historizable.capacity().unit(),
+                                                                                          shared::plugin::yPluginApi::EKeywordDataType(historizable.capacity().type()),
+                                                                                          shared::plugin::yPluginApi::EKeywordAccessMode(historizable.accessmode()),
+                                                                                          shared::plugin::yPluginApi::historization::EMeasureType(historizable.measure()),
+                                                                                          historizable.typeinfo())),
         m_value(formatValue)
    {
    }
 
+   CFromPluginHistorizer::CFromPluginHistorizer(boost::shared_ptr<const CHistorizableDescriptionTable::Description> description,
+                                                const std::string& formatValue)
+      : m_description(description),
+        m_value(formatValue)
+   {
+   }
+
+   boost::shared_ptr<const CHistorizableDescriptionTable::Description> CFromPluginHistorizer::description(const plugin_IPC::toYadoms::Historizable& historizable,
+                                                                                                          CHistorizableDescriptionTable& table)
+   {
+      return table.get(historizable.name(),
+                       historizable.capacity().name(),
+                       historizable.capacity().unit(),
+                       shared::plugin::yPluginApi::EKeywordDataType(historizable.capacity().type()),
+                       shared::plugin::yPluginApi::EKeywordAccessMode(historizable.accessmode()),
+                       shared::plugin::yPluginApi::historization::EMeasureType(historizable.measure()),
+                       historizable.typeinfo());
+   }
+
+   std::vector<boost::shared_ptr<const shared::plugin::yPluginApi::historization::IHistorizable>> CFromPluginHistorizer::historizables(const plugin_IPC::toYadoms::HistorizeData& msg,
+                                                                                                                                       CHistorizableDescriptionTable& table)
+   {
+      std::vector<boost::shared_ptr<const IHistorizable>> historizables;
+      historizables.reserve(msg.value_size());
+      for (auto value = msg.value().begin(); value != msg.value().end(); ++value)
+      {
+         // Keyword description is shared by all values of the keyword, only value is copied
+         historizables.push_back(boost::make_shared<CFromPluginHistorizer>(description(value->historizable(), table),
+                                                                           value->formattedvalue()));
+      }
+      return historizables;
+   }
+
    CFromPluginHistorizer::~CFromPluginHistorizer()
    {
    }
 
    const std::string& CFromPluginHistorizer::getKeyword() const
    {
-      return m_keyword;
+      return m_description->keyword;
    }
 
    const shared::plugin::yPluginApi::CStandardCapacity& CFromPluginHistorizer::getCapacity() const
    {
-      return m_capacity;
+      return m_description->capacity;
    }
 
    const shared::plugin::yPluginApi::EKeywordAccessMode& CFromPluginHistorizer::getAccessMode() const
    {
-      return m_accessMode;
+      return m_description->accessMode;
    }
 
    std::string CFromPluginHistorizer::formatValue() const
@@ -42,12 +75,12 @@ namespace pluginSystem
 
    const shared::plugin::yPluginApi::historization::EMeasureType& CFromPluginHistorizer::getMeasureType() const
    {
-      return m_measureType;
+      return m_description->measureType;
    }
 
    shared::CDataContainer CFromPluginHistorizer::getTypeInfo() const
    {
-      return m_typeInfo;
+      return m_description->typeInfo;
    }
 } // namespace pluginSystem	
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <shared/plugin/yPluginApi/historization/IHistorizable.h>
 #include <plugin_IPC/pluginToYadoms.pb.h>
+#include "HistorizableDescriptionTable.h"
 
 namespace pluginSystem
 {
@@ -17,6 +18,33 @@ namespace pluginSystem
       //-----------------------------------------------------
       CFromPluginHistorizer(const plugin_IPC::toYadoms::Historizable& historizable,
                             const std::string& formatValue = std::string());
+
+      //-----------------------------------------------------
+      ///\brief                     Constructor
+      ///\param[in] description     The keyword description (shared by all values of the keyword)
+      ///\param[in] formatValue     Value
+      //-----------------------------------------------------
+      CFromPluginHistorizer(boost::shared_ptr<const CHistorizableDescriptionTable::Description> description,
+                            const std::string& formatValue);
+
+      //-----------------------------------------------------
+      ///\brief                     Get the description of a keyword from its Protobuf buffer
+      ///\param[in] historizable    Historizable data from Protobuf buffer
+      ///\param[in] table           The already known descriptions
+      ///\return                    The shared description
+      //-----------------------------------------------------
+      static boost::shared_ptr<const CHistorizableDescriptionTable::Description> description(const plugin_IPC::toYadoms::Historizable& historizable,
+                                                                                             CHistorizableDescriptionTable& table);
+
+      //-----------------------------------------------------
+      ///\brief                     Get the historizables of a received HistorizeData message
+      ///\param[in] msg             HistorizeData from Protobuf buffer
+      ///\param[in] table           The already known descriptions
+      ///\return                    The historizables (keywords descriptions are shared, only values are copied)
+      //-----------------------------------------------------
+      static std::vector<boost::shared_ptr<const shared::plugin::yPluginApi::historization::IHistorizable>> historizables(const plugin_IPC::toYadoms::HistorizeData& msg,
+                                                                                                                          CHistorizableDescriptionTable& table);
+
       //-----------------------------------------------------
       ///\brief                     Destructor
       //-----------------------------------------------------
@@ -32,11 +60,7 @@ namespace pluginSystem
       // [END] IHistorizable implementation
 
    private:
-      const std::string m_keyword;
-      const shared::plugin::yPluginApi::CStandardCapacity m_capacity;
-      const shared::plugin::yPluginApi::EKeywordAccessMode m_accessMode;
-      const shared::plugin::yPluginApi::historization::EMeasureType m_measureType;
-      const shared::CDataContainer m_typeInfo;
+      const boost::shared_ptr<const CHistorizableDescriptionTable::Description> m_description;
       const std::string m_value;
    };
 } // namespace pluginSystem	
@@ -0,0 +1,72 @@
+#include "stdafx.h"
+#include "HistorizableDescriptionTable.h"
+
+namespace pluginSystem
+{
+   CHistorizableDescriptionTable::Description::Description(const std::string& keywordName,
+                                                           const std::string& capacityName,
+                                                           const std::string& unit,
+                                                           const shared::plugin::yPluginApi::EKeywordDataType& dataType,
+                                                           const shared::plugin::yPluginApi::EKeywordAccessMode& keywordAccessMode,
+                                                           const shared::plugin::yPluginApi::historization::EMeasureType& keywordMeasureType,
+                                                           const std::string& typeInfoString)
+      : keyword(keywordName),
+        capacity(capacityName, unit, dataType),
+        accessMode(keywordAccessMode),
+        measureType(keywordMeasureType),
+        serializedTypeInfo(typeInfoString),
+        typeInfo(typeInfoString.empty() ? shared::CDataContainer::EmptyContainer : shared::CDataContainer(typeInfoString))
+   {
+   }
+
+   CHistorizableDescriptionTable::CHistorizableDescriptionTable(std::size_t maxDescriptions)
+      : m_maxDescriptions(maxDescriptions),
+        m_size(0)
+   {
+   }
+
+   CHistorizableDescriptionTable::~CHistorizableDescriptionTable()
+   {
+   }
+
+   boost::shared_ptr<const CHistorizableDescriptionTable::Description> CHistorizableDescriptionTable::get(const std::string& keyword,
+                                                                                                          const std::string& capacityName,
+                                                                                                          const std::string& unit,
+                                                                                                          const shared::plugin::yPluginApi::EKeywordDataType& dataType,
+                                                                                                          const shared::plugin::yPluginApi::EKeywordAccessMode& accessMode,
+                                                                                                          const shared::plugin::yPluginApi::historization::EMeasureType& measureType,
+                                                                                                          const std::string& typeInfo)
+   {
+      const auto sameName = m_descriptions.find(keyword);
+      if (sameName != m_descriptions.end())
+      {
+         for (const auto& description : sameName->second)
+         {
+            if (description->capacity.getName() == capacityName &&
+               description->capacity.getUnit() == unit &&
+               description->capacity.getType().toInteger() == dataType.toInteger() &&
+               description->accessMode.toInteger() == accessMode.toInteger() &&
+               description->measureType.toInteger() == measureType.toInteger() &&
+               description->serializedTypeInfo == typeInfo)
+               return description;
+         }
+      }
+
+      // A plugin creating always new keywords must not make the table grow forever
+      if (m_size >= m_maxDescriptions)
+      {
+         m_descriptions.clear();
+         m_size = 0;
+      }
+
+      auto description = boost::make_shared<const Description>(keyword, capacityName, unit, dataType, accessMode, measureType, typeInfo);
+      m_descriptions[keyword].push_back(description);
+      ++m_size;
+      return description;
+   }
+
+   std::size_t CHistorizableDescriptionTable::size() const
+   {
+      return m_size;
+   }
+} // namespace pluginSystem
@@ -0,0 +1,93 @@
+#pragma once
+#include <unordered_map>
+#include <shared/DataContainer.h>
+#include <shared/plugin/yPluginApi/StandardCapacity.h>
+#include <shared/plugin/yPluginApi/KeywordAccessMode.h>
+#include <shared/plugin/yPluginApi/historization/MeasureType.h>
+
+namespace pluginSystem
+{
+   //-----------------------------------------------------
+   ///\brief Table of the keywords descriptions received from a plugin
+   ///
+   /// A plugin sends the full description of a keyword (name, capacity, type info...)
+   /// with each historized value. Descriptions are built once and shared by all the values
+   /// of the keyword, so historizing an already known keyword allocates nothing.
+   /// Not thread-safe (to be used by the thread receiving the plugin messages).
+   //-----------------------------------------------------
+   class CHistorizableDescriptionTable
+   {
+   public:
+      //-----------------------------------------------------
+      ///\brief The description of a keyword (everything except the value)
+      //-----------------------------------------------------
+      struct Description
+      {
+         Description(const std::string& keywordName,
+                     const std::string& capacityName,
+                     const std::string& unit,
+                     const shared::plugin::yPluginApi::EKeywordDataType& dataType,
+                     const shared::plugin::yPluginApi::EKeywordAccessMode& keywordAccessMode,
+                     const shared::plugin::yPluginApi::historization::EMeasureType& keywordMeasureType,
+                     const std::string& typeInfoString);
+
+         const std::string keyword;
+         const shared::plugin::yPluginApi::CStandardCapacity capacity;
+         const shared::plugin::yPluginApi::EKeywordAccessMode accessMode;
+         const shared::plugin::yPluginApi::historization::EMeasureType measureType;
+         const std::string serializedTypeInfo;
+         const shared::CDataContainer typeInfo;
+      };
+
+      //-----------------------------------------------------
+      ///\brief                     Constructor
+      ///\param[in] maxDescriptions The maximum number of descriptions kept (the table is cleared when reached)
+      //-----------------------------------------------------
+      explicit CHistorizableDescriptionTable(std::size_t maxDescriptions = 4096);
+
+      //-----------------------------------------------------
+      ///\brief                     Destructor
+      //-----------------------------------------------------
+      virtual ~CHistorizableDescriptionTable();
+
+      //-----------------------------------------------------
+      ///\brief                     Get the description of a keyword (created if not already known)
+      ///\param[in] keyword         The keyword name
+      ///\param[in] capacityName    The capacity name
+      ///\param[in] unit            The capacity unit
+      ///\param[in] dataType        The capacity data type
+      ///\param[in] accessMode      The keyword access mode
+      ///\param[in] measureType     The keyword measure type
+      ///\param[in] typeInfo        The keyword type info (serialized)
+      ///\return                    The shared description
+      //-----------------------------------------------------
+      boost::shared_ptr<const Description> get(const std::string& keyword,
+                                               const std::string& capacityName,
+                                               const std::string& unit,
+                                               const shared::plugin::yPluginApi::EKeywordDataType& dataType,
+                                               const shared::plugin::yPluginApi::EKeywordAccessMode& accessMode,
+                                               const shared::plugin::yPluginApi::historization::EMeasureType& measureType,
+                                               const std::string& typeInfo);
+
+      //-----------------------------------------------------
+      ///\brief                     Get the number of known descriptions
+      //-----------------------------------------------------
+      std::size_t size() const;
+
+   private:
+      //-----------------------------------------------------
+      ///\brief                     The maximum number of descriptions kept
+      //-----------------------------------------------------
+      const std::size_t m_maxDescriptions;
+
+      //-----------------------------------------------------
+      ///\brief                     The descriptions, by keyword name (several keywords of different devices can have the same name)
+      //-----------------------------------------------------
+      std::unordered_map<std::string, std::vector<boost::shared_ptr<const Description>>> m_descriptions;
+
+      //-----------------------------------------------------
+      ///\brief                     The number of known descriptions
+      //-----------------------------------------------------
+      std::size_t m_size;
+   };
+} // namespace pluginSystem
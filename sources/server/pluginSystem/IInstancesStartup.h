@@ -0,0 +1,30 @@
+#pragma once
+
+namespace pluginSystem
+{
+   //-----------------------------------------------------
+   ///\brief Progress of the plugin instances startup
+   //-----------------------------------------------------
+   class IInstancesStartup
+   {
+   public:
+      //-----------------------------------------------------
+      ///\brief               Destructor
+      //-----------------------------------------------------
+      virtual ~IInstancesStartup() {}
+
+      //-----------------------------------------------------
+      ///\brief               Check if instances startup is finished
+      ///\param[in] instanceIds The instances to check
+      ///\return              true if none of these instances is still waiting or starting (started instances are running or failed to start)
+      //-----------------------------------------------------
+      virtual bool areInstancesStarted(const std::set<int>& instanceIds) const = 0;
+
+      //-----------------------------------------------------
+      ///\brief               Check if startup of all instances is finished
+      ///\return              true if no instance is still waiting or starting
+      //-----------------------------------------------------
+      virtual bool areAllInstancesStarted() const = 0;
+   };
+
+} // namespace pluginSystem	
@@ -9,15 +9,44 @@
 #include <plugin_IPC/yadomsToPlugin.pb.h>
 #include <shared/communication/SmallHeaderMessageCutter.h>
 #include <shared/communication/SmallHeaderMessageAssembler.h>
+#include <shared/metrics/MetricsRegistry.h>
+#include <shared/metrics/ScopedLatency.h>
 
 namespace pluginSystem
 {
+   namespace
+   {
+      std::map<int, shared::metrics::CLatencyHistogram*> createProcessMessageLatencies()
+      {
+         static const std::string Name("yadoms_plugin_ipc_message_duration_seconds");
+         static const std::string Help("Time to process a message received from a plugin, by message type");
+
+         std::map<int, shared::metrics::CLatencyHistogram*> latencies;
+         latencies[plugin_IPC::toYadoms::msg::ONEOF_NOT_SET] = &shared::metrics::CMetricsRegistry::instance().histogram(Name, Help, {{"type", "unknown"}});
+
+         const auto descriptor = plugin_IPC::toYadoms::msg::descriptor();
+         for (auto field = 0; field < descriptor->field_count(); ++field)
+            latencies[descriptor->field(field)->number()] = &shared::metrics::CMetricsRegistry::instance().histogram(Name, Help, {{"type", descriptor->field(field)->name()}});
+
+         return latencies;
+      }
+
+      shared::metrics::CLatencyHistogram& processMessageLatency(int messageType)
+      {
+         // Built once (thread-safe static initialization), then only read by the receive threads of all plugins
+         static const auto Latencies = createProcessMessageLatencies();
+
+         const auto latency = Latencies.find(messageType);
+         return *(latency != Latencies.end() ? latency->second : Latencies.at(plugin_IPC::toYadoms::msg::ONEOF_NOT_SET));
+      }
+   }
+
    const size_t CIpcAdapter::m_maxMessages(100);
    const size_t CIpcAdapter::m_maxMessageSize(100000);
 
    CIpcAdapter::CIpcAdapter(boost::shared_ptr<CYPluginApiImplementation> yPluginApi)
       : m_pluginApi(yPluginApi),
-        m_id(createId()),
+        m_id(createId(yPluginApi->getPluginId())),
         m_sendMessageQueueId(m_id + ".plugin_IPC.toPlugin"),
         m_receiveMessageQueueId(m_id + ".plugin_IPC.toYadoms"),
         m_sendMessageQueueRemover(m_sendMessageQueueId),
@@ -40,10 +69,10 @@ namespace pluginSystem
       return m_id;
    }
 
-   std::string CIpcAdapter::createId()
+   std::string CIpcAdapter::createId(int pluginInstanceId)
    {
       std::stringstream ss;
-      ss << "yPlugin." << boost::uuids::random_generator()();
+      ss << "yPlugin." << pluginInstanceId << "." << boost::uuids::random_generator()();
       return ss.str();
    }
 
@@ -127,16 +156,15 @@ namespace pluginSystem
          return;
       }
 
-      const auto pbMessageSize = pbMsg.ByteSize();
-      const auto serializedMessage = boost::make_shared<unsigned char[]>(pbMessageSize);
-      if (!pbMsg.SerializeWithCachedSizesToArray(serializedMessage.get()))
+      // Serialize in the reused send buffer (protected by m_sendMutex)
+      if (!m_sendBuffer.serialize(pbMsg))
       {
          YADOMS_LOG(error) << "CIpcAdapter::send : fail to serialize message ==> ignored";
          return;
       }
 
-      const auto cuttedMessage = m_messageCutter->cut(serializedMessage,
-                                                      pbMessageSize);
+      const auto cuttedMessage = m_messageCutter->cut(m_sendBuffer.data(),
+                                                      m_sendBuffer.size());
 
       if (!cuttedMessage->empty())
       {
@@ -186,13 +214,13 @@ namespace pluginSystem
       if (messageSize < 1)
          throw shared::exception::CInvalidParameter("messageSize");
 
-      // Unserialize message
-      plugin_IPC::toYadoms::msg toYadomsProtoBuffer;
-      if (!toYadomsProtoBuffer.ParseFromArray(message.get(), messageSize))
-         throw shared::exception::CInvalidParameter("message : fail to parse received data into protobuf format");
+      // Unserialize message (in the receive arena, the message is released when next one is received)
+      const auto& toYadomsProtoBuffer = m_receiveArena.parse<plugin_IPC::toYadoms::msg>(message.get(), messageSize);
 
       YADOMS_LOG(trace) << "[RECEIVE] message " << toYadomsProtoBuffer.OneOf_case() << " from plugin instance #" << m_pluginApi->getPluginId() << (m_onReceiveHook ? " (onReceiveHook ENABLED)" : "");
 
+      shared::metrics::CScopedLatency latency(processMessageLatency(toYadomsProtoBuffer.OneOf_case()));
+
       {
          boost::lock_guard<boost::recursive_mutex> lock(m_onReceiveHookMutex);
          if (m_onReceiveHook && m_onReceiveHook(toYadomsProtoBuffer))
@@ -425,12 +453,7 @@ namespace pluginSystem
 
    void CIpcAdapter::processHistorizeData(const plugin_IPC::toYadoms::HistorizeData& msg) const
    {
-      std::vector<boost::shared_ptr<const shared::plugin::yPluginApi::historization::IHistorizable>> dataVect;
-      for (auto value = msg.value().begin(); value != msg.value().end(); ++value)
-      {
-         dataVect.push_back(boost::make_shared<CFromPluginHistorizer>(value->historizable(), value->formattedvalue()));
-      }
-      m_pluginApi->historizeData(msg.device(), dataVect);
+      m_pluginApi->historizeData(msg.device(), CFromPluginHistorizer::historizables(msg, m_historizableDescriptions));
    }
 
    void CIpcAdapter::processYadomsInformationRequest(const plugin_IPC::toYadoms::YadomsInformationRequest& msg)
@@ -5,6 +5,9 @@
 #include <plugin_IPC/yadomsToPlugin.pb.h>
 #include "yPluginApiImplementation.h"
 #include <shared/communication/IMessageCutter.h>
+#include "communication/ReceiveArena.hpp"
+#include "communication/SendBuffer.hpp"
+#include "HistorizableDescriptionTable.h"
 
 namespace pluginSystem
 {
@@ -45,8 +48,9 @@ namespace pluginSystem
 
       //--------------------------------------------------------------
       /// \brief	Create a unique context accessor ID (unique on full system)
+      /// \param[in] pluginInstanceId The plugin instance ID (put in the ID, to identify the instance process from its command line)
       //--------------------------------------------------------------
-      static std::string createId();
+      static std::string createId(int pluginInstanceId);
 
       //--------------------------------------------------------------
       /// \brief	Message queue receive thread
@@ -161,11 +165,26 @@ namespace pluginSystem
       //-----------------------------------------------------
       mutable boost::recursive_mutex m_sendMutex;
 
+      //-----------------------------------------------------
+      ///\brief               The buffer in which sent messages are serialized
+      //-----------------------------------------------------
+      communication::CSendBuffer m_sendBuffer;
+
       //-----------------------------------------------------
       ///\brief               The message cutter, to manage oversized messages
       //-----------------------------------------------------
       boost::shared_ptr<shared::communication::IMessageCutter> m_messageCutter;
 
+      //-----------------------------------------------------
+      ///\brief               The arena in which received messages are parsed (used only by the receiving thread)
+      //-----------------------------------------------------
+      communication::CReceiveArena m_receiveArena;
+
+      //-----------------------------------------------------
+      ///\brief               The keywords descriptions received from the plugin (used only by the receiving thread)
+      //-----------------------------------------------------
+      mutable CHistorizableDescriptionTable m_historizableDescriptions;
+
       //-----------------------------------------------------
       ///\brief               The receiving thread
       //-----------------------------------------------------
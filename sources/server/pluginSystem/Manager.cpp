@@ -47,101 +47,194 @@ namespace pluginSystem
       stop();
    }
 
+   const unsigned int CManager::MaxParallelStarts = 4;
+
    void CManager::start(const boost::posix_time::time_duration& timeout)
    {
-      std::set<int> startedInstanceIds;
-
-      // Start all plugin instances
       YADOMS_LOG(information) << "Start all plugin instances...";
       {
          boost::lock_guard<boost::recursive_mutex> lock(m_runningInstancesMutex);
+         if (!m_runningInstances.empty())
+            throw shared::exception::CException("Some plugins are already started, are you sure that manager was successfuly stopped ?");
 
          // Initialize the plugin list (detect available plugins)
          updatePluginList();
 
-         startAllInstances(startedInstanceIds);
+         //start the internal plugin
+         startInternalPlugin();
+      }
+
+      // Start other instances in background
+      {
+         boost::lock_guard<boost::mutex> lock(m_startupPlanMutex);
+         m_startupPlan = createStartupPlan(getInstanceList());
       }
+      m_startupThread = boost::thread(&CManager::doStartInstances, this, shared::currentTime::Provider().now() + timeout);
+   }
+
+   void CManager::stop()
+   {
+      m_startupThread.interrupt();
+      m_startupThread.join();
 
-      // Wait for instances started or timeout
-      YADOMS_LOG(debug) << "All plugin instances are started, wait for running...";
-      enum
+      stopInstances();
+   }
+
+   boost::shared_ptr<CStartupPlan> CManager::createStartupPlan(const std::vector<boost::shared_ptr<database::entities::CPlugin>>& instances) const
+   {
+      auto startupPlan = boost::make_shared<CStartupPlan>(MaxParallelStarts);
+      const auto availablePlugins = getPluginList();
+
+      for (const auto& instance : instances)
+      {
+         if (instance->Category() == database::entities::EPluginCategory::kSystem || !instance->AutoStart())
+            continue;
+
+         std::vector<std::string> after;
+         auto priority = 0;
+         const auto pluginInformation = availablePlugins.find(instance->Type());
+         if (pluginInformation != availablePlugins.end())
          {
-            kStartInstancesTimeoutId = shared::event::kUserFirstId
-         };
-      shared::event::CEventHandler startInstancesEventHandler;
-      startInstancesEventHandler.createTimePoint(kStartInstancesTimeoutId, shared::currentTime::Provider().now() + timeout);
-      while (true)
+            try
+            {
+               const auto package = pluginInformation->second->getPackage();
+               if (package->containsChild("startup.after") || package->containsValue("startup.after"))
+                  after = package->get<std::vector<std::string>>("startup.after");
+               if (package->containsValue("startup.priority"))
+                  priority = package->get<int>("startup.priority");
+            }
+            catch (shared::exception::CException& e)
+            {
+               YADOMS_LOG(warning) << "Invalid startup section in package.json of plugin " << instance->Type() << " (" << e.what() << "), ignored";
+            }
+         }
+
+         startupPlan->addInstance(instance->Id(), instance->Type(), after, priority);
+      }
+
+      return startupPlan;
+   }
+
+   void CManager::doStartInstances(const boost::posix_time::ptime& deadline)
+   {
+      try
       {
-         switch (startInstancesEventHandler.waitForEvents(boost::posix_time::seconds(2)))
+         auto allInstancesStarted = true;
+         while (true)
          {
-         case kStartInstancesTimeoutId:
-            YADOMS_LOG(warning) << "Timeout starting plugin instances : some instance(s) are not running";
-            return;
-         case shared::event::kTimeout: // Every 2 seconds
-            for (auto it = startedInstanceIds.begin(); it != startedInstanceIds.end();)
+            std::vector<int> instancesToStart;
             {
-               if (getInstanceState(*it) == shared::plugin::yPluginApi::historization::EPluginState::kRunning)
+               boost::lock_guard<boost::mutex> lock(m_startupPlanMutex);
+               if (m_startupPlan->completed())
+                  break;
+               instancesToStart = m_startupPlan->nextInstancesToStart();
+            }
+
+            for (const auto& instanceId : instancesToStart)
+            {
+               if (!startPlannedInstance(instanceId))
+                  allInstancesStarted = false;
+            }
+
+            std::set<int> startingInstances;
+            {
+               boost::lock_guard<boost::mutex> lock(m_startupPlanMutex);
+               startingInstances = m_startupPlan->startingInstances();
+            }
+            if (startingInstances.empty())
+               continue;
+
+            if (shared::currentTime::Provider().now() >= deadline)
+            {
+               // Stop waiting for instances to be running, but start all remaining instances anyway
+               std::vector<int> waitingInstances;
                {
-                  YADOMS_LOG(debug) << "Plugin instance " << *it << " is running";
-                  it = startedInstanceIds.erase(it);
+                  boost::lock_guard<boost::mutex> lock(m_startupPlanMutex);
+                  waitingInstances = m_startupPlan->abort();
                }
-               else
-                  ++it;
+               YADOMS_LOG(warning) << "Timeout starting plugin instances : " << startingInstances.size() << " instance(s) are not running yet, "
+                  << waitingInstances.size() << " instance(s) are started without waiting for dependencies";
+
+               for (const auto& instanceId : waitingInstances)
+                  startPlannedInstance(instanceId);
+               return;
             }
-            if (startedInstanceIds.empty())
+
+            // Wait for starting instances to be running
+            boost::this_thread::sleep(boost::posix_time::milliseconds(500));
+            for (const auto& instanceId : startingInstances)
             {
-               YADOMS_LOG(information) << "All started instances are now running";
-               return;
+               if (!isInstanceStartupFinished(instanceId))
+                  continue;
+
+               boost::lock_guard<boost::mutex> lock(m_startupPlanMutex);
+               m_startupPlan->onInstanceStarted(instanceId);
             }
-            break;
-         default: break;
          }
+
+         if (allInstancesStarted)
+            YADOMS_LOG(information) << "All started instances are now running";
+         else
+            YADOMS_LOG(error) << "One or more plugins failed to start, check plugins page for details";
+      }
+      catch (boost::thread_interrupted&)
+      {
+         YADOMS_LOG(information) << "Plugin instances startup interrupted";
       }
    }
 
-   void CManager::stop()
+   bool CManager::startPlannedInstance(int instanceId)
    {
-      stopInstances();
+      try
+      {
+         YADOMS_LOG(debug) << "Start plugin instance " << instanceId << "...";
+         startInstance(instanceId);
+         return true;
+      }
+      catch (CPluginException& ex)
+      {
+         YADOMS_LOG(error) << "Unable to start plugin instance " << instanceId << " (" << ex.what() << "), skipped";
+
+         boost::lock_guard<boost::mutex> lock(m_startupPlanMutex);
+         m_startupPlan->onInstanceStarted(instanceId);
+         return false;
+      }
    }
 
-   void CManager::startAllInstances(std::set<int>& startedInstanceIds)
+   bool CManager::isInstanceStartupFinished(int id) const
    {
-      boost::lock_guard<boost::recursive_mutex> lock(m_runningInstancesMutex);
-      if (!m_runningInstances.empty())
-         throw shared::exception::CException("Some plugins are already started, are you sure that manager was successfuly stopped ?");
+      if (!isInstanceRunning(id))
+      {
+         YADOMS_LOG(warning) << "Plugin instance " << id << " stopped during startup";
+         return true;
+      }
 
-      if (!startInstances(getInstanceList(),
-                          startedInstanceIds))
-      YADOMS_LOG(error) << "One or more plugins failed to start, check plugins page for details";
+      const auto state = getInstanceState(id);
+      if (state == shared::plugin::yPluginApi::historization::EPluginState::kRunning)
+      {
+         YADOMS_LOG(debug) << "Plugin instance " << id << " is running";
+         return true;
+      }
 
-      //start the internal plugin
-      startInternalPlugin();
+      if (state == shared::plugin::yPluginApi::historization::EPluginState::kError)
+      {
+         YADOMS_LOG(warning) << "Plugin instance " << id << " is in error state";
+         return true;
+      }
+
+      return false;
    }
 
-   bool CManager::startInstances(const std::vector<boost::shared_ptr<database::entities::CPlugin>>& instances,
-                                 std::set<int>& startedInstanceIds)
+   bool CManager::areInstancesStarted(const std::set<int>& instanceIds) const
    {
-      auto allInstancesStarted = true;
-      for (auto it = instances.begin(); it != instances.end(); ++it)
-      {
-         try
-         {
-            if ((*it)->Category() != database::entities::EPluginCategory::kSystem)
-               if ((*it)->AutoStart())
-               {
-                  YADOMS_LOG(debug) << "Start plugin instance " << (*it)->Id() << "...";
-                  startInstance((*it)->Id());
-                  startedInstanceIds.insert((*it)->Id());
-               }
-         }
-         catch (CPluginException& ex)
-         {
-            YADOMS_LOG(error) << "Unable to start plugin " << (*it)->DisplayName() << "(" << ex.what() << "), skipped";
-            allInstancesStarted = false;
-         }
-      }
+      boost::lock_guard<boost::mutex> lock(m_startupPlanMutex);
+      return !m_startupPlan || m_startupPlan->areStarted(instanceIds);
+   }
 
-      return allInstancesStarted;
+   bool CManager::areAllInstancesStarted() const
+   {
+      boost::lock_guard<boost::mutex> lock(m_startupPlanMutex);
+      return !m_startupPlan || m_startupPlan->completed();
    }
 
    void CManager::updatePluginList()
@@ -612,7 +705,7 @@ namespace pluginSystem
          try
          {
             auto stateKw = m_dataProvider->getKeywordRequester()->getKeyword(device->Id, "state");
-            shared::plugin::yPluginApi::historization::EPluginState state(m_dataProvider->getKeywordRequester()->getKeywordLastData(stateKw->Id));
+            shared::plugin::yPluginApi::historization::EPluginState state(m_dataAccessLayer->getKeywordManager()->getKeywordLastData(stateKw->Id));
             if (state == shared::plugin::yPluginApi::historization::EPluginState::kError)
             {
                // In error state
@@ -622,14 +715,14 @@ namespace pluginSystem
 
                try
                {
-                  shared::CDataContainer dc(m_dataProvider->getKeywordRequester()->getKeywordLastData(customMessageIdKw->Id));
+                  shared::CDataContainer dc(m_dataAccessLayer->getKeywordManager()->getKeywordLastData(customMessageIdKw->Id));
                   defaultState.set("messageId", dc.getWithDefault("messageId", std::string()));
                   defaultState.set("messageData", dc.getWithDefault("messageData", std::string()));
                }
                catch (shared::exception::CJSONParse& jsonerror)
                {
                   YADOMS_LOG(debug) << "Fail to parser JSON in pluginState id=" << id << " error=" << jsonerror.what();
-                  defaultState.set("messageId", m_dataProvider->getKeywordRequester()->getKeywordLastData(customMessageIdKw->Id));
+                  defaultState.set("messageId", m_dataAccessLayer->getKeywordManager()->getKeywordLastData(customMessageIdKw->Id));
                }
                return defaultState;
             }
@@ -668,18 +761,18 @@ namespace pluginSystem
          auto stateKw = m_dataProvider->getKeywordRequester()->getKeyword(device->Id, "state");
          auto customMessageIdKw = m_dataProvider->getKeywordRequester()->getKeyword(device->Id, "customMessageId");
          shared::CDataContainer defaultState;
-         defaultState.set("state", m_dataProvider->getKeywordRequester()->getKeywordLastData(stateKw->Id));
+         defaultState.set("state", m_dataAccessLayer->getKeywordManager()->getKeywordLastData(stateKw->Id));
 
          try
          {
-            shared::CDataContainer dc(m_dataProvider->getKeywordRequester()->getKeywordLastData(customMessageIdKw->Id));
+            shared::CDataContainer dc(m_dataAccessLayer->getKeywordManager()->getKeywordLastData(customMessageIdKw->Id));
             defaultState.set("messageId", dc.getWithDefault("messageId", std::string()));
             defaultState.set("messageData", dc.getWithDefault("messageData", std::string()));
          }
          catch (shared::exception::CJSONParse& jsonerror)
          {
             YADOMS_LOG(debug) << "Fail to parser JSON in pluginState id=" << id << " error=" << jsonerror.what();
-            defaultState.set("messageId", m_dataProvider->getKeywordRequester()->getKeywordLastData(customMessageIdKw->Id));
+            defaultState.set("messageId", m_dataAccessLayer->getKeywordManager()->getKeywordLastData(customMessageIdKw->Id));
          }
 
          return defaultState;
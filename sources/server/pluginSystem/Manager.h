@@ -6,6 +6,8 @@
 #pragma once
 #include "IFactory.h"
 #include "IInstance.h"
+#include "IInstancesStartup.h"
+#include "StartupPlan.h"
 #include "database/IDataProvider.h"
 #include "database/IPluginRequester.h"
 #include <shared/event/EventHandler.hpp>
@@ -26,7 +28,7 @@ namespace pluginSystem
    /// \brief	this class is used to manage plugin. 
    ///         It search for plugins into directories and generate plugin factories
    //--------------------------------------------------------------
-   class CManager
+   class CManager : public IInstancesStartup
    {
    public:
       //--------------------------------------------------------------
@@ -50,7 +52,9 @@ namespace pluginSystem
       //--------------------------------------------------------------
       /// \brief			Start the manager (try to start all active plugins)
       /// \param[in]    timeout  Timeout waiting plugins to start
-      /// \details      This function is blocking until all plugins are started or timeout
+      /// \details      Internal plugin is started immediately, other instances are started in background,
+      ///               following plugins dependencies and priority (see CStartupPlan).
+      ///               Use IInstancesStartup to know when instances are started.
       //--------------------------------------------------------------
       void start(const boost::posix_time::time_duration& timeout);
 
@@ -259,21 +263,38 @@ namespace pluginSystem
       //--------------------------------------------------------------
       void notifyDeviceRemoved(int deviceId) const;
 
+      // IInstancesStartup Implementation
+      bool areInstancesStarted(const std::set<int>& instanceIds) const override;
+      bool areAllInstancesStarted() const override;
+      // [END] IInstancesStartup Implementation
+
    private:
       //-----------------------------------------------------
-      ///\brief               Start all instances
-      ///\param[out] startedInstanceIds Instances started
+      ///\brief               Create the startup plan of the auto-started instances
+      ///\param[in] instances All instances
+      ///\return              The startup plan
       //-----------------------------------------------------
-      void startAllInstances(std::set<int>& startedInstanceIds);
+      boost::shared_ptr<CStartupPlan> createStartupPlan(const std::vector<boost::shared_ptr<database::entities::CPlugin>>& instances) const;
 
       //-----------------------------------------------------
-      ///\brief               Start all specified instances
-      ///\param[in] instances Instances to start
-      ///\param[out] startedInstanceIds Instances started
-      ///\return              true if all instances were successfully started
+      ///\brief               Start the instances of the startup plan (startup thread)
+      ///\param[in] deadline  Time limit for instances to be running
       //-----------------------------------------------------
-      bool startInstances(const std::vector<boost::shared_ptr<database::entities::CPlugin>>& instances,
-                          std::set<int>& startedInstanceIds);
+      void doStartInstances(const boost::posix_time::ptime& deadline);
+
+      //-----------------------------------------------------
+      ///\brief               Start an instance of the startup plan
+      ///\param[in] instanceId The instance ID
+      ///\return              false if instance failed to start
+      //-----------------------------------------------------
+      bool startPlannedInstance(int instanceId);
+
+      //-----------------------------------------------------
+      ///\brief               Check if a starting instance is started (running or failed)
+      ///\param[in] id        The instance ID
+      ///\return              true if instance startup is finished
+      //-----------------------------------------------------
+      bool isInstanceStartupFinished(int id) const;
 
       //-----------------------------------------------------
       ///\brief               Stop all started instances
@@ -331,6 +352,22 @@ namespace pluginSystem
       //--------------------------------------------------------------
       std::map<int, boost::shared_ptr<IInstance>> m_runningInstances;
       mutable boost::recursive_mutex m_runningInstancesMutex;
+
+      //--------------------------------------------------------------
+      /// \brief			Maximum number of instances starting at the same time
+      //--------------------------------------------------------------
+      static const unsigned int MaxParallelStarts;
+
+      //--------------------------------------------------------------
+      /// \brief			The instances startup plan (null if manager not started), and its mutex
+      //--------------------------------------------------------------
+      boost::shared_ptr<CStartupPlan> m_startupPlan;
+      mutable boost::mutex m_startupPlanMutex;
+
+      //--------------------------------------------------------------
+      /// \brief			The instances startup thread
+      //--------------------------------------------------------------
+      boost::thread m_startupThread;
    };
 } // namespace pluginSystem
 
@@ -0,0 +1,132 @@
+#include "stdafx.h"
+#include "StartupPlan.h"
+
+namespace pluginSystem
+{
+   CStartupPlan::CStartupPlan(unsigned int maxParallelStarts)
+      : m_maxParallelStarts(std::max(maxParallelStarts, 1U))
+   {
+   }
+
+   CStartupPlan::~CStartupPlan()
+   {
+   }
+
+   void CStartupPlan::addInstance(int instanceId,
+                                  const std::string& pluginType,
+                                  const std::vector<std::string>& after,
+                                  int priority)
+   {
+      if (m_notStarted.find(instanceId) != m_notStarted.end())
+         return;
+
+      const Instance instance = {instanceId, pluginType, after, priority};
+
+      // Keep waiting list sorted by priority (then by insertion order)
+      const auto insertPosition = std::find_if(m_waiting.begin(),
+                                               m_waiting.end(),
+                                               [&](const Instance& waiting)
+                                               {
+                                                  return waiting.priority < priority;
+                                               });
+      m_waiting.insert(insertPosition, instance);
+
+      m_notStarted[instanceId] = pluginType;
+      ++m_notStartedByPluginType[pluginType];
+   }
+
+   bool CStartupPlan::dependenciesStarted(const Instance& instance) const
+   {
+      for (const auto& dependency : instance.after)
+      {
+         if (dependency == instance.pluginType)
+            continue;
+
+         const auto notStarted = m_notStartedByPluginType.find(dependency);
+         if (notStarted != m_notStartedByPluginType.end() && notStarted->second != 0)
+            return false;
+      }
+      return true;
+   }
+
+   std::vector<int> CStartupPlan::nextInstancesToStart()
+   {
+      std::vector<int> instancesToStart;
+
+      for (auto instance = m_waiting.begin(); instance != m_waiting.end() && m_starting.size() < m_maxParallelStarts;)
+      {
+         if (!dependenciesStarted(*instance))
+         {
+            ++instance;
+            continue;
+         }
+
+         instancesToStart.push_back(instance->id);
+         m_starting.insert(instance->id);
+         instance = m_waiting.erase(instance);
+      }
+
+      if (m_starting.empty() && !m_waiting.empty())
+      {
+         // Nothing is starting and nothing can start : cyclic dependencies, start the first waiting instance
+         instancesToStart.push_back(m_waiting.front().id);
+         m_starting.insert(m_waiting.front().id);
+         m_waiting.erase(m_waiting.begin());
+      }
+
+      return instancesToStart;
+   }
+
+   void CStartupPlan::onInstanceStarted(int instanceId)
+   {
+      const auto notStarted = m_notStarted.find(instanceId);
+      if (notStarted == m_notStarted.end())
+         return;
+
+      --m_notStartedByPluginType[notStarted->second];
+      m_notStarted.erase(notStarted);
+
+      m_starting.erase(instanceId);
+      m_waiting.erase(std::remove_if(m_waiting.begin(),
+                                     m_waiting.end(),
+                                     [&](const Instance& waiting)
+                                     {
+                                        return waiting.id == instanceId;
+                                     }),
+                      m_waiting.end());
+   }
+
+   std::vector<int> CStartupPlan::abort()
+   {
+      std::vector<int> waitingInstances;
+      for (const auto& waiting : m_waiting)
+         waitingInstances.push_back(waiting.id);
+
+      m_waiting.clear();
+      m_starting.clear();
+      m_notStarted.clear();
+      m_notStartedByPluginType.clear();
+
+      return waitingInstances;
+   }
+
+   const std::set<int>& CStartupPlan::startingInstances() const
+   {
+      return m_starting;
+   }
+
+   bool CStartupPlan::areStarted(const std::set<int>& instanceIds) const
+   {
+      for (const auto& instanceId : instanceIds)
+      {
+         if (m_notStarted.find(instanceId) != m_notStarted.end())
+            return false;
+      }
+      return true;
+   }
+
+   bool CStartupPlan::completed() const
+   {
+      return m_notStarted.empty();
+   }
+} // namespace pluginSystem
@@ -0,0 +1,110 @@
+#pragma once
+
+namespace pluginSystem
+{
+   //-----------------------------------------------------
+   ///\brief The plugin instances startup plan
+   ///\details Instances are started by priority order, with a bounded number of instances starting at the same time.
+   ///         An instance is started only when all instances of the plugins it depends on are started.
+   ///         Dependencies and priority are declared in the plugin package.json :
+   ///         "startup" : { "after" : [ "otherPluginType" ], "priority" : 10 }
+   ///\note    Not thread-safe
+   //-----------------------------------------------------
+   class CStartupPlan
+   {
+   public:
+      //-----------------------------------------------------
+      ///\brief               Constructor
+      ///\param[in] maxParallelStarts Maximum number of instances starting at the same time
+      //-----------------------------------------------------
+      explicit CStartupPlan(unsigned int maxParallelStarts);
+      virtual ~CStartupPlan();
+
+      //-----------------------------------------------------
+      ///\brief               Add an instance to start
+      ///\param[in] instanceId   The instance ID
+      ///\param[in] pluginType   The plugin type of the instance
+      ///\param[in] after        Plugin types to start before this instance
+      ///\param[in] priority     Start priority (higher starts first)
+      //-----------------------------------------------------
+      void addInstance(int instanceId,
+                       const std::string& pluginType,
+                       const std::vector<std::string>& after = std::vector<std::string>(),
+                       int priority = 0);
+
+      //-----------------------------------------------------
+      ///\brief               Get the instances to start now, and mark them as starting
+      ///\return              Instances to start, in start order (empty if no more instance can be started for now)
+      ///\note                If dependencies are cyclic, cycle is broken by starting the highest priority instance
+      //-----------------------------------------------------
+      std::vector<int> nextInstancesToStart();
+
+      //-----------------------------------------------------
+      ///\brief               Signal that instance startup is finished (running or failed)
+      ///\param[in] instanceId The instance ID
+      //-----------------------------------------------------
+      void onInstanceStarted(int instanceId);
+
+      //-----------------------------------------------------
+      ///\brief               Abort the startup (all remaining instances are considered as started)
+      ///\return              The instances which were still waiting, in start order (they must be started without waiting)
+      ///\note                Dependencies and parallel starts limit are no more taken into account
+      //-----------------------------------------------------
+      std::vector<int> abort();
+
+      //-----------------------------------------------------
+      ///\brief               Get the currently starting instances
+      ///\return              The starting instances
+      //-----------------------------------------------------
+      const std::set<int>& startingInstances() const;
+
+      //-----------------------------------------------------
+      ///\brief               Check if instances startup is finished
+      ///\param[in] instanceIds The instances to check (instances not in the plan are considered as started)
+      ///\return              true if none of these instances is waiting or starting
+      //-----------------------------------------------------
+      bool areStarted(const std::set<int>& instanceIds) const;
+
+      //-----------------------------------------------------
+      ///\brief               Check if the whole startup is finished
+      ///\return              true if no instance is waiting or starting
+      //-----------------------------------------------------
+      bool completed() const;
+
+   private:
+      struct Instance
+      {
+         int id;
+         std::string pluginType;
+         std::vector<std::string> after;
+         int priority;
+      };
+
+      //-----------------------------------------------------
+      ///\brief               Check if all dependencies of an instance are started
+      //-----------------------------------------------------
+      bool dependenciesStarted(const Instance& instance) const;
+
+      const unsigned int m_maxParallelStarts;
+
+      //-----------------------------------------------------
+      ///\brief               Instances waiting to be started, in start order
+      //-----------------------------------------------------
+      std::vector<Instance> m_waiting;
+
+      //-----------------------------------------------------
+      ///\brief               Instances being started
+      //-----------------------------------------------------
+      std::set<int> m_starting;
+
+      //-----------------------------------------------------
+      ///\brief               Number of waiting or starting instances, by plugin type
+      //-----------------------------------------------------
+      std::map<std::string, int> m_notStartedByPluginType;
+
+      //-----------------------------------------------------
+      ///\brief               Plugin type of waiting or starting instances
+      //-----------------------------------------------------
+      std::map<int, std::string> m_notStarted;
+   };
+} // namespace pluginSystem
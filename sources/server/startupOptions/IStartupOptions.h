@@ -281,11 +281,24 @@ namespace startupOptions
       //--------------------------------------------------------------
       virtual int getDatabaseAcquisitionLifetime() const = 0;
 
+      //--------------------------------------------------------------
+      /// \brief	    Get the acquisition lifetime of specific keywords
+      /// \return     The acquisition lifetime (in days, 0 for unlimited) by keyword id
+      ///             These keywords are not concerned by the global acquisition lifetime
+      //--------------------------------------------------------------
+      virtual std::map<int, int> getDatabaseAcquisitionLifetimeByKeyword() const = 0;
+
       //--------------------------------------------------------------
       /// \brief	    Tell if the developer pode is enabled
       /// \return     true the developer pode is enabled
       //--------------------------------------------------------------
       virtual bool getDeveloperMode() const = 0;
+
+      //--------------------------------------------------------------
+      /// \brief	    Tell if the server metrics (latencies, counters...) are collected
+      /// \return     true if metrics are collected
+      //--------------------------------------------------------------
+      virtual bool getMetricsEnabled() const = 0;
    };
 } // namespace startupOptions
 
@@ -298,12 +298,27 @@ namespace startupOptions
          .validator(new Poco::Util::IntValidator(0, 3650)) //from 0 (unlimited), to 10 years
          .binding("server.acquisitionLifetime", &m_configContainer));
 
+      options.addOption(
+         Poco::Util::Option("acquisitionLifetimeByKeyword", "ak", "Specify the acquisition lifetime in days of some keywords, as keywordId:days list (ie : 12:7,35:365). 0 days means unlimited.")
+         .required(false)
+         .repeatable(false)
+         .argument("acquisitionLifetimeByKeyword")
+         .validator(new Poco::Util::RegExpValidator("^ *([0-9]+ *: *[0-9]+ *(, *[0-9]+ *: *[0-9]+ *)*)?$"))
+         .binding("server.acquisitionLifetimeByKeyword", &m_configContainer));
+
       options.addOption(
          Poco::Util::Option("developerMode", "d", "Activate the developer mode")
          .required(false)
          .repeatable(false)
          .noArgument()
          .binding("server.developerMode", &m_configContainer));
+
+      options.addOption(
+         Poco::Util::Option("metrics", "m", "Collect the server metrics (available at /rest/system/metrics)")
+         .required(false)
+         .repeatable(false)
+         .noArgument()
+         .binding("server.metrics", &m_configContainer));
    }
 
    std::string CStartupOptions::getLogLevel() const
@@ -561,9 +576,40 @@ namespace startupOptions
       return m_configContainer.getInt("server.acquisitionLifetime", 30);
    }  
 
+   std::map<int, int> CStartupOptions::getDatabaseAcquisitionLifetimeByKeyword() const
+   {
+      std::map<int, int> lifetimes;
+
+      std::vector<std::string> policies;
+      const auto value = m_configContainer.getString("server.acquisitionLifetimeByKeyword", std::string());
+      boost::split(policies, value, boost::is_any_of(","), boost::token_compress_on);
+      for (const auto& policy : policies)
+      {
+         std::vector<std::string> fields;
+         boost::split(fields, policy, boost::is_any_of(":"));
+         if (fields.size() != 2)
+            continue;
+
+         try
+         {
+            lifetimes[boost::lexical_cast<int>(boost::trim_copy(fields[0]))] = boost::lexical_cast<int>(boost::trim_copy(fields[1]));
+         }
+         catch (boost::bad_lexical_cast&)
+         {
+            //invalid entries are ignored (already refused by the option validator when given by command line)
+         }
+      }
+      return lifetimes;
+   }
+
    bool CStartupOptions::getDeveloperMode() const
    {
       return m_configContainer.getBool("server.developerMode", false);
    }
 
+   bool CStartupOptions::getMetricsEnabled() const
+   {
+      return m_configContainer.getBool("server.metrics", false);
+   }
+
 } // namespace startupOptions
@@ -80,7 +80,9 @@ namespace startupOptions
       std::string getUpdateSiteUri() const override;
       std::string getBackupPath() const override;
       int getDatabaseAcquisitionLifetime() const override;
+      std::map<int, int> getDatabaseAcquisitionLifetimeByKeyword() const override;
       bool getDeveloperMode() const override;
+      bool getMetricsEnabled() const override;
       bool getNoWebServerCacheFlag() const override;
       // [END] IStartupOptions implementation
       //--------------------------------------------------------------
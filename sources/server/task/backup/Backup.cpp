@@ -3,11 +3,12 @@
 #include "database/IDataBackup.h"
 #include "task/ITask.h"
 #include "Backup.h"
-#include "tools/FileSystem.h"
+#include "BackupFile.h"
 #include <Poco/Zip/Compress.h>
 #include <shared/currentTime/Provider.h>
 #include <Poco/Zip/ZipException.h>
 #include <Poco/Delegate.h>
+#include <Poco/Path.h>
 #include "i18n/ClientStrings.h"
 
 namespace task
@@ -16,8 +17,8 @@ namespace task
    {
       std::string CBackup::m_taskName = "backup";
 
-      CBackup::CBackup(boost::shared_ptr<const IPathProvider> pathProvider, boost::shared_ptr<database::IDataBackup> dataBackupInterface)
-         : m_pathProvider(pathProvider), m_dataBackupInterface(dataBackupInterface), m_fileCountToZip(0), m_currentFileCount(0)
+      CBackup::CBackup(boost::shared_ptr<const IPathProvider> pathProvider, boost::shared_ptr<database::IDataBackup> dataBackupInterface, bool incremental)
+         : m_pathProvider(pathProvider), m_dataBackupInterface(dataBackupInterface), m_incremental(incremental), m_fileCountToZip(0), m_currentFileCount(0)
       {
          if (!m_dataBackupInterface)
             throw shared::exception::CInvalidParameter("dataBackupInterface");
@@ -50,21 +51,30 @@ namespace task
       {
          try
          {
+            //the backup date is taken before copying the database, so next incremental backup can't miss any acquisition
+            const auto backupDate = shared::currentTime::Provider().now();
+
+            auto since = boost::posix_time::ptime(boost::posix_time::not_a_date_time);
+            if (m_incremental)
+            {
+               since = CBackupFile::lastBackupDate(m_pathProvider->backupPath());
+               if (since.is_not_a_date_time())
+                  YADOMS_LOG(information) << "No previous backup found, do a full backup";
+            }
+
             boost::filesystem::path backupTempFolder = prepareBackup();
-            if (backupFiles(backupTempFolder))
+            try
             {
-               boost::filesystem::path zipFile = makeZipArchive(backupTempFolder);
-               cleanup(backupTempFolder);
-               OnProgressionUpdatedInternal(0, 100, 99.0f, 100.0f, i18n::CClientStrings::BackupSuccess);
+               backupDatabase(backupTempFolder, since);
+               makeZipArchive(backupTempFolder, backupDate, !since.is_not_a_date_time());
             }
-            else
+            catch (std::exception&)
             {
-               //fail to backup files, just cleanup and ends with error
                cleanup(backupTempFolder);
-               std::string errorMessage = "fail to copy files to temp folder : ";
-               errorMessage += backupTempFolder.string();
-               throw shared::exception::CException(errorMessage);
+               throw;
             }
+            cleanup(backupTempFolder);
+            OnProgressionUpdatedInternal(0, 100, 99.0f, 100.0f, i18n::CClientStrings::BackupSuccess);
          }
          catch (std::exception &ex)
          {
@@ -87,7 +97,7 @@ namespace task
 
       boost::filesystem::path CBackup::prepareBackup() const
       {
-         //create "backup temp" folder
+         //create "backup temp" folder (only used for the database copy, other files are directly added to the archive)
          boost::filesystem::path backupTempFolder = boost::filesystem::temp_directory_path() / "yadomsBackup";
 
          //if folder exist, cleanup, else create if
@@ -108,80 +118,70 @@ namespace task
             YADOMS_LOG(error) << "Fail to create folder " << backupTempFolder;
             throw shared::exception::CException("fail to create temp backup folder");
          }
-         OnProgressionUpdatedInternal(0, 100, 0.0f, 1.0f, i18n::CClientStrings::BackupPrepare);
-         return backupTempFolder;
-      }
 
-      bool CBackup::backupFiles(boost::filesystem::path & backupTempFolder)
-      {
-         //backup database (1 -> 40%)
-         if (m_dataBackupInterface->backupSupported())
+         //create if needed a backup folder
+         if (!boost::filesystem::exists(m_pathProvider->backupPath()))
          {
-            m_dataBackupInterface->backupData(backupTempFolder.string(), [&](int remaining, int total, std::string i18nMessage, std::string error)
-            {
-               OnProgressionUpdatedInternal(remaining, total, 1.0f, 40.0f, i18n::CClientStrings::BackupCopyFile);
-            });
+            boost::filesystem::create_directory(m_pathProvider->backupPath());
          }
          else
          {
-            //database backup not supported
+            YADOMS_LOG(debug) << "Folder " << m_pathProvider->backupPath().string() << " already exists. Do not create it";
          }
 
-         //backup scripts (40 -> 50%)
-         if (tools::CFileSystem::copyDirectoryRecursivelyTo(m_pathProvider->scriptsPath(), backupTempFolder / "scripts"))
-         {
-            OnProgressionUpdatedInternal(0, 100, 40.0f, 50.0f, i18n::CClientStrings::BackupCopyFile);
+         OnProgressionUpdatedInternal(0, 100, 0.0f, 1.0f, i18n::CClientStrings::BackupPrepare);
+         return backupTempFolder;
+      }
 
-            //backup plugins data  (50 -> 60%)
-            if (tools::CFileSystem::copyDirectoryRecursivelyTo(m_pathProvider->pluginsDataPath(), backupTempFolder / "data"))
-            {
-               boost::system::error_code ec;
-               boost::filesystem::copy_file("yadoms.ini", backupTempFolder / "yadoms.ini", ec);
-               OnProgressionUpdatedInternal(0, 100, 50.0f, 60.0f, i18n::CClientStrings::BackupCopyFile);
-
-
-               //create if needed a backup folder
-               if (!boost::filesystem::exists(m_pathProvider->backupPath()))
-               {
-                  boost::filesystem::create_directory(m_pathProvider->backupPath());
-               }
-               else
-               {
-                  YADOMS_LOG(debug) << "Folder " << m_pathProvider->backupPath().string() << " already exists. Do not create it";
-               }
-               return true;
-            }
-            else
-            {
-               YADOMS_LOG(error) << "Fail to copy plugins data to temp folder";
-            }
-         }
-         else 
+      void CBackup::backupDatabase(const boost::filesystem::path & backupTempFolder, const boost::posix_time::ptime & since)
+      {
+         //backup database (1 -> 60%)
+         if (!m_dataBackupInterface->backupSupported())
+            return;
+
+         const auto reporter = [&](int remaining, int total, std::string i18nMessage, std::string error)
          {
-            YADOMS_LOG(error) << "Fail to copy scripts to temp folder";
-         }
-         return false;
+            OnProgressionUpdatedInternal(remaining, total, 1.0f, 60.0f, i18n::CClientStrings::BackupCopyFile);
+         };
+
+         if (since.is_not_a_date_time())
+            m_dataBackupInterface->backupData(backupTempFolder.string(), reporter);
+         else
+            m_dataBackupInterface->backupAcquisitionsSince(backupTempFolder.string(), since, reporter);
       }
 
-      boost::filesystem::path CBackup::makeZipArchive(boost::filesystem::path & backupTempFolder)
+      boost::filesystem::path CBackup::makeZipArchive(const boost::filesystem::path & backupTempFolder, const boost::posix_time::ptime & backupDate, bool incremental)
       {
 
-         //zip folder content (60 -> 99)
-         std::string dateAsIsoString = boost::posix_time::to_iso_string(shared::currentTime::Provider().now());
-         boost::replace_all(dateAsIsoString, ",", "_");
-
-         boost::filesystem::path zipFilenameFinal = m_pathProvider->backupPath() / (boost::format("backup_%1%.zip") % dateAsIsoString).str();
-         boost::filesystem::path zipFilename = m_pathProvider->backupPath() / (boost::format("backup_%1%.zip.inprogress") % dateAsIsoString).str();
+         //zip folder content (60 -> 98)
+         boost::filesystem::path zipFilenameFinal = m_pathProvider->backupPath() / CBackupFile::name(backupDate, incremental);
+         boost::filesystem::path zipFilename = m_pathProvider->backupPath() / (CBackupFile::name(backupDate, incremental) + ".inprogress");
          try
          {
             //count files
-            m_fileCountToZip = std::count_if(boost::filesystem::recursive_directory_iterator(backupTempFolder), boost::filesystem::recursive_directory_iterator(), static_cast<bool(*)(const boost::filesystem::path&)>(boost::filesystem::is_regular_file));
+            m_fileCountToZip = countFiles(backupTempFolder);
+            if (!incremental)
+               m_fileCountToZip += countFiles(m_pathProvider->scriptsPath()) + countFiles(m_pathProvider->pluginsDataPath());
             m_currentFileCount = 0;
 
             std::ofstream out(zipFilename.string(), std::ios::binary);
             Poco::Zip::Compress c(out, true);
             c.EDone += Poco::Delegate<CBackup, const Poco::Zip::ZipLocalFileHeader>(this, &CBackup::onZipEDone);
-            c.addRecursive(backupTempFolder.string());
+
+            //database copy
+            c.addRecursive(Poco::Path(backupTempFolder.string()));
+
+            //files are read from their location, no temporary copy
+            if (!incremental)
+            {
+               if (boost::filesystem::is_directory(m_pathProvider->scriptsPath()))
+                  c.addRecursive(Poco::Path(m_pathProvider->scriptsPath().string()), Poco::Zip::ZipCommon::CM_DEFLATE, Poco::Zip::ZipCommon::CL_MAXIMUM, true, Poco::Path("scripts"));
+               if (boost::filesystem::is_directory(m_pathProvider->pluginsDataPath()))
+                  c.addRecursive(Poco::Path(m_pathProvider->pluginsDataPath().string()), Poco::Zip::ZipCommon::CM_DEFLATE, Poco::Zip::ZipCommon::CL_MAXIMUM, true, Poco::Path("data"));
+               if (boost::filesystem::is_regular_file("yadoms.ini"))
+                  c.addFile(Poco::Path("yadoms.ini"), Poco::Path("yadoms.ini"));
+            }
+
             c.EDone -= Poco::Delegate<CBackup, const Poco::Zip::ZipLocalFileHeader>(this, &CBackup::onZipEDone);
             c.close(); // MUST be done to finalize the Zip file
             OnProgressionUpdatedInternal(0, 100, 60.0f, 98.0f, i18n::CClientStrings::BackupCompress);
@@ -216,6 +216,15 @@ namespace task
         
       }
 
+      int CBackup::countFiles(const boost::filesystem::path & folder)
+      {
+         if (!boost::filesystem::is_directory(folder))
+            return 0;
+         return static_cast<int>(std::count_if(boost::filesystem::recursive_directory_iterator(folder),
+                                               boost::filesystem::recursive_directory_iterator(),
+                                               [](const boost::filesystem::directory_entry& entry) { return boost::filesystem::is_regular_file(entry.status()); }));
+      }
+
       void CBackup::onZipEDone(const void* pSender, const Poco::Zip::ZipLocalFileHeader& hdr)
       {
          if (hdr.isFile())
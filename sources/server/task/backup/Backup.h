@@ -16,8 +16,11 @@ namespace task
       public:
          //------------------------------------------
          ///\brief   Constructor
+         ///\param [in] pathProvider          The path provider
+         ///\param [in] dataBackupInterface   The database backup interface
+         ///\param [in] incremental           true to only backup acquisitions recorded since the last backup
          //------------------------------------------
-         explicit CBackup(boost::shared_ptr<const IPathProvider> pathProvider, boost::shared_ptr<database::IDataBackup> dataBackupInterface);
+         CBackup(boost::shared_ptr<const IPathProvider> pathProvider, boost::shared_ptr<database::IDataBackup> dataBackupInterface, bool incremental = false);
 
          //------------------------------------------
          ///\brief   Destructor
@@ -32,10 +35,17 @@ namespace task
       private:
          void doWork(int currentTry = 0);
          boost::filesystem::path prepareBackup() const;
-         bool backupFiles(boost::filesystem::path & tempPath);
-         boost::filesystem::path makeZipArchive(boost::filesystem::path & tempPath);
+         void backupDatabase(const boost::filesystem::path & tempPath, const boost::posix_time::ptime & since);
+         boost::filesystem::path makeZipArchive(const boost::filesystem::path & tempPath, const boost::posix_time::ptime & backupDate, bool incremental);
          void cleanup(boost::filesystem::path & tempPath) const;
 
+         //------------------------------------------
+         ///\brief   Count the files of a folder (recursively)
+         ///\param [in] folder  The folder (can be non existing)
+         ///\return  The file count
+         //------------------------------------------
+         static int countFiles(const boost::filesystem::path & folder);
+
          //------------------------------------------
          ///\brief   Internal progress handler 
          ///\param [in] remaining   The remaining count (between 0 and total) for current operation
@@ -67,6 +77,11 @@ namespace task
          //------------------------------------------
          boost::shared_ptr<database::IDataBackup> m_dataBackupInterface;
 
+         //------------------------------------------
+         ///\brief   true for an incremental backup
+         //------------------------------------------
+         bool m_incremental;
+
          //------------------------------------------
          ///\brief   The function pointer for reporting progression
          //------------------------------------------
@@ -0,0 +1,53 @@
+#include "stdafx.h"
+#include "BackupFile.h"
+#include <shared/Log.h>
+
+namespace task
+{
+   namespace backup
+   {
+      std::string CBackupFile::name(const boost::posix_time::ptime& backupDate, bool incremental)
+      {
+         auto dateAsIsoString = boost::posix_time::to_iso_string(backupDate);
+         boost::replace_all(dateAsIsoString, ",", "_");
+         return (boost::format("backup_%1%%2%.zip") % dateAsIsoString % (incremental ? "_incremental" : "")).str();
+      }
+
+      boost::posix_time::ptime CBackupFile::date(const std::string& filename)
+      {
+         static const boost::regex BackupFilePattern("backup_([0-9]{8}T[0-9]{6})[0-9_.]*(_incremental)?\\.zip");
+
+         boost::smatch match;
+         if (!boost::regex_match(filename, match, BackupFilePattern))
+            return boost::posix_time::ptime(boost::posix_time::not_a_date_time);
+
+         try
+         {
+            return boost::posix_time::from_iso_string(match[1]);
+         }
+         catch (std::exception&)
+         {
+            YADOMS_LOG(warning) << "Ignore backup file with invalid date : " << filename;
+            return boost::posix_time::ptime(boost::posix_time::not_a_date_time);
+         }
+      }
+
+      boost::posix_time::ptime CBackupFile::lastBackupDate(const boost::filesystem::path& backupFolder)
+      {
+         auto lastDate = boost::posix_time::ptime(boost::posix_time::not_a_date_time);
+         if (!boost::filesystem::is_directory(backupFolder))
+            return lastDate;
+
+         for (boost::filesystem::directory_iterator i(backupFolder); i != boost::filesystem::directory_iterator(); ++i)
+         {
+            if (!boost::filesystem::is_regular_file(i->path()))
+               continue;
+
+            const auto backupDate = date(i->path().filename().string());
+            if (!backupDate.is_not_a_date_time() && (lastDate.is_not_a_date_time() || backupDate > lastDate))
+               lastDate = backupDate;
+         }
+         return lastDate;
+      }
+   } //namespace backup
+} //namespace task
@@ -0,0 +1,38 @@
+#pragma once
+
+namespace task
+{
+   namespace backup
+   {
+      //------------------------------------------
+      ///\brief   Backup files naming
+      ///
+      /// Backup files are named "backup_{iso date}[_{fractional seconds}][_incremental].zip"
+      //------------------------------------------
+      class CBackupFile
+      {
+      public:
+         //------------------------------------------
+         ///\brief   Get the file name of a backup
+         ///\param [in] backupDate  The backup date
+         ///\param [in] incremental true for an incremental backup
+         ///\return  The file name
+         //------------------------------------------
+         static std::string name(const boost::posix_time::ptime& backupDate, bool incremental);
+
+         //------------------------------------------
+         ///\brief   Get the date of a backup from its file name
+         ///\param [in] filename    The file name
+         ///\return  The backup date (not_a_date_time if not a backup file)
+         //------------------------------------------
+         static boost::posix_time::ptime date(const std::string& filename);
+
+         //------------------------------------------
+         ///\brief   Get the date of the last backup found in a folder
+         ///\param [in] backupFolder The backup folder (can be non existing)
+         ///\return  The last backup date (not_a_date_time if no backup found)
+         //------------------------------------------
+         static boost::posix_time::ptime lastBackupDate(const boost::filesystem::path& backupFolder);
+      };
+   } //namespace backup
+} //namespace task
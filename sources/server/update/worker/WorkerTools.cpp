@@ -10,6 +10,7 @@
 #include "tools/FileSystem.h"
 #include <shared/web/UriHelpers.h>
 #include <shared/web/FileDownloader.h>
+#include <shared/web/PackageDownloader.h>
 #include <shared/compression/Extract.h>
 
 #include "startupOptions/IStartupOptions.h"
@@ -35,6 +36,18 @@ namespace update
                                          boost::bind(&CWorkerTools::reportDownloadProgress, _1, _2, callback, function, min, max));
       }
 
+      Poco::Path CWorkerTools::downloadAndExtractPackage(const std::string& downloadUrl, const std::string& md5Hash, WorkerProgressFunc callback,
+                                                         const std::string& function, float min, float max)
+      {
+         auto targetPath(tools::CFileSystem::createTemporaryFolder());
+         targetPath /= "package";
+
+         return shared::web::PackageDownloader().downloadAndExtract(Poco::URI(downloadUrl),
+                                                                    Poco::Path::forDirectory(targetPath.string()),
+                                                                    md5Hash,
+                                                                    boost::bind(&CWorkerTools::reportDownloadProgress, _1, _2, callback, function, min, max));
+      }
+
       Poco::Path CWorkerTools::downloadPackage(const std::string& downloadUrl)
       {
          return downloadPackage(downloadUrl, boost::bind(&shared::web::CFileDownloader::reportProgressToLog, _1, _2));
@@ -68,7 +81,7 @@ namespace update
          targetPath /= packageName;
          const auto outPath = Poco::Path(targetPath.string());
 
-         shared::web::CFileDownloader::downloadFileAndVerify(toDownload, outPath, md5Hash, progressReporter);
+         shared::web::PackageDownloader().downloadAndVerify(toDownload, outPath, md5Hash, progressReporter);
          return outPath;
       }
 
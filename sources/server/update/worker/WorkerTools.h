@@ -40,6 +40,19 @@ namespace update
          static Poco::Path downloadPackageAndVerify(const std::string& downloadUrl, const std::string& md5Hash, WorkerProgressFunc callback,
                                                     const std::string& function, float min, float max);
 
+         //---------------------------------------------
+         ///\brief   Download a package, verify and extract it (tar.gz packages are extracted while downloading)
+         ///\param [in] downloadUrl The downloaded package URL
+         ///\param [in] md5Hash     The expected md5hash
+         ///\param [in] callback    The callback to use
+         ///\param [in] function    The i18n string to send to callback (ex: update.plugin.download)
+         ///\param [in] min         The global progression when download start
+         ///\param [in] max         The global progression when download ends
+         ///\return The extracted package folder
+         //---------------------------------------------
+         static Poco::Path downloadAndExtractPackage(const std::string& downloadUrl, const std::string& md5Hash, WorkerProgressFunc callback,
+                                                     const std::string& function, float min, float max);
+
          //---------------------------------------------
          ///\brief   Download a package (report progress to log)
          ///\param [in] downloadUrl  The downloaded package URL
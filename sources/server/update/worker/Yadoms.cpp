@@ -3,7 +3,7 @@
 #include <shared/Log.h>
 #include <shared/ServiceLocator.h>
 #include <Poco/Process.h>
-#include <shared/compression/Extract.h>
+#include <shared/exception/Extract.hpp>
 #include "tools/FileSystem.h"
 #include "i18n/ClientStrings.h"
 #include <shared/process/SoftwareStop.h> 
@@ -30,74 +30,60 @@ namespace update
 
          //////////////////////////////////////////////////////////
          // STEP2 : download package file
+         // STEP3 : extract package (while downloading)
          //////////////////////////////////////////////////////////
 
          try
          {
             YADOMS_LOG(information) << "Downloading package " << downloadUrl;
             progressCallback(true, 0.0f, i18n::CClientStrings::UpdateYadomsDownload, std::string(), callbackData);
-            auto downloadedPackage = CWorkerTools::downloadPackageAndVerify(downloadUrl, expectedMd5Hash, progressCallback,
-                                                                            i18n::CClientStrings::UpdateYadomsDownload, 0.0, 50.0);
-            YADOMS_LOG(information) << "Package successfully downloaded into " << downloadedPackage.toString();
+            auto extractedPackageLocation = CWorkerTools::downloadAndExtractPackage(downloadUrl, expectedMd5Hash, progressCallback,
+                                                                                    i18n::CClientStrings::UpdateYadomsDownload, 0.0, 90.0);
+            YADOMS_LOG(information) << "Package successfully extracted into " << extractedPackageLocation.toString();
 
             //////////////////////////////////////////////////////////
-            // STEP3 : extract package
+            // STEP4 : run updater command
             //////////////////////////////////////////////////////////
             try
             {
-               YADOMS_LOG(information) << "Extracting downloaded package";
+               YADOMS_LOG(information) << "Find update command";
+               shared::CDataContainer packageJson;
+               packageJson.deserializeFromFile(Poco::Path(extractedPackageLocation, "package.json").toString());
+               const auto& commandToRun = packageJson.get<std::string>("yadoms.information.commandToRun");
 
-               progressCallback(true, 50.0f, i18n::CClientStrings::UpdateYadomsExtract, std::string(), callbackData);
-               shared::compression::CExtract unZipper;
-               auto extractedPackageLocation = unZipper.here(downloadedPackage);
+               YADOMS_LOG(information) << "Running updater";
+               progressCallback(true, 90.0f, i18n::CClientStrings::UpdateYadomsDeploy, std::string(), callbackData);
+               step4RunUpdaterProcess(extractedPackageLocation, commandToRun, runningInformation);
 
                //////////////////////////////////////////////////////////
-               // STEP4 : run updater command
+               // STEP5 : exit yadoms
                //////////////////////////////////////////////////////////
-               try
-               {
-                  YADOMS_LOG(information) << "Find update command";
-                  shared::CDataContainer packageJson;
-                  packageJson.deserializeFromFile(Poco::Path(extractedPackageLocation, "package.json").toString());
-                  const auto& commandToRun = packageJson.get<std::string>("yadoms.information.commandToRun");
-
-                  YADOMS_LOG(information) << "Running updater";
-                  progressCallback(true, 90.0f, i18n::CClientStrings::UpdateYadomsDeploy, std::string(), callbackData);
-                  step4RunUpdaterProcess(extractedPackageLocation, commandToRun, runningInformation);
-
-                  //////////////////////////////////////////////////////////
-                  // STEP5 : exit yadoms
-                  //////////////////////////////////////////////////////////
-
-                  //exit yadoms
-                  YADOMS_LOG(information) << "Exiting Yadoms";
-                  progressCallback(true, 100.0f, i18n::CClientStrings::UpdateYadomsExit, std::string(), callbackData);
-
-                  //sleep 1 sec, to ensure clients receive last notification
-                  boost::this_thread::sleep(boost::posix_time::seconds(1));
-
-                  //ask to close application (asynchronously as Yadoms will want to free all resources now and CSoftwareStop::stop blocks)
-                  boost::thread asyncStop(&shared::process::CSoftwareStop::stop);
-               }
-               catch (std::exception& ex)
-               {
-                  //fail to run updater
-                  YADOMS_LOG(error) << "Fail to run updater : " << ex.what();
-                  progressCallback(false, 100.0f, i18n::CClientStrings::UpdateYadomsDeployFailed, ex.what(), callbackData);
-
-                  //remove folder
-                  tools::CFileSystem::remove(extractedPackageLocation, true);
-               }
+
+               //exit yadoms
+               YADOMS_LOG(information) << "Exiting Yadoms";
+               progressCallback(true, 100.0f, i18n::CClientStrings::UpdateYadomsExit, std::string(), callbackData);
+
+               //sleep 1 sec, to ensure clients receive last notification
+               boost::this_thread::sleep(boost::posix_time::seconds(1));
+
+               //ask to close application (asynchronously as Yadoms will want to free all resources now and CSoftwareStop::stop blocks)
+               boost::thread asyncStop(&shared::process::CSoftwareStop::stop);
             }
             catch (std::exception& ex)
             {
-               //fail to download package
-               YADOMS_LOG(error) << "Fail to extract package : " << ex.what();
-               progressCallback(false, 100.0f, i18n::CClientStrings::UpdateYadomsExtractFailed, ex.what(), callbackData);
-            }
+               //fail to run updater
+               YADOMS_LOG(error) << "Fail to run updater : " << ex.what();
+               progressCallback(false, 100.0f, i18n::CClientStrings::UpdateYadomsDeployFailed, ex.what(), callbackData);
 
-            //no more need downloaded zip package
-            tools::CFileSystem::remove(downloadedPackage, false);
+               //remove folder
+               tools::CFileSystem::remove(extractedPackageLocation, true);
+            }
+         }
+         catch (shared::exception::CExtract& ex)
+         {
+            //fail to extract package
+            YADOMS_LOG(error) << "Fail to extract package : " << ex.what();
+            progressCallback(false, 100.0f, i18n::CClientStrings::UpdateYadomsExtractFailed, ex.what(), callbackData);
          }
          catch (std::exception& ex)
          {
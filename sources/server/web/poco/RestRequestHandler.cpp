@@ -2,6 +2,7 @@
 #include "RestRequestHandler.h"
 #include <shared/Log.h>
 #include "web/rest/Result.h"
+#include "web/rest/StringContainer.h"
 #include <Poco/URI.h>
 
 namespace web
@@ -56,8 +57,11 @@ namespace web
          return results;
       }
 
-      std::string CRestRequestHandler::manageRestRequests(Poco::Net::HTTPServerRequest& request)
+      std::string CRestRequestHandler::manageRestRequests(Poco::Net::HTTPServerRequest& request,
+                                                          std::string& contentType)
       {
+         contentType = "application/json";
+
          // Decode url to path.
          std::string request_path = request.getURI();
 
@@ -81,6 +85,12 @@ namespace web
             //dispatch url to rest dispatcher
             auto js = m_restDispatcher.dispath(request.getMethod(), parameters, content);
             std::string temp = js->serialize();
+
+            //some answers are not JSON (ie : metrics in Prometheus format)
+            auto stringContainer = boost::dynamic_pointer_cast<rest::CStringContainer>(js);
+            if (stringContainer)
+               contentType = stringContainer->contentType();
+
             return temp;
          }
 
@@ -101,8 +111,9 @@ namespace web
       {
          YADOMS_LOG(trace) << "Rest request : [" << request.getMethod() << "] : " << request.getURI();
 
-         std::string answer = manageRestRequests(request);
-         response.setContentType("application/json");
+         std::string contentType;
+         std::string answer = manageRestRequests(request, contentType);
+         response.setContentType(contentType);
          std::ostream& ostr = response.send();
          ostr << answer;
       }
@@ -52,8 +52,12 @@ namespace web
 
          //--------------------------------------   
          ///\brief  Method which handle rest requests
+         ///\param [in]    request        the request
+         ///\param [out]   contentType    the MIME type of the answer
+         ///\return the answer
          //--------------------------------------   
-         std::string manageRestRequests(Poco::Net::HTTPServerRequest& request);
+         std::string manageRestRequests(Poco::Net::HTTPServerRequest& request,
+                                        std::string& contentType);
 
 
          //--------------------------------------   
@@ -5,6 +5,8 @@
 
 #include <shared/Log.h>
 #include <shared/event/EventHandler.hpp>
+#include <shared/metrics/MetricsRegistry.h>
+#include <shared/metrics/ScopedLatency.h>
 
 #include "web/ws/FrameFactory.h"
 #include "web/ws/AcquisitionFilterFrame.h"
@@ -31,6 +33,23 @@ namespace web
 {
    namespace poco
    {
+      namespace
+      {
+         shared::metrics::CGauge& connectionsCount()
+         {
+            static auto& Gauge = shared::metrics::CMetricsRegistry::instance().gauge("yadoms_websocket_connections",
+                                                                                     "Number of connected websocket clients");
+            return Gauge;
+         }
+
+         shared::metrics::CGauge& sendQueuesSize()
+         {
+            static auto& Gauge = shared::metrics::CMetricsRegistry::instance().gauge("yadoms_websocket_send_queue_size",
+                                                                                     "Number of events waiting to be sent, for all websocket clients");
+            return Gauge;
+         }
+      }
+
       CWebSocketRequestHandler::CWebSocketRequestHandler()
       {
       }
@@ -50,6 +69,9 @@ namespace web
          boost::thread wsReceiverThread;
          auto eventHandler = boost::make_shared<shared::event::CEventHandler>();
 
+         connectionsCount().increment();
+         long long sendQueueSize = 0;
+
          // For each request (each time a new ws connexion is made),
          // just create a websocket server and wait infinite (until client ends)
          try
@@ -127,7 +149,14 @@ namespace web
             while (clientSeemConnected)
             {
                //manage server send to websocket data
-               switch (eventHandler->waitForEvents())
+               const auto eventId = eventHandler->waitForEvents();
+
+               // Contribution of this client to the total of events waiting to be sent
+               const auto newSendQueueSize = static_cast<long long>(eventHandler->size());
+               sendQueuesSize().increment(newSendQueueSize - sendQueueSize);
+               sendQueueSize = newSendQueueSize;
+
+               switch (eventId)
                {
                case kConnectionLost:
                   {
@@ -304,6 +333,9 @@ namespace web
          for (const auto& observer : observers)
             notification::CHelpers::unsubscribeObserver(observer);
 
+         sendQueuesSize().decrement(sendQueueSize);
+         connectionsCount().decrement();
+
          YADOMS_LOG(information) << "Websocket client lost";
       }
 
@@ -397,6 +429,10 @@ namespace web
       bool CWebSocketRequestHandler::send(boost::shared_ptr<Poco::Net::WebSocket> webSocket,
                                           const ws::CFrameBase& toSend)
       {
+         static auto& SendLatency = shared::metrics::CMetricsRegistry::instance().histogram("yadoms_websocket_send_duration_seconds",
+                                                                                           "Time to serialize and send a frame to a websocket client");
+         shared::metrics::CScopedLatency latency(SendLatency);
+
          auto dataString = toSend.serialize();
          return (webSocket->sendFrame(dataString.c_str(),
                                       dataString.length(),
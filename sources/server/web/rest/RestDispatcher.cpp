@@ -2,6 +2,8 @@
 #include "RestDispatcher.h"
 #include "Result.h"
 #include <shared/Log.h>
+#include <shared/metrics/MetricsRegistry.h>
+#include <shared/metrics/ScopedLatency.h>
 
 namespace web { namespace rest {
 
@@ -16,12 +18,15 @@ namespace web { namespace rest {
 
    void CRestDispatcher::registerRestMethodHandler(const std::string & requestType, const std::vector<std::string> & configKeywords, CRestMethodHandler functionPtr, CRestMethodIndirector indirectPtr /*= NULL*/)
    {
-      m_handledFunctions[requestType].insert( CUrlPattern(configKeywords, functionPtr, indirectPtr) );
+      m_handledFunctions[requestType].insert( CUrlPattern(requestType, configKeywords, functionPtr, indirectPtr) );
    }
 
 
-   CRestDispatcher::CUrlPattern::CUrlPattern(const std::vector<std::string> & pattern, CRestMethodHandler & handler, CRestMethodIndirector & indirector)
-      :m_pattern(pattern), m_methodHandler(handler), m_methodIndirector(indirector)
+   CRestDispatcher::CUrlPattern::CUrlPattern(const std::string & requestType, const std::vector<std::string> & pattern, CRestMethodHandler & handler, CRestMethodIndirector & indirector)
+      :m_pattern(pattern), m_methodHandler(handler), m_methodIndirector(indirector),
+      m_latency(&shared::metrics::CMetricsRegistry::instance().histogram("yadoms_rest_request_duration_seconds",
+                                                                         "Time to process a REST request, by route",
+                                                                         {{"method", requestType}, {"route", toString()}}))
    {
    }
 
@@ -41,6 +46,10 @@ namespace web { namespace rest {
    { 
       return m_methodIndirector; 
    }
+   shared::metrics::CLatencyHistogram &  CRestDispatcher::CUrlPattern::getLatency() const 
+   { 
+      return *m_latency; 
+   }
 
 
 
@@ -113,6 +122,7 @@ namespace web { namespace rest {
          {
             if(match(url, *iPatterns))
             {
+               shared::metrics::CScopedLatency latency(iPatterns->getLatency());
                return callRealMethod(iPatterns->getMethodHandler(), iPatterns->getMethodIndirector(), url, requestContent);
             }
          }
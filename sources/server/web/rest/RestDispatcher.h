@@ -2,6 +2,7 @@
 
 #include <shared/DataContainer.h>
 #include <shared/serialization/IDataSerializable.h>
+#include <shared/metrics/LatencyHistogram.h>
 
 namespace web { namespace rest {
 
@@ -66,11 +67,12 @@ namespace web { namespace rest {
       public:
          //--------------------------------------   
          ///\brief   Constructor
+         ///\param [in]    requestType       the type of request, usually GET, PUT, POST or DELETE
          ///\param [in]    pattern           the url pattern : ie. : /widget/*/acquisitions
          ///\param [in]    functionPtr       the function pointer to call when url match configuration pattern
          ///\param [in]    indirectPtr       the function pointer which will call the functionPtr (indirect so some common process can be handled in this function)
          //-------------------------------------- 
-         CUrlPattern(const std::vector<std::string> & pattern, CRestMethodHandler & handler, CRestMethodIndirector & indirector);
+         CUrlPattern(const std::string & requestType, const std::vector<std::string> & pattern, CRestMethodHandler & handler, CRestMethodIndirector & indirector);
 
          //--------------------------------------   
          ///\brief   Destructor
@@ -95,6 +97,12 @@ namespace web { namespace rest {
          //--------------------------------------
          const CRestMethodIndirector & getMethodIndirector() const;
 
+         //--------------------------------------   
+         ///\brief   Get the latency histogram of this route
+         ///\return  the histogram
+         //--------------------------------------
+         shared::metrics::CLatencyHistogram & getLatency() const;
+
          //--------------------------------------   
          ///\brief   Operator <   Allow automatic sorting in std::map or std::set
          ///\param [in] right The object to compare to
@@ -123,6 +131,11 @@ namespace web { namespace rest {
          ///\brief   The indirector function pointer
          //--------------------------------------
          CRestMethodIndirector m_methodIndirector;
+
+         //--------------------------------------   
+         ///\brief   The latency histogram (owned by the metrics registry)
+         //--------------------------------------
+         shared::metrics::CLatencyHistogram* m_latency;
       };
 
       //--------------------------------------   
@@ -1,5 +1,6 @@
 #include "stdafx.h"
 #include "Result.h"
+#include "StringContainer.h"
 
 namespace web { namespace rest { 
 
@@ -29,6 +30,32 @@ namespace web { namespace rest {
       return GenerateInternal(true, std::string(), stringData);
    }
 
+   boost::shared_ptr<shared::serialization::IDataSerializable> CResult::GenerateSuccessSerialized(const std::string & dataName, const std::string & serializedData)
+   {
+      //same layout as GenerateSuccess, without parsing the data again
+      std::string content;
+      content.reserve(serializedData.size() + dataName.size() + 64);
+      content += "{\"" + m_resultFieldName + "\":\"true\",\"" + m_errorMessageFieldName + "\":\"\",\"" + m_dataFieldName + "\":{\"" + dataName + "\":";
+      content += serializedData;
+      content += "}}";
+      return boost::make_shared<CStringContainer>(content);
+   }
+
+   boost::shared_ptr<shared::serialization::IDataSerializable> CResult::GenerateSuccessSerialized(const std::vector<std::pair<std::string, std::string>> & serializedData)
+   {
+      std::string content;
+      content += "{\"" + m_resultFieldName + "\":\"true\",\"" + m_errorMessageFieldName + "\":\"\",\"" + m_dataFieldName + "\":{";
+      for (auto data = serializedData.begin(); data != serializedData.end(); ++data)
+      {
+         if (data != serializedData.begin())
+            content += ",";
+         content += "\"" + data->first + "\":";
+         content += data->second;
+      }
+      content += "}}";
+      return boost::make_shared<CStringContainer>(content);
+   }
+
    boost::shared_ptr<shared::CDataContainer> CResult::GenerateInternal(const bool result, const std::string & message, const shared::CDataContainer & data)
    {
       boost::shared_ptr<shared::CDataContainer> error = boost::make_shared<shared::CDataContainer>();
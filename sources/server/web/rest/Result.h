@@ -47,6 +47,21 @@ namespace web { namespace rest {
       //-----------------------------------------
       static boost::shared_ptr<shared::CDataContainer> GenerateSuccess(const std::string & stringData);
 
+      //-----------------------------------------
+      ///\brief   Generate a success JSON message from already serialized data
+      ///\param [in] dataName : the name of the data
+      ///\param [in] serializedData : the data, serialized as JSON
+      ///\return  the message, sent as is
+      //-----------------------------------------
+      static boost::shared_ptr<shared::serialization::IDataSerializable> GenerateSuccessSerialized(const std::string & dataName, const std::string & serializedData);
+
+      //-----------------------------------------
+      ///\brief   Generate a success JSON message from several already serialized data
+      ///\param [in] serializedData : the data names and values, serialized as JSON
+      ///\return  the message, sent as is
+      //-----------------------------------------
+      static boost::shared_ptr<shared::serialization::IDataSerializable> GenerateSuccessSerialized(const std::vector<std::pair<std::string, std::string>> & serializedData);
+
       //-----------------------------------------
       ///\brief   Generate a success JSON message
       ///\param [in] data : a datacontainable object
@@ -3,8 +3,8 @@
 
 namespace web { namespace rest { 
 
-   CStringContainer::CStringContainer(const std::string & content)
-      :m_content(content)
+   CStringContainer::CStringContainer(const std::string & content, const std::string & contentType)
+      :m_content(content), m_contentType(contentType)
    {
    }
 
@@ -21,5 +21,10 @@ namespace web { namespace rest {
       m_content = data;
    }
 
+   const std::string & CStringContainer::contentType() const
+   {
+      return m_contentType;
+   }
+
 } //namespace rest
 } //namespace web 
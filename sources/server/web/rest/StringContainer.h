@@ -8,7 +8,7 @@ namespace web { namespace rest {
    class CStringContainer : public shared::serialization::IDataSerializable
    {
    public:
-      explicit CStringContainer(const std::string & content);
+      explicit CStringContainer(const std::string & content, const std::string & contentType = "application/json");
       virtual ~CStringContainer();
 
    public:
@@ -17,8 +17,14 @@ namespace web { namespace rest {
       void deserialize(const std::string & data) override;
       // [END] IDataSerializable implementation 
 
+      //-----------------------------------------
+      ///\brief   Get the MIME type of the content
+      //-----------------------------------------
+      const std::string & contentType() const;
+
    private:
       std::string m_content;
+      std::string m_contentType;
    };
 
 } //namespace rest
@@ -16,8 +16,10 @@ namespace web
          std::string CAcquisition::m_restKeyword = std::string("acquisition");
 
 
-         CAcquisition::CAcquisition(boost::shared_ptr<database::IDataProvider> dataProvider)
-            : m_dataProvider(dataProvider)
+         CAcquisition::CAcquisition(boost::shared_ptr<database::IDataProvider> dataProvider,
+                                    boost::shared_ptr<dataAccessLayer::IKeywordManager> keywordManager)
+            : m_dataProvider(dataProvider),
+              m_keywordManager(keywordManager)
          {
          }
 
@@ -63,7 +65,7 @@ namespace web
                if (parameters.size() > 2)
                {
                   auto keywordId = boost::lexical_cast<int>(parameters[2]);
-                  auto acq = m_dataProvider->getKeywordRequester()->getKeywordLastAcquisition(keywordId);
+                  auto acq = m_keywordManager->getKeywordLastAcquisition(keywordId);
                   return CResult::GenerateSuccess(acq);
                }
                return CResult::GenerateError("invalid parameter. Can not retreive acquisitionId in url");
@@ -114,47 +116,25 @@ namespace web
                      sort(list.begin(), list.end());
                      list.erase(unique(list.begin(), list.end()), list.end());
 
+                     //all last values are read at the same time, from memory
+                     const auto lastAcquisitions = m_keywordManager->getKeywordsLastAcquisition(list);
+
                      shared::CDataContainer result;
                      for (auto i = list.begin(); i != list.end(); ++i)
                      {
-                        try
+                        const auto lastData = lastAcquisitions.find(*i);
+                        if (lastData != lastAcquisitions.end())
                         {
-                           auto lastData = m_dataProvider->getKeywordRequester()->getKeywordLastAcquisition(*i, false);
-                           if (lastData)
-                           {
-                              result.set(boost::lexical_cast<std::string>(*i),
-                                         lastData);
-                           }
-                           else
-                           {
-                              try {
-                                 auto keyword = m_dataProvider->getKeywordRequester()->getKeyword(*i);
-
-                                 if (keyword)
-                                 {
-                                    shared::CDataContainer emptyResult;
-                                    emptyResult.set("keywordId", *i);
-                                    result.set(boost::lexical_cast<std::string>(*i),
-                                               emptyResult);
-                                 }
-                              }
-                              catch(std::exception& /*nokeyword*/)
-                              {
-                                 shared::CDataContainer noKeyword;
-                                 noKeyword.set("keywordId", *i);
-                                 noKeyword.set("error", "keyword id doesn't exist");
-                                 result.set(boost::lexical_cast<std::string>(*i),
-                                            noKeyword);
-                              }
-                           }
+                           result.set(boost::lexical_cast<std::string>(*i),
+                                      lastData->second);
                         }
-                        catch (std::exception& /*noData*/)
+                        else
                         {
-                           //ensure returning entity object, because we need to indicate that a keyword have no data, not others (in case of multiple keyword without data)
-                           shared::CDataContainer emptyResult;
-                           emptyResult.set("keywordId", *i);
+                           shared::CDataContainer noKeyword;
+                           noKeyword.set("keywordId", *i);
+                           noKeyword.set("error", "keyword id doesn't exist");
                            result.set(boost::lexical_cast<std::string>(*i),
-                                      emptyResult);
+                                      noKeyword);
                         }
                      }
                      return CResult::GenerateSuccess(result);
@@ -2,6 +2,7 @@
 
 #include "IRestService.h"
 #include "database/IDataProvider.h"
+#include "dataAccessLayer/IKeywordManager.h"
 
 namespace web
 {
@@ -12,7 +13,8 @@ namespace web
          class CAcquisition : public IRestService
          {
          public:
-            explicit CAcquisition(boost::shared_ptr<database::IDataProvider> dataProvider);
+            CAcquisition(boost::shared_ptr<database::IDataProvider> dataProvider,
+                         boost::shared_ptr<dataAccessLayer::IKeywordManager> keywordManager);
             virtual ~CAcquisition();
 
          public:
@@ -66,6 +68,7 @@ namespace web
                                                                                              const std::string& requestContent) const;
 
             boost::shared_ptr<database::IDataProvider> m_dataProvider;
+            boost::shared_ptr<dataAccessLayer::IKeywordManager> m_keywordManager;
             static std::string m_restKeyword;
          };
       } //namespace service
@@ -44,6 +44,7 @@ namespace web
             REGISTER_DISPATCHER_HANDLER(dispatcher, "GET", (m_restKeyword)("*")("configurationSchema"), CDevice::getDeviceConfigurationSchema);
             REGISTER_DISPATCHER_HANDLER(dispatcher, "GET", (m_restKeyword)("keyword"), CDevice::getAllKeywords);
             REGISTER_DISPATCHER_HANDLER(dispatcher, "GET", (m_restKeyword)("keyword")("*"), CDevice::getKeyword);
+            REGISTER_DISPATCHER_HANDLER(dispatcher, "PUT", (m_restKeyword)("withkeywords"), CDevice::getDevicesWithKeywords); //get a page of devices with their keywords
             REGISTER_DISPATCHER_HANDLER(dispatcher, "GET", (m_restKeyword)("matchcapacity")("*")("*"), CDevice::getDevicesWithCapacity);
             REGISTER_DISPATCHER_HANDLER(dispatcher, "GET", (m_restKeyword)("matchcapacitytype")("*")("*"), CDevice::getDeviceWithCapacityType);
             REGISTER_DISPATCHER_HANDLER(dispatcher, "GET", (m_restKeyword)("matchkeywordaccess")("*"), CDevice::getDeviceWithKeywordAccessMode);
@@ -124,6 +125,46 @@ namespace web
             return CResult::GenerateSuccess(collection);
          }
 
+         boost::shared_ptr<shared::serialization::IDataSerializable> CDevice::getDevicesWithKeywords(const std::vector<std::string>& parameters, const std::string& requestContent) const
+         {
+            try
+            {
+               database::IDeviceRequester::DevicesWithKeywordsQuery query;
+               if (!requestContent.empty())
+               {
+                  shared::CDataContainer content(requestContent);
+                  query.afterDeviceId = content.getWithDefault<int>("cursor", query.afterDeviceId);
+                  query.maxDevices = std::max(1, std::min(content.getWithDefault<int>("limit", query.maxDevices), 1000));
+                  query.pluginId = content.getWithDefault<int>("pluginId", query.pluginId);
+                  query.capacityName = content.getWithDefault<std::string>("capacity", query.capacityName);
+                  if (content.containsValue("accessMode"))
+                     query.accessMode = shared::plugin::yPluginApi::EKeywordAccessMode(content.get<std::string>("accessMode"));
+                  query.blacklistedIncluded = content.getWithDefault<bool>("blacklisted", query.blacklistedIncluded);
+                  query.lastValues = content.getWithDefault<bool>("lastValues", query.lastValues);
+                  if (content.containsChild("deviceFields"))
+                     query.deviceFields = content.get<std::vector<std::string>>("deviceFields");
+                  if (content.containsChild("keywordFields"))
+                     query.keywordFields = content.get<std::vector<std::string>>("keywordFields");
+               }
+
+               //serialized straight from the resultset
+               int nextCursor;
+               const auto devices = m_dataProvider->getDeviceRequester()->getDevicesWithKeywordsAsJson(query, nextCursor);
+               return CResult::GenerateSuccessSerialized({
+                  std::make_pair(getRestKeyword(), devices),
+                  std::make_pair(std::string("nextCursor"), "\"" + std::to_string(nextCursor) + "\"")
+               });
+            }
+            catch (std::exception& ex)
+            {
+               return CResult::GenerateError(ex);
+            }
+            catch (...)
+            {
+               return CResult::GenerateError("unknown exception in retreiving devices with keywords");
+            }
+         }
+
          boost::shared_ptr<shared::serialization::IDataSerializable> CDevice::getKeyword(const std::vector<std::string>& parameters, const std::string& requestContent) const
          {
             try
@@ -151,10 +192,8 @@ namespace web
          {
             try
             {
-               auto result = m_keywordManager->getAllKeywords();
-               shared::CDataContainer collection;
-               collection.set("keywords", result);
-               return CResult::GenerateSuccess(collection);
+               //serialized straight from the resultset, can be huge
+               return CResult::GenerateSuccessSerialized("keywords", m_keywordManager->getAllKeywordsAsJson());
             }
             catch (std::exception& ex)
             {
@@ -288,10 +327,7 @@ namespace web
 
                   if (deviceInDatabase)
                   {
-                     auto allKeywordsforDevice = m_keywordManager->getKeywords(deviceId);
-                     shared::CDataContainer collection;
-                     collection.set("keyword", allKeywordsforDevice);
-                     return CResult::GenerateSuccess(collection);
+                     return CResult::GenerateSuccessSerialized("keyword", m_keywordManager->getKeywordsAsJson(deviceId));
                   }
                   return CResult::GenerateError("Fail to retrieve device in database");
                }
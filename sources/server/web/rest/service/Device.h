@@ -43,6 +43,11 @@ namespace web
             //-----------------------------------------
             boost::shared_ptr<shared::serialization::IDataSerializable> getAllDevices(const std::vector<std::string>& parameters, const std::string& requestContent) const;
 
+            //-----------------------------------------
+            ///\brief   get a page of devices with their keywords (criteria in request content)
+            //-----------------------------------------
+            boost::shared_ptr<shared::serialization::IDataSerializable> getDevicesWithKeywords(const std::vector<std::string>& parameters, const std::string& requestContent) const;
+
             //-----------------------------------------
             ///\brief   get all devices which supports a capacity
             //-----------------------------------------
@@ -65,7 +65,15 @@ namespace web
             {
                if (m_databaseRequester->backupSupported())
                {
-                  boost::shared_ptr<task::ITask> task(boost::make_shared<task::backup::CBackup>(m_pathProvider, m_databaseRequester));
+                  //incremental backup only saves acquisitions since last backup
+                  auto incremental = false;
+                  if (!requestContent.empty())
+                  {
+                     shared::CDataContainer content(requestContent);
+                     incremental = content.exists("incremental") && content.get<bool>("incremental");
+                  }
+
+                  boost::shared_ptr<task::ITask> task(boost::make_shared<task::backup::CBackup>(m_pathProvider, m_databaseRequester, incremental));
 
                   std::string taskUid;
                   if (m_taskScheduler->runTask(task, taskUid))
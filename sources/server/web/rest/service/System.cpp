@@ -3,6 +3,7 @@
 #include "web/rest/RestDispatcherHelpers.hpp"
 #include "web/rest/RestDispatcher.h"
 #include "web/rest/Result.h"
+#include "web/rest/StringContainer.h"
 #include "tools/OperatingSystem.h"
 #include <shared/Peripherals.h>
 #include <shared/currentTime/Provider.h>
@@ -11,6 +12,7 @@
 #include <shared/plugin/yPluginApi/StandardCapacities.h>
 #include <startupOptions/IStartupOptions.h>
 #include "dateTime/TimeZoneDatabase.h"
+#include <shared/metrics/MetricsRegistry.h>
 
 namespace web
 {
@@ -41,6 +43,8 @@ namespace web
             REGISTER_DISPATCHER_HANDLER(dispatcher, "GET", (m_restKeyword)("currentTime"), CSystem::getCurrentTime);
             REGISTER_DISPATCHER_HANDLER(dispatcher, "GET", (m_restKeyword)("virtualDevicesSupportedCapacities"), CSystem
                ::getVirtualDevicesSupportedCapacities);
+            REGISTER_DISPATCHER_HANDLER(dispatcher, "GET", (m_restKeyword)("metrics"), CSystem::getMetrics);
+            REGISTER_DISPATCHER_HANDLER(dispatcher, "GET", (m_restKeyword)("metrics")("prometheus"), CSystem::getPrometheusMetrics);
          }
 
 
@@ -193,6 +197,41 @@ namespace web
             }
          }
 
+         boost::shared_ptr<shared::serialization::IDataSerializable> CSystem::getMetrics(const std::vector<std::string>& parameters,
+                                                                                         const std::string& requestContent) const
+         {
+            try
+            {
+               return CResult::GenerateSuccess(shared::metrics::CMetricsRegistry::instance().toContainer());
+            }
+            catch (std::exception& ex)
+            {
+               return CResult::GenerateError(ex);
+            }
+            catch (...)
+            {
+               return CResult::GenerateError("unknown exception in retreiving metrics");
+            }
+         }
+
+         boost::shared_ptr<shared::serialization::IDataSerializable> CSystem::getPrometheusMetrics(const std::vector<std::string>& parameters,
+                                                                                                   const std::string& requestContent) const
+         {
+            try
+            {
+               return boost::make_shared<CStringContainer>(shared::metrics::CMetricsRegistry::instance().toPrometheus(),
+                                                           "text/plain; version=0.0.4");
+            }
+            catch (std::exception& ex)
+            {
+               return CResult::GenerateError(ex);
+            }
+            catch (...)
+            {
+               return CResult::GenerateError("unknown exception in retreiving metrics");
+            }
+         }
+
          boost::shared_ptr<shared::serialization::IDataSerializable> CSystem::platformIs(const std::string& refPlatform) const
          {
             try
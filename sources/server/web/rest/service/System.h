@@ -32,6 +32,10 @@ namespace web
                                                                         const std::string& requestContent) const;
             boost::shared_ptr<shared::serialization::IDataSerializable> getVirtualDevicesSupportedCapacities(const std::vector<std::string>& parameters,
                                                                         const std::string& requestContent) const;
+            boost::shared_ptr<shared::serialization::IDataSerializable> getMetrics(const std::vector<std::string>& parameters,
+                                                                        const std::string& requestContent) const;
+            boost::shared_ptr<shared::serialization::IDataSerializable> getPrometheusMetrics(const std::vector<std::string>& parameters,
+                                                                        const std::string& requestContent) const;
 
          private:
             boost::shared_ptr<shared::serialization::IDataSerializable> getSerialPorts() const;
@@ -1,6 +1,5 @@
 #include "stdafx.h"
 #include "Log.h"
-#include "logInternal/LogStreamEnhanced.h"
 
 namespace shared
 {
@@ -8,12 +7,9 @@ namespace shared
 
    Poco::Logger& CLog::logger()
    {
-      return Poco::Logger::get("YadomsLogger");
-   }
-   
-   boost::shared_ptr<logInternal::ILogStream> CLog::logStream()
-   {
-      return boost::make_shared<logInternal::CLogStreamEnhanced>(logger());
+      //Poco::Logger::get locks the loggers map, so get it once
+      static auto& yadomsLogger = Poco::Logger::get("YadomsLogger");
+      return yadomsLogger;
    }
 
    void CLog::setThreadName(const std::string & name)
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <shared/Export.h>
-#include "logInternal/ILogStream.h"
+#include "logInternal/LogLine.h"
 #include <Poco/Logger.h>
 #include <Poco/Thread.h>
 
@@ -10,8 +10,14 @@ namespace shared
  
    //--------------------------------------------------------------
    /// \brief	    Log a message (stream way)
+   ///
+   /// Level is checked first : if disabled, nothing is built and the
+   /// streamed values are not even evaluated.
    //--------------------------------------------------------------
-   #define YADOMS_LOG(lvl) shared::CLog::logStream()->lvl()
+   #define YADOMS_LOG(lvl) \
+      !shared::CLog::logger().is(shared::logInternal::priority::lvl) \
+         ? shared::logInternal::CLogLine::nullStream() \
+         : shared::logInternal::CLogLine(shared::CLog::logger(), shared::logInternal::priority::lvl).stream()
 
    //--------------------------------------------------------------
    /// \brief	    Configure the logger by settings the current thread name
@@ -31,12 +37,6 @@ namespace shared
       //--------------------------------------------------------------
       static Poco::Logger& logger();
 
-      //--------------------------------------------------------------
-      /// \brief	    Get the main logger stream
-      /// \return     The main logger stream (shread ptr)
-      //--------------------------------------------------------------
-      static boost::shared_ptr<logInternal::ILogStream> logStream();
-
       //--------------------------------------------------------------
       /// \brief	    Set the thread name
       /// \param [in] name    Name of the thread
@@ -0,0 +1,433 @@
+#include "stdafx.h"
+#include "TarGzStreamExtractor.h"
+#include <shared/exception/Extract.hpp>
+#include <shared/Log.h>
+#include <Poco/File.h>
+#include <fstream>
+
+namespace shared { namespace compression { 
+
+   //--------------------------------------------------------------
+   /// \brief	Parser of a tar stream (ustar, GNU long names and pax path supported)
+   ///
+   /// Only regular files and directories are extracted, other entries are skipped.
+   /// Errors are kept (a stream buffer must not throw), writing stops at first error.
+   //--------------------------------------------------------------   
+   class CTarGzStreamExtractor::CTarStreamBuf : public std::streambuf
+   {
+   public:
+      explicit CTarStreamBuf(const Poco::Path& extractPath)
+         : m_extractPath(extractPath),
+           m_state(kHeader),
+           m_headerSize(0),
+           m_entryType(kSkippedEntry),
+           m_entrySize(0),
+           m_remaining(0),
+           m_padding(0),
+           m_executable(false),
+           m_entriesCount(0)
+      {
+      }
+
+      virtual ~CTarStreamBuf()
+      {
+      }
+
+      const std::string& error() const
+      {
+         return m_error;
+      }
+
+      //--------------------------------------------------------------
+      /// \brief	true if stream was cut at an entry boundary (or after the end of archive marker)
+      //--------------------------------------------------------------   
+      bool complete() const
+      {
+         return m_state == kEnd || (m_state == kHeader && m_headerSize == 0 && m_entriesCount != 0);
+      }
+
+   protected:
+      std::streamsize xsputn(const char* s, std::streamsize n) override
+      {
+         if (!m_error.empty())
+            return 0;
+
+         try
+         {
+            consume(s, static_cast<std::size_t>(n));
+            return n;
+         }
+         catch (Poco::Exception& e)
+         {
+            m_error = e.displayText();
+         }
+         catch (std::exception& e)
+         {
+            m_error = e.what();
+         }
+         return 0;
+      }
+
+      int_type overflow(int_type c) override
+      {
+         if (traits_type::eq_int_type(c, traits_type::eof()))
+            return traits_type::not_eof(c);
+
+         const auto ch = traits_type::to_char_type(c);
+         return xsputn(&ch, 1) == 1 ? c : traits_type::eof();
+      }
+
+   private:
+      enum
+      {
+         kBlockSize = 512,
+         kMaxMetadataSize = 0x10000
+      };
+
+      enum EState
+      {
+         kHeader,
+         kContent,
+         kPadding,
+         kEnd
+      };
+
+      enum EEntryType
+      {
+         kFileEntry,
+         kLongNameEntry,
+         kPaxHeaderEntry,
+         kSkippedEntry
+      };
+
+      void consume(const char* data, std::size_t size)
+      {
+         while (size != 0)
+         {
+            std::size_t consumed;
+            switch (m_state)
+            {
+            case kHeader:
+               consumed = std::min(size, kBlockSize - m_headerSize);
+               memcpy(m_header + m_headerSize, data, consumed);
+               m_headerSize += consumed;
+               if (m_headerSize == kBlockSize)
+               {
+                  m_headerSize = 0;
+                  onHeader();
+               }
+               break;
+
+            case kContent:
+               consumed = static_cast<std::size_t>(std::min(static_cast<Poco::UInt64>(size), m_remaining));
+               onContent(data, consumed);
+               m_remaining -= consumed;
+               if (m_remaining == 0)
+                  endEntry();
+               break;
+
+            case kPadding:
+               consumed = std::min(size, m_padding);
+               m_padding -= consumed;
+               if (m_padding == 0)
+                  m_state = kHeader;
+               break;
+
+            default:
+               //data after the end of archive marker are ignored
+               return;
+            }
+
+            data += consumed;
+            size -= consumed;
+         }
+      }
+
+      void onHeader()
+      {
+         if (std::all_of(m_header, m_header + kBlockSize, [](char c) { return c == '\0'; }))
+         {
+            m_state = kEnd;
+            return;
+         }
+
+         //checksum is computed with checksum field filled with spaces
+         unsigned int checksum = 0;
+         for (auto index = 0; index < kBlockSize; ++index)
+            checksum += (index >= 148 && index < 156) ? ' ' : static_cast<unsigned char>(m_header[index]);
+         if (checksum != parseNumber(m_header + 148, 8))
+            throw exception::CExtract("Invalid tar header checksum");
+
+         m_entrySize = parseNumber(m_header + 124, 12);
+         m_remaining = m_entrySize;
+         m_entryName = m_nextEntryName.empty() ? headerName() : m_nextEntryName;
+         m_nextEntryName.clear();
+
+         const auto typeFlag = m_header[156];
+         switch (typeFlag)
+         {
+         case '\0':
+         case '0':
+         case '7':
+            m_entryType = kFileEntry;
+            startFile(parseNumber(m_header + 100, 8));
+            break;
+
+         case '5':
+            m_entryType = kSkippedEntry;
+            Poco::File(entryPath(m_entryName, true)).createDirectories();
+            break;
+
+         case 'L':
+            m_entryType = kLongNameEntry;
+            startMetadata();
+            break;
+
+         case 'x':
+            m_entryType = kPaxHeaderEntry;
+            startMetadata();
+            break;
+
+         case 'g':
+            m_entryType = kSkippedEntry;
+            break;
+
+         default:
+            m_entryType = kSkippedEntry;
+            YADOMS_LOG(warning) << "Archive entry " << m_entryName << " ignored (type '" << typeFlag << "' not supported)";
+            break;
+         }
+
+         if (m_remaining == 0)
+            endEntry();
+         else
+            m_state = kContent;
+      }
+
+      void onContent(const char* data, std::size_t size)
+      {
+         switch (m_entryType)
+         {
+         case kFileEntry:
+            m_file.write(data, size);
+            if (!m_file)
+               throw exception::CExtract("Fail to write " + m_filePath.toString());
+            break;
+
+         case kLongNameEntry:
+         case kPaxHeaderEntry:
+            m_metadata.append(data, size);
+            break;
+
+         default:
+            break;
+         }
+      }
+
+      void endEntry()
+      {
+         switch (m_entryType)
+         {
+         case kFileEntry:
+            m_file.close();
+            if (!m_file)
+               throw exception::CExtract("Fail to write " + m_filePath.toString());
+            if (m_executable)
+               Poco::File(m_filePath).setExecutable(true);
+            ++m_entriesCount;
+            break;
+
+         case kLongNameEntry:
+            m_nextEntryName = m_metadata.substr(0, m_metadata.find('\0'));
+            break;
+
+         case kPaxHeaderEntry:
+            m_nextEntryName = paxPath();
+            break;
+
+         default:
+            ++m_entriesCount;
+            break;
+         }
+
+         m_padding = static_cast<std::size_t>((kBlockSize - m_entrySize % kBlockSize) % kBlockSize);
+         m_state = m_padding != 0 ? kPadding : kHeader;
+      }
+
+      void startFile(Poco::UInt64 mode)
+      {
+         m_filePath = entryPath(m_entryName, false);
+         Poco::File(m_filePath.parent()).createDirectories();
+
+         m_file.open(m_filePath.toString().c_str(), std::ios::binary | std::ios::trunc);
+         if (!m_file.is_open())
+            throw exception::CExtract("Fail to create " + m_filePath.toString());
+
+         m_executable = (mode & 0111) != 0;
+      }
+
+      void startMetadata()
+      {
+         if (m_entrySize > kMaxMetadataSize)
+            throw exception::CExtract("Invalid tar extended header size");
+         m_metadata.clear();
+      }
+
+      std::string headerName() const
+      {
+         const std::string name(m_header, strnlen(m_header, 100));
+         if (memcmp(m_header + 257, "ustar", 5) != 0 || m_header[345] == '\0')
+            return name;
+         return std::string(m_header + 345, strnlen(m_header + 345, 155)) + "/" + name;
+      }
+
+      std::string paxPath() const
+      {
+         //records are "<length> <key>=<value>\n"
+         std::size_t position = 0;
+         while (position < m_metadata.size())
+         {
+            const auto space = m_metadata.find(' ', position);
+            if (space == std::string::npos)
+               break;
+            const auto length = static_cast<std::size_t>(std::strtoul(m_metadata.c_str() + position, nullptr, 10));
+            if (length == 0 || position + length > m_metadata.size())
+               break;
+
+            const auto record = m_metadata.substr(space + 1, position + length - space - 2);
+            if (boost::starts_with(record, "path="))
+               return record.substr(5);
+            position += length;
+         }
+         return std::string();
+      }
+
+      Poco::Path entryPath(const std::string& name, bool isDirectory) const
+      {
+         //entries must stay in the extraction directory
+         std::vector<std::string> parts;
+         boost::split(parts, name, boost::is_any_of("/"));
+         if (name.empty() || name[0] == '/' || name.find(':') != std::string::npos || name.find('\\') != std::string::npos)
+            throw exception::CExtract("Invalid archive entry name : " + name);
+
+         Poco::Path path(m_extractPath);
+         path.makeDirectory();
+         std::vector<std::string> components;
+         for (const auto& part : parts)
+         {
+            if (part == "..")
+               throw exception::CExtract("Invalid archive entry name : " + name);
+            if (!part.empty() && part != ".")
+               components.push_back(part);
+         }
+         if (components.empty())
+            return path;
+
+         for (std::size_t index = 0; index + 1 < components.size(); ++index)
+            path.pushDirectory(components[index]);
+         if (isDirectory)
+            path.pushDirectory(components.back());
+         else
+            path.setFileName(components.back());
+         return path;
+      }
+
+      static Poco::UInt64 parseNumber(const char* field, std::size_t size)
+      {
+         Poco::UInt64 value = 0;
+
+         //base-256 encoding (for big values)
+         if (static_cast<unsigned char>(field[0]) & 0x80)
+         {
+            value = static_cast<unsigned char>(field[0]) & 0x7F;
+            for (std::size_t index = 1; index < size; ++index)
+               value = (value << 8) | static_cast<unsigned char>(field[index]);
+            return value;
+         }
+
+         //octal encoding, padded with spaces or nulls
+         for (std::size_t index = 0; index < size && field[index] != '\0'; ++index)
+         {
+            if (field[index] == ' ')
+               continue;
+            if (field[index] < '0' || field[index] > '7')
+               throw exception::CExtract("Invalid tar header number");
+            value = (value << 3) | static_cast<Poco::UInt64>(field[index] - '0');
+         }
+         return value;
+      }
+
+      const Poco::Path m_extractPath;
+      EState m_state;
+      char m_header[kBlockSize];
+      std::size_t m_headerSize;
+
+      EEntryType m_entryType;
+      std::string m_entryName;
+      Poco::UInt64 m_entrySize;
+      Poco::UInt64 m_remaining;
+      std::size_t m_padding;
+
+      std::string m_metadata;
+      std::string m_nextEntryName;
+
+      std::ofstream m_file;
+      Poco::Path m_filePath;
+      bool m_executable;
+
+      unsigned int m_entriesCount;
+      std::string m_error;
+   };
+
+
+   CTarGzStreamExtractor::CTarGzStreamExtractor(const Poco::Path& extractPath)
+      : m_tarStreamBuf(new CTarStreamBuf(extractPath))
+   {
+      Poco::File(extractPath).createDirectories();
+      m_tarStream.reset(new std::ostream(m_tarStreamBuf.get()));
+      m_inflater.reset(new Poco::InflatingOutputStream(*m_tarStream, Poco::InflatingStreamBuf::STREAM_GZIP));
+   }
+
+   CTarGzStreamExtractor::~CTarGzStreamExtractor()
+   {
+   }
+
+   void CTarGzStreamExtractor::write(const char* data, std::size_t size)
+   {
+      try
+      {
+         m_inflater->write(data, size);
+      }
+      catch (Poco::Exception& e)
+      {
+         throwError(e.displayText());
+      }
+
+      if (!*m_inflater || !*m_tarStream)
+         throwError("Fail to uncompress archive");
+   }
+
+   void CTarGzStreamExtractor::finish()
+   {
+      try
+      {
+         m_inflater->close();
+      }
+      catch (Poco::Exception& e)
+      {
+         throwError(e.displayText());
+      }
+
+      if (!*m_inflater || !*m_tarStream)
+         throwError("Fail to uncompress archive");
+      if (!m_tarStreamBuf->complete())
+         throwError("Archive is truncated");
+   }
+
+   void CTarGzStreamExtractor::throwError(const std::string& reason) const
+   {
+      throw exception::CExtract("Fail to extract archive : " + (m_tarStreamBuf->error().empty() ? reason : m_tarStreamBuf->error()));
+   }
+
+} // namespace compression
+} // namespace shared
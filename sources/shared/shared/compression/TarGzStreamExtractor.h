@@ -0,0 +1,65 @@
+#pragma once
+
+#include <shared/Export.h>
+#include <Poco/Path.h>
+#include <Poco/InflatingStream.h>
+
+namespace shared { namespace compression { 
+
+   //--------------------------------------------------------------
+   /// \brief	tar.gz archive extraction, while archive data are received
+   ///
+   /// Compressed data are given by successive blocks (as received from network for example),
+   /// entries are written to the extraction directory as soon as they are uncompressed.
+   /// So the archive itself never needs to be stored.
+   //--------------------------------------------------------------
+   class YADOMS_SHARED_EXPORT CTarGzStreamExtractor : boost::noncopyable
+   {
+   public:
+      //--------------------------------------------------------------
+      /// \brief	Constructor
+      /// \param [in] extractPath   The directory where to extract entries (created if needed)
+      //--------------------------------------------------------------   
+      explicit CTarGzStreamExtractor(const Poco::Path& extractPath);
+
+      //--------------------------------------------------------------
+      /// \brief	Destructor
+      //--------------------------------------------------------------   
+      virtual ~CTarGzStreamExtractor();
+
+      //--------------------------------------------------------------
+      /// \brief	Give the next archive data
+      /// \param [in] data    The compressed data
+      /// \param [in] size    The data size
+      /// \throw  shared::exception::CExtract if data are invalid or an entry can not be written
+      //--------------------------------------------------------------   
+      void write(const char* data, std::size_t size);
+
+      //--------------------------------------------------------------
+      /// \brief	Notify that all data were given
+      /// \throw  shared::exception::CExtract if archive is incomplete
+      //--------------------------------------------------------------   
+      void finish();
+
+   private:
+      //--------------------------------------------------------------
+      /// \brief	Throw the extraction error
+      /// \param [in] reason    The error, if tar stream has no more precise one
+      //--------------------------------------------------------------   
+      void throwError(const std::string& reason) const;
+
+      //--------------------------------------------------------------
+      /// \brief	The uncompressed (tar) stream parser, writing entries
+      //--------------------------------------------------------------   
+      class CTarStreamBuf;
+      boost::scoped_ptr<CTarStreamBuf> m_tarStreamBuf;
+      boost::scoped_ptr<std::ostream> m_tarStream;
+
+      //--------------------------------------------------------------
+      /// \brief	The gzip decompression, writing into tar stream
+      //--------------------------------------------------------------   
+      boost::scoped_ptr<Poco::InflatingOutputStream> m_inflater;
+   };
+
+} // namespace compression
+} // namespace shared
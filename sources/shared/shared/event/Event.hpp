@@ -20,7 +20,7 @@ namespace shared
          /// \note      data will be copied locally so it can be disallowed after this call
          //--------------------------------------------------------------
          CEvent(int id, const T& data)
-            : CEventBase(id), m_data(data)
+            : CEventBase(id, typeTag()), m_data(data)
          {
          }
 
@@ -37,6 +37,17 @@ namespace shared
          //--------------------------------------------------------------
          const T& getData() const { return m_data; }
 
+         //--------------------------------------------------------------
+         /// \brief	    Tag identifying the data type T
+         /// \return     Tag, unique per data type (in a same module)
+         /// \note      Used to check the event type without RTTI
+         //--------------------------------------------------------------
+         static const void* typeTag()
+         {
+            static const char Tag = 0;
+            return &Tag;
+         }
+
       private:
          //--------------------------------------------------------------
          /// \brief	    Local copy of event data
@@ -1,11 +1,15 @@
 #pragma once
+#include <atomic>
 
 namespace shared
 {
    namespace event
    {
+      class CEventQueue;
+
       //--------------------------------------------------------------
       /// \brief	    An simple event (without data)
+      /// \note      Events are intrusive nodes of CEventQueue, so posting an event costs only one allocation
       //--------------------------------------------------------------
       class CEventBase
       {
@@ -15,7 +19,9 @@ namespace shared
          /// \param[in] id Event id
          //--------------------------------------------------------------
          explicit CEventBase(int id)
-            : m_id(id)
+            : m_id(id),
+              m_typeTag(nullptr),
+              m_next(nullptr)
          {
          }
 
@@ -26,17 +32,52 @@ namespace shared
          {
          }
 
+         // Avoid copy (event is linked in a queue)
+         CEventBase(const CEventBase&) = delete;
+         CEventBase& operator=(const CEventBase&) = delete;
+
          //--------------------------------------------------------------
          /// \brief	    Id getter
          /// \return     Event id
          //--------------------------------------------------------------
          int getId() const { return m_id; }
 
+         //--------------------------------------------------------------
+         /// \brief	    Data type tag getter
+         /// \return     Tag identifying the type of the event data (nullptr for event without data)
+         //--------------------------------------------------------------
+         const void* getTypeTag() const { return m_typeTag; }
+
+      protected:
+         //--------------------------------------------------------------
+         /// \brief	    Constructor for events containing data
+         /// \param[in] id Event id
+         /// \param[in] typeTag Tag identifying the type of the event data
+         //--------------------------------------------------------------
+         CEventBase(int id, const void* typeTag)
+            : m_id(id),
+              m_typeTag(typeTag),
+              m_next(nullptr)
+         {
+         }
+
       private:
+         friend class CEventQueue;
+
          //--------------------------------------------------------------
          /// \brief	    Event id
          //--------------------------------------------------------------
          int m_id;
+
+         //--------------------------------------------------------------
+         /// \brief	    Data type tag
+         //--------------------------------------------------------------
+         const void* m_typeTag;
+
+         //--------------------------------------------------------------
+         /// \brief	    Next event in the queue (owned by CEventQueue)
+         //--------------------------------------------------------------
+         std::atomic<CEventBase*> m_next;
       };
    }
 } // namespace shared::event
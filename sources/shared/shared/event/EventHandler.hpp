@@ -1,7 +1,9 @@
 #pragma once
 #include "Event.hpp"
+#include "EventQueue.hpp"
 #include "EventTimer.h"
 #include "EventTimePoint.h"
+#include "TimeEventScheduler.h"
 #include <shared/currentTime/Provider.h>
 #include <shared/exception/BadConversion.hpp>
 #include <shared/exception/NullReference.hpp>
@@ -23,11 +25,16 @@ namespace shared
 
       //--------------------------------------------------------------
       /// \brief	    An handler for events
+      /// \note      Events can be posted from any thread without lock (only the post making
+      ///             the queue non-empty takes the lock to wake the consumer).
+      ///             Time events can be created, started and stopped from any thread.
+      ///             waitForEvents and event getters must be called from the consumer thread.
       //--------------------------------------------------------------
       class CEventHandler
       {
       public:
          CEventHandler()
+            : m_timeEvents(m_waitMutex)
          {
          }
 
@@ -45,8 +52,7 @@ namespace shared
          //--------------------------------------------------------------
          void postEvent(int id)
          {
-            auto evt = boost::make_shared<CEventBase>(id);
-            postEvent(evt);
+            postEvent(new CEventBase(id));
          }
 
          //--------------------------------------------------------------
@@ -58,8 +64,7 @@ namespace shared
          template <typename DataType>
          void postEvent(int id, const DataType& data)
          {
-            boost::shared_ptr<CEventBase> evt = boost::make_shared<CEvent<DataType>>(id, data);
-            postEvent(evt);
+            postEvent(new CEvent<DataType>(id, data));
          }
 
          //--------------------------------------------------------------
@@ -69,18 +74,25 @@ namespace shared
          //--------------------------------------------------------------
          bool empty() const
          {
-            boost::recursive_mutex::scoped_lock lock(m_eventsQueueMutex);
             return m_eventsQueue.empty();
          }
 
+         //--------------------------------------------------------------
+         /// \brief	    Get the number of awaiting events
+         /// \return     the number of events in the queue
+         //--------------------------------------------------------------
+         std::size_t size() const
+         {
+            return m_eventsQueue.size();
+         }
+
          //--------------------------------------------------------------
          /// \brief	    Erase all pending events
          //--------------------------------------------------------------
          void clear()
          {
-            boost::recursive_mutex::scoped_lock lock(m_eventsQueueMutex);
-            while (!m_eventsQueue.empty())
-               m_eventsQueue.pop();
+            boost::mutex::scoped_lock lock(m_waitMutex);
+            m_eventsQueue.clear();
          }
 
          //--------------------------------------------------------------
@@ -102,13 +114,21 @@ namespace shared
             // Clean last received message data
             m_lastEvent.reset();
 
-            // Clean the time event list
-            timeEventListCleanup();
+            // Release the obsolete time events, and get the elapsed ones
+            std::vector<boost::shared_ptr<ITimeEvent>> elapsedTimeEvents;
+            {
+               boost::mutex::scoped_lock lock(m_waitMutex);
+               m_timeEvents.collect();
+               if (m_timeEvents.hasRunningTimeEvents())
+                  elapsedTimeEvents = m_timeEvents.elapsed(currentTime::Provider().now());
+            }
 
             // If time events are elapsed, must post corresponding event to the queue
-            signalElapsedTimeEvents();
+            // (a late periodic timer catches up on next calls)
+            for (const auto& timeEvent : elapsedTimeEvents)
+               signalTimeEvent(timeEvent);
 
-            boost::recursive_mutex::scoped_lock lock(m_eventsQueueMutex);
+            boost::mutex::scoped_lock lock(m_waitMutex);
 
             // Don't wait if event is already present
             if (!m_eventsQueue.empty())
@@ -121,28 +141,32 @@ namespace shared
                return kNoEvent;
             }
 
-            if (!hasRunningTimeEvents() && timeout == boost::date_time::pos_infin)
+            if (!m_timeEvents.hasRunningTimeEvents() && timeout == boost::date_time::pos_infin)
             {
                // Wait infinite for event
-               m_condition.wait(lock);
+               while (m_eventsQueue.empty())
+                  m_condition.wait(lock);
                return popEvent();
             }
 
             // Have time event or timeout
-            const auto closerTimeEvent = getNextTimeEventStopPoint();
-            if (!!closerTimeEvent && (closerTimeEvent->getNextStopPoint() < (currentTime::Provider().now() + timeout)))
+            const auto closerTimeEvent = m_timeEvents.next();
+            const auto closerStopPoint = m_timeEvents.nextStopPoint();
+            const auto now = currentTime::Provider().now();
+            if (!!closerTimeEvent && (closerStopPoint < (now + timeout)))
             {
                // Next stop point will be the closer time event
-               if (!m_condition.timed_wait(lock, closerTimeEvent->getNextStopPoint() - currentTime::Provider().now()))
+               if (!m_condition.timed_wait(lock, closerStopPoint - now, [this] { return !m_eventsQueue.empty(); }))
                {
-                  // No event ==> Signal time event
+                  // No event ==> Signal time event (without lock, as the time event notifies the scheduler)
+                  lock.unlock();
                   signalTimeEvent(closerTimeEvent);
                }
             }
             else
             {
                // Next stop point will be the normal timeout
-               if (!m_condition.timed_wait(lock, timeout))
+               if (!m_condition.timed_wait(lock, timeout, [this] { return !m_eventsQueue.empty(); }))
                {
                   // No event ==> timeout
                   return kTimeout;
@@ -180,15 +204,7 @@ namespace shared
             if (!m_lastEvent)
                throw exception::CNullReference("isEventType, no event available");
 
-            try
-            {
-               auto evt = boost::dynamic_pointer_cast<CEvent<DataType>>(m_lastEvent);
-               return evt.get() != NULL;
-            }
-            catch (std::bad_cast&)
-            {
-               return false;
-            }
+            return getLastEvent<DataType>() != nullptr;
          }
 
          //--------------------------------------------------------------
@@ -205,17 +221,11 @@ namespace shared
             if (!m_lastEvent)
                throw exception::CNullReference("getEventData, no event available");
 
-            try
-            {
-               CEvent<DataType> evt = dynamic_cast<CEvent<DataType> &>(*m_lastEvent);
-               return evt.getData();
-            }
-            catch (std::bad_cast& bc)
-            {
-               std::string s = "getEventData : ";
-               s += bc.what();
-               throw exception::CBadConversion(s, boost::lexical_cast<std::string>(m_lastEvent->getId()));
-            }
+            const auto evt = getLastEvent<DataType>();
+            if (!evt)
+               throw exception::CBadConversion("getEventData : unexpected event data type", boost::lexical_cast<std::string>(m_lastEvent->getId()));
+
+            return evt->getData();
          }
 
          //--------------------------------------------------------------
@@ -238,7 +248,8 @@ namespace shared
                                                        periodicity,
                                                        period));
 
-            m_timeEvents.push_back(timer);
+            boost::mutex::scoped_lock lock(m_waitMutex);
+            m_timeEvents.add(timer);
             return timer;
          }
 
@@ -264,7 +275,8 @@ namespace shared
             auto timePoint(boost::make_shared<CEventTimePoint>(timePointEventId,
                                                                dateTime));
 
-            m_timeEvents.push_back(timePoint);
+            boost::mutex::scoped_lock lock(m_waitMutex);
+            m_timeEvents.add(timePoint);
             return timePoint;
          }
 
@@ -272,25 +284,28 @@ namespace shared
       private:
          //--------------------------------------------------------------
          /// \brief	    Send an event
-         /// \param[in] event event to send
+         /// \param[in] event event to send (owned by the queue)
+         /// \note      Consumer is only woken up when the queue becomes non-empty
          //--------------------------------------------------------------
-         void postEvent(boost::shared_ptr<CEventBase>& event)
+         void postEvent(CEventBase* event)
          {
-            boost::recursive_mutex::scoped_lock lock(m_eventsQueueMutex);
-            pushEvent(event);
+            if (!pushEvent(event))
+               return;
+
+            boost::mutex::scoped_lock lock(m_waitMutex);
             m_condition.notify_one();
          }
 
          //--------------------------------------------------------------
          /// \brief	    Push an event to the queue
-         /// \param[in] event event to push
+         /// \param[in] event event to push (owned by the queue)
+         /// \return     true if the queue was empty
          //--------------------------------------------------------------
-         void pushEvent(boost::shared_ptr<CEventBase>& event)
+         bool pushEvent(CEventBase* event)
          {
             BOOST_ASSERT(event->getId() >= kUserFirstId);
 
-            boost::recursive_mutex::scoped_lock lock(m_eventsQueueMutex);
-            m_eventsQueue.push(event);
+            return m_eventsQueue.push(event);
          }
 
          //--------------------------------------------------------------
@@ -299,86 +314,29 @@ namespace shared
          //--------------------------------------------------------------
          int popEvent()
          {
-            boost::recursive_mutex::scoped_lock lock(m_eventsQueueMutex);
-
-            if (m_eventsQueue.empty())
-            {
-               //sometimes happen with MacOSX, don't know why
+            m_lastEvent.reset(m_eventsQueue.pop());
+            if (!m_lastEvent)
                return kNoEvent;
-            }
 
-            //good behavior
-            m_lastEvent = m_eventsQueue.front();
-            m_eventsQueue.pop();
             return m_lastEvent->getId();
          }
 
          //--------------------------------------------------------------
-         /// \brief	   Get the next time event stop point
-         ///            This function computes the next event to arrive, between registred time events
-         /// \return    The next time event (null pointer if none)
-         //--------------------------------------------------------------
-         boost::shared_ptr<ITimeEvent> getNextTimeEventStopPoint() const
-         {
-            if (m_timeEvents.empty())
-               return boost::shared_ptr<ITimeEvent>();
-
-            // Find the closer time event
-            boost::posix_time::ptime lower = boost::posix_time::max_date_time;
-            boost::shared_ptr<ITimeEvent> nextTimeEvent;
-            for (auto it = m_timeEvents.begin();
-                 it != m_timeEvents.end();
-                 ++it)
-            {
-               const auto nextStopPoint = (*it)->getNextStopPoint();
-               if (nextStopPoint != boost::date_time::not_a_date_time)
-               {
-                  if (nextStopPoint < lower)
-                  {
-                     lower = nextStopPoint;
-                     nextTimeEvent = *it;
-                  }
-               }
-            }
-            return nextTimeEvent;
-         }
-
-         //--------------------------------------------------------------
-         /// \brief	   Check if some time event(s) is(are) running
-         /// \return    true if time event is running, false if none
+         /// \brief	    Get the last event as event containing DataType
+         /// \template DataType  Type of the data in the event
+         /// \return     The last event, or nullptr if event data is not of type DataType
+         /// \note      Type tag is checked first, RTTI is only used if event was created by another module
          //--------------------------------------------------------------
-         bool hasRunningTimeEvents()
+         template <typename DataType>
+         const CEvent<DataType>* getLastEvent() const
          {
-            if (m_timeEvents.empty())
-               return false;
-
-            for (auto it = m_timeEvents.begin();
-                 it != m_timeEvents.end();
-                 ++it)
-            {
-               if ((*it)->getNextStopPoint() != boost::date_time::not_a_date_time)
-                  return true;
-            }
+            if (m_lastEvent->getTypeTag() == CEvent<DataType>::typeTag())
+               return static_cast<const CEvent<DataType>*>(m_lastEvent.get());
 
-            return false;
-         }
+            if (!m_lastEvent->getTypeTag())
+               return nullptr;
 
-         //--------------------------------------------------------------
-         /// \brief	   Check for elapsed time events, and post corresponding events to the queue
-         //--------------------------------------------------------------
-         void signalElapsedTimeEvents()
-         {
-            if (m_timeEvents.empty())
-               return;
-
-            for (auto it = m_timeEvents.begin();
-                 it != m_timeEvents.end();
-                 ++it)
-            {
-               const auto nextStopPoint = (*it)->getNextStopPoint();
-               if (nextStopPoint != boost::date_time::not_a_date_time && nextStopPoint < currentTime::Provider().now())
-                  signalTimeEvent(*it); // Elapsed time point, signal it
-            }
+            return dynamic_cast<const CEvent<DataType>*>(m_lastEvent.get());
          }
 
          //--------------------------------------------------------------
@@ -389,60 +347,37 @@ namespace shared
          {
             BOOST_ASSERT(!!timeEvent);
 
-            auto evt(boost::make_shared<CEventBase>(timeEvent->getId()));
-            pushEvent(evt);
+            // Called from consumer thread, no need to wake it up
+            pushEvent(new CEventBase(timeEvent->getId()));
             timeEvent->reset();
          }
 
-         //--------------------------------------------------------------
-         /// \brief	            Purge obsolets time events
-         //--------------------------------------------------------------
-         void timeEventListCleanup()
-         {
-            if (m_timeEvents.empty())
-               return;
-
-            for (auto it = m_timeEvents.begin();
-                 it != m_timeEvents.end();)
-            {
-               if ((*it).unique() && (*it)->canBeRemoved())
-               {
-                  // Time event no more makes sense, and is not referenced by user, so erase it from the list
-                  it = m_timeEvents.erase(it);
-               }
-               else
-               {
-                  ++it;
-               }
-            }
-         }
-
 
          //--------------------------------------------------------------
          /// \brief	   The events queue
          //--------------------------------------------------------------
-         std::queue<boost::shared_ptr<CEventBase>> m_eventsQueue;
+         CEventQueue m_eventsQueue;
 
          //--------------------------------------------------------------
          /// \brief	   The last received event
          //--------------------------------------------------------------
-         boost::shared_ptr<CEventBase> m_lastEvent;
+         std::unique_ptr<CEventBase> m_lastEvent;
 
          //--------------------------------------------------------------
-         /// \brief	   Mutex protecting the events queue
+         /// \brief	   Mutex used to wait for events and guarding the time events schedule
+         ///            (not used by event producers, except to wake the consumer up)
          //--------------------------------------------------------------
-         mutable boost::recursive_mutex m_eventsQueueMutex;
+         boost::mutex m_waitMutex;
 
          //--------------------------------------------------------------
-         /// \brief	   Condition variable signaling an event arrives
+         /// \brief	   Condition variable signaling the queue becomes non-empty
          //--------------------------------------------------------------
-         boost::condition_variable_any m_condition;
+         boost::condition_variable m_condition;
 
          //--------------------------------------------------------------
-         /// \brief	   The time events associated with this event handler
+         /// \brief	   The time events associated with this event handler, ordered by next stop point
          //--------------------------------------------------------------
-         typedef std::vector<boost::shared_ptr<ITimeEvent>> TimeEventList;
-         TimeEventList m_timeEvents;
+         CTimeEventScheduler m_timeEvents;
       };
    }
 } // namespace shared::event
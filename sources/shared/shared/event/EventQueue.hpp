@@ -0,0 +1,175 @@
+#pragma once
+#include "EventBase.hpp"
+#include <boost/thread/thread.hpp>
+
+namespace shared
+{
+   namespace event
+   {
+      //--------------------------------------------------------------
+      /// \brief	    Lock-free multi-producers/single-consumer events queue
+      /// \note      Intrusive queue (events are linked by themselves), based on the D. Vyukov algorithm.
+      ///             push can be called from any thread, pop/clear must be called by only one thread at a time.
+      ///             The queue owns the pushed events, popped events are owned by the caller.
+      //--------------------------------------------------------------
+      class CEventQueue
+      {
+      public:
+         CEventQueue()
+            : m_stub(kStubId),
+              m_head(&m_stub),
+              m_tail(&m_stub),
+              m_size(0)
+         {
+         }
+
+         virtual ~CEventQueue()
+         {
+            clear();
+         }
+
+         // Avoid copy
+         CEventQueue(const CEventQueue&) = delete;
+         CEventQueue& operator=(const CEventQueue&) = delete;
+
+         //--------------------------------------------------------------
+         /// \brief	    Push an event (can be called from any thread)
+         /// \param[in] event event to push, owned by the queue
+         /// \return     true if the queue was empty before this call
+         //--------------------------------------------------------------
+         bool push(CEventBase* event)
+         {
+            // Count the event before linking it, so a consumer seeing a non-empty queue
+            // will always finally find the event
+            const auto wasEmpty = m_size.fetch_add(1, std::memory_order_acq_rel) == 0;
+            link(event);
+            return wasEmpty;
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Pop the next event (consumer thread only)
+         /// \return     The next event (to be deleted by caller), or nullptr if queue is empty
+         /// \note      Can wait a short time if a producer is currently pushing an event
+         //--------------------------------------------------------------
+         CEventBase* pop()
+         {
+            while (!empty())
+            {
+               auto event = tryPop();
+               if (event)
+               {
+                  m_size.fetch_sub(1, std::memory_order_acq_rel);
+                  return event;
+               }
+
+               // A producer is pushing an event, let it finish
+               boost::this_thread::yield();
+            }
+            return nullptr;
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Delete all pending events (consumer thread only)
+         //--------------------------------------------------------------
+         void clear()
+         {
+            CEventBase* event;
+            while ((event = pop()) != nullptr)
+               delete event;
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Check if queue is empty
+         /// \return     true if no event is pending
+         //--------------------------------------------------------------
+         bool empty() const
+         {
+            return size() == 0;
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the number of pending events
+         /// \return     the number of events in the queue
+         //--------------------------------------------------------------
+         std::size_t size() const
+         {
+            return m_size.load(std::memory_order_acquire);
+         }
+
+      private:
+         //--------------------------------------------------------------
+         /// \brief	    Link an event at the head of the list
+         /// \param[in] event event to link
+         //--------------------------------------------------------------
+         void link(CEventBase* event)
+         {
+            event->m_next.store(nullptr, std::memory_order_relaxed);
+            const auto previous = m_head.exchange(event, std::memory_order_acq_rel);
+            previous->m_next.store(event, std::memory_order_release);
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Try to unlink the event at the tail of the list
+         /// \return     The unlinked event, or nullptr if no event is linked yet
+         //--------------------------------------------------------------
+         CEventBase* tryPop()
+         {
+            auto tail = m_tail;
+            auto next = tail->m_next.load(std::memory_order_acquire);
+
+            if (tail == &m_stub)
+            {
+               if (!next)
+                  return nullptr;
+               m_tail = next;
+               tail = next;
+               next = next->m_next.load(std::memory_order_acquire);
+            }
+
+            if (next)
+            {
+               m_tail = next;
+               return tail;
+            }
+
+            if (tail != m_head.load(std::memory_order_acquire))
+               return nullptr; // A producer is linking a new event
+
+            // tail is the last event, re-insert the stub to be able to unlink it
+            link(&m_stub);
+
+            next = tail->m_next.load(std::memory_order_acquire);
+            if (!next)
+               return nullptr;
+
+            m_tail = next;
+            return tail;
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Id of the stub event (never returned to the consumer)
+         //--------------------------------------------------------------
+         enum { kStubId = -100 };
+
+         //--------------------------------------------------------------
+         /// \brief	    The stub event, keeping the list never empty
+         //--------------------------------------------------------------
+         CEventBase m_stub;
+
+         //--------------------------------------------------------------
+         /// \brief	    Last pushed event (producers side)
+         //--------------------------------------------------------------
+         std::atomic<CEventBase*> m_head;
+
+         //--------------------------------------------------------------
+         /// \brief	    Next event to pop (consumer side)
+         //--------------------------------------------------------------
+         CEventBase* m_tail;
+
+         //--------------------------------------------------------------
+         /// \brief	    Number of pending events (including events being linked)
+         //--------------------------------------------------------------
+         std::atomic<std::size_t> m_size;
+      };
+   }
+} // namespace shared::event
@@ -10,7 +10,8 @@ namespace shared
       CEventTimePoint::CEventTimePoint(int eventId,
                                        const boost::posix_time::ptime& dateTime)
          : m_id(eventId),
-           m_dateTime(dateTime)
+           m_dateTime(dateTime),
+           m_scheduler(nullptr)
       {
          if (dateTime == boost::date_time::not_a_date_time)
             return; // Nothing to do more, m_dateTime will be set later by a call to set() method
@@ -27,6 +28,7 @@ namespace shared
          if (dateTime.is_special() || dateTime <= currentTime::Provider().now())
             throw exception::CInvalidParameter("Provided dateTime value is not valid, or not in the future");
          m_dateTime = dateTime;
+         notifyScheduler();
       }
 
       void CEventTimePoint::cancel()
@@ -42,6 +44,7 @@ namespace shared
       void CEventTimePoint::reset()
       {
          m_dateTime = boost::date_time::not_a_date_time;
+         notifyScheduler();
       }
 
       bool CEventTimePoint::canBeRemoved() const
@@ -54,5 +57,16 @@ namespace shared
       {
          return m_id;
       }
+
+      void CEventTimePoint::setScheduler(ITimeEventScheduler* scheduler)
+      {
+         m_scheduler = scheduler;
+      }
+
+      void CEventTimePoint::notifyScheduler() const
+      {
+         if (m_scheduler)
+            m_scheduler->onNextStopPointChanged(*this);
+      }
    }
 } // namespace shared::event
@@ -44,8 +44,14 @@ namespace shared
          void reset() override;
          bool canBeRemoved() const override;
          int getId() const override;
+         void setScheduler(ITimeEventScheduler* scheduler) override;
          // [END] ITimeEvent Implementation
 
+         //--------------------------------------------------------------
+         /// \brief	    Notify the scheduler (if any) that the next stop point changed
+         //--------------------------------------------------------------
+         void notifyScheduler() const;
+
       private:
          //--------------------------------------------------------------
          /// \brief	    The event ID associated with the timer
@@ -56,6 +62,11 @@ namespace shared
          /// \brief	    The next stop point
          //--------------------------------------------------------------
          boost::posix_time::ptime m_dateTime;
+
+         //--------------------------------------------------------------
+         /// \brief	    The scheduler to notify of changes (nullptr if none)
+         //--------------------------------------------------------------
+         ITimeEventScheduler* m_scheduler;
       };
    }
 } // namespace shared::event
@@ -14,7 +14,8 @@ namespace shared
            m_periodicity(periodicity),
            m_period(period),
            m_nextStopPoint(boost::date_time::not_a_date_time),
-           m_isRunning(false)
+           m_isRunning(false),
+           m_scheduler(nullptr)
       {
          if (m_period != boost::date_time::not_a_date_time)
             start(m_period);
@@ -39,6 +40,7 @@ namespace shared
       {
          m_nextStopPoint = boost::date_time::not_a_date_time;
          m_isRunning = false;
+         notifyScheduler();
       }
 
       bool CEventTimer::isRunning() const
@@ -60,6 +62,13 @@ namespace shared
                                     : currentTime::Provider().now();
 
          m_nextStopPoint = startPoint + periodToUse;
+         notifyScheduler();
+      }
+
+      void CEventTimer::notifyScheduler() const
+      {
+         if (m_scheduler)
+            m_scheduler->onNextStopPointChanged(*this);
       }
 
       boost::posix_time::ptime CEventTimer::getNextStopPoint() const
@@ -85,5 +94,10 @@ namespace shared
       {
          return m_id;
       }
+
+      void CEventTimer::setScheduler(ITimeEventScheduler* scheduler)
+      {
+         m_scheduler = scheduler;
+      }
    }
 } // namespace shared::event
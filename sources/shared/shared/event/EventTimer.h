@@ -57,10 +57,16 @@ namespace shared
          void reset() override;
          bool canBeRemoved() const override;
          int getId() const override;
+         void setScheduler(ITimeEventScheduler* scheduler) override;
          // [END] ITimeEvent Implementation
 
          void doStart(const boost::posix_time::time_duration& period = boost::date_time::not_a_date_time);
 
+         //--------------------------------------------------------------
+         /// \brief	    Notify the scheduler (if any) that the next stop point changed
+         //--------------------------------------------------------------
+         void notifyScheduler() const;
+
       private:
          //--------------------------------------------------------------
          /// \brief	    The event ID associated with the timer
@@ -86,6 +92,11 @@ namespace shared
          /// \brief	    Running flag
          //--------------------------------------------------------------
          bool m_isRunning;
+
+         //--------------------------------------------------------------
+         /// \brief	    The scheduler to notify of changes (nullptr if none)
+         //--------------------------------------------------------------
+         ITimeEventScheduler* m_scheduler;
       };
    }
 } // namespace shared::event
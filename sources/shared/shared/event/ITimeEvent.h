@@ -1,5 +1,6 @@
 #pragma once
 #include <shared/Export.h>
+#include "ITimeEventScheduler.h"
 
 namespace shared
 {
@@ -44,6 +45,13 @@ namespace shared
          /// \return     Event id
          //--------------------------------------------------------------
          virtual int getId() const = 0;
+
+         //--------------------------------------------------------------
+         /// \brief	    Set the scheduler to notify when the next stop point changes
+         /// \param[in] scheduler   The scheduler (nullptr to detach from scheduler)
+         /// \note       Normaly only called by event handler
+         //--------------------------------------------------------------
+         virtual void setScheduler(ITimeEventScheduler* scheduler) = 0;
       };
    }
 } // namespace shared::event
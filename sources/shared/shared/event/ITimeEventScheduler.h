@@ -0,0 +1,32 @@
+#pragma once
+#include <shared/Export.h>
+
+namespace shared
+{
+   namespace event
+   {
+      class ITimeEvent;
+
+      //--------------------------------------------------------------
+      /// \brief	    Interface of the scheduler of time events, to notify it of time event changes
+      //--------------------------------------------------------------
+      class YADOMS_SHARED_EXPORT ITimeEventScheduler
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \brief	    Destructor
+         //--------------------------------------------------------------
+         virtual ~ITimeEventScheduler()
+         {
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Called by a time event when its next stop point changed (started, stopped, rescheduled...)
+         /// \param[in] timeEvent   The time event
+         //--------------------------------------------------------------
+         virtual void onNextStopPointChanged(const ITimeEvent& timeEvent) = 0;
+      };
+   }
+} // namespace shared::event
+
+
@@ -0,0 +1,145 @@
+#include "stdafx.h"
+#include "TimeEventScheduler.h"
+
+namespace shared
+{
+   namespace event
+   {
+      static const std::size_t MinStoppedCollectThreshold = 64;
+
+      CTimeEventScheduler::CTimeEventScheduler(boost::mutex& mutex)
+         : m_mutex(mutex),
+           m_stoppedCollectThreshold(MinStoppedCollectThreshold)
+      {
+      }
+
+      CTimeEventScheduler::~CTimeEventScheduler()
+      {
+         // Time events can be still referenced by user
+         for (const auto& registration : m_registrations)
+            registration.second.timeEvent->setScheduler(nullptr);
+      }
+
+      void CTimeEventScheduler::add(boost::shared_ptr<ITimeEvent> timeEvent)
+      {
+         Registration registration;
+         registration.timeEvent = timeEvent;
+         registration.scheduledStopPoint = boost::date_time::not_a_date_time;
+         m_registrations[timeEvent.get()] = registration;
+
+         timeEvent->setScheduler(this);
+         reschedule(*timeEvent);
+
+         // A time event not started is released at next collect if not referenced outside
+         if (timeEvent->getNextStopPoint() == boost::date_time::not_a_date_time)
+            m_recentlyStopped.push_back(timeEvent.get());
+      }
+
+      bool CTimeEventScheduler::hasRunningTimeEvents() const
+      {
+         return !m_schedule.empty();
+      }
+
+      boost::shared_ptr<ITimeEvent> CTimeEventScheduler::next() const
+      {
+         if (m_schedule.empty())
+            return boost::shared_ptr<ITimeEvent>();
+
+         return m_registrations.at(m_schedule.begin()->second).timeEvent;
+      }
+
+      boost::posix_time::ptime CTimeEventScheduler::nextStopPoint() const
+      {
+         if (m_schedule.empty())
+            return boost::date_time::not_a_date_time;
+
+         return m_schedule.begin()->first;
+      }
+
+      std::vector<boost::shared_ptr<ITimeEvent>> CTimeEventScheduler::elapsed(const boost::posix_time::ptime& now) const
+      {
+         std::vector<boost::shared_ptr<ITimeEvent>> elapsedTimeEvents;
+         for (auto scheduled = m_schedule.begin(); scheduled != m_schedule.end() && scheduled->first < now; ++scheduled)
+            elapsedTimeEvents.push_back(m_registrations.at(scheduled->second).timeEvent);
+         return elapsedTimeEvents;
+      }
+
+      void CTimeEventScheduler::collect()
+      {
+         for (const auto timeEvent : m_recentlyStopped)
+         {
+            const auto registration = m_registrations.find(timeEvent);
+            if (registration == m_registrations.end() || registration->second.scheduledStopPoint != boost::date_time::not_a_date_time)
+               continue; // Already released, or restarted since
+
+            if (!releaseIfUnused(timeEvent))
+               m_stopped.insert(timeEvent);
+         }
+         m_recentlyStopped.clear();
+
+         // Stopped time events kept by user are checked again only when they become numerous,
+         // so the cost stays proportional to the number of stop operations
+         if (m_stopped.size() < m_stoppedCollectThreshold)
+            return;
+
+         for (auto timeEvent = m_stopped.begin(); timeEvent != m_stopped.end();)
+         {
+            const auto current = *timeEvent++;
+            releaseIfUnused(current);
+         }
+         m_stoppedCollectThreshold = std::max(MinStoppedCollectThreshold, 2 * m_stopped.size());
+      }
+
+      std::size_t CTimeEventScheduler::size() const
+      {
+         return m_registrations.size();
+      }
+
+      void CTimeEventScheduler::onNextStopPointChanged(const ITimeEvent& timeEvent)
+      {
+         boost::mutex::scoped_lock lock(m_mutex);
+         reschedule(timeEvent);
+      }
+
+      void CTimeEventScheduler::reschedule(const ITimeEvent& timeEvent)
+      {
+         const auto registration = m_registrations.find(&timeEvent);
+         if (registration == m_registrations.end())
+            return;
+
+         const auto nextStopPoint = timeEvent.getNextStopPoint();
+         auto& scheduledStopPoint = registration->second.scheduledStopPoint;
+         if (nextStopPoint == scheduledStopPoint)
+            return;
+
+         if (scheduledStopPoint != boost::date_time::not_a_date_time)
+            m_schedule.erase(std::make_pair(scheduledStopPoint, &timeEvent));
+
+         scheduledStopPoint = nextStopPoint;
+         if (nextStopPoint != boost::date_time::not_a_date_time)
+         {
+            m_schedule.insert(std::make_pair(nextStopPoint, &timeEvent));
+            m_stopped.erase(&timeEvent);
+         }
+         else
+         {
+            m_recentlyStopped.push_back(&timeEvent);
+         }
+      }
+
+      bool CTimeEventScheduler::releaseIfUnused(const ITimeEvent* timeEvent)
+      {
+         const auto registration = m_registrations.find(timeEvent);
+         if (registration == m_registrations.end())
+            return true;
+
+         if (!registration->second.timeEvent.unique() || !registration->second.timeEvent->canBeRemoved())
+            return false;
+
+         // Time event no more makes sense, and is not referenced by user, so release it
+         m_stopped.erase(timeEvent);
+         m_registrations.erase(registration);
+         return true;
+      }
+   }
+} // namespace shared::event
@@ -0,0 +1,138 @@
+#pragma once
+#include <shared/Export.h>
+#include <boost/thread/mutex.hpp>
+#include "ITimeEvent.h"
+
+namespace shared
+{
+   namespace event
+   {
+      //--------------------------------------------------------------
+      /// \brief	    The time events of an event handler, ordered by next stop point
+      ///
+      /// Time events notify the scheduler when their next stop point changes, so the
+      /// schedule is kept ordered : start/stop/reset are O(log n), getting the next
+      /// time event is O(1).
+      /// Time events are owned by the scheduler until they are no more running and no more
+      /// referenced outside, then they are released.
+      /// \note       Time events can be started/stopped from any thread : the scheduler is guarded by the mutex
+      ///             of the associated event handler. All methods (except onNextStopPointChanged, called by the
+      ///             time events) must be called with this mutex locked.
+      //--------------------------------------------------------------
+      class YADOMS_SHARED_EXPORT CTimeEventScheduler : public ITimeEventScheduler
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \brief	    Constructor
+         /// \param[in] mutex       The mutex guarding the scheduler (the one of the associated event handler)
+         //--------------------------------------------------------------
+         explicit CTimeEventScheduler(boost::mutex& mutex);
+
+         //--------------------------------------------------------------
+         /// \brief	    Destructor, detach the remaining time events
+         //--------------------------------------------------------------
+         virtual ~CTimeEventScheduler();
+
+         // Avoid copy
+         CTimeEventScheduler(const CTimeEventScheduler&) = delete;
+         const CTimeEventScheduler& operator=(const CTimeEventScheduler&) = delete;
+
+         //--------------------------------------------------------------
+         /// \brief	    Add a time event
+         /// \param[in] timeEvent   The time event
+         //--------------------------------------------------------------
+         void add(boost::shared_ptr<ITimeEvent> timeEvent);
+
+         //--------------------------------------------------------------
+         /// \brief	    Check if some time event(s) is(are) running
+         //--------------------------------------------------------------
+         bool hasRunningTimeEvents() const;
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the next time event to elapse
+         /// \return     The next time event (null pointer if none)
+         //--------------------------------------------------------------
+         boost::shared_ptr<ITimeEvent> next() const;
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the stop point of the next time event to elapse
+         /// \return     The next stop point (not_a_date_time if no running time event)
+         //--------------------------------------------------------------
+         boost::posix_time::ptime nextStopPoint() const;
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the time events elapsed at a time
+         /// \param[in] now         The current time
+         /// \return     The time events which next stop point is before now, in stop point order
+         //--------------------------------------------------------------
+         std::vector<boost::shared_ptr<ITimeEvent>> elapsed(const boost::posix_time::ptime& now) const;
+
+         //--------------------------------------------------------------
+         /// \brief	    Release the time events no more running and no more referenced outside
+         //--------------------------------------------------------------
+         void collect();
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the number of time events owned by the scheduler
+         //--------------------------------------------------------------
+         std::size_t size() const;
+
+         // ITimeEventScheduler Implementation
+         void onNextStopPointChanged(const ITimeEvent& timeEvent) override;
+         // [END] ITimeEventScheduler Implementation
+
+      protected:
+         //--------------------------------------------------------------
+         /// \brief	    Update the position of a time event in the schedule
+         /// \param[in] timeEvent   The time event
+         //--------------------------------------------------------------
+         void reschedule(const ITimeEvent& timeEvent);
+
+         //--------------------------------------------------------------
+         /// \brief	    Release a time event if no more running and no more referenced outside
+         /// \param[in] timeEvent   The time event
+         /// \return     true if time event was released
+         //--------------------------------------------------------------
+         bool releaseIfUnused(const ITimeEvent* timeEvent);
+
+      private:
+         //--------------------------------------------------------------
+         /// \brief	    The mutex guarding the scheduler
+         //--------------------------------------------------------------
+         boost::mutex& m_mutex;
+
+         //--------------------------------------------------------------
+         /// \brief	    A time event, and its position in the schedule
+         //--------------------------------------------------------------
+         struct Registration
+         {
+            boost::shared_ptr<ITimeEvent> timeEvent;
+            boost::posix_time::ptime scheduledStopPoint;
+         };
+
+         std::map<const ITimeEvent*, Registration> m_registrations;
+
+         //--------------------------------------------------------------
+         /// \brief	    The running time events, ordered by next stop point
+         //--------------------------------------------------------------
+         std::set<std::pair<boost::posix_time::ptime, const ITimeEvent*>> m_schedule;
+
+         //--------------------------------------------------------------
+         /// \brief	    Time events stopped since last collect
+         //--------------------------------------------------------------
+         std::vector<const ITimeEvent*> m_recentlyStopped;
+
+         //--------------------------------------------------------------
+         /// \brief	    Stopped time events still referenced outside at last collect
+         //--------------------------------------------------------------
+         std::set<const ITimeEvent*> m_stopped;
+
+         //--------------------------------------------------------------
+         /// \brief	    Number of stopped time events triggering a full check of m_stopped
+         //--------------------------------------------------------------
+         std::size_t m_stoppedCollectThreshold;
+      };
+   }
+} // namespace shared::event
+
+
@@ -0,0 +1,29 @@
+#include "stdafx.h"
+#include "HttpClientSessionFactory.h"
+#include "KeepAliveClientSession.h"
+#include <Poco/Crypto/OpenSSLInitializer.h>
+#include <Poco/Net/Context.h>
+#include <Poco/Net/HTTPSClientSession.h>
+
+namespace shared
+{
+   CHttpClientSessionFactory::CHttpClientSessionFactory()
+   {
+   }
+
+   CHttpClientSessionFactory::~CHttpClientSessionFactory()
+   {
+   }
+
+   boost::shared_ptr<Poco::Net::HTTPClientSession> CHttpClientSessionFactory::createSession(const Poco::URI& uri) const
+   {
+      if (boost::iequals(uri.getScheme(), "https"))
+      {
+         Poco::Crypto::OpenSSLInitializer::initialize();
+         const Poco::Net::Context::Ptr context(new Poco::Net::Context(Poco::Net::Context::CLIENT_USE, "", "", "", Poco::Net::Context::VERIFY_NONE, 9, false, "ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH"));
+         return boost::make_shared<Poco::Net::HTTPSClientSession>(uri.getHost(), uri.getPort(), context);
+      }
+
+      return boost::make_shared<CKeepAliveClientSession>(uri.getHost(), uri.getPort());
+   }
+} // namespace shared
@@ -0,0 +1,20 @@
+#pragma once
+#include "IHttpClientSessionFactory.h"
+
+namespace shared
+{
+   //--------------------------------------------------------------
+   /// \brief	Default factory : plain HTTP sessions support pipelining,
+   ///         HTTPS sessions use the same context than SecureSession
+   //--------------------------------------------------------------
+   class CHttpClientSessionFactory : public IHttpClientSessionFactory
+   {
+   public:
+      CHttpClientSessionFactory();
+      virtual ~CHttpClientSessionFactory();
+
+      // IHttpClientSessionFactory implementation
+      boost::shared_ptr<Poco::Net::HTTPClientSession> createSession(const Poco::URI& uri) const override;
+      // [END] IHttpClientSessionFactory implementation
+   };
+} // namespace shared
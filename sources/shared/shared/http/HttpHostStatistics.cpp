@@ -0,0 +1,99 @@
+#include "stdafx.h"
+#include "HttpHostStatistics.h"
+
+namespace shared
+{
+   CHttpHostStatistics::CHttpHostStatistics()
+      : m_requestCount(0),
+        m_pipelinedRequestCount(0),
+        m_failureCount(0),
+        m_connectionCount(0),
+        m_reuseCount(0),
+        m_lastLatency(boost::posix_time::not_a_date_time),
+        m_minLatency(boost::posix_time::not_a_date_time),
+        m_maxLatency(boost::posix_time::not_a_date_time),
+        m_totalLatency(boost::posix_time::seconds(0))
+   {
+   }
+
+   CHttpHostStatistics::~CHttpHostStatistics()
+   {
+   }
+
+   void CHttpHostStatistics::addRequest(const boost::posix_time::time_duration& latency,
+                                        bool pipelined)
+   {
+      ++m_requestCount;
+      if (pipelined)
+         ++m_pipelinedRequestCount;
+
+      m_lastLatency = latency;
+      m_totalLatency += latency;
+      if (m_minLatency.is_not_a_date_time() || latency < m_minLatency)
+         m_minLatency = latency;
+      if (m_maxLatency.is_not_a_date_time() || latency > m_maxLatency)
+         m_maxLatency = latency;
+   }
+
+   void CHttpHostStatistics::addFailure()
+   {
+      ++m_failureCount;
+   }
+
+   void CHttpHostStatistics::addConnection()
+   {
+      ++m_connectionCount;
+   }
+
+   void CHttpHostStatistics::addReuse()
+   {
+      ++m_reuseCount;
+   }
+
+   unsigned long long CHttpHostStatistics::requestCount() const
+   {
+      return m_requestCount;
+   }
+
+   unsigned long long CHttpHostStatistics::pipelinedRequestCount() const
+   {
+      return m_pipelinedRequestCount;
+   }
+
+   unsigned long long CHttpHostStatistics::failureCount() const
+   {
+      return m_failureCount;
+   }
+
+   unsigned long long CHttpHostStatistics::connectionCount() const
+   {
+      return m_connectionCount;
+   }
+
+   unsigned long long CHttpHostStatistics::reuseCount() const
+   {
+      return m_reuseCount;
+   }
+
+   boost::posix_time::time_duration CHttpHostStatistics::lastLatency() const
+   {
+      return m_lastLatency;
+   }
+
+   boost::posix_time::time_duration CHttpHostStatistics::minLatency() const
+   {
+      return m_minLatency;
+   }
+
+   boost::posix_time::time_duration CHttpHostStatistics::maxLatency() const
+   {
+      return m_maxLatency;
+   }
+
+   boost::posix_time::time_duration CHttpHostStatistics::averageLatency() const
+   {
+      if (m_requestCount == 0)
+         return boost::posix_time::not_a_date_time;
+      return boost::posix_time::microseconds(m_totalLatency.total_microseconds() / static_cast<long long>(m_requestCount));
+   }
+} // namespace shared
@@ -0,0 +1,69 @@
+#pragma once
+#include <shared/Export.h>
+
+namespace shared
+{
+   //--------------------------------------------------------------
+   /// \brief	Statistics of the HTTP requests sent to one host
+   //--------------------------------------------------------------
+   class YADOMS_SHARED_EXPORT CHttpHostStatistics
+   {
+   public:
+      //--------------------------------------------------------------
+      /// \brief	    Constructor
+      //--------------------------------------------------------------
+      CHttpHostStatistics();
+
+      //--------------------------------------------------------------
+      /// \brief	    Destructor
+      //--------------------------------------------------------------
+      virtual ~CHttpHostStatistics();
+
+      //--------------------------------------------------------------
+      /// \brief	    Record a successful request
+      /// \param[in]  latency             time between request sending and response headers reception
+      /// \param[in]  pipelined           true if the request was sent in a pipelined batch
+      //--------------------------------------------------------------
+      void addRequest(const boost::posix_time::time_duration& latency,
+                      bool pipelined = false);
+
+      //--------------------------------------------------------------
+      /// \brief	    Record a failed request
+      //--------------------------------------------------------------
+      void addFailure();
+
+      //--------------------------------------------------------------
+      /// \brief	    Record a new connection (TCP, and TLS if any, handshake)
+      //--------------------------------------------------------------
+      void addConnection();
+
+      //--------------------------------------------------------------
+      /// \brief	    Record the reuse of a kept-alive connection
+      //--------------------------------------------------------------
+      void addReuse();
+
+      //--------------------------------------------------------------
+      /// \brief	    Getters
+      //--------------------------------------------------------------
+      unsigned long long requestCount() const;
+      unsigned long long pipelinedRequestCount() const;
+      unsigned long long failureCount() const;
+      unsigned long long connectionCount() const;
+      unsigned long long reuseCount() const;
+      boost::posix_time::time_duration lastLatency() const;
+      boost::posix_time::time_duration minLatency() const;
+      boost::posix_time::time_duration maxLatency() const;
+      boost::posix_time::time_duration averageLatency() const;
+
+   private:
+      unsigned long long m_requestCount;
+      unsigned long long m_pipelinedRequestCount;
+      unsigned long long m_failureCount;
+      unsigned long long m_connectionCount;
+      unsigned long long m_reuseCount;
+      boost::posix_time::time_duration m_lastLatency;
+      boost::posix_time::time_duration m_minLatency;
+      boost::posix_time::time_duration m_maxLatency;
+      boost::posix_time::time_duration m_totalLatency;
+   };
+} // namespace shared
@@ -5,8 +5,7 @@
 #include <Poco/Net/SSLException.h>
 #include <shared/exception/Exception.hpp>
 #include <shared/Log.h>
-#include "SecureSession.h"
-#include "StandardSession.h"
+#include "HttpSessionPool.h"
 
 namespace shared
 {
@@ -91,9 +90,7 @@ namespace shared
                                                const boost::posix_time::time_duration& timeout)
    {
       CDataContainer responseData;
-	  boost::shared_ptr<StandardSession> session=boost::make_shared<StandardSession>(url);
-
-      SendGetRequest(session,
+      SendGetRequest(HttpSessionPool().getSession(url),
                      CDataContainer(), // no header parameters
                      parameters,
                      [&](CDataContainer& data)
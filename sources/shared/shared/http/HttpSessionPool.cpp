@@ -0,0 +1,235 @@
+#include "stdafx.h"
+#include "HttpSessionPool.h"
+#include "KeepAliveClientSession.h"
+#include "PooledSession.h"
+#include <Poco/Net/NetException.h>
+
+namespace shared
+{
+   CHttpSessionPool::CHttpSessionPool(boost::shared_ptr<IHttpClientSessionFactory> sessionFactory,
+                                      unsigned int maxIdleSessionsPerHost,
+                                      const boost::posix_time::time_duration& idleTimeout)
+      : m_sessionFactory(sessionFactory),
+        m_maxIdleSessionsPerHost(maxIdleSessionsPerHost),
+        m_idleTimeout(boost::chrono::microseconds(idleTimeout.total_microseconds()))
+   {
+   }
+
+   CHttpSessionPool::~CHttpSessionPool()
+   {
+   }
+
+   std::string CHttpSessionPool::key(const std::string& url)
+   {
+      const Poco::URI uri(url);
+      return (boost::format("%1%://%2%:%3%") % boost::to_lower_copy(uri.getScheme()) % boost::to_lower_copy(uri.getHost()) % uri.getPort()).str();
+   }
+
+   boost::shared_ptr<IHTTPSession> CHttpSessionPool::getSession(const std::string& url)
+   {
+      const Poco::URI uri(url);
+      const auto hostKey = key(url);
+
+      bool reused;
+      const auto session = acquire(hostKey, uri, reused);
+
+      return boost::make_shared<CPooledSession>(*this, hostKey, url, session, reused);
+   }
+
+   void CHttpSessionPool::sendPipelinedGetRequests(const std::string& url,
+                                                   const std::vector<std::string>& pathAndQueries,
+                                                   PipelinedResponseHandler onResponse,
+                                                   const boost::posix_time::time_duration& timeout)
+   {
+      if (pathAndQueries.empty())
+         return;
+
+      const Poco::URI uri(url);
+      const auto hostKey = key(url);
+
+      bool reused;
+      const auto session = acquire(hostKey, uri, reused);
+      session->setTimeout(Poco::Timespan(timeout.total_microseconds()));
+
+      const auto keepAliveSession = boost::dynamic_pointer_cast<CKeepAliveClientSession>(session);
+      if (!keepAliveSession)
+      {
+         // Pipelining not supported by this session (HTTPS) : send requests one after another, on the same connection
+         release(hostKey, session);
+         for (std::size_t index = 0; index < pathAndQueries.size(); ++index)
+         {
+            const auto pooledSession = getSession(url);
+            pooledSession->setTimeout(timeout);
+            Poco::Net::HTTPRequest request(Poco::Net::HTTPRequest::HTTP_GET,
+                                           pathAndQueries[index],
+                                           Poco::Net::HTTPMessage::HTTP_1_1);
+            pooledSession->sendRequest(request);
+            Poco::Net::HTTPResponse response;
+            auto& body = pooledSession->receiveResponse(response);
+            onResponse(index, response, body);
+         }
+         return;
+      }
+
+      std::vector<Poco::Net::HTTPRequest> requests;
+      requests.reserve(pathAndQueries.size());
+      for (const auto& pathAndQuery : pathAndQueries)
+         requests.push_back(Poco::Net::HTTPRequest(Poco::Net::HTTPRequest::HTTP_GET,
+                                                   pathAndQuery,
+                                                   Poco::Net::HTTPMessage::HTTP_1_1));
+
+      auto start = boost::chrono::steady_clock::now();
+      std::size_t receivedCount = 0;
+      auto timedResponseHandler = [&](std::size_t index, Poco::Net::HTTPResponse& response, std::istream& body)
+      {
+         ++receivedCount;
+         const auto now = boost::chrono::steady_clock::now();
+         recordRequest(hostKey, now - start, true);
+         start = now;
+         onResponse(index, response, body);
+      };
+
+      try
+      {
+         unsigned int connectionsCount;
+         try
+         {
+            connectionsCount = keepAliveSession->sendPipelinedRequests(requests, timedResponseHandler);
+         }
+         catch (Poco::Net::NetException&)
+         {
+            // Reused connection may have been closed by server while idle
+            if (!reused || receivedCount != 0)
+               throw;
+            keepAliveSession->reset();
+            connectionsCount = keepAliveSession->sendPipelinedRequests(requests, timedResponseHandler);
+         }
+
+         for (unsigned int connection = 0; connection < connectionsCount; ++connection)
+            recordConnection(hostKey);
+      }
+      catch (Poco::Exception&)
+      {
+         recordFailure(hostKey);
+         throw;
+      }
+
+      release(hostKey, session);
+   }
+
+   CHttpHostStatistics CHttpSessionPool::getStatistics(const std::string& url) const
+   {
+      const auto hostKey = key(url);
+
+      boost::lock_guard<boost::mutex> lock(m_mutex);
+      const auto statistics = m_statistics.find(hostKey);
+      if (statistics == m_statistics.end())
+         return CHttpHostStatistics();
+      return statistics->second;
+   }
+
+   std::map<std::string, CHttpHostStatistics> CHttpSessionPool::getAllStatistics() const
+   {
+      boost::lock_guard<boost::mutex> lock(m_mutex);
+      return m_statistics;
+   }
+
+   void CHttpSessionPool::clear()
+   {
+      boost::lock_guard<boost::mutex> lock(m_mutex);
+      m_idleSessions.clear();
+   }
+
+   std::size_t CHttpSessionPool::idleSessionsCount() const
+   {
+      boost::lock_guard<boost::mutex> lock(m_mutex);
+      std::size_t count = 0;
+      for (const auto& hostSessions : m_idleSessions)
+         count += hostSessions.second.size();
+      return count;
+   }
+
+   boost::shared_ptr<Poco::Net::HTTPClientSession> CHttpSessionPool::acquire(const std::string& key,
+                                                                             const Poco::URI& uri,
+                                                                             bool& reused)
+   {
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         auto hostSessions = m_idleSessions.find(key);
+         if (hostSessions != m_idleSessions.end())
+         {
+            const auto now = boost::chrono::steady_clock::now();
+            // Most recently released sessions are at front
+            while (!hostSessions->second.empty())
+            {
+               const auto idleSession = hostSessions->second.front();
+               hostSessions->second.pop_front();
+
+               if (now - idleSession.since < m_idleTimeout && isStillUsable(*idleSession.session))
+               {
+                  m_statistics[key].addReuse();
+                  reused = true;
+                  return idleSession.session;
+               }
+            }
+         }
+      }
+
+      reused = false;
+      auto session = m_sessionFactory->createSession(uri);
+      session->setKeepAlive(true);
+      session->setKeepAliveTimeout(Poco::Timespan(boost::chrono::duration_cast<boost::chrono::microseconds>(m_idleTimeout).count()));
+      return session;
+   }
+
+   void CHttpSessionPool::release(const std::string& key,
+                                  boost::shared_ptr<Poco::Net::HTTPClientSession> session)
+   {
+      if (!session->connected())
+         return;
+
+      boost::lock_guard<boost::mutex> lock(m_mutex);
+      auto& hostSessions = m_idleSessions[key];
+      IdleSession idleSession = {session, boost::chrono::steady_clock::now()};
+      hostSessions.push_front(idleSession);
+      while (hostSessions.size() > m_maxIdleSessionsPerHost)
+         hostSessions.pop_back();
+   }
+
+   void CHttpSessionPool::recordRequest(const std::string& key,
+                                        const boost::chrono::steady_clock::duration& latency,
+                                        bool pipelined)
+   {
+      boost::lock_guard<boost::mutex> lock(m_mutex);
+      m_statistics[key].addRequest(boost::posix_time::microseconds(boost::chrono::duration_cast<boost::chrono::microseconds>(latency).count()),
+                                   pipelined);
+   }
+
+   void CHttpSessionPool::recordFailure(const std::string& key)
+   {
+      boost::lock_guard<boost::mutex> lock(m_mutex);
+      m_statistics[key].addFailure();
+   }
+
+   void CHttpSessionPool::recordConnection(const std::string& key)
+   {
+      boost::lock_guard<boost::mutex> lock(m_mutex);
+      m_statistics[key].addConnection();
+   }
+
+   bool CHttpSessionPool::isStillUsable(Poco::Net::HTTPClientSession& session)
+   {
+      if (!session.connected())
+         return true;
+
+      try
+      {
+         // An idle connection has nothing to read, unless peer closed it
+         return !session.socket().poll(Poco::Timespan(0), Poco::Net::Socket::SELECT_READ);
+      }
+      catch (Poco::Exception&)
+      {
+         return false;
+      }
+   }
+} // namespace shared
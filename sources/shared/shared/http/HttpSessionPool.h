@@ -0,0 +1,150 @@
+#pragma once
+#include <shared/Export.h>
+#include "IHttpSession.h"
+#include "IHttpClientSessionFactory.h"
+#include "HttpHostStatistics.h"
+#include <boost/chrono.hpp>
+#include <boost/function.hpp>
+#include <boost/thread/mutex.hpp>
+
+namespace shared
+{
+   //--------------------------------------------------------------
+   /// \brief	Pool of kept-alive HTTP sessions, keyed by scheme/host/port
+   ///
+   /// Polling plugins send a request to the same equipment every few seconds.
+   /// Getting sessions from this pool avoids a new TCP (and TLS) handshake for each request.
+   /// A session got from the pool returns to it when released (if its connection is still usable).
+   //--------------------------------------------------------------
+   class YADOMS_SHARED_EXPORT CHttpSessionPool
+   {
+   public:
+      //--------------------------------------------------------------
+      /// \brief	    Function called for each response of a pipelined batch
+      /// \param[in]  index               index of the request in the batch
+      /// \param[in]  response            the response headers
+      /// \param[in]  body                the response body stream
+      //--------------------------------------------------------------
+      typedef boost::function3<void, std::size_t, Poco::Net::HTTPResponse&, std::istream&> PipelinedResponseHandler;
+
+      //--------------------------------------------------------------
+      /// \brief	    Constructor
+      /// \param[in]  sessionFactory            factory used to create new Poco sessions
+      /// \param[in]  maxIdleSessionsPerHost    max number of idle sessions kept for one host
+      /// \param[in]  idleTimeout               idle sessions older than this are closed
+      //--------------------------------------------------------------
+      explicit CHttpSessionPool(boost::shared_ptr<IHttpClientSessionFactory> sessionFactory,
+                                unsigned int maxIdleSessionsPerHost = 2,
+                                const boost::posix_time::time_duration& idleTimeout = boost::posix_time::seconds(60));
+
+      //--------------------------------------------------------------
+      /// \brief	    Destructor
+      //--------------------------------------------------------------
+      virtual ~CHttpSessionPool();
+
+      //--------------------------------------------------------------
+      /// \brief	    Get a session for the url, reusing an idle connection if any
+      /// \param[in]  url                 the url where to send the request
+      /// \return     the session. It returns to the pool when released.
+      /// \note       The session must not outlive the pool
+      //--------------------------------------------------------------
+      boost::shared_ptr<IHTTPSession> getSession(const std::string& url);
+
+      //--------------------------------------------------------------
+      /// \brief	    Send several GET requests to the same host in a pipelined way
+      /// \param[in]  url                 the url (scheme/host/port) of the host
+      /// \param[in]  pathAndQueries      path and query of each request
+      /// \param[in]  onResponse          function called for each response, in requests order
+      /// \param[in]  timeout             timeout for each network operation
+      /// \note       HTTPS requests are not pipelined but sent one after another on the same connection
+      /// \throw      Poco::Exception on network error
+      //--------------------------------------------------------------
+      void sendPipelinedGetRequests(const std::string& url,
+                                    const std::vector<std::string>& pathAndQueries,
+                                    PipelinedResponseHandler onResponse,
+                                    const boost::posix_time::time_duration& timeout);
+
+      //--------------------------------------------------------------
+      /// \brief	    Get the statistics of a host
+      /// \param[in]  url                 any url of the host
+      /// \return     the statistics (empty if no request was sent to this host)
+      //--------------------------------------------------------------
+      CHttpHostStatistics getStatistics(const std::string& url) const;
+
+      //--------------------------------------------------------------
+      /// \brief	    Get the statistics of all hosts
+      /// \return     the statistics, by host key ("scheme://host:port")
+      //--------------------------------------------------------------
+      std::map<std::string, CHttpHostStatistics> getAllStatistics() const;
+
+      //--------------------------------------------------------------
+      /// \brief	    Close all idle sessions
+      //--------------------------------------------------------------
+      void clear();
+
+      //--------------------------------------------------------------
+      /// \brief	    Get the number of idle sessions (all hosts)
+      //--------------------------------------------------------------
+      std::size_t idleSessionsCount() const;
+
+      //--------------------------------------------------------------
+      /// \brief	    Compute the pool key of an url
+      /// \param[in]  url                 the url
+      /// \return     the key ("scheme://host:port")
+      //--------------------------------------------------------------
+      static std::string key(const std::string& url);
+
+   protected:
+      friend class CPooledSession;
+
+      //--------------------------------------------------------------
+      /// \brief	    Give back a session to the pool
+      /// \param[in]  key                 the host key
+      /// \param[in]  session             the session, still connected
+      //--------------------------------------------------------------
+      void release(const std::string& key,
+                   boost::shared_ptr<Poco::Net::HTTPClientSession> session);
+
+      //--------------------------------------------------------------
+      /// \brief	    Statistics recording
+      //--------------------------------------------------------------
+      void recordRequest(const std::string& key,
+                         const boost::chrono::steady_clock::duration& latency,
+                         bool pipelined = false);
+      void recordFailure(const std::string& key);
+      void recordConnection(const std::string& key);
+
+   private:
+      //--------------------------------------------------------------
+      /// \brief	    Take an idle session for this key, or create a new one
+      /// \param[in]  key                 the host key
+      /// \param[in]  uri                 the uri
+      /// \param[out] reused              true if session comes from idle sessions
+      //--------------------------------------------------------------
+      boost::shared_ptr<Poco::Net::HTTPClientSession> acquire(const std::string& key,
+                                                              const Poco::URI& uri,
+                                                              bool& reused);
+
+      //--------------------------------------------------------------
+      /// \brief	    Check that an idle connection was not closed by the peer
+      //--------------------------------------------------------------
+      static bool isStillUsable(Poco::Net::HTTPClientSession& session);
+
+      struct IdleSession
+      {
+         boost::shared_ptr<Poco::Net::HTTPClientSession> session;
+         boost::chrono::steady_clock::time_point since;
+      };
+
+      boost::shared_ptr<IHttpClientSessionFactory> m_sessionFactory;
+      const unsigned int m_maxIdleSessionsPerHost;
+      const boost::chrono::steady_clock::duration m_idleTimeout;
+
+      mutable boost::mutex m_mutex;
+      std::map<std::string, std::list<IdleSession>> m_idleSessions;
+      std::map<std::string, CHttpHostStatistics> m_statistics;
+   };
+
+   // The process-wide HTTP session pool
+   YADOMS_SHARED_EXPORT CHttpSessionPool& HttpSessionPool();
+} // namespace shared
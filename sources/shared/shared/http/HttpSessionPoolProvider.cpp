@@ -0,0 +1,12 @@
+#include "stdafx.h"
+#include "HttpSessionPool.h"
+#include "HttpClientSessionFactory.h"
+
+namespace shared
+{
+   CHttpSessionPool& HttpSessionPool()
+   {
+      static CHttpSessionPool StaticHttpSessionPool(boost::make_shared<CHttpClientSessionFactory>());
+      return StaticHttpSessionPool;
+   }
+} // namespace shared
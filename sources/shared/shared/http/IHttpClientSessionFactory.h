@@ -0,0 +1,24 @@
+#pragma once
+#include <Poco/Net/HTTPClientSession.h>
+#include <Poco/URI.h>
+
+namespace shared
+{
+   //--------------------------------------------------------------
+   /// \brief	Factory of the Poco sessions used by the HTTP session pool
+   //--------------------------------------------------------------
+   class IHttpClientSessionFactory
+   {
+   public:
+      virtual ~IHttpClientSessionFactory()
+      {
+      }
+
+      //--------------------------------------------------------------
+      /// \brief	    Create a new (not yet connected) session
+      /// \param[in]  uri                 the uri (scheme, host and port are used)
+      /// \return     the new session
+      //--------------------------------------------------------------
+      virtual boost::shared_ptr<Poco::Net::HTTPClientSession> createSession(const Poco::URI& uri) const = 0;
+   };
+} // namespace shared
@@ -0,0 +1,98 @@
+#include "stdafx.h"
+#include "KeepAliveClientSession.h"
+#include <Poco/Net/HTTPChunkedStream.h>
+#include <Poco/Net/HTTPFixedLengthStream.h>
+#include <Poco/Net/HTTPHeaderStream.h>
+#include <Poco/Net/HTTPStream.h>
+#include <boost/scoped_ptr.hpp>
+#include <limits>
+
+namespace shared
+{
+   CKeepAliveClientSession::CKeepAliveClientSession(const std::string& host,
+                                                    Poco::UInt16 port)
+      : HTTPClientSession(host, port)
+   {
+      setKeepAlive(true);
+   }
+
+   CKeepAliveClientSession::~CKeepAliveClientSession()
+   {
+   }
+
+   unsigned int CKeepAliveClientSession::sendPipelinedRequests(std::vector<Poco::Net::HTTPRequest>& requests,
+                                                               PipelinedResponseHandler onResponse)
+   {
+      unsigned int connectionsCount = 0;
+      std::size_t nextRequest = 0;
+
+      while (nextRequest < requests.size())
+      {
+         if (!connected() || mustReconnect())
+         {
+            close();
+            reconnect();
+            ++connectionsCount;
+         }
+
+         nextRequest = sendPipelinedRequestsFrom(requests, nextRequest, onResponse);
+      }
+
+      return connectionsCount;
+   }
+
+   std::size_t CKeepAliveClientSession::sendPipelinedRequestsFrom(std::vector<Poco::Net::HTTPRequest>& requests,
+                                                                  std::size_t firstRequest,
+                                                                  PipelinedResponseHandler onResponse)
+   {
+      // Write all requests back-to-back
+      for (auto request = requests.begin() + firstRequest; request != requests.end(); ++request)
+      {
+         request->setKeepAlive(true);
+         if (!request->has(Poco::Net::HTTPRequest::HOST))
+            request->setHost(getHost(), getPort());
+
+         Poco::Net::HTTPHeaderOutputStream headerStream(*this);
+         request->write(headerStream);
+      }
+
+      // Then read responses, in the same order
+      for (auto index = firstRequest; index < requests.size(); ++index)
+      {
+         Poco::Net::HTTPResponse response;
+         do
+         {
+            response.clear();
+            Poco::Net::HTTPHeaderInputStream headerStream(*this);
+            response.read(headerStream);
+         }
+         while (response.getStatus() == Poco::Net::HTTPResponse::HTTP_CONTINUE);
+
+         auto connectionReusable = response.getKeepAlive();
+         boost::scoped_ptr<std::istream> body;
+         if (response.getChunkedTransferEncoding())
+            body.reset(new Poco::Net::HTTPChunkedInputStream(*this));
+         else if (response.hasContentLength())
+            body.reset(new Poco::Net::HTTPFixedLengthInputStream(*this, response.getContentLength()));
+         else
+         {
+            // Body ends with connection, next responses will never come on this connection
+            body.reset(new Poco::Net::HTTPInputStream(*this));
+            connectionReusable = false;
+         }
+
+         onResponse(index, response, *body);
+
+         // Consume what handler didn't read, to be on next response
+         body->ignore(std::numeric_limits<std::streamsize>::max());
+
+         if (!connectionReusable)
+         {
+            close();
+            return index + 1;
+         }
+      }
+
+      return requests.size();
+   }
+} // namespace shared
@@ -0,0 +1,57 @@
+#pragma once
+#include <Poco/Net/HTTPClientSession.h>
+#include <Poco/Net/HTTPRequest.h>
+#include <Poco/Net/HTTPResponse.h>
+#include <boost/function.hpp>
+
+namespace shared
+{
+   //--------------------------------------------------------------
+   /// \brief	Plain HTTP client session able to pipeline requests
+   ///         (all requests written back-to-back, then all responses read in order)
+   //--------------------------------------------------------------
+   class CKeepAliveClientSession : public Poco::Net::HTTPClientSession
+   {
+   public:
+      //--------------------------------------------------------------
+      /// \brief	    Function called for each pipelined response
+      /// \param[in]  index               index of the request in the batch
+      /// \param[in]  response            the response headers
+      /// \param[in]  body                the response body stream
+      //--------------------------------------------------------------
+      typedef boost::function3<void, std::size_t, Poco::Net::HTTPResponse&, std::istream&> PipelinedResponseHandler;
+
+      //--------------------------------------------------------------
+      /// \brief	    Constructor
+      /// \param[in]  host                the host
+      /// \param[in]  port                the port
+      //--------------------------------------------------------------
+      CKeepAliveClientSession(const std::string& host,
+                              Poco::UInt16 port);
+
+      //--------------------------------------------------------------
+      /// \brief	    Destructor
+      //--------------------------------------------------------------
+      virtual ~CKeepAliveClientSession();
+
+      //--------------------------------------------------------------
+      /// \brief	    Send idempotent requests (GET) in a pipelined way
+      /// \param[in]  requests            the requests to send
+      /// \param[in]  onResponse          function called for each response, in requests order
+      /// \note       If the server closes the connection in the middle of the batch (no keep-alive,
+      ///             response without length...), remaining requests are sent again on a new connection
+      /// \return     the number of connections opened to process the batch
+      //--------------------------------------------------------------
+      unsigned int sendPipelinedRequests(std::vector<Poco::Net::HTTPRequest>& requests,
+                                         PipelinedResponseHandler onResponse);
+
+   private:
+      //--------------------------------------------------------------
+      /// \brief	    Send requests from firstRequest, and read responses until connection must be closed
+      /// \return     index of the first request not processed
+      //--------------------------------------------------------------
+      std::size_t sendPipelinedRequestsFrom(std::vector<Poco::Net::HTTPRequest>& requests,
+                                            std::size_t firstRequest,
+                                            PipelinedResponseHandler onResponse);
+   };
+} // namespace shared
@@ -0,0 +1,151 @@
+#include "stdafx.h"
+#include "PooledSession.h"
+#include "HttpSessionPool.h"
+#include <Poco/Net/NetException.h>
+#include <shared/Log.h>
+#include <limits>
+
+namespace shared
+{
+   CPooledSession::CPooledSession(CHttpSessionPool& pool,
+                                  const std::string& key,
+                                  const std::string& url,
+                                  boost::shared_ptr<Poco::Net::HTTPClientSession> session,
+                                  bool reused)
+      : m_pool(pool),
+        m_key(key),
+        m_url(url),
+        m_session(session),
+        m_reused(reused),
+        m_state(kIdle),
+        m_pendingRequest(nullptr),
+        m_responseStream(nullptr),
+        m_responseKeepAlive(false)
+   {
+   }
+
+   CPooledSession::~CPooledSession()
+   {
+      switch (m_state)
+      {
+      case kIdle:
+         m_pool.release(m_key, m_session);
+         break;
+
+      case kResponseReceived:
+         if (!m_responseKeepAlive)
+            break;
+         try
+         {
+            // Skip unread body, so the connection is ready for next request
+            if (m_responseStream)
+               m_responseStream->ignore(std::numeric_limits<std::streamsize>::max());
+            m_pool.release(m_key, m_session);
+         }
+         catch (std::exception&)
+         {
+            // Connection is dropped
+         }
+         break;
+
+      default:
+         // Connection state is unknown, drop it
+         break;
+      }
+   }
+
+   void CPooledSession::setTimeout(const boost::posix_time::time_duration& timeout)
+   {
+      m_session->setTimeout(Poco::Timespan(timeout.total_microseconds()));
+   }
+
+   std::ostream& CPooledSession::sendRequest(Poco::Net::HTTPRequest& request)
+   {
+      m_pendingRequest = &request;
+      m_responseStream = nullptr;
+      m_requestStart = boost::chrono::steady_clock::now();
+
+      try
+      {
+         try
+         {
+            if (!m_session->connected())
+               m_pool.recordConnection(m_key);
+
+            auto& requestStream = m_session->sendRequest(request);
+            m_state = kRequestSent;
+            return requestStream;
+         }
+         catch (Poco::Net::NetException& e)
+         {
+            if (!canResend())
+               throw;
+
+            YADOMS_LOG(debug) << "Kept-alive connection to " << m_key << " was closed (" << e.displayText() << "), reconnect";
+            return resendOnNewConnection();
+         }
+      }
+      catch (Poco::Exception&)
+      {
+         m_state = kBroken;
+         m_pool.recordFailure(m_key);
+         throw;
+      }
+   }
+
+   std::istream& CPooledSession::receiveResponse(Poco::Net::HTTPResponse& response)
+   {
+      try
+      {
+         try
+         {
+            m_responseStream = &m_session->receiveResponse(response);
+         }
+         catch (Poco::Net::NetException& e)
+         {
+            if (!canResend())
+               throw;
+
+            YADOMS_LOG(debug) << "Kept-alive connection to " << m_key << " was closed (" << e.displayText() << "), reconnect";
+            response.clear();
+            resendOnNewConnection();
+            m_responseStream = &m_session->receiveResponse(response);
+         }
+      }
+      catch (Poco::Exception&)
+      {
+         m_state = kBroken;
+         m_pool.recordFailure(m_key);
+         throw;
+      }
+
+      m_state = kResponseReceived;
+      m_responseKeepAlive = response.getKeepAlive();
+      m_pool.recordRequest(m_key, boost::chrono::steady_clock::now() - m_requestStart);
+      return *m_responseStream;
+   }
+
+   const std::string& CPooledSession::getUrl() const
+   {
+      return m_url;
+   }
+
+   bool CPooledSession::canResend() const
+   {
+      // Only idempotent requests without body, and only once
+      return m_reused &&
+         m_pendingRequest &&
+         (m_pendingRequest->getMethod() == Poco::Net::HTTPRequest::HTTP_GET || m_pendingRequest->getMethod() == Poco::Net::HTTPRequest::HTTP_HEAD);
+   }
+
+   std::ostream& CPooledSession::resendOnNewConnection()
+   {
+      m_reused = false;
+      m_session->reset();
+      m_pool.recordConnection(m_key);
+      m_requestStart = boost::chrono::steady_clock::now();
+      auto& requestStream = m_session->sendRequest(*m_pendingRequest);
+      m_state = kRequestSent;
+      return requestStream;
+   }
+} // namespace shared
@@ -0,0 +1,76 @@
+#pragma once
+#include "IHttpSession.h"
+#include <boost/chrono.hpp>
+
+namespace shared
+{
+   class CHttpSessionPool;
+
+   //--------------------------------------------------------------
+   /// \brief	Session borrowed from the HTTP session pool
+   ///
+   /// The connection returns to the pool at destruction, if the response was received
+   /// and its body can be skipped. A GET sent on a reused connection closed meanwhile
+   /// by the server is transparently sent again on a new connection.
+   //--------------------------------------------------------------
+   class CPooledSession : public IHTTPSession
+   {
+   public:
+      //--------------------------------------------------------------
+      /// \brief	    Constructor
+      /// \param[in]  pool            the owner pool
+      /// \param[in]  key             the host key in the pool
+      /// \param[in]  url             the url where to send the request
+      /// \param[in]  session         the Poco session
+      /// \param[in]  reused          true if the session connection comes from the pool
+      //--------------------------------------------------------------
+      CPooledSession(CHttpSessionPool& pool,
+                     const std::string& key,
+                     const std::string& url,
+                     boost::shared_ptr<Poco::Net::HTTPClientSession> session,
+                     bool reused);
+
+      //--------------------------------------------------------------
+      /// \brief	    Destructor (give back the session to the pool)
+      //--------------------------------------------------------------
+      virtual ~CPooledSession();
+
+      // IHTTPSession implementation
+      void setTimeout(const boost::posix_time::time_duration& timeout) override;
+      std::ostream& sendRequest(Poco::Net::HTTPRequest& request) override;
+      std::istream& receiveResponse(Poco::Net::HTTPResponse& response) override;
+      const std::string& getUrl() const override;
+      // [END] IHTTPSession implementation
+
+   private:
+      //--------------------------------------------------------------
+      /// \brief	    Close the connection and send again the pending GET request
+      /// \return     the request stream
+      //--------------------------------------------------------------
+      std::ostream& resendOnNewConnection();
+
+      //--------------------------------------------------------------
+      /// \brief	    Return true if the request is sent again on error on a reused connection
+      //--------------------------------------------------------------
+      bool canResend() const;
+
+      enum EState
+      {
+         kIdle = 0,
+         kRequestSent,
+         kResponseReceived,
+         kBroken
+      };
+
+      CHttpSessionPool& m_pool;
+      const std::string m_key;
+      const std::string m_url;
+      boost::shared_ptr<Poco::Net::HTTPClientSession> m_session;
+      bool m_reused;
+      EState m_state;
+      Poco::Net::HTTPRequest* m_pendingRequest;
+      std::istream* m_responseStream;
+      bool m_responseKeepAlive;
+      boost::chrono::steady_clock::time_point m_requestStart;
+   };
+} // namespace shared
@@ -0,0 +1,163 @@
+#include "stdafx.h"
+#include "BoundedAsyncChannel.h"
+
+namespace shared
+{
+   namespace logInternal
+   {
+      const std::size_t CBoundedAsyncChannel::DefaultCapacity = 4096;
+
+      CBoundedAsyncChannel::CBoundedAsyncChannel(Poco::Channel* channel,
+                                                 std::size_t capacity)
+         : m_channel(channel, true),
+           m_ring(capacity),
+           m_first(0),
+           m_count(0),
+           m_dropped(0),
+           m_running(true),
+           m_stopRequested(false),
+           m_writing(false)
+      {
+         m_writerThread = boost::thread(&CBoundedAsyncChannel::doWork, this);
+      }
+
+      CBoundedAsyncChannel::~CBoundedAsyncChannel()
+      {
+         try
+         {
+            close();
+         }
+         catch (...)
+         {
+         }
+      }
+
+      void CBoundedAsyncChannel::close()
+      {
+         {
+            boost::lock_guard<boost::mutex> lock(m_mutex);
+            if (m_stopRequested)
+               return;
+            m_stopRequested = true;
+         }
+         m_messageAvailable.notify_one();
+
+         //writer thread exits when all queued messages are written
+         if (m_writerThread.joinable())
+            m_writerThread.join();
+
+         m_channel->close();
+      }
+
+      void CBoundedAsyncChannel::log(const Poco::Message& msg)
+      {
+         const auto mustBeWritten = msg.getPriority() <= Poco::Message::PRIO_CRITICAL;
+
+         boost::unique_lock<boost::mutex> lock(m_mutex);
+         if (!m_running)
+         {
+            lock.unlock();
+            m_channel->log(msg);
+            return;
+         }
+
+         if (m_count == m_ring.size())
+         {
+            if (!mustBeWritten)
+            {
+               ++m_dropped;
+               return;
+            }
+            while (m_running && m_count == m_ring.size())
+               m_queueChanged.wait(lock);
+            if (!m_running)
+            {
+               lock.unlock();
+               m_channel->log(msg);
+               return;
+            }
+         }
+
+         copyMessage(msg, m_ring[(m_first + m_count) % m_ring.size()]);
+         ++m_count;
+         m_messageAvailable.notify_one();
+
+         //process can be stopped just after a fatal message, make sure it is written
+         if (mustBeWritten)
+         {
+            while (m_running && (m_count != 0 || m_writing))
+               m_queueChanged.wait(lock);
+         }
+      }
+
+      void CBoundedAsyncChannel::doWork()
+      {
+         std::vector<Poco::Message> batch(m_ring.size());
+
+         boost::unique_lock<boost::mutex> lock(m_mutex);
+         while (true)
+         {
+            while (m_count == 0 && m_dropped == 0 && !m_stopRequested)
+               m_messageAvailable.wait(lock);
+
+            if (m_count == 0 && m_dropped == 0)
+               break;
+
+            //take all queued messages (swap keeps the allocated buffers in the ring)
+            const auto batchSize = m_count;
+            for (std::size_t index = 0; index < batchSize; ++index)
+               batch[index].swap(m_ring[(m_first + index) % m_ring.size()]);
+            m_first = 0;
+            m_count = 0;
+            const auto dropped = m_dropped;
+            m_dropped = 0;
+            m_writing = true;
+            lock.unlock();
+            m_queueChanged.notify_all();
+
+            for (std::size_t index = 0; index < batchSize; ++index)
+            {
+               try
+               {
+                  m_channel->log(batch[index]);
+               }
+               catch (...)
+               {
+                  //nowhere to report a log error
+               }
+            }
+
+            if (dropped != 0)
+            {
+               try
+               {
+                  m_channel->log(Poco::Message(batch[0].getSource(),
+                                               (boost::format("%1% log messages dropped (log queue full)") % dropped).str(),
+                                               Poco::Message::PRIO_WARNING));
+               }
+               catch (...)
+               {
+               }
+            }
+
+            lock.lock();
+            m_writing = false;
+            m_queueChanged.notify_all();
+         }
+
+         m_running = false;
+         m_queueChanged.notify_all();
+      }
+
+      void CBoundedAsyncChannel::copyMessage(const Poco::Message& from, Poco::Message& to)
+      {
+         to.setSource(from.getSource());
+         to.setText(from.getText());
+         to.setPriority(from.getPriority());
+         to.setTime(from.getTime());
+         to.setThread(from.getThread());
+         to.setTid(from.getTid());
+         to.setPid(from.getPid());
+      }
+   } // namespace logInternal
+} // namespace shared
@@ -0,0 +1,87 @@
+#pragma once
+#include <shared/Export.h>
+#include <Poco/Channel.h>
+#include <Poco/AutoPtr.h>
+#include <Poco/Message.h>
+
+namespace shared
+{
+   namespace logInternal
+   {
+      //--------------------------------------------------------------
+      /// \brief	    Channel writing messages to another channel from a dedicated thread
+      ///
+      /// Messages are copied into a ring of preallocated messages, so logging thread never
+      /// waits for the wrapped channel (file write on a slow storage for example).
+      /// When the ring is full, new messages are dropped (and the drop count is logged later),
+      /// except fatal and critical messages which wait until all queued messages are written.
+      /// After close, messages are written synchronously.
+      //--------------------------------------------------------------
+      class YADOMS_SHARED_EXPORT CBoundedAsyncChannel : public Poco::Channel
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \brief	    Constructor
+         /// \param [in] channel    The wrapped channel
+         /// \param [in] capacity   The maximum number of queued messages
+         //--------------------------------------------------------------
+         explicit CBoundedAsyncChannel(Poco::Channel* channel,
+                                       std::size_t capacity = DefaultCapacity);
+
+         // Poco::Channel implementation
+         void close() override;
+         void log(const Poco::Message& msg) override;
+         // [END] Poco::Channel implementation
+
+         //--------------------------------------------------------------
+         /// \brief	    The default maximum number of queued messages
+         //--------------------------------------------------------------
+         static const std::size_t DefaultCapacity;
+
+      protected:
+         virtual ~CBoundedAsyncChannel();
+
+      private:
+         //--------------------------------------------------------------
+         /// \brief	    The writer thread
+         //--------------------------------------------------------------
+         void doWork();
+
+         //--------------------------------------------------------------
+         /// \brief	    Copy a message, reusing the destination buffers
+         /// \param [in] from    The source message
+         /// \param [in] to      The destination message
+         //--------------------------------------------------------------
+         static void copyMessage(const Poco::Message& from, Poco::Message& to);
+
+         //--------------------------------------------------------------
+         /// \brief	    The wrapped channel
+         //--------------------------------------------------------------
+         Poco::AutoPtr<Poco::Channel> m_channel;
+
+         //--------------------------------------------------------------
+         /// \brief	    The queued messages (ring buffer)
+         //--------------------------------------------------------------
+         std::vector<Poco::Message> m_ring;
+         std::size_t m_first;
+         std::size_t m_count;
+
+         //--------------------------------------------------------------
+         /// \brief	    The number of dropped messages, not reported yet
+         //--------------------------------------------------------------
+         std::size_t m_dropped;
+
+         //--------------------------------------------------------------
+         /// \brief	    The writer thread state
+         //--------------------------------------------------------------
+         bool m_running;
+         bool m_stopRequested;
+         bool m_writing;
+
+         boost::mutex m_mutex;
+         boost::condition_variable m_messageAvailable;
+         boost::condition_variable m_queueChanged;
+         boost::thread m_writerThread;
+      };
+   } // namespace logInternal
+} // namespace shared
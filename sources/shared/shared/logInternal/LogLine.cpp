@@ -0,0 +1,101 @@
+#include "stdafx.h"
+#include "LogLine.h"
+#include "../Log.h"
+#include <boost/thread/tss.hpp>
+
+namespace shared
+{
+   namespace logInternal
+   {
+      //--------------------------------------------------------------
+      /// \brief	    The log streams of a thread
+      //--------------------------------------------------------------
+      class CThreadLogStreams
+      {
+      public:
+         CThreadLogStreams()
+            : m_inUse(0),
+              m_defaultFormat(nullptr),
+              m_nullStream(nullptr)
+         {
+         }
+
+         std::ostringstream& acquire()
+         {
+            //a message can be logged while building another one (logs in a streamed function)
+            if (m_inUse == m_streams.size())
+               m_streams.push_back(boost::make_shared<std::ostringstream>());
+
+            auto& stream = *m_streams[m_inUse++];
+            stream.str(std::string());
+            stream.clear();
+            stream.copyfmt(m_defaultFormat);
+            return stream;
+         }
+
+         void release()
+         {
+            --m_inUse;
+         }
+
+         std::ostream& nullStream()
+         {
+            return m_nullStream;
+         }
+
+      private:
+         std::size_t m_inUse;
+         std::vector<boost::shared_ptr<std::ostringstream>> m_streams;
+         std::ios m_defaultFormat;
+         std::ostream m_nullStream;
+      };
+
+      static CThreadLogStreams& threadLogStreams()
+      {
+         //never destroyed, messages can be logged until the very end of the process
+         static auto threadStreams = new boost::thread_specific_ptr<CThreadLogStreams>();
+         if (!threadStreams->get())
+            threadStreams->reset(new CThreadLogStreams());
+         return *threadStreams->get();
+      }
+
+      CLogLine::CLogLine(Poco::Logger& logger, Poco::Message::Priority priority)
+         : m_logger(logger),
+           m_priority(priority),
+           m_stream(threadLogStreams().acquire())
+      {
+      }
+
+      CLogLine::~CLogLine()
+      {
+         try
+         {
+            //recommended to create Message only for propagated message (performance issue)
+            if (m_logger.is(m_priority))
+            {
+               Poco::Message msg;
+               msg.setText(m_stream.str());
+               msg.setPriority(m_priority);
+               msg.setThread(CLog::getCurrentThreadName());
+               m_logger.log(msg);
+            }
+         }
+         catch (...)
+         {
+            //a log must never throw
+         }
+
+         threadLogStreams().release();
+      }
+
+      std::ostream& CLogLine::stream() const
+      {
+         return m_stream;
+      }
+
+      std::ostream& CLogLine::nullStream()
+      {
+         return threadLogStreams().nullStream();
+      }
+   } // namespace logInternal
+} // namespace shared
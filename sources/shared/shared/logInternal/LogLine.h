@@ -0,0 +1,62 @@
+#pragma once
+#include <shared/Export.h>
+#include <Poco/Logger.h>
+#include <Poco/Message.h>
+
+namespace shared
+{
+   namespace logInternal
+   {
+      //--------------------------------------------------------------
+      /// \brief	    The priorities, named as YADOMS_LOG levels
+      //--------------------------------------------------------------
+      namespace priority
+      {
+         const Poco::Message::Priority fatal = Poco::Message::PRIO_FATAL;
+         const Poco::Message::Priority critical = Poco::Message::PRIO_CRITICAL;
+         const Poco::Message::Priority error = Poco::Message::PRIO_ERROR;
+         const Poco::Message::Priority warning = Poco::Message::PRIO_WARNING;
+         const Poco::Message::Priority notice = Poco::Message::PRIO_NOTICE;
+         const Poco::Message::Priority information = Poco::Message::PRIO_INFORMATION;
+         const Poco::Message::Priority debug = Poco::Message::PRIO_DEBUG;
+         const Poco::Message::Priority trace = Poco::Message::PRIO_TRACE;
+      } // namespace priority
+
+      //--------------------------------------------------------------
+      /// \brief	    One log message, sent to the logger when destroyed
+      ///
+      /// The message is written in a stream of the calling thread, reused
+      /// from one message to the next one (no allocation in the common case).
+      //--------------------------------------------------------------
+      class YADOMS_SHARED_EXPORT CLogLine : boost::noncopyable
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \brief	    Constructor
+         /// \param [in] logger     The logger receiving the message
+         /// \param [in] priority   The message priority
+         //--------------------------------------------------------------
+         CLogLine(Poco::Logger& logger, Poco::Message::Priority priority);
+
+         //--------------------------------------------------------------
+         /// \brief	    Destructor, send the message
+         //--------------------------------------------------------------
+         virtual ~CLogLine();
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the message stream
+         //--------------------------------------------------------------
+         std::ostream& stream() const;
+
+         //--------------------------------------------------------------
+         /// \brief	    Get a stream of the calling thread ignoring all output (used when level is disabled)
+         //--------------------------------------------------------------
+         static std::ostream& nullStream();
+
+      private:
+         Poco::Logger& m_logger;
+         const Poco::Message::Priority m_priority;
+         std::ostringstream& m_stream;
+      };
+   } // namespace logInternal
+} // namespace shared
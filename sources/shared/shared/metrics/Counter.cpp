@@ -0,0 +1,22 @@
+#include "stdafx.h"
+#include "Counter.h"
+
+namespace shared
+{
+   namespace metrics
+   {
+      CCounter::CCounter()
+         : m_value(0)
+      {
+      }
+
+      CCounter::~CCounter()
+      {
+      }
+
+      unsigned long long CCounter::value() const
+      {
+         return m_value.load(std::memory_order_relaxed);
+      }
+   } // namespace metrics
+} // namespace shared
@@ -0,0 +1,44 @@
+#pragma once
+#include <shared/Export.h>
+#include "MetricsSwitch.h"
+
+namespace shared
+{
+   namespace metrics
+   {
+      //--------------------------------------------------------------
+      /// \brief	Monotonic counter (lock-free)
+      //--------------------------------------------------------------
+      class YADOMS_SHARED_EXPORT CCounter
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \brief	    Constructor
+         //--------------------------------------------------------------
+         CCounter();
+
+         //--------------------------------------------------------------
+         /// \brief	    Destructor
+         //--------------------------------------------------------------
+         virtual ~CCounter();
+
+         //--------------------------------------------------------------
+         /// \brief	    Increment the counter (does nothing if metrics are disabled)
+         /// \param[in]  count         value to add
+         //--------------------------------------------------------------
+         void increment(unsigned long long count = 1)
+         {
+            if (CMetricsSwitch::enabled())
+               m_value.fetch_add(count, std::memory_order_relaxed);
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the counter value
+         //--------------------------------------------------------------
+         unsigned long long value() const;
+
+      private:
+         std::atomic<unsigned long long> m_value;
+      };
+   } // namespace metrics
+} // namespace shared
@@ -0,0 +1,22 @@
+#include "stdafx.h"
+#include "Gauge.h"
+
+namespace shared
+{
+   namespace metrics
+   {
+      CGauge::CGauge()
+         : m_value(0)
+      {
+      }
+
+      CGauge::~CGauge()
+      {
+      }
+
+      long long CGauge::value() const
+      {
+         return m_value.load(std::memory_order_relaxed);
+      }
+   } // namespace metrics
+} // namespace shared
@@ -0,0 +1,57 @@
+#pragma once
+#include <shared/Export.h>
+#include "MetricsSwitch.h"
+
+namespace shared
+{
+   namespace metrics
+   {
+      //--------------------------------------------------------------
+      /// \brief	Value which can go up and down, like a queue size (lock-free)
+      /// \note   Gauges are maintained even if metrics are disabled, as they can't be
+      ///         rebuilt from later changes once metrics are enabled
+      //--------------------------------------------------------------
+      class YADOMS_SHARED_EXPORT CGauge
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \brief	    Constructor
+         //--------------------------------------------------------------
+         CGauge();
+
+         //--------------------------------------------------------------
+         /// \brief	    Destructor
+         //--------------------------------------------------------------
+         virtual ~CGauge();
+
+         //--------------------------------------------------------------
+         /// \brief	    Set the gauge value
+         //--------------------------------------------------------------
+         void set(long long value)
+         {
+            m_value.store(value, std::memory_order_relaxed);
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Increment/decrement the gauge value
+         //--------------------------------------------------------------
+         void increment(long long delta = 1)
+         {
+            m_value.fetch_add(delta, std::memory_order_relaxed);
+         }
+
+         void decrement(long long delta = 1)
+         {
+            m_value.fetch_sub(delta, std::memory_order_relaxed);
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the gauge value
+         //--------------------------------------------------------------
+         long long value() const;
+
+      private:
+         std::atomic<long long> m_value;
+      };
+   } // namespace metrics
+} // namespace shared
@@ -0,0 +1,104 @@
+#include "stdafx.h"
+#include "LatencyHistogram.h"
+#include <cmath>
+
+namespace shared
+{
+   namespace metrics
+   {
+      namespace
+      {
+         unsigned int highestBit(unsigned long long value)
+         {
+            unsigned int bit = 0;
+            while (value >>= 1)
+               ++bit;
+            return bit;
+         }
+      }
+
+      unsigned long long CLatencyHistogram::Snapshot::percentile(double quantile) const
+      {
+         if (count == 0)
+            return 0;
+
+         auto rank = static_cast<unsigned long long>(std::ceil(quantile * count));
+         if (rank < 1)
+            rank = 1;
+
+         unsigned long long cumulated = 0;
+         for (std::size_t index = 0; index < buckets.size(); ++index)
+         {
+            cumulated += buckets[index];
+            if (cumulated >= rank)
+               return std::min(bucketUpperBound(index), maxMicroseconds);
+         }
+         return maxMicroseconds;
+      }
+
+      CLatencyHistogram::CLatencyHistogram()
+         : m_sum(0),
+           m_max(0)
+      {
+         for (auto& bucket : m_buckets)
+            bucket.store(0, std::memory_order_relaxed);
+      }
+
+      CLatencyHistogram::~CLatencyHistogram()
+      {
+      }
+
+      void CLatencyHistogram::record(unsigned long long microseconds)
+      {
+         if (!CMetricsSwitch::enabled())
+            return;
+
+         m_buckets[bucketIndex(microseconds)].fetch_add(1, std::memory_order_relaxed);
+         m_sum.fetch_add(microseconds, std::memory_order_relaxed);
+
+         auto max = m_max.load(std::memory_order_relaxed);
+         while (microseconds > max && !m_max.compare_exchange_weak(max, microseconds, std::memory_order_relaxed))
+         {
+         }
+      }
+
+      CLatencyHistogram::Snapshot CLatencyHistogram::snapshot() const
+      {
+         Snapshot snapshot;
+         snapshot.buckets.reserve(kBucketCount);
+         snapshot.count = 0;
+         for (const auto& bucket : m_buckets)
+         {
+            snapshot.buckets.push_back(bucket.load(std::memory_order_relaxed));
+            snapshot.count += snapshot.buckets.back();
+         }
+         snapshot.sumMicroseconds = m_sum.load(std::memory_order_relaxed);
+         snapshot.maxMicroseconds = m_max.load(std::memory_order_relaxed);
+         return snapshot;
+      }
+
+      std::size_t CLatencyHistogram::bucketIndex(unsigned long long microseconds)
+      {
+         // First power of 2 ranges are exact, then each power of 2 is split in kSubBucketCount
+         if (microseconds < kSubBucketCount)
+            return static_cast<std::size_t>(microseconds);
+
+         const auto bit = highestBit(microseconds);
+         if (bit >= kMaxValueBits)
+            return kBucketCount - 1;
+
+         const auto shift = bit - kSubBucketBits;
+         return (shift + 1) * kSubBucketCount + static_cast<std::size_t>((microseconds >> shift) & (kSubBucketCount - 1));
+      }
+
+      unsigned long long CLatencyHistogram::bucketUpperBound(std::size_t index)
+      {
+         if (index < kSubBucketCount)
+            return index;
+
+         const auto shift = index / kSubBucketCount - 1;
+         const auto lowerBound = static_cast<unsigned long long>(kSubBucketCount + index % kSubBucketCount) << shift;
+         return lowerBound + (1ULL << shift) - 1;
+      }
+   } // namespace metrics
+} // namespace shared
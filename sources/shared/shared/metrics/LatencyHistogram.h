@@ -0,0 +1,91 @@
+#pragma once
+#include <shared/Export.h>
+#include "MetricsSwitch.h"
+
+namespace shared
+{
+   namespace metrics
+   {
+      //--------------------------------------------------------------
+      /// \brief	Latency histogram, HDR-style (lock-free)
+      ///
+      /// Latencies are recorded in microseconds, in log-linear buckets : each power of 2
+      /// is split in 8 linear sub-buckets, so the relative error on percentiles is less than 12.5%
+      /// from 1us to several days, with a fixed memory footprint.
+      //--------------------------------------------------------------
+      class YADOMS_SHARED_EXPORT CLatencyHistogram
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \brief	    Bits of sub-bucket resolution, and resulting sizes
+         //--------------------------------------------------------------
+         enum
+         {
+            kSubBucketBits = 3,
+            kSubBucketCount = 1 << kSubBucketBits,
+            kMaxValueBits = 40,
+            kBucketCount = (kMaxValueBits - kSubBucketBits + 1) * kSubBucketCount
+         };
+
+         //--------------------------------------------------------------
+         /// \brief	    Consistent copy of the histogram content
+         //--------------------------------------------------------------
+         struct Snapshot
+         {
+            unsigned long long count;
+            unsigned long long sumMicroseconds;
+            unsigned long long maxMicroseconds;
+            std::vector<unsigned long long> buckets;
+
+            //--------------------------------------------------------------
+            /// \brief	    Get a percentile
+            /// \param[in]  quantile      the quantile, in [0; 1] (ex : 0.99)
+            /// \return     the upper bound of the bucket containing the percentile, in microseconds (0 if empty)
+            //--------------------------------------------------------------
+            unsigned long long percentile(double quantile) const;
+         };
+
+         //--------------------------------------------------------------
+         /// \brief	    Constructor
+         //--------------------------------------------------------------
+         CLatencyHistogram();
+
+         //--------------------------------------------------------------
+         /// \brief	    Destructor
+         //--------------------------------------------------------------
+         virtual ~CLatencyHistogram();
+
+         //--------------------------------------------------------------
+         /// \brief	    Record a latency (does nothing if metrics are disabled)
+         /// \param[in]  microseconds  the latency
+         //--------------------------------------------------------------
+         void record(unsigned long long microseconds);
+
+         //--------------------------------------------------------------
+         /// \brief	    Take a snapshot of the histogram
+         /// \note       Recording continues while snapshot is taken, so sum and max
+         ///             may include a few records not yet counted in buckets
+         //--------------------------------------------------------------
+         Snapshot snapshot() const;
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the bucket of a value
+         /// \param[in]  microseconds  the value
+         /// \return     the bucket index
+         //--------------------------------------------------------------
+         static std::size_t bucketIndex(unsigned long long microseconds);
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the highest value of a bucket
+         /// \param[in]  index         the bucket index
+         /// \return     the highest value (included) of the bucket
+         //--------------------------------------------------------------
+         static unsigned long long bucketUpperBound(std::size_t index);
+
+      private:
+         std::atomic<unsigned long long> m_sum;
+         std::atomic<unsigned long long> m_max;
+         std::atomic<unsigned long long> m_buckets[kBucketCount];
+      };
+   } // namespace metrics
+} // namespace shared
@@ -0,0 +1,238 @@
+#include "stdafx.h"
+#include "MetricsRegistry.h"
+#include <shared/exception/InvalidParameter.hpp>
+
+namespace shared
+{
+   namespace metrics
+   {
+      namespace
+      {
+         const double Quantiles[] = {0.5, 0.9, 0.99};
+
+         std::string escapeLabelValue(const std::string& value)
+         {
+            std::string escaped;
+            escaped.reserve(value.size());
+            for (const auto c : value)
+            {
+               switch (c)
+               {
+               case '\\': escaped += "\\\\";
+                  break;
+               case '"': escaped += "\\\"";
+                  break;
+               case '\n': escaped += "\\n";
+                  break;
+               default: escaped += c;
+                  break;
+               }
+            }
+            return escaped;
+         }
+
+         std::string toSeconds(unsigned long long microseconds)
+         {
+            return (boost::format("%1%.%2$06d") % (microseconds / 1000000) % (microseconds % 1000000)).str();
+         }
+
+         CDataContainer labelsToContainer(const CMetricsRegistry::Labels& labels)
+         {
+            CDataContainer container;
+            for (const auto& label : labels)
+               container.set(label.first, label.second, 0x00);
+            return container;
+         }
+      }
+
+      CMetricsRegistry& CMetricsRegistry::instance()
+      {
+         static CMetricsRegistry StaticMetricsRegistry;
+         return StaticMetricsRegistry;
+      }
+
+      CMetricsRegistry::CMetricsRegistry()
+      {
+      }
+
+      CMetricsRegistry::~CMetricsRegistry()
+      {
+      }
+
+      CCounter& CMetricsRegistry::counter(const std::string& name,
+                                          const std::string& help,
+                                          const Labels& labels)
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         std::string labelsKey;
+         auto& metric = family(name, help, kCounter, labels, labelsKey).counters[labelsKey];
+         if (!metric)
+            metric = boost::make_shared<CCounter>();
+         return *metric;
+      }
+
+      CGauge& CMetricsRegistry::gauge(const std::string& name,
+                                      const std::string& help,
+                                      const Labels& labels)
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         std::string labelsKey;
+         auto& metric = family(name, help, kGauge, labels, labelsKey).gauges[labelsKey];
+         if (!metric)
+            metric = boost::make_shared<CGauge>();
+         return *metric;
+      }
+
+      CLatencyHistogram& CMetricsRegistry::histogram(const std::string& name,
+                                                     const std::string& help,
+                                                     const Labels& labels)
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         std::string labelsKey;
+         auto& metric = family(name, help, kHistogram, labels, labelsKey).histograms[labelsKey];
+         if (!metric)
+            metric = boost::make_shared<CLatencyHistogram>();
+         return *metric;
+      }
+
+      CMetricsRegistry::Family& CMetricsRegistry::family(const std::string& name,
+                                                         const std::string& help,
+                                                         EType type,
+                                                         const Labels& labels,
+                                                         std::string& labelsKey)
+      {
+         auto familyIt = m_families.find(name);
+         if (familyIt == m_families.end())
+         {
+            Family newFamily;
+            newFamily.type = type;
+            newFamily.help = help;
+            familyIt = m_families.insert(std::make_pair(name, newFamily)).first;
+         }
+         else if (familyIt->second.type != type)
+         {
+            throw exception::CInvalidParameter(name + " : metric already registered with another type");
+         }
+
+         labelsKey = formatLabels(labels);
+         familyIt->second.labels[labelsKey] = labels;
+         return familyIt->second;
+      }
+
+      const char* CMetricsRegistry::typeName(EType type)
+      {
+         switch (type)
+         {
+         case kCounter: return "counter";
+         case kGauge: return "gauge";
+         default: return "summary";
+         }
+      }
+
+      std::string CMetricsRegistry::formatLabels(const Labels& labels,
+                                                 const std::string& extraLabel)
+      {
+         if (labels.empty() && extraLabel.empty())
+            return std::string();
+
+         std::string formatted("{");
+         for (const auto& label : labels)
+         {
+            if (formatted.size() > 1)
+               formatted += ",";
+            formatted += label.first + "=\"" + escapeLabelValue(label.second) + "\"";
+         }
+         if (!extraLabel.empty())
+         {
+            if (formatted.size() > 1)
+               formatted += ",";
+            formatted += extraLabel;
+         }
+         formatted += "}";
+         return formatted;
+      }
+
+      std::string CMetricsRegistry::toPrometheus() const
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+
+         std::ostringstream output;
+         for (const auto& family : m_families)
+         {
+            const auto& name = family.first;
+            output << "# HELP " << name << " " << family.second.help << "\n";
+            output << "# TYPE " << name << " " << typeName(family.second.type) << "\n";
+
+            for (const auto& counter : family.second.counters)
+               output << name << counter.first << " " << counter.second->value() << "\n";
+
+            for (const auto& gauge : family.second.gauges)
+               output << name << gauge.first << " " << gauge.second->value() << "\n";
+
+            for (const auto& histogram : family.second.histograms)
+            {
+               const auto& labels = family.second.labels.at(histogram.first);
+               const auto snapshot = histogram.second->snapshot();
+               for (const auto quantile : Quantiles)
+                  output << name << formatLabels(labels, (boost::format("quantile=\"%1%\"") % quantile).str()) << " "
+                     << toSeconds(snapshot.percentile(quantile)) << "\n";
+               output << name << "_sum" << histogram.first << " " << toSeconds(snapshot.sumMicroseconds) << "\n";
+               output << name << "_count" << histogram.first << " " << snapshot.count << "\n";
+            }
+         }
+         return output.str();
+      }
+
+      CDataContainer CMetricsRegistry::toContainer() const
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+
+         CDataContainer metrics;
+         for (const auto& family : m_families)
+         {
+            std::vector<CDataContainer> series;
+
+            for (const auto& counter : family.second.counters)
+            {
+               CDataContainer serie;
+               serie.set("labels", labelsToContainer(family.second.labels.at(counter.first)));
+               serie.set("value", counter.second->value());
+               series.push_back(serie);
+            }
+
+            for (const auto& gauge : family.second.gauges)
+            {
+               CDataContainer serie;
+               serie.set("labels", labelsToContainer(family.second.labels.at(gauge.first)));
+               serie.set("value", gauge.second->value());
+               series.push_back(serie);
+            }
+
+            for (const auto& histogram : family.second.histograms)
+            {
+               const auto snapshot = histogram.second->snapshot();
+               CDataContainer serie;
+               serie.set("labels", labelsToContainer(family.second.labels.at(histogram.first)));
+               serie.set("count", snapshot.count);
+               serie.set("sumMicroseconds", snapshot.sumMicroseconds);
+               serie.set("maxMicroseconds", snapshot.maxMicroseconds);
+               serie.set("p50Microseconds", snapshot.percentile(0.5));
+               serie.set("p90Microseconds", snapshot.percentile(0.9));
+               serie.set("p99Microseconds", snapshot.percentile(0.99));
+               series.push_back(serie);
+            }
+
+            CDataContainer familyContainer;
+            familyContainer.set("help", family.second.help);
+            familyContainer.set("type", typeName(family.second.type));
+            familyContainer.set("series", series);
+            metrics.set(family.first, familyContainer, 0x00);
+         }
+
+         CDataContainer result;
+         result.set("enabled", CMetricsSwitch::enabled());
+         result.set("metrics", metrics);
+         return result;
+      }
+   } // namespace metrics
+} // namespace shared
@@ -0,0 +1,123 @@
+#pragma once
+#include <shared/Export.h>
+#include <shared/DataContainer.h>
+#include "Counter.h"
+#include "Gauge.h"
+#include "LatencyHistogram.h"
+#include <boost/thread/mutex.hpp>
+
+namespace shared
+{
+   namespace metrics
+   {
+      //--------------------------------------------------------------
+      /// \brief	Registry of all the metrics of the process
+      ///
+      /// Metrics are identified by a name and a set of labels (Prometheus model).
+      /// Getting a metric from the registry takes a lock, so callers should keep the returned
+      /// reference (metrics are never destroyed before the registry). Recording is lock-free.
+      //--------------------------------------------------------------
+      class YADOMS_SHARED_EXPORT CMetricsRegistry
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \brief	    Labels of a metric (name, value)
+         //--------------------------------------------------------------
+         typedef std::vector<std::pair<std::string, std::string>> Labels;
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the registry of the process
+         //--------------------------------------------------------------
+         static CMetricsRegistry& instance();
+
+         //--------------------------------------------------------------
+         /// \brief	    Constructor
+         //--------------------------------------------------------------
+         CMetricsRegistry();
+
+         //--------------------------------------------------------------
+         /// \brief	    Destructor
+         //--------------------------------------------------------------
+         virtual ~CMetricsRegistry();
+
+         //--------------------------------------------------------------
+         /// \brief	    Get (create if needed) a metric
+         /// \param[in]  name          the metric name (ex : "yadoms_ipc_message_duration_seconds")
+         /// \param[in]  help          the metric description
+         /// \param[in]  labels        the labels identifying this metric among others with same name
+         /// \return     the metric, valid as long as the registry
+         /// \throw      shared::exception::CInvalidParameter if the name is already used by another type of metric
+         //--------------------------------------------------------------
+         CCounter& counter(const std::string& name,
+                           const std::string& help,
+                           const Labels& labels = Labels());
+         CGauge& gauge(const std::string& name,
+                       const std::string& help,
+                       const Labels& labels = Labels());
+         CLatencyHistogram& histogram(const std::string& name,
+                                      const std::string& help,
+                                      const Labels& labels = Labels());
+
+         //--------------------------------------------------------------
+         /// \brief	    Export all metrics in Prometheus text exposition format (version 0.0.4)
+         /// \note       Histograms are exported as summaries (quantiles 0.5, 0.9, 0.99, sum and count, in seconds)
+         //--------------------------------------------------------------
+         std::string toPrometheus() const;
+
+         //--------------------------------------------------------------
+         /// \brief	    Export all metrics in a container (for JSON serialization)
+         //--------------------------------------------------------------
+         CDataContainer toContainer() const;
+
+      private:
+         //--------------------------------------------------------------
+         /// \brief	    Metric types
+         //--------------------------------------------------------------
+         enum EType
+         {
+            kCounter,
+            kGauge,
+            kHistogram
+         };
+
+         //--------------------------------------------------------------
+         /// \brief	    All metrics with same name
+         //--------------------------------------------------------------
+         struct Family
+         {
+            EType type;
+            std::string help;
+            std::map<std::string, Labels> labels;
+            std::map<std::string, boost::shared_ptr<CCounter>> counters;
+            std::map<std::string, boost::shared_ptr<CGauge>> gauges;
+            std::map<std::string, boost::shared_ptr<CLatencyHistogram>> histograms;
+         };
+
+         //--------------------------------------------------------------
+         /// \brief	    Get (create if needed) a family, and record the labels
+         /// \return     the family, and the labels key in family
+         //--------------------------------------------------------------
+         Family& family(const std::string& name,
+                        const std::string& help,
+                        EType type,
+                        const Labels& labels,
+                        std::string& labelsKey);
+
+         //--------------------------------------------------------------
+         /// \brief	    Get the Prometheus name of a metric type
+         //--------------------------------------------------------------
+         static const char* typeName(EType type);
+
+         //--------------------------------------------------------------
+         /// \brief	    Format labels as Prometheus does ({name="value",...})
+         /// \param[in]  labels        the labels
+         /// \param[in]  extraLabel    an optional additional label (already formatted)
+         //--------------------------------------------------------------
+         static std::string formatLabels(const Labels& labels,
+                                         const std::string& extraLabel = std::string());
+
+         mutable boost::mutex m_mutex;
+         std::map<std::string, Family> m_families;
+      };
+   } // namespace metrics
+} // namespace shared
@@ -0,0 +1,15 @@
+#include "stdafx.h"
+#include "MetricsSwitch.h"
+
+namespace shared
+{
+   namespace metrics
+   {
+      std::atomic<bool> CMetricsSwitch::m_enabled(false);
+
+      void CMetricsSwitch::enable(bool enabled)
+      {
+         m_enabled.store(enabled, std::memory_order_relaxed);
+      }
+   } // namespace metrics
+} // namespace shared
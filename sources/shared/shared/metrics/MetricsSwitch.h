@@ -0,0 +1,34 @@
+#pragma once
+#include <shared/Export.h>
+#include <atomic>
+
+namespace shared
+{
+   namespace metrics
+   {
+      //--------------------------------------------------------------
+      /// \brief	Global switch of the metrics collection
+      /// \note   Disabled by default. When disabled, recording a metric costs only a relaxed atomic load.
+      //--------------------------------------------------------------
+      class YADOMS_SHARED_EXPORT CMetricsSwitch
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \brief	    Enable or disable the metrics collection
+         /// \param[in]  enabled       true to collect metrics
+         //--------------------------------------------------------------
+         static void enable(bool enabled);
+
+         //--------------------------------------------------------------
+         /// \brief	    Check if metrics are collected
+         //--------------------------------------------------------------
+         static bool enabled()
+         {
+            return m_enabled.load(std::memory_order_relaxed);
+         }
+
+      private:
+         static std::atomic<bool> m_enabled;
+      };
+   } // namespace metrics
+} // namespace shared
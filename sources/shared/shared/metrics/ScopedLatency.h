@@ -0,0 +1,45 @@
+#pragma once
+#include <shared/Export.h>
+#include "LatencyHistogram.h"
+#include <chrono>
+
+namespace shared
+{
+   namespace metrics
+   {
+      //--------------------------------------------------------------
+      /// \brief	Record in a histogram the time spent in a scope
+      /// \note   Clock is not even read if metrics are disabled at construction
+      //--------------------------------------------------------------
+      class YADOMS_SHARED_EXPORT CScopedLatency
+      {
+      public:
+         //--------------------------------------------------------------
+         /// \brief	    Constructor
+         /// \param[in]  histogram     the histogram where to record the latency
+         //--------------------------------------------------------------
+         explicit CScopedLatency(CLatencyHistogram& histogram)
+            : m_histogram(CMetricsSwitch::enabled() ? &histogram : nullptr)
+         {
+            if (m_histogram)
+               m_start = std::chrono::steady_clock::now();
+         }
+
+         //--------------------------------------------------------------
+         /// \brief	    Destructor, record the latency
+         //--------------------------------------------------------------
+         ~CScopedLatency()
+         {
+            if (m_histogram)
+               m_histogram->record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count());
+         }
+
+      private:
+         CScopedLatency(const CScopedLatency&);
+         CScopedLatency& operator=(const CScopedLatency&);
+
+         CLatencyHistogram* m_histogram;
+         std::chrono::steady_clock::time_point m_start;
+      };
+   } // namespace metrics
+} // namespace shared
@@ -14,6 +14,9 @@ namespace shared
 
       CYadomsSubModuleLogConfiguration::~CYadomsSubModuleLogConfiguration()
       {
+         //write pending messages
+         if (!m_asyncFileChannel.isNull())
+            m_asyncFileChannel->close();
       }
 
       void CYadomsSubModuleLogConfiguration::configure(const std::string& logLevel,
@@ -35,19 +38,20 @@ namespace shared
          m_fileChannel->setProperty("rotateOnOpen", "true");
          m_formattingFileChannel.assign(new Poco::FormattingChannel(m_patternFormatter,
                                                                     m_fileChannel));
+         m_asyncFileChannel.assign(new logInternal::CBoundedAsyncChannel(m_formattingFileChannel));
 
          //configure any already created loggers
          std::vector<std::string> loggerNames;
          Poco::Logger::names(loggerNames);
          for (const auto& loggerName : loggerNames)
          {
-            Poco::Logger::get(loggerName).setChannel(m_formattingFileChannel);
+            Poco::Logger::get(loggerName).setChannel(m_asyncFileChannel);
             Poco::Logger::get(loggerName).setLevel(logLevel);
          }
          loggerNames.clear();
 
          //configure root logger
-         Poco::Logger::root().setChannel(m_formattingFileChannel);
+         Poco::Logger::root().setChannel(m_asyncFileChannel);
          Poco::Logger::root().setLevel(logLevel);
       }
    }
@@ -5,6 +5,7 @@
 #include <Poco/FormattingChannel.h>
 #include <Poco/PatternFormatter.h>
 #include "CoutCerrConsoleLogChannel.h"
+#include <shared/logInternal/BoundedAsyncChannel.h>
 
 namespace shared
 {
@@ -36,6 +37,7 @@ namespace shared
       private:
          Poco::AutoPtr<Poco::PatternFormatter> m_patternFormatter;
          Poco::AutoPtr<Poco::FormattingChannel> m_formattingFileChannel;
+         Poco::AutoPtr<logInternal::CBoundedAsyncChannel> m_asyncFileChannel;
          Poco::AutoPtr<Poco::FileChannel> m_fileChannel;
       };
    }
@@ -43,11 +43,20 @@ namespace shared
             //-----------------------------------------------------
             ///\brief Read the last known state of the keyword
             ///\param[in] keywordId The keyword ID we are interesting in
-            ///\return The last known keyword state (empty if no known state)
-            ///\throw std::out_of_range if keyword not found
+            ///\return The last known keyword state
+            ///\throw std::out_of_range if keyword not found, or if keyword has no known state
             //-----------------------------------------------------
             virtual std::string readKeyword(int keywordId) const = 0;
 
+            //-----------------------------------------------------
+            ///\brief Read the last known states of several keywords, in one call
+            ///\param[in] keywordIdList The keyword IDs we are interesting in
+            ///\return The last known keyword states, in the same order than keywordIdList (empty string if no known state)
+            ///\throw std::out_of_range if one of the keyword is not found
+            ///\note Unlike readKeyword, a keyword without known state is not an error
+            //-----------------------------------------------------
+            virtual std::vector<std::string> readKeywords(const std::vector<int>& keywordIdList) const = 0;
+
             //-----------------------------------------------------
             ///\brief Wait for a new acquisition on a keyword
             ///\param[in] keywordId The keyword ID to watch
@@ -103,6 +112,37 @@ namespace shared
             //-----------------------------------------------------
             virtual void writeKeyword(int keywordId, const std::string& newState) = 0;
 
+            //-----------------------------------------------------
+            ///\brief Change state of several keywords, in one call
+            ///\param[in] newStates The list of keyword ID and new state pairs
+            ///\throw std::out_of_range if one of the keyword is not found (no state is changed)
+            //-----------------------------------------------------
+            virtual void writeKeywords(const std::vector<std::pair<int, std::string>>& newStates) = 0;
+
+            //-----------------------------------------------------
+            ///\brief Subscribe to the acquisitions of a keyword list
+            ///\param[in] keywordIdList The keyword IDs list to watch
+            ///\throw std::out_of_range if one of the keyword is not found
+            ///\note Acquisitions are queued by Yadoms from this call, until unsubscribeAcquisitions is called,
+            ///      so no acquisition is missed between two calls of waitForSubscribedAcquisitions.
+            ///      Calling it again replaces the current subscription (pending acquisitions are dropped).
+            //-----------------------------------------------------
+            virtual void subscribeAcquisitions(const std::vector<int>& keywordIdList) = 0;
+
+            //-----------------------------------------------------
+            ///\brief Wait for acquisitions of the subscribed keywords
+            ///\param[in] timeout Timeout to wait.
+            ///\return All pending acquisitions (pairs of keyword Id and value), in reception order. Empty if timeout.
+            ///\throw std::out_of_range if no subscription is opened
+            //-----------------------------------------------------
+            virtual std::vector<std::pair<int, std::string>> waitForSubscribedAcquisitions(const std::string& timeout = std::string()) = 0;
+
+            //-----------------------------------------------------
+            ///\brief Close the acquisitions subscription
+            ///\note Do nothing if no subscription is opened
+            //-----------------------------------------------------
+            virtual void unsubscribeAcquisitions() = 0;
+
             //-----------------------------------------------------
             ///\brief Send a notification
             ///\param[in] keywordId The keyword ID to use to send notification
@@ -0,0 +1,265 @@
+#include "stdafx.h"
+#include "PackageDownloader.h"
+#include <shared/Log.h>
+#include <shared/compression/Extract.h>
+#include <shared/compression/TarGzStreamExtractor.h>
+#include "exception/InvalidHash.hpp"
+#include "exception/DownloadFailed.hpp"
+#include <Poco/Net/HTTPRequest.h>
+#include <Poco/Net/HTTPResponse.h>
+#include <Poco/MD5Engine.h>
+#include <Poco/File.h>
+#include <fstream>
+
+namespace shared
+{
+   namespace web
+   {
+      const std::size_t CPackageDownloader::BufferSize = 64 * 1024;
+
+      CPackageDownloader::CPackageDownloader(boost::shared_ptr<IHttpClientSessionFactory> sessionFactory,
+                                             int maxAttempts,
+                                             const boost::posix_time::time_duration& retryDelay,
+                                             const boost::posix_time::time_duration& timeout)
+         : m_sessionFactory(sessionFactory),
+           m_maxAttempts(std::max(maxAttempts, 1)),
+           m_retryDelay(retryDelay),
+           m_timeout(timeout)
+      {
+      }
+
+      CPackageDownloader::~CPackageDownloader()
+      {
+      }
+
+      void CPackageDownloader::download(const Poco::URI& uri, DataHandler onData, RestartHandler onRestart, ProgressFunc reporter) const
+      {
+         std::vector<char> buffer(BufferSize);
+         Poco::UInt64 received = 0;
+         Poco::Int64 totalSize = -1;
+         std::string validator;
+         auto currentProgress = 0.0f;
+
+         for (auto attempt = 1;; ++attempt)
+         {
+            try
+            {
+               auto session = m_sessionFactory->createSession(uri);
+               session->setTimeout(Poco::Timespan(m_timeout.total_milliseconds() * 1000));
+
+               Poco::Net::HTTPRequest request(Poco::Net::HTTPRequest::HTTP_GET,
+                                              uri.getPathAndQuery(),
+                                              Poco::Net::HTTPMessage::HTTP_1_1);
+               request.set("User-Agent", "yadoms");
+               if (received != 0)
+               {
+                  //resume download, only if resource was not modified since first request
+                  request.set("Range", "bytes=" + std::to_string(received) + "-");
+                  if (!validator.empty())
+                     request.set("If-Range", validator);
+               }
+               session->sendRequest(request);
+
+               Poco::Net::HTTPResponse response;
+               auto& body = session->receiveResponse(response);
+
+               if (response.getStatus() == Poco::Net::HTTPResponse::HTTP_PARTIAL_CONTENT && received != 0)
+               {
+                  //Content-Range : "bytes <first>-<last>/<total>"
+                  const auto contentRange = response.get("Content-Range", std::string());
+                  const auto dash = contentRange.find('-');
+                  const auto slash = contentRange.find('/');
+                  if (!boost::istarts_with(contentRange, "bytes ") || dash == std::string::npos
+                     || std::strtoull(contentRange.c_str() + 6, nullptr, 10) != received)
+                     throw exception::CDownloadFailed(uri, "Invalid Content-Range : " + contentRange);
+                  if (slash != std::string::npos && contentRange[slash + 1] != '*')
+                     totalSize = static_cast<Poco::Int64>(std::strtoull(contentRange.c_str() + slash + 1, nullptr, 10));
+               }
+               else if (response.getStatus() == Poco::Net::HTTPResponse::HTTP_OK)
+               {
+                  if (received != 0)
+                  {
+                     YADOMS_LOG(information) << "Download of " << uri.toString() << " can not be resumed, restart it";
+                     onRestart();
+                     received = 0;
+                  }
+                  totalSize = response.hasContentLength() ? response.getContentLength64() : -1;
+               }
+               else
+               {
+                  throw exception::CDownloadFailed(uri, "Response returned with status code : " + std::to_string(response.getStatus()));
+               }
+
+               if (response.has("ETag"))
+                  validator = response.get("ETag");
+               else if (response.has("Last-Modified"))
+                  validator = response.get("Last-Modified");
+
+               const auto expectedEnd = response.hasContentLength() ? static_cast<Poco::Int64>(received) + response.getContentLength64() : -1;
+
+               while (body.read(buffer.data(), buffer.size()) || body.gcount() > 0)
+               {
+                  const auto count = static_cast<std::size_t>(body.gcount());
+                  onData(buffer.data(), count);
+                  received += count;
+
+                  //update progress if needed (minimum step of 1% to avoid too much calls)
+                  if (totalSize > 0)
+                  {
+                     const auto progress = received * 100.0f / static_cast<float>(totalSize);
+                     if (fabs(currentProgress - progress) >= 1.0)
+                     {
+                        currentProgress = progress;
+                        reporter(uri.getPath(), currentProgress);
+                     }
+                  }
+               }
+
+               if (body.bad() || (expectedEnd >= 0 && static_cast<Poco::Int64>(received) < expectedEnd))
+                  throw Poco::IOException("Connection closed before end of content");
+
+               if (received == 0)
+                  throw exception::CDownloadFailed(uri, "File size is 0");
+
+               if (currentProgress < 100.0f)
+                  reporter(uri.getPath(), 100.0f);
+               return;
+            }
+            catch (Poco::Exception& e)
+            {
+               //network errors : resume download
+               if (attempt >= m_maxAttempts)
+               {
+                  YADOMS_LOG(error) << "Fail to download file : " << e.displayText();
+                  throw exception::CDownloadFailed(uri, e.displayText());
+               }
+
+               YADOMS_LOG(warning) << "Download of " << uri.toString() << " interrupted (" << e.displayText() << "), resume from byte " << received;
+               boost::this_thread::sleep(m_retryDelay);
+            }
+         }
+      }
+
+      Poco::Path CPackageDownloader::downloadAndVerify(const Poco::URI& uri, const Poco::Path& location, const std::string& md5HashExpected, ProgressFunc reporter) const
+      {
+         Poco::MD5Engine md5Engine;
+         std::ofstream file;
+
+         try
+         {
+            file.open(location.toString().c_str(), std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+               throw exception::CDownloadFailed(uri, "Fail to create " + location.toString());
+
+            download(uri,
+                     [&](const char* data, std::size_t size)
+                     {
+                        md5Engine.update(data, size);
+                        file.write(data, size);
+                        if (!file)
+                           throw exception::CDownloadFailed(uri, "Fail to write " + location.toString());
+                     },
+                     [&]()
+                     {
+                        md5Engine.reset();
+                        file.close();
+                        file.open(location.toString().c_str(), std::ios::binary | std::ios::trunc);
+                     },
+                     reporter);
+
+            file.close();
+            if (!file)
+               throw exception::CDownloadFailed(uri, "Fail to write " + location.toString());
+         }
+         catch (...)
+         {
+            file.close();
+            Poco::File(location).remove();
+            throw;
+         }
+
+         const auto md5HashCalculated = Poco::DigestEngine::digestToHex(md5Engine.digest());
+         if (!boost::iequals(md5HashCalculated, md5HashExpected))
+         {
+            Poco::File(location).remove();
+            throw exception::CInvalidHash(location, md5HashExpected, md5HashCalculated);
+         }
+
+         return location;
+      }
+
+      Poco::Path CPackageDownloader::downloadAndExtract(const Poco::URI& uri, const Poco::Path& extractDirectory, const std::string& md5HashExpected, ProgressFunc reporter) const
+      {
+         Poco::Path extractPath(extractDirectory);
+         extractPath.makeDirectory();
+
+         if (!isStreamExtractable(uri))
+         {
+            //archive format needs random access : download it first
+            Poco::Path archive(extractPath);
+            archive.popDirectory();
+            archive.setFileName(Poco::Path(uri.getPath()).getFileName());
+            downloadAndVerify(uri, archive, md5HashExpected, reporter);
+
+            try
+            {
+               compression::CExtract().to(archive, extractPath);
+            }
+            catch (...)
+            {
+               Poco::File(archive).remove();
+               if (Poco::File(extractPath).exists())
+                  Poco::File(extractPath).remove(true);
+               throw;
+            }
+            Poco::File(archive).remove();
+            return extractPath;
+         }
+
+         Poco::MD5Engine md5Engine;
+         try
+         {
+            boost::scoped_ptr<compression::CTarGzStreamExtractor> extractor(new compression::CTarGzStreamExtractor(extractPath));
+
+            download(uri,
+                     [&](const char* data, std::size_t size)
+                     {
+                        md5Engine.update(data, size);
+                        extractor->write(data, size);
+                     },
+                     [&]()
+                     {
+                        md5Engine.reset();
+                        extractor.reset();
+                        Poco::File(extractPath).remove(true);
+                        extractor.reset(new compression::CTarGzStreamExtractor(extractPath));
+                     },
+                     reporter);
+
+            extractor->finish();
+         }
+         catch (...)
+         {
+            if (Poco::File(extractPath).exists())
+               Poco::File(extractPath).remove(true);
+            throw;
+         }
+
+         //extracted files are dropped if package is not the expected one
+         const auto md5HashCalculated = Poco::DigestEngine::digestToHex(md5Engine.digest());
+         if (!boost::iequals(md5HashCalculated, md5HashExpected))
+         {
+            Poco::File(extractPath).remove(true);
+            throw exception::CInvalidHash(Poco::Path(uri.getPath()), md5HashExpected, md5HashCalculated);
+         }
+
+         return extractPath;
+      }
+
+      bool CPackageDownloader::isStreamExtractable(const Poco::URI& uri)
+      {
+         const auto& path = uri.getPath();
+         return boost::iends_with(path, ".tar.gz") || boost::iends_with(path, ".tgz");
+      }
+   } //namespace web
+} //namespace shared
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <shared/Export.h>
+#include <shared/http/IHttpClientSessionFactory.h>
+#include <Poco/URI.h>
+#include <Poco/Path.h>
+
+namespace shared
+{
+   namespace web
+   {
+      //---------------------------------
+      ///\brief Package downloader, for updates
+      ///
+      /// Data are hashed (and extracted for tar.gz packages) while they are received, so the
+      /// package is never read again from disk. Interrupted downloads are resumed (HTTP Range requests)
+      /// instead of restarted, if the server supports it.
+      //---------------------------------
+      class YADOMS_SHARED_EXPORT CPackageDownloader
+      {
+      public:
+         //---------------------------------
+         ///\brief Define a function prototype for updating a download progress
+         //---------------------------------
+         typedef boost::function2<void, const std::string &, float> ProgressFunc;
+
+         //---------------------------------
+         ///\brief Define a function prototype receiving downloaded data
+         //---------------------------------
+         typedef boost::function2<void, const char*, std::size_t> DataHandler;
+
+         //---------------------------------
+         ///\brief Define a function prototype called when the server restarts the download from the beginning
+         ///       (all data already received must be dropped)
+         //---------------------------------
+         typedef boost::function0<void> RestartHandler;
+
+         //---------------------------------
+         ///\brief Constructor
+         ///\param [in] sessionFactory    The HTTP sessions factory
+         ///\param [in] maxAttempts       The maximum number of attempts (resumes included)
+         ///\param [in] retryDelay        The delay before resuming an interrupted download
+         ///\param [in] timeout           The network timeout
+         //---------------------------------
+         explicit CPackageDownloader(boost::shared_ptr<IHttpClientSessionFactory> sessionFactory,
+                                     int maxAttempts = 5,
+                                     const boost::posix_time::time_duration& retryDelay = boost::posix_time::seconds(2),
+                                     const boost::posix_time::time_duration& timeout = boost::posix_time::seconds(30));
+
+         //---------------------------------
+         ///\brief Destructor
+         //---------------------------------
+         virtual ~CPackageDownloader();
+
+         //---------------------------------
+         ///\brief Download a resource
+         ///\param [in] uri               The URI to download
+         ///\param [in] onData            Called for each received data block
+         ///\param [in] onRestart         Called if download restarts from the beginning
+         ///\param [in] reporter          A function pointer for reporting progress (can be used with CFileDownloader::reportProgressToLog)
+         ///\throw   shared::web::exception::CDownloadFailed : if download fails (after all attempts)
+         ///\note Exceptions thrown by handlers stop the download (no retry)
+         //---------------------------------
+         void download(const Poco::URI& uri, DataHandler onData, RestartHandler onRestart, ProgressFunc reporter) const;
+
+         //---------------------------------
+         ///\brief Download a file and check MD5 hash (computed while downloading)
+         ///\param [in] uri               The URI to download
+         ///\param [in] location          The file download location (file will be created)
+         ///\param [in] md5HashExpected   The expected file MD5 hash
+         ///\param [in] reporter          A function pointer for reporting progress
+         ///\return The downloaded location
+         ///\throw   shared::web::exception::CDownloadFailed : if download fails
+         ///\throw   shared::web::exception::CInvalidHash : if md5 hash is not valid (file is removed)
+         //---------------------------------
+         Poco::Path downloadAndVerify(const Poco::URI& uri, const Poco::Path& location, const std::string& md5HashExpected, ProgressFunc reporter) const;
+
+         //---------------------------------
+         ///\brief Download a package, check its MD5 hash and extract it
+         ///
+         /// tar.gz packages are extracted while downloading, other packages are downloaded next to the
+         /// extraction directory, then extracted and removed.
+         /// Extraction directory must be a staging directory : its content must not be used before this method returns.
+         ///\param [in] uri               The URI to download
+         ///\param [in] extractPath       The extraction directory (created)
+         ///\param [in] md5HashExpected   The expected package MD5 hash
+         ///\param [in] reporter          A function pointer for reporting progress
+         ///\return The extraction directory
+         ///\throw   shared::web::exception::CDownloadFailed : if download fails
+         ///\throw   shared::web::exception::CInvalidHash : if md5 hash is not valid
+         ///\throw   shared::exception::CExtract : if extraction fails
+         ///\note On error, the extraction directory is removed
+         //---------------------------------
+         Poco::Path downloadAndExtract(const Poco::URI& uri, const Poco::Path& extractPath, const std::string& md5HashExpected, ProgressFunc reporter) const;
+
+         //---------------------------------
+         ///\brief Check if a package can be extracted while downloading
+         ///\param [in] uri               The package URI
+         ///\return true for tar.gz packages
+         //---------------------------------
+         static bool isStreamExtractable(const Poco::URI& uri);
+
+      private:
+         //---------------------------------
+         ///\brief The size of the blocks read from network
+         //---------------------------------
+         static const std::size_t BufferSize;
+
+         boost::shared_ptr<IHttpClientSessionFactory> m_sessionFactory;
+         const int m_maxAttempts;
+         const boost::posix_time::time_duration m_retryDelay;
+         const boost::posix_time::time_duration m_timeout;
+      };
+
+      //---------------------------------
+      ///\brief Get the package downloader using default HTTP(S) sessions
+      //---------------------------------
+      YADOMS_SHARED_EXPORT const CPackageDownloader& PackageDownloader();
+   } //namespace web
+} //namespace shared
@@ -0,0 +1,15 @@
+#include "stdafx.h"
+#include "PackageDownloader.h"
+#include <shared/http/HttpClientSessionFactory.h>
+
+namespace shared
+{
+   namespace web
+   {
+      const CPackageDownloader& PackageDownloader()
+      {
+         static const CPackageDownloader StaticPackageDownloader(boost::make_shared<CHttpClientSessionFactory>());
+         return StaticPackageDownloader;
+      }
+   } //namespace web
+} //namespace shared
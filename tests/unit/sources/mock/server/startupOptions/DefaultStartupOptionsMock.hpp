@@ -0,0 +1,78 @@
+// Includes needed to compile tested classes
+#pragma once
+#include "../../../../../../sources/server/startupOptions/IStartupOptions.h"
+
+// Mock IStartupOptions (default values, PostgreSQL connection can be changed)
+class CDefaultStartupOptionsMock : public startupOptions::IStartupOptions
+{
+public:
+   CDefaultStartupOptionsMock()
+      : m_databaseEngine(startupOptions::EDatabaseEngine::kSqlite),
+        m_postgresqlHost("127.0.0.1"),
+        m_postgresqlPort(5432),
+        m_postgresqlDbName("yadoms"),
+        m_postgresqlLogin("yadoms"),
+        m_postgresqlPassword("yadoms")
+   {
+   }
+
+   virtual ~CDefaultStartupOptionsMock()
+   {
+   }
+
+   // IStartupOptions implementation
+   std::string getLogLevel() const override { return "information"; }
+   boost::filesystem::path getLogPath() const override { return boost::filesystem::path("logs"); }
+   unsigned short getWebServerPortNumber() const override { return 8080; }
+   unsigned short getSSLWebServerPortNumber() const override { return 443; }
+   bool getIsWebServerUseSSL() const override { return false; }
+   std::string getWebServerIPAddress() const override { return "0.0.0.0"; }
+   std::string getWebServerInitialPath() const override { return "www"; }
+   bool getWebServerAllowExternalAccess() const override { return false; }
+   startupOptions::EDatabaseEngine getDatabaseEngine() const override { return m_databaseEngine; }
+   std::string getDatabaseSqliteFile() const override { return "yadoms.db3"; }
+   std::string getDatabaseSqliteBackupFile() const override { return "yadoms_backup.db3"; }
+   std::string getDatabasePostgresqlHost() const override { return m_postgresqlHost; }
+   unsigned int getDatabasePostgresqlPort() const override { return m_postgresqlPort; }
+   std::string getDatabasePostgresqlDbName() const override { return m_postgresqlDbName; }
+   std::string getDatabasePostgresqlLogin() const override { return m_postgresqlLogin; }
+   std::string getDatabasePostgresqlPassword() const override { return m_postgresqlPassword; }
+   Poco::Nullable<std::string> getDatabasePostgresqlHostAddr() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<int> getDatabasePostgresqlConnectTimeout() const override { return Poco::Nullable<int>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlClientEncoding() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlOptions() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<int> getDatabasePostgresqlKeepAlives() const override { return Poco::Nullable<int>(); }
+   Poco::Nullable<int> getDatabasePostgresqlKeepAlivesIdle() const override { return Poco::Nullable<int>(); }
+   Poco::Nullable<int> getDatabasePostgresqlKeepAlivesInterval() const override { return Poco::Nullable<int>(); }
+   Poco::Nullable<int> getDatabasePostgresqlKeepAlivesCount() const override { return Poco::Nullable<int>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlSslMode() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<int> getDatabasePostgresqlRequireSsl() const override { return Poco::Nullable<int>(); }
+   Poco::Nullable<int> getDatabasePostgresqlSslCompression() const override { return Poco::Nullable<int>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlSslCert() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlSslKey() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlSslRootCert() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlSslRevocationList() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlRequirePeer() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlKerberos() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlGssLib() const override { return Poco::Nullable<std::string>(); }
+   Poco::Nullable<std::string> getDatabasePostgresqlService() const override { return Poco::Nullable<std::string>(); }
+   std::string getPluginsPath() const override { return "plugins"; }
+   std::string getScriptInterpretersPath() const override { return "scriptInterpreters"; }
+   bool getNoPasswordFlag() const override { return false; }
+   bool getNoWebServerCacheFlag() const override { return false; }
+   bool getIsRunningAsService() const override { return false; }
+   std::string getUpdateSiteUri() const override { return std::string(); }
+   std::string getBackupPath() const override { return "backups"; }
+   int getDatabaseAcquisitionLifetime() const override { return 30; }
+   std::map<int, int> getDatabaseAcquisitionLifetimeByKeyword() const override { return std::map<int, int>(); }
+   bool getDeveloperMode() const override { return false; }
+   bool getMetricsEnabled() const override { return false; }
+   // [END] IStartupOptions implementation
+
+   startupOptions::EDatabaseEngine m_databaseEngine;
+   std::string m_postgresqlHost;
+   unsigned int m_postgresqlPort;
+   std::string m_postgresqlDbName;
+   std::string m_postgresqlLogin;
+   std::string m_postgresqlPassword;
+};
@@ -0,0 +1,189 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../sources/plugins/EnOcean/profiles/TableDrivenDecoder.h"
+#include "../../../../sources/plugins/EnOcean/profiles/bitsetHelpers.hpp"
+
+// Includes needed to compile the test
+#include <boost/chrono.hpp>
+
+namespace
+{
+   // Same descriptors as generated from eep2.6.5.xml
+   const DataFieldDescriptor Fields_A5_02_05[] = {
+      {16, 8, kTemperature, 255, -0.156862745098, 0.0, "TMP - Temperature"}
+   };
+   const DataFieldDescriptor Fields_A5_04_01[] = {
+      {8, 8, kHumidity, 0, 0.4, 0.0, "HUM - Humidity"},
+      {16, 8, kTemperature, 0, 0.16, 0.0, "TMP - Temperature"},
+      {30, 1, kSwitch, 0, 0.0, 0.0, "TSN - T-Sensor"}
+   };
+   const DataFieldDescriptor Fields_A5_06_04[] = {
+      {0, 8, kTemperature, 0, 0.313725490196, -20.0, "TEMP - Temperature"},
+      {8, 16, kIllumination, 0, 1.0, 0.0, "ILL - Illuminance"},
+      {24, 4, kBatteryLevel, 0, 6.66666666667, 0.0, "SV - Energy Storage"},
+      {30, 1, kSwitch, 0, 0.0, 0.0, "TMPAV - Temperature Availability"},
+      {31, 1, kSwitch, 0, 0.0, 0.0, "ENAV - Energy Storage Availability"}
+   };
+   const DataFieldDescriptor Fields_A5_13_02[] = {
+      {0, 8, kIllumination, 0, 588.235294118, 0.0, "SNW - Sun - West"},
+      {8, 8, kIllumination, 0, 588.235294118, 0.0, "SNS - Sun - South"},
+      {16, 8, kIllumination, 0, 588.235294118, 0.0, "SNE - Sun - East"},
+      {29, 1, kSwitch, 0, 0.0, 0.0, "HEM - Hemisphere"}
+   };
+
+   const ProfileDescriptor ProfileDescriptors[] = {
+      {0xA5, 0x02, 0x05, "A5-02-05", Fields_A5_02_05, 1},
+      {0xA5, 0x04, 0x01, "A5-04-01", Fields_A5_04_01, 3},
+      {0xA5, 0x06, 0x04, "A5-06-04", Fields_A5_06_04, 5},
+      {0xA5, 0x13, 0x02, "A5-13-02", Fields_A5_13_02, 4}
+   };
+
+   // Reference decoding, as done by generated profile classes
+   double referenceLinearValue(const boost::dynamic_bitset<>& data,
+                               const DataFieldDescriptor& descriptor)
+   {
+      auto rawValue = bitset_extract(data, descriptor.bitOffset, descriptor.bitSize);
+      return descriptor.multiplier * (static_cast<signed>(rawValue) - descriptor.rangeMin) + descriptor.scaleMin;
+   }
+
+   void referenceDecode(const boost::dynamic_bitset<>& data,
+                        const ProfileDescriptor& profile,
+                        std::vector<double>& values)
+   {
+      for (auto field = profile.fields; field != profile.fields + profile.fieldsCount; ++field)
+      {
+         if (field->kind == kSwitch)
+            values.push_back(data[field->bitOffset] ? 1.0 : 0.0);
+         else if (field->kind == kBatteryLevel)
+            values.push_back(static_cast<int>(referenceLinearValue(data, *field)));
+         else
+            values.push_back(referenceLinearValue(data, *field));
+      }
+   }
+
+   std::vector<unsigned char> randomTelegram(unsigned int seed)
+   {
+      std::vector<unsigned char> userData(4);
+      for (auto& byte : userData)
+      {
+         seed = seed * 1103515245 + 12345;
+         byte = static_cast<unsigned char>(seed >> 16);
+      }
+      return userData;
+   }
+}
+
+BOOST_AUTO_TEST_SUITE(TestTableDrivenDecoder)
+
+BOOST_AUTO_TEST_CASE(Extract)
+{
+   const std::vector<unsigned char> data = {0x01, 0x02, 0x55, 0xAA, 0xFF};
+   const auto bitset = bitset_from_bytes(data);
+
+   for (unsigned int offset = 0; offset < data.size() * 8; ++offset)
+      for (unsigned int size = 1; size <= 32 && offset + size <= data.size() * 8; ++size)
+         BOOST_CHECK_EQUAL(CTableDrivenDecoder::extract(data, offset, size), bitset_extract(bitset, offset, size));
+
+   BOOST_REQUIRE_THROW(CTableDrivenDecoder::extract(data, 0, 33), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(Historizers)
+{
+   CTableDrivenDecoder decoder(ProfileDescriptors[1]);
+
+   BOOST_CHECK_EQUAL(decoder.profile(), "A5-04-01");
+   BOOST_REQUIRE_EQUAL(decoder.allHistorizers().size(), static_cast<std::size_t>(3));
+   BOOST_CHECK_EQUAL(decoder.allHistorizers()[0]->getKeyword(), "HUM - Humidity");
+   BOOST_CHECK_EQUAL(decoder.allHistorizers()[1]->getKeyword(), "TMP - Temperature");
+   BOOST_CHECK_EQUAL(decoder.allHistorizers()[2]->getKeyword(), "TSN - T-Sensor");
+}
+
+BOOST_AUTO_TEST_CASE(Decode_A5_02_05)
+{
+   CTableDrivenDecoder decoder(ProfileDescriptors[0]);
+
+   // 0x00 => 40 degC, 0xFF => 0 degC
+   const auto& historizers = decoder.decode({0x00, 0x00, 0x00, 0x08});
+   BOOST_REQUIRE_EQUAL(historizers.size(), static_cast<std::size_t>(1));
+   BOOST_CHECK_CLOSE(boost::dynamic_pointer_cast<const yApi::historization::CTemperature>(historizers[0])->get(), 40.0, 0.01);
+
+   decoder.decode({0x00, 0x00, 0xFF, 0x08});
+   BOOST_CHECK_SMALL(boost::dynamic_pointer_cast<const yApi::historization::CTemperature>(historizers[0])->get(), 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeSameAsProfileClasses)
+{
+   for (const auto& profile : ProfileDescriptors)
+   {
+      CTableDrivenDecoder decoder(profile);
+
+      for (unsigned int seed = 0; seed < 100; ++seed)
+      {
+         const auto userData = randomTelegram(seed);
+         std::vector<double> expectedValues;
+         referenceDecode(bitset_from_bytes(userData), profile, expectedValues);
+
+         const auto& historizers = decoder.decode(userData);
+         BOOST_REQUIRE_EQUAL(historizers.size(), expectedValues.size());
+         for (std::size_t index = 0; index < historizers.size(); ++index)
+         {
+            switch (profile.fields[index].kind)
+            {
+            case kSwitch:
+               BOOST_CHECK_EQUAL(boost::dynamic_pointer_cast<const yApi::historization::CSwitch>(historizers[index])->get(), expectedValues[index] != 0.0);
+               break;
+            case kBatteryLevel:
+               BOOST_CHECK_EQUAL(boost::dynamic_pointer_cast<const yApi::historization::CBatteryLevel>(historizers[index])->get(), static_cast<int>(expectedValues[index]));
+               break;
+            default:
+               BOOST_CHECK_EQUAL(boost::dynamic_pointer_cast<const yApi::historization::CSingleHistorizableData<double>>(historizers[index])->get(), expectedValues[index]);
+               break;
+            }
+         }
+      }
+   }
+}
+
+BOOST_AUTO_TEST_CASE(TelegramTooShort)
+{
+   CTableDrivenDecoder decoder(ProfileDescriptors[1]);
+
+   BOOST_REQUIRE_THROW(decoder.decode({0x00, 0x00, 0x00}), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(Benchmark)
+{
+   static const unsigned int TelegramsCount = 100000;
+
+   std::vector<std::vector<unsigned char>> telegrams;
+   for (unsigned int seed = 0; seed < TelegramsCount; ++seed)
+      telegrams.push_back(randomTelegram(seed));
+
+   for (const auto& profile : ProfileDescriptors)
+   {
+      CTableDrivenDecoder decoder(profile);
+
+      // Bitset-based decoding, as done by generated profile classes
+      auto start = boost::chrono::steady_clock::now();
+      std::vector<double> values;
+      for (const auto& userData : telegrams)
+      {
+         values.clear();
+         referenceDecode(bitset_from_bytes(userData), profile, values);
+      }
+      const auto bitsetDuration = boost::chrono::steady_clock::now() - start;
+
+      start = boost::chrono::steady_clock::now();
+      for (const auto& userData : telegrams)
+         decoder.decode(userData);
+      const auto tableDuration = boost::chrono::steady_clock::now() - start;
+
+      BOOST_TEST_MESSAGE(profile.profile << " : bitset decoding " << boost::chrono::duration_cast<boost::chrono::microseconds>(bitsetDuration).count() << " us"
+         << ", table-driven decoding " << boost::chrono::duration_cast<boost::chrono::microseconds>(tableDuration).count() << " us"
+         << " (" << TelegramsCount << " telegrams)");
+   }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
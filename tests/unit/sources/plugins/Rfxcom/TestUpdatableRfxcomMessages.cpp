@@ -0,0 +1,144 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../sources/plugins/Rfxcom/rfxcomMessages/Temp.h"
+#include "../../../../sources/plugins/Rfxcom/rfxcomMessages/TempHumidity.h"
+#include "../../../../sources/plugins/Rfxcom/rfxcomMessages/Wind.h"
+#include <shared/exception/Exception.hpp>
+
+// Includes needed to compile the test
+#include <boost/chrono.hpp>
+
+namespace
+{
+   // Frames captured from a RFXtrx433E, 3 sensors around (2 temperature/humidity sensors and a wind sensor)
+   const std::vector<std::vector<unsigned char>> Trace = {
+      {0x0A, 0x52, 0x01, 0x2A, 0x96, 0x03, 0x00, 0xA7, 0x2B, 0x03, 0x39},
+      {0x08, 0x50, 0x02, 0x2B, 0x70, 0x02, 0x00, 0xB4, 0x89},
+      {0x10, 0x56, 0x04, 0x2C, 0x2F, 0x00, 0x00, 0xB4, 0x00, 0x12, 0x00, 0x1F, 0x00, 0xD2, 0x00, 0xC8, 0x79},
+      {0x0A, 0x52, 0x01, 0x2D, 0x96, 0x03, 0x00, 0xA8, 0x2B, 0x03, 0x39},
+      {0x0A, 0x52, 0x01, 0x2E, 0x41, 0x07, 0x80, 0x15, 0x50, 0x02, 0x59},
+      {0x10, 0x56, 0x04, 0x2F, 0x2F, 0x00, 0x01, 0x0E, 0x00, 0x0A, 0x00, 0x2A, 0x80, 0x05, 0x80, 0x1E, 0x79},
+      {0x08, 0x50, 0x02, 0x30, 0x70, 0x02, 0x00, 0xB2, 0x79},
+      {0x0A, 0x52, 0x01, 0x31, 0x96, 0x03, 0x00, 0xA9, 0x2C, 0x03, 0x39},
+      {0x0A, 0x52, 0x01, 0x32, 0x41, 0x07, 0x80, 0x14, 0x51, 0x02, 0x59},
+      {0x10, 0x56, 0x04, 0x33, 0x2F, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x08, 0x00, 0xD0, 0x00, 0xD0, 0x79}
+   };
+
+   const RBUF& toRbuf(const std::vector<unsigned char>& frame)
+   {
+      return *reinterpret_cast<const RBUF*>(frame.data());
+   }
+
+   boost::shared_ptr<rfxcomMessages::IRfxcomMessage> createMessage(const std::vector<unsigned char>& frame)
+   {
+      // Messages don't use API at construction
+      const boost::shared_ptr<yApi::IYPluginApi> api;
+
+      switch (toRbuf(frame).RXRESPONSE.packettype)
+      {
+      case pTypeTEMP: return boost::make_shared<rfxcomMessages::CTemp>(api, toRbuf(frame), frame.size());
+      case pTypeTEMP_HUM: return boost::make_shared<rfxcomMessages::CTempHumidity>(api, toRbuf(frame), frame.size());
+      case pTypeWIND: return boost::make_shared<rfxcomMessages::CWind>(api, toRbuf(frame), frame.size());
+      default: throw std::invalid_argument("Unsupported frame in trace");
+      }
+   }
+
+   unsigned int deviceKey(const std::vector<unsigned char>& frame)
+   {
+      return frame[1] << 24 | frame[2] << 16 | frame[4] << 8 | frame[5];
+   }
+
+   std::vector<std::string> keywordsValues(const boost::shared_ptr<rfxcomMessages::IRfxcomMessage>& message)
+   {
+      std::vector<std::string> values;
+      for (const auto& keyword : message->keywords())
+         values.push_back(keyword->getKeyword() + "=" + keyword->formatValue());
+      return values;
+   }
+}
+
+BOOST_AUTO_TEST_SUITE(TestUpdatableRfxcomMessages)
+
+BOOST_AUTO_TEST_CASE(UpdateSameAsConstruction)
+{
+   std::map<unsigned int, boost::shared_ptr<rfxcomMessages::IRfxcomMessage>> cachedMessages;
+
+   for (const auto& frame : Trace)
+   {
+      const auto expectedMessage = createMessage(frame);
+
+      auto& cachedMessage = cachedMessages[deviceKey(frame)];
+      if (!cachedMessage)
+      {
+         cachedMessage = createMessage(frame);
+         continue;
+      }
+
+      BOOST_REQUIRE(boost::dynamic_pointer_cast<rfxcomMessages::IUpdatableRfxcomMessage>(cachedMessage)->update(toRbuf(frame), frame.size()));
+      BOOST_CHECK_EQUAL(cachedMessage->getDeviceName(), expectedMessage->getDeviceName());
+
+      const auto values = keywordsValues(cachedMessage);
+      const auto expectedValues = keywordsValues(expectedMessage);
+      BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expectedValues.begin(), expectedValues.end());
+   }
+
+   BOOST_CHECK_EQUAL(cachedMessages.size(), static_cast<std::size_t>(4));
+}
+
+BOOST_AUTO_TEST_CASE(UpdateFromOtherDevice)
+{
+   const auto message = createMessage(Trace[0]);
+   const auto expectedValues = keywordsValues(message);
+
+   // Same message type, other id
+   BOOST_CHECK_EQUAL(boost::dynamic_pointer_cast<rfxcomMessages::IUpdatableRfxcomMessage>(message)->update(toRbuf(Trace[4]), Trace[4].size()), false);
+
+   const auto values = keywordsValues(message);
+   BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expectedValues.begin(), expectedValues.end());
+}
+
+BOOST_AUTO_TEST_CASE(UpdateFromInvalidFrame)
+{
+   const auto message = createMessage(Trace[0]);
+   const auto updatableMessage = boost::dynamic_pointer_cast<rfxcomMessages::IUpdatableRfxcomMessage>(message);
+
+   // Other message type
+   BOOST_REQUIRE_THROW(updatableMessage->update(toRbuf(Trace[1]), Trace[1].size()), shared::exception::CException);
+
+   // Truncated frame
+   BOOST_REQUIRE_THROW(updatableMessage->update(toRbuf(Trace[3]), Trace[3].size() - 1), shared::exception::CException);
+}
+
+BOOST_AUTO_TEST_CASE(ReplayBenchmark)
+{
+   static const unsigned int ReplayCount = 10000;
+
+   // One message constructed per frame, as before
+   auto start = boost::chrono::steady_clock::now();
+   for (unsigned int replay = 0; replay < ReplayCount; ++replay)
+   {
+      for (const auto& frame : Trace)
+         createMessage(frame);
+   }
+   const auto constructionDuration = boost::chrono::steady_clock::now() - start;
+
+   // Messages updated in place
+   std::map<unsigned int, boost::shared_ptr<rfxcomMessages::IUpdatableRfxcomMessage>> cachedMessages;
+   for (const auto& frame : Trace)
+      cachedMessages[deviceKey(frame)] = boost::dynamic_pointer_cast<rfxcomMessages::IUpdatableRfxcomMessage>(createMessage(frame));
+
+   start = boost::chrono::steady_clock::now();
+   for (unsigned int replay = 0; replay < ReplayCount; ++replay)
+   {
+      for (const auto& frame : Trace)
+         BOOST_REQUIRE(cachedMessages[deviceKey(frame)]->update(toRbuf(frame), frame.size()));
+   }
+   const auto updateDuration = boost::chrono::steady_clock::now() - start;
+
+   BOOST_TEST_MESSAGE("Replay of " << ReplayCount * Trace.size() << " frames : construction " << boost::chrono::duration_cast<boost::chrono::microseconds>(constructionDuration).count() << " us"
+      << ", update in place " << boost::chrono::duration_cast<boost::chrono::microseconds>(updateDuration).count() << " us");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
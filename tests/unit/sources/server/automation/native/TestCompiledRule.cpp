@@ -0,0 +1,97 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../sources/server/automation/native/PredicateGraph.h"
+#include "../../../../../sources/server/automation/native/CompiledRule.h"
+#include <shared/exception/InvalidParameter.hpp>
+
+BOOST_AUTO_TEST_SUITE(TestCompiledRule)
+
+   static const boost::posix_time::ptime Noon(boost::gregorian::date(2020, 1, 1), boost::posix_time::hours(12));
+
+   BOOST_AUTO_TEST_CASE(AboveWithHysteresis)
+   {
+      automation::native::CPredicateGraph graph(shared::CDataContainer("{ \"keyword\" : 1, \"above\" : 20, \"hysteresis\" : 1 }"));
+
+      BOOST_CHECK(!graph.result());
+      BOOST_CHECK(!graph.setKeywordValue(1, "19.5"));
+      BOOST_CHECK(graph.setKeywordValue(1, "20.5"));
+      BOOST_CHECK(graph.result());
+
+      // Stays true while value is above threshold - hysteresis
+      BOOST_CHECK(!graph.setKeywordValue(1, "19.5"));
+      BOOST_CHECK(graph.result());
+      BOOST_CHECK(graph.setKeywordValue(1, "18.9"));
+      BOOST_CHECK(!graph.result());
+
+      // Other keywords are ignored
+      BOOST_CHECK(!graph.setKeywordValue(2, "100"));
+   }
+
+   BOOST_AUTO_TEST_CASE(Groups)
+   {
+      automation::native::CPredicateGraph graph(shared::CDataContainer(
+         "{ \"all\" : [ { \"keyword\" : 1, \"equals\" : \"1\" }, { \"not\" : { \"keyword\" : 2, \"below\" : 10 } } ] }"));
+
+      BOOST_CHECK_EQUAL(graph.keywords().size(), 2);
+      BOOST_CHECK(!graph.dependsOnTime());
+
+      BOOST_CHECK(graph.setKeywordValue(1, "1")); // keyword 2 has no value yet : "not" is true
+      BOOST_CHECK(graph.result());
+      BOOST_CHECK(graph.setKeywordValue(2, "5"));
+      BOOST_CHECK(!graph.result());
+      BOOST_CHECK(graph.setKeywordValue(2, "15"));
+      BOOST_CHECK(graph.result());
+      BOOST_CHECK(graph.setKeywordValue(1, "0"));
+      BOOST_CHECK(!graph.result());
+   }
+
+   BOOST_AUTO_TEST_CASE(TimeWindow)
+   {
+      automation::native::CPredicateGraph graph(shared::CDataContainer("{ \"between\" : { \"from\" : \"22:00\", \"to\" : \"06:30\" } }"));
+
+      BOOST_CHECK(graph.dependsOnTime());
+      BOOST_CHECK(!graph.setTime(Noon));
+      BOOST_CHECK_EQUAL(graph.nextTimeChange(Noon), Noon + boost::posix_time::hours(10));
+
+      const auto night = Noon + boost::posix_time::hours(11);
+      BOOST_CHECK(graph.setTime(night));
+      BOOST_CHECK(graph.result());
+      BOOST_CHECK_EQUAL(graph.nextTimeChange(night), Noon + boost::posix_time::hours(18) + boost::posix_time::minutes(30));
+   }
+
+   BOOST_AUTO_TEST_CASE(InvalidCondition)
+   {
+      BOOST_CHECK_THROW(automation::native::CPredicateGraph(shared::CDataContainer("{ \"keyword\" : 1 }")), shared::exception::CInvalidParameter);
+      BOOST_CHECK_THROW(automation::native::CPredicateGraph(shared::CDataContainer("{ \"any\" : [] }")), shared::exception::CInvalidParameter);
+      BOOST_CHECK_THROW(automation::native::CPredicateGraph(shared::CDataContainer("{ \"between\" : { \"from\" : \"25:00\", \"to\" : \"06:00\" } }")), shared::exception::CInvalidParameter);
+      BOOST_CHECK_THROW(automation::native::CCompiledRule(1, shared::CDataContainer("{ \"condition\" : { \"keyword\" : 1, \"equals\" : \"1\" } }")), shared::exception::CInvalidParameter);
+   }
+
+   BOOST_AUTO_TEST_CASE(Debounce)
+   {
+      automation::native::CCompiledRule rule(1, shared::CDataContainer(
+         "{ \"condition\" : { \"keyword\" : 1, \"equals\" : \"1\" }, \"debounce\" : 10,"
+         " \"onTrue\" : [ { \"keyword\" : 2, \"value\" : \"on\" } ], \"onFalse\" : [ { \"keyword\" : 2, \"value\" : \"off\" } ] }"));
+
+      rule.start(std::map<int, std::string>(), Noon);
+      BOOST_CHECK(rule.nextDeadline().is_not_a_date_time());
+
+      // Bounce : change is cancelled before debounce delay
+      rule.onKeywordValue(1, "1", Noon);
+      BOOST_CHECK_EQUAL(rule.nextDeadline(), Noon + boost::posix_time::seconds(10));
+      BOOST_CHECK(rule.process(Noon + boost::posix_time::seconds(5)).empty());
+      rule.onKeywordValue(1, "0", Noon + boost::posix_time::seconds(6));
+      BOOST_CHECK(rule.nextDeadline().is_not_a_date_time());
+
+      // Stable change
+      rule.onKeywordValue(1, "1", Noon + boost::posix_time::seconds(20));
+      const auto actions = rule.process(Noon + boost::posix_time::seconds(30));
+      BOOST_REQUIRE_EQUAL(actions.size(), 1);
+      BOOST_CHECK_EQUAL(actions[0].keywordId, 2);
+      BOOST_CHECK_EQUAL(actions[0].value, "on");
+      BOOST_CHECK(rule.nextDeadline().is_not_a_date_time());
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
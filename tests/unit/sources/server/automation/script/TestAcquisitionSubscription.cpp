@@ -0,0 +1,128 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../sources/server/automation/script/AcquisitionSubscription.h"
+#include "../../../../../sources/server/notification/NotificationCenter.h"
+#include <shared/ServiceLocator.h>
+
+BOOST_AUTO_TEST_SUITE(TestAcquisitionSubscription)
+
+   //--------------------------------------------------------------
+   /// \brief	    Register a notification center in the service locator, as used by the subscription
+   //--------------------------------------------------------------
+   struct CNotificationCenterFixture
+   {
+      CNotificationCenterFixture()
+         : m_center(boost::make_shared<notification::CNotificationCenter>())
+      {
+         shared::CServiceLocator::instance().push<notification::CNotificationCenter>(m_center);
+      }
+
+      ~CNotificationCenterFixture()
+      {
+         shared::CServiceLocator::instance().removeInterface<notification::CNotificationCenter>();
+      }
+
+      void postAcquisition(int keywordId, const std::string& value) const
+      {
+         auto acquisition = boost::make_shared<database::entities::CAcquisition>();
+         acquisition->KeywordId = keywordId;
+         acquisition->Date = boost::posix_time::second_clock::universal_time();
+         acquisition->Value = value;
+         notification::CHelpers::postNotification(boost::make_shared<notification::acquisition::CNotification>(acquisition), m_center);
+      }
+
+      boost::shared_ptr<notification::CNotificationCenter> m_center;
+   };
+
+   static const std::vector<std::pair<int, std::string>> NoAcquisition;
+
+   BOOST_FIXTURE_TEST_CASE(AcquisitionsAreQueuedBetweenWaits, CNotificationCenterFixture)
+   {
+      automation::script::CAcquisitionSubscription subscription({1, 2}, 10);
+
+      postAcquisition(1, "a");
+      postAcquisition(3, "not observed");
+      postAcquisition(2, "b");
+      postAcquisition(1, "c");
+
+      const auto acquisitions = subscription.wait(boost::posix_time::milliseconds(100));
+      const std::vector<std::pair<int, std::string>> expected = {{1, "a"}, {2, "b"}, {1, "c"}};
+      BOOST_CHECK(acquisitions == expected);
+
+      // Queue is emptied by wait
+      const auto next = subscription.wait(boost::posix_time::milliseconds(10));
+      BOOST_CHECK(next.empty());
+   }
+
+   BOOST_FIXTURE_TEST_CASE(WaitTimeout, CNotificationCenterFixture)
+   {
+      automation::script::CAcquisitionSubscription subscription({1}, 10);
+
+      postAcquisition(2, "not observed");
+
+      const auto start = boost::posix_time::microsec_clock::universal_time();
+      const auto acquisitions = subscription.wait(boost::posix_time::milliseconds(100));
+      const auto elapsed = boost::posix_time::microsec_clock::universal_time() - start;
+
+      BOOST_CHECK(acquisitions.empty());
+      BOOST_CHECK(elapsed >= boost::posix_time::milliseconds(90));
+   }
+
+   BOOST_FIXTURE_TEST_CASE(WaitWithoutTimeoutIsWokenUp, CNotificationCenterFixture)
+   {
+      automation::script::CAcquisitionSubscription subscription({1}, 10);
+
+      boost::thread poster([this]()
+         {
+            boost::this_thread::sleep(boost::posix_time::milliseconds(50));
+            postAcquisition(1, "a");
+         });
+
+      const auto acquisitions = subscription.wait(boost::posix_time::pos_infin);
+      poster.join();
+
+      BOOST_REQUIRE_EQUAL(acquisitions.size(), 1);
+      BOOST_CHECK_EQUAL(acquisitions[0].first, 1);
+      BOOST_CHECK_EQUAL(acquisitions[0].second, "a");
+   }
+
+   BOOST_FIXTURE_TEST_CASE(FullQueueDropsOldest, CNotificationCenterFixture)
+   {
+      automation::script::CAcquisitionSubscription subscription({1}, 3);
+
+      for (auto value = 1; value <= 5; ++value)
+         postAcquisition(1, std::to_string(value));
+
+      const auto acquisitions = subscription.wait(boost::posix_time::milliseconds(100));
+      const std::vector<std::pair<int, std::string>> expected = {{1, "3"}, {1, "4"}, {1, "5"}};
+      BOOST_CHECK(acquisitions == expected);
+
+      // Queue is usable again after drop
+      postAcquisition(1, "6");
+      const auto next = subscription.wait(boost::posix_time::milliseconds(100));
+      BOOST_REQUIRE_EQUAL(next.size(), 1);
+      BOOST_CHECK_EQUAL(next[0].second, "6");
+   }
+
+   BOOST_FIXTURE_TEST_CASE(ResubscribeReplacesSubscription, CNotificationCenterFixture)
+   {
+      // As done by the script API when a script subscribes again
+      auto subscription = boost::make_shared<automation::script::CAcquisitionSubscription>(std::vector<int>{1}, 10);
+      postAcquisition(1, "before replacement");
+
+      subscription.reset();
+      subscription = boost::make_shared<automation::script::CAcquisitionSubscription>(std::vector<int>{2}, 10);
+
+      postAcquisition(1, "old keyword");
+      postAcquisition(2, "new keyword");
+
+      // Acquisitions of the replaced subscription are lost, old keywords are not observed anymore
+      const auto acquisitions = subscription->wait(boost::posix_time::milliseconds(100));
+      BOOST_REQUIRE_EQUAL(acquisitions.size(), 1);
+      BOOST_CHECK_EQUAL(acquisitions[0].first, 2);
+      BOOST_CHECK_EQUAL(acquisitions[0].second, "new keyword");
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,185 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../sources/server/dataAccessLayer/LastValueCache.h"
+#include "../../../../../sources/server/notification/NotificationCenter.h"
+
+BOOST_AUTO_TEST_SUITE(TestLastValueCache)
+
+   //--------------------------------------------------------------
+   /// \brief	    Keyword requester keeping the keywords last values in memory, counting the last acquisition reads
+   //--------------------------------------------------------------
+   class CKeywordRequesterMock : public database::IKeywordRequester
+   {
+   public:
+      CKeywordRequesterMock()
+         : m_lastAcquisitionReads(0)
+      {
+      }
+
+      virtual ~CKeywordRequesterMock()
+      {
+      }
+
+      void setLastValue(int keywordId, const std::string& value)
+      {
+         m_lastValues[keywordId] = value;
+      }
+
+      // IKeywordRequester implementation
+      void addKeyword(const database::entities::CKeyword& newKeyword) override { }
+      boost::shared_ptr<database::entities::CKeyword> getKeyword(int deviceId, const std::string& keyword) const override { return boost::shared_ptr<database::entities::CKeyword>(); }
+      boost::shared_ptr<database::entities::CKeyword> getKeyword(int keywordId) const override { return boost::shared_ptr<database::entities::CKeyword>(); }
+      std::vector<boost::shared_ptr<database::entities::CKeyword>> getKeywordIdFromFriendlyName(int deviceId, const std::string& friendlyName) const override { return std::vector<boost::shared_ptr<database::entities::CKeyword>>(); }
+
+      std::vector<boost::shared_ptr<database::entities::CKeyword>> getAllKeywords() const override
+      {
+         std::vector<boost::shared_ptr<database::entities::CKeyword>> keywords;
+         for (const auto& lastValue : m_lastValues)
+         {
+            auto keyword = boost::make_shared<database::entities::CKeyword>();
+            keyword->Id = lastValue.first;
+            keyword->LastAcquisitionDate = LastValueDate;
+            keyword->LastAcquisitionValue = lastValue.second;
+            keywords.push_back(keyword);
+         }
+         return keywords;
+      }
+
+      std::vector<boost::shared_ptr<database::entities::CKeyword>> getKeywords(int deviceId) const override { return std::vector<boost::shared_ptr<database::entities::CKeyword>>(); }
+      std::string getAllKeywordsAsJson() const override { return std::string(); }
+      std::string getKeywordsAsJson(int deviceId) const override { return std::string(); }
+      std::vector<boost::shared_ptr<database::entities::CKeyword>> getKeywordsMatchingCapacity(const std::string& capacity) const override { return std::vector<boost::shared_ptr<database::entities::CKeyword>>(); }
+      std::vector<boost::shared_ptr<database::entities::CKeyword>> getDeviceKeywordsWithCapacity(int deviceId, const std::string& capacityName, const shared::plugin::yPluginApi::EKeywordAccessMode& capacityAccessMode) const override { return std::vector<boost::shared_ptr<database::entities::CKeyword>>(); }
+
+      boost::shared_ptr<database::entities::CAcquisition> getKeywordLastAcquisition(const int keywordId, bool throwIfNotExists) override
+      {
+         ++m_lastAcquisitionReads;
+         const auto lastValue = m_lastValues.find(keywordId);
+         if (lastValue == m_lastValues.end())
+            return boost::shared_ptr<database::entities::CAcquisition>();
+
+         auto acquisition = boost::make_shared<database::entities::CAcquisition>();
+         acquisition->KeywordId = keywordId;
+         acquisition->Date = LastValueDate;
+         acquisition->Value = lastValue->second;
+         return acquisition;
+      }
+
+      std::string getKeywordLastData(const int keywordId, bool throwIfNotExists) override { return std::string(); }
+      void updateKeywordBlacklistState(int keywordId, const bool blacklist) override { }
+      void removeKeyword(int keywordId) override { }
+      void updateKeywordFriendlyName(int keywordId, const std::string& newFriendlyName) override { }
+      void updateLastValue(int keywordId, const boost::posix_time::ptime& valueDatetime, const std::string& value) override { }
+      void updateLastValues(const std::vector<boost::shared_ptr<database::entities::CAcquisition>>& acquisitions) override { }
+      // [END] IKeywordRequester implementation
+
+      static const boost::posix_time::ptime LastValueDate;
+      int m_lastAcquisitionReads;
+
+   private:
+      std::map<int, std::string> m_lastValues;
+   };
+
+   const boost::posix_time::ptime CKeywordRequesterMock::LastValueDate(boost::gregorian::date(2020, 1, 1), boost::posix_time::hours(12));
+
+   //--------------------------------------------------------------
+   /// \brief	    Two keywords in database, and a notification center to post acquisitions
+   //--------------------------------------------------------------
+   struct CLastValueCacheFixture
+   {
+      CLastValueCacheFixture()
+         : m_keywordRequester(boost::make_shared<CKeywordRequesterMock>()),
+           m_center(boost::make_shared<notification::CNotificationCenter>())
+      {
+         m_keywordRequester->setLastValue(1, "10");
+         m_keywordRequester->setLastValue(2, "20");
+      }
+
+      void postAcquisition(int keywordId, const std::string& value, const boost::posix_time::ptime& date) const
+      {
+         auto acquisition = boost::make_shared<database::entities::CAcquisition>();
+         acquisition->KeywordId = keywordId;
+         acquisition->Date = date;
+         acquisition->Value = value;
+         notification::CHelpers::postNotification(boost::make_shared<notification::acquisition::CNotification>(acquisition), m_center);
+      }
+
+      std::string lastValue(dataAccessLayer::CLastValueCache& cache, int keywordId) const
+      {
+         dataAccessLayer::CLastValueCache::LastValue lastValue;
+         BOOST_REQUIRE(cache.get(keywordId, lastValue));
+         return lastValue.value;
+      }
+
+      boost::shared_ptr<CKeywordRequesterMock> m_keywordRequester;
+      boost::shared_ptr<notification::CNotificationCenter> m_center;
+   };
+
+   BOOST_FIXTURE_TEST_CASE(SnapshotOfLoadedKeywords, CLastValueCacheFixture)
+   {
+      dataAccessLayer::CLastValueCache cache(m_keywordRequester, m_center);
+
+      const auto snapshot = cache.snapshot({1, 2});
+      BOOST_REQUIRE_EQUAL(snapshot.size(), 2);
+      BOOST_CHECK_EQUAL(snapshot.at(1).value, "10");
+      BOOST_CHECK_EQUAL(snapshot.at(1).date, CKeywordRequesterMock::LastValueDate);
+      BOOST_CHECK_EQUAL(snapshot.at(2).value, "20");
+
+      // All read from the table loaded at construction
+      BOOST_CHECK_EQUAL(m_keywordRequester->m_lastAcquisitionReads, 0);
+   }
+
+   BOOST_FIXTURE_TEST_CASE(AcquisitionUpdatesLastValue, CLastValueCacheFixture)
+   {
+      dataAccessLayer::CLastValueCache cache(m_keywordRequester, m_center);
+
+      const auto date = CKeywordRequesterMock::LastValueDate + boost::posix_time::minutes(1);
+      postAcquisition(1, "11", date);
+
+      dataAccessLayer::CLastValueCache::LastValue value;
+      BOOST_REQUIRE(cache.get(1, value));
+      BOOST_CHECK_EQUAL(value.value, "11");
+      BOOST_CHECK_EQUAL(value.date, date);
+      BOOST_CHECK_EQUAL(lastValue(cache, 2), "20");
+      BOOST_CHECK_EQUAL(m_keywordRequester->m_lastAcquisitionReads, 0);
+   }
+
+   BOOST_FIXTURE_TEST_CASE(InvalidatedKeywordIsReadAgain, CLastValueCacheFixture)
+   {
+      dataAccessLayer::CLastValueCache cache(m_keywordRequester, m_center);
+
+      // Changed without notification : not seen until invalidated
+      m_keywordRequester->setLastValue(1, "12");
+      BOOST_CHECK_EQUAL(lastValue(cache, 1), "10");
+
+      cache.invalidate(1);
+      BOOST_CHECK_EQUAL(lastValue(cache, 1), "12");
+      BOOST_CHECK_EQUAL(m_keywordRequester->m_lastAcquisitionReads, 1);
+
+      // Back in the table
+      BOOST_CHECK_EQUAL(lastValue(cache, 1), "12");
+      BOOST_CHECK_EQUAL(m_keywordRequester->m_lastAcquisitionReads, 1);
+   }
+
+   BOOST_FIXTURE_TEST_CASE(MissingKeywordIsLoadedOnce, CLastValueCacheFixture)
+   {
+      dataAccessLayer::CLastValueCache cache(m_keywordRequester, m_center);
+
+      // Keyword created after the table loading
+      m_keywordRequester->setLastValue(3, "30");
+      BOOST_CHECK_EQUAL(lastValue(cache, 3), "30");
+      BOOST_CHECK_EQUAL(lastValue(cache, 3), "30");
+      BOOST_CHECK_EQUAL(m_keywordRequester->m_lastAcquisitionReads, 1);
+
+      // Unknown keyword
+      dataAccessLayer::CLastValueCache::LastValue value;
+      BOOST_CHECK(!cache.get(4, value));
+
+      const auto snapshot = cache.snapshot({1, 3, 4});
+      BOOST_CHECK_EQUAL(snapshot.size(), 2);
+      BOOST_CHECK(snapshot.find(4) == snapshot.end());
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,134 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../sources/server/database/common/adapters/JsonCollectionAdapter.h"
+#include "../../../../sources/server/database/common/adapters/EntityStorage.hpp"
+
+
+BOOST_AUTO_TEST_SUITE(TestJsonCollectionAdapter)
+
+//--------------------------------------------------------------
+/// \brief	    Result handler over a static resultset (nullptr values are NULL)
+//--------------------------------------------------------------
+class CStaticResultHandler : public database::common::IResultHandler
+{
+public:
+   CStaticResultHandler(const std::vector<std::string>& columns, const std::vector<std::vector<const char*>>& rows)
+      : m_columns(columns), m_rows(rows), m_currentRow(-1)
+   {
+   }
+
+   virtual ~CStaticResultHandler()
+   {
+   }
+
+   int getColumnCount() override { return static_cast<int>(m_columns.size()); }
+   std::string getColumnName(const int columnIndex) override { return m_columns[columnIndex]; }
+   int getRowCount() override { return static_cast<int>(m_rows.size()); }
+   bool next_step() override { return ++m_currentRow < static_cast<int>(m_rows.size()); }
+   const char* extractValueAsCString(const int columnIndex) override { return m_rows[m_currentRow][columnIndex]; }
+   std::string extractValueAsString(const int columnIndex) override { return extractValueAsCString(columnIndex); }
+   int extractValueAsInt(const int columnIndex) override { return std::stoi(extractValueAsString(columnIndex)); }
+   float extractValueAsFloat(const int columnIndex) override { return std::stof(extractValueAsString(columnIndex)); }
+   double extractValueAsDouble(const int columnIndex) override { return std::stod(extractValueAsString(columnIndex)); }
+   unsigned char* extractValueAsBlob(const int columnIndex) override { return nullptr; }
+   bool extractValueAsBool(const int columnIndex) override { return extractValueAsInt(columnIndex) == 1; }
+   bool isValueNull(const int columnIndex) override { return m_rows[m_currentRow][columnIndex] == nullptr; }
+   boost::posix_time::ptime extractValueAsBoostTime(const int columnIndex) override { return boost::posix_time::from_iso_string(extractValueAsString(columnIndex)); }
+   Poco::DateTime extractValueAsPocoTime(const int columnIndex) override { return Poco::DateTime(); }
+   shared::CDataContainer extractValueAsDataContainer(const int columnIndex) override { return shared::CDataContainer(extractValueAsString(columnIndex)); }
+
+private:
+   std::vector<std::string> m_columns;
+   std::vector<std::vector<const char*>> m_rows;
+   int m_currentRow;
+};
+
+BOOST_AUTO_TEST_CASE(Serialization)
+{
+   auto resultHandler = boost::make_shared<CStaticResultHandler>(
+      std::vector<std::string>{ "ID", "name", "details", "blacklist" },
+      std::vector<std::vector<const char*>>{
+         { "1", "a\"b/c", "{\"unit\":\"W\"}\n", "1" },
+         { "2", nullptr, "{ }", "0" } });
+
+   database::common::adapters::CJsonCollectionAdapter adapter;
+   adapter.addField(database::common::CDatabaseColumn("id"), "id");
+   adapter.addField(database::common::CDatabaseColumn("name"), "name");
+   adapter.addField(database::common::CDatabaseColumn("details"), "details", database::common::adapters::CJsonCollectionAdapter::kJson);
+   adapter.addField(database::common::CDatabaseColumn("blacklist"), "blacklist", database::common::adapters::CJsonCollectionAdapter::kBoolean, "0");
+   adapter.addField(database::common::CDatabaseColumn("missing"), "missing", database::common::adapters::CJsonCollectionAdapter::kText, "default");
+
+   BOOST_CHECK_EQUAL(adapter.adapt(resultHandler), true);
+   BOOST_CHECK_EQUAL(adapter.getRawResults(),
+                     "[{\"id\":\"1\",\"name\":\"a\\\"b\\/c\",\"details\":{\"unit\":\"W\"},\"blacklist\":\"true\",\"missing\":\"default\"},"
+                     "{\"id\":\"2\",\"name\":\"\",\"details\":\"\",\"blacklist\":\"false\",\"missing\":\"default\"}]");
+}
+
+BOOST_AUTO_TEST_CASE(EmptyResult)
+{
+   auto resultHandler = boost::make_shared<CStaticResultHandler>(std::vector<std::string>{ "id" }, std::vector<std::vector<const char*>>());
+
+   database::common::adapters::CJsonCollectionAdapter adapter;
+   adapter.addField(database::common::CDatabaseColumn("id"), "id");
+
+   BOOST_CHECK_EQUAL(adapter.adapt(resultHandler), true);
+   BOOST_CHECK_EQUAL(adapter.getRawResults(), "\"\"");
+}
+
+BOOST_AUTO_TEST_CASE(GroupedRows)
+{
+   // a left join result, sorted by device
+   auto resultHandler = boost::make_shared<CStaticResultHandler>(
+      std::vector<std::string>{ "device_id", "device_name", "id", "name", "units" },
+      std::vector<std::vector<const char*>>{
+         { "1", "dev1", "10", "temperature", "degrees" },
+         { "1", "dev1", "11", "humidity", nullptr },
+         { "2", "dev2", nullptr, nullptr, nullptr },
+         { "3", "dev3", "30", "switch", nullptr } });
+
+   auto keywords = boost::make_shared<database::common::adapters::CJsonCollectionAdapter>();
+   keywords->addField(database::common::CDatabaseColumn("id"), "id");
+   keywords->addField(database::common::CDatabaseColumn("name"), "name");
+   keywords->addField(database::common::CDatabaseColumn("units"), "units");
+   keywords->restrictFields({ "name", "units" });
+
+   database::common::adapters::CJsonCollectionAdapter adapter;
+   adapter.addField(database::common::CDatabaseColumn("device_id"), "id");
+   adapter.addField(database::common::CDatabaseColumn("device_name"), "name");
+   adapter.setChildren(database::common::CDatabaseColumn("device_id"), "keywords", keywords, database::common::CDatabaseColumn("id"));
+
+   BOOST_CHECK_EQUAL(adapter.adapt(resultHandler), true);
+   BOOST_CHECK_EQUAL(adapter.getRawResults(),
+                     "[{\"id\":\"1\",\"name\":\"dev1\",\"keywords\":[{\"name\":\"temperature\",\"units\":\"degrees\"},{\"name\":\"humidity\",\"units\":\"\"}]},"
+                     "{\"id\":\"2\",\"name\":\"dev2\",\"keywords\":\"\"},"
+                     "{\"id\":\"3\",\"name\":\"dev3\",\"keywords\":[{\"name\":\"switch\",\"units\":\"\"}]}]");
+   BOOST_CHECK_EQUAL(adapter.getCount(), 3);
+   BOOST_CHECK_EQUAL(adapter.getLastGroupValue(), "3");
+}
+
+BOOST_AUTO_TEST_CASE(EntityStorage)
+{
+   database::common::adapters::CEntityStorage<std::string> storage(-1);
+   std::vector<std::string*> addresses;
+   for (auto i = 0; i < 100; ++i)
+   {
+      auto& entity = storage.emplace();
+      entity = std::to_string(i);
+      addresses.push_back(&entity);
+   }
+
+   std::vector<boost::shared_ptr<std::string>> results;
+   storage.share(results);
+
+   BOOST_REQUIRE_EQUAL(results.size(), 100);
+   for (auto i = 0; i < 100; ++i)
+   {
+      // entities never move once constructed
+      BOOST_CHECK_EQUAL(results[i].get(), addresses[i]);
+      BOOST_CHECK_EQUAL(*results[i], std::to_string(i));
+   }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -91,5 +91,25 @@ BOOST_AUTO_TEST_CASE(Update)
 
 }
 
+BOOST_AUTO_TEST_CASE(InValuesList)
+{
+   database::pgsql::CPgsqlQuery test1;
+   std::vector<int> ids = { 1, 42, 7 };
+   test1.Select(database::common::CKeywordTable::getIdColumnName()).From(database::common::CKeywordTable::getTableName()).
+      Where(database::common::CKeywordTable::getDeviceIdColumnName(), CQUERY_OP_IN, test1.valuesList(ids)).
+      GroupBy(database::common::CKeywordTable::getDeviceIdColumnName());
+
+   std::string checkQuery = (boost::format("SELECT id FROM %1% WHERE deviceId IN (1,42,7) GROUP BY deviceId") % database::common::CKeywordTable::getTableName().GetName()).str();
+   BOOST_CHECK_EQUAL(beautifyQuery(test1), checkQuery);
+
+   database::pgsql::CPgsqlQuery test2;
+   std::vector<std::string> names = { "a", "b" };
+   test2.Select().From(database::common::CKeywordTable::getTableName()).
+      Where(database::common::CKeywordTable::getNameColumnName(), CQUERY_OP_IN, test2.valuesList(names));
+
+   checkQuery = (boost::format("SELECT * FROM %1% WHERE name IN ('a','b')") % database::common::CKeywordTable::getTableName().GetName()).str();
+   BOOST_CHECK_EQUAL(beautifyQuery(test2), checkQuery);
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
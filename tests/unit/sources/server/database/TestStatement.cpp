@@ -0,0 +1,93 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../sources/server/database/common/Statement.hpp"
+#include "../../../../sources/server/database/common/DatabaseTables.h"
+
+using namespace database::common;
+
+BOOST_AUTO_TEST_SUITE(TestStatement)
+
+BOOST_AUTO_TEST_CASE(Select)
+{
+   CStatementBuilder test1;
+   test1.Select().From(CKeywordTable::getTableName()).Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL);
+   BOOST_CHECK_EQUAL(test1.str(), "SELECT * FROM Keyword WHERE id = $1");
+   BOOST_CHECK_EQUAL(test1.parametersCount(), 1);
+
+   CStatementBuilder test2;
+   test2.Select({CKeywordTable::getIdColumnName(), CKeywordTable::getNameColumnName()}).
+      From(CKeywordTable::getTableName()).
+      Where(CKeywordTable::getDeviceIdColumnName(), CQUERY_OP_EQUAL).
+      And(CKeywordTable::getNameColumnName(), CQUERY_OP_LIKE).
+      OrderBy(CKeywordTable::getNameColumnName(), true).
+      Limit(10);
+   BOOST_CHECK_EQUAL(test2.str(), "SELECT id, name FROM Keyword WHERE deviceId = $1 AND name LIKE $2 ORDER BY name DESC LIMIT 10");
+   BOOST_CHECK_EQUAL(test2.parametersCount(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(JoinAndSubquery)
+{
+   CStatementBuilder test;
+   test.Select(CDeviceTable::getTableName(), {CDeviceTable::getIdColumnName(), CDeviceTable::getNameColumnName()}, "device_").
+      AndSelect(CKeywordTable::getTableName(), {CKeywordTable::getIdColumnName()}).
+      From(CDeviceTable::getTableName()).
+      LeftJoin(CKeywordTable::getTableName(), CKeywordTable::getDeviceIdColumnName(), CDeviceTable::getTableName(), CDeviceTable::getIdColumnName()).
+      And(CStatementBuilder::qualified(CKeywordTable::getTableName(), CKeywordTable::getCapacityNameColumnName()), CQUERY_OP_EQUAL).
+      WhereIn(CStatementBuilder::qualified(CDeviceTable::getTableName(), CDeviceTable::getIdColumnName())).
+      Select({CDeviceTable::getIdColumnName()}).
+      From(CDeviceTable::getTableName()).
+      Where(CDeviceTable::getIdColumnName(), CQUERY_OP_SUP).
+      OrderBy(CDeviceTable::getIdColumnName()).
+      Limit().
+      EndIn().
+      OrderBy(CStatementBuilder::qualified(CDeviceTable::getTableName(), CDeviceTable::getIdColumnName())).
+      ThenBy(CStatementBuilder::qualified(CKeywordTable::getTableName(), CKeywordTable::getIdColumnName()));
+   BOOST_CHECK_EQUAL(test.str(), "SELECT Device.id AS device_id, Device.name AS device_name, Keyword.id FROM Device"
+                     " LEFT JOIN Keyword ON Keyword.deviceId = Device.id AND Keyword.capacityName = $1"
+                     " WHERE Device.id IN (SELECT id FROM Device WHERE id > $2 ORDER BY id LIMIT $3)"
+                     " ORDER BY Device.id, Keyword.id");
+   BOOST_CHECK_EQUAL(test.parametersCount(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(InsertUpdateDelete)
+{
+   CStatementBuilder insert;
+   insert.InsertInto(CAcquisitionTable::getTableName(), {CAcquisitionTable::getDateColumnName(), CAcquisitionTable::getKeywordIdColumnName(), CAcquisitionTable::getValueColumnName()});
+   BOOST_CHECK_EQUAL(insert.str(), "INSERT INTO Acquisition (date, keywordId, value) VALUES ($1, $2, $3)");
+   BOOST_CHECK_EQUAL(insert.parametersCount(), 3);
+
+   CStatementBuilder update;
+   update.Update(CKeywordTable::getTableName()).
+      Set(CKeywordTable::getLastAcquisitionDateColumnName()).
+      Set(CKeywordTable::getLastAcquisitionValueColumnName()).
+      Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL);
+   BOOST_CHECK_EQUAL(update.str(), "UPDATE Keyword SET lastAcquisitionDate = $1, lastAcquisitionValue = $2 WHERE id = $3");
+   BOOST_CHECK_EQUAL(update.parametersCount(), 3);
+
+   CStatementBuilder remove;
+   remove.DeleteFrom(CKeywordTable::getTableName()).Where(CKeywordTable::getIdColumnName(), CQUERY_OP_SUP_EQUAL);
+   BOOST_CHECK_EQUAL(remove.str(), "DELETE FROM Keyword WHERE id >= $1");
+}
+
+BOOST_AUTO_TEST_CASE(Bind)
+{
+   const CStatement<int, std::string, bool, boost::posix_time::ptime> statement("test",
+                                                                                 CStatementBuilder().Update(CKeywordTable::getTableName()).
+                                                                                 Set(CKeywordTable::getFriendlyNameColumnName()).
+                                                                                 Set(CKeywordTable::getBlacklistColumnName()).
+                                                                                 Set(CKeywordTable::getLastAcquisitionDateColumnName()).
+                                                                                 Where(CKeywordTable::getIdColumnName(), CQUERY_OP_EQUAL));
+
+   const auto call = statement.bind(12, "it's a name", true, boost::posix_time::ptime(boost::gregorian::date(2020, 3, 14), boost::posix_time::hours(15)));
+   BOOST_CHECK_EQUAL(call.name, "test");
+   BOOST_CHECK_EQUAL(call.statement, statement.str());
+   BOOST_REQUIRE_EQUAL(call.parameters.size(), static_cast<std::size_t>(4));
+   BOOST_CHECK_EQUAL(call.parameters[0], "12");
+   BOOST_CHECK_EQUAL(call.parameters[1], "it's a name"); // bound values are never escaped
+   BOOST_CHECK_EQUAL(call.parameters[2], "1");
+   BOOST_CHECK_EQUAL(call.parameters[3], "20200314T150000");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,246 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../../sources/server/database/pgsql/PgsqlRequester.h"
+#include "../../../../../../sources/server/database/pgsql/PgsqlConnectionPool.h"
+#include "../../../../../../sources/server/database/pgsql/PgsqlLibrary.h"
+#include "../../../../../../sources/server/database/common/DatabaseTables.h"
+#include "../../../../../../sources/server/database/common/Query.h"
+#include "../../../../../../sources/server/database/DatabaseException.hpp"
+#include <shared/ServiceLocator.h>
+
+#include "../../../mock/server/startupOptions/DefaultStartupOptionsMock.hpp"
+
+// Tests needing a PostgreSQL server are only run if the YADOMS_TESTS_PGSQL_HOST environment variable is set
+// (YADOMS_TESTS_PGSQL_PORT, YADOMS_TESTS_PGSQL_USER, YADOMS_TESTS_PGSQL_PASSWORD and YADOMS_TESTS_PGSQL_DBNAME are optional).
+// The database is created if not existing, tests only use their own tables.
+
+using namespace database::common;
+
+BOOST_AUTO_TEST_SUITE(TestPgsqlRequester)
+
+   static std::string environment(const char* name, const std::string& defaultValue = std::string())
+   {
+      const auto value = std::getenv(name);
+      return value == nullptr ? defaultValue : std::string(value);
+   }
+
+   static bool serverAvailable()
+   {
+      if (!environment("YADOMS_TESTS_PGSQL_HOST").empty())
+         return true;
+      BOOST_TEST_MESSAGE("YADOMS_TESTS_PGSQL_HOST is not set, test skipped");
+      return false;
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    A requester connected to the tests PostgreSQL server, with an empty test table
+   //--------------------------------------------------------------
+   struct CPgsqlFixture
+   {
+      CPgsqlFixture()
+         : m_startupOptions(boost::make_shared<CDefaultStartupOptionsMock>()),
+           m_library(boost::make_shared<database::pgsql::CPgsqlLibrary>())
+      {
+         m_startupOptions->m_databaseEngine = startupOptions::EDatabaseEngine::kPostgresql;
+         m_startupOptions->m_postgresqlHost = environment("YADOMS_TESTS_PGSQL_HOST");
+         m_startupOptions->m_postgresqlPort = boost::lexical_cast<unsigned int>(environment("YADOMS_TESTS_PGSQL_PORT", "5432"));
+         m_startupOptions->m_postgresqlLogin = environment("YADOMS_TESTS_PGSQL_USER", "yadoms");
+         m_startupOptions->m_postgresqlPassword = environment("YADOMS_TESTS_PGSQL_PASSWORD", "yadoms");
+         m_startupOptions->m_postgresqlDbName = environment("YADOMS_TESTS_PGSQL_DBNAME", "yadoms_tests");
+         shared::CServiceLocator::instance().push<const startupOptions::IStartupOptions>(m_startupOptions);
+
+         m_requester = boost::make_shared<database::pgsql::CPgsqlRequester>(m_library);
+         m_requester->initialize();
+
+         execute("DROP TABLE IF EXISTS yadomsTestsAcquisition", CQuery::kDrop);
+         execute("CREATE TABLE yadomsTestsAcquisition (date TEXT NOT NULL, keywordId INTEGER NOT NULL, value TEXT, PRIMARY KEY (date, keywordId))", CQuery::kCreate);
+      }
+
+      ~CPgsqlFixture()
+      {
+         execute("DROP TABLE IF EXISTS yadomsTestsAcquisition", CQuery::kDrop);
+         m_requester->finalize();
+         shared::CServiceLocator::instance().remove<const startupOptions::IStartupOptions>(m_startupOptions);
+      }
+
+      std::string connectionString() const
+      {
+         return (boost::format("host=%1% port=%2% dbname=%3% user=%4% password=%5%")
+            % m_startupOptions->m_postgresqlHost
+            % m_startupOptions->m_postgresqlPort
+            % m_startupOptions->m_postgresqlDbName
+            % m_startupOptions->m_postgresqlLogin
+            % m_startupOptions->m_postgresqlPassword).str();
+      }
+
+      void execute(const std::string& statement, const CQuery::EQueryType& type) const
+      {
+         m_requester->queryStatement(CQuery::CustomQuery(statement, type));
+      }
+
+      int count() const
+      {
+         auto q = m_requester->newQuery();
+         q->SelectCount().From(CDatabaseTable("yadomsTestsAcquisition"));
+         return m_requester->queryCount(*q);
+      }
+
+      static database::IDatabaseRequester::PreparedStatement insert(int keywordId, const std::string& value)
+      {
+         database::IDatabaseRequester::PreparedStatement statement;
+         statement.name = "yadomsTestsInsert";
+         statement.statement = "INSERT INTO yadomsTestsAcquisition (date, keywordId, value) VALUES ('20200101T120000', $1, $2)";
+         statement.parameters.push_back(boost::lexical_cast<std::string>(keywordId));
+         statement.parameters.push_back(value);
+         return statement;
+      }
+
+      static boost::shared_ptr<database::entities::CAcquisition> acquisition(int keywordId, const std::string& value)
+      {
+         auto acquisition = boost::make_shared<database::entities::CAcquisition>();
+         acquisition->Date = boost::posix_time::ptime(boost::gregorian::date(2020, 1, 1), boost::posix_time::hours(12));
+         acquisition->KeywordId = keywordId;
+         acquisition->Value = value;
+         return acquisition;
+      }
+
+      boost::shared_ptr<CDefaultStartupOptionsMock> m_startupOptions;
+      boost::shared_ptr<database::pgsql::CPgsqlLibrary> m_library;
+      boost::shared_ptr<database::pgsql::CPgsqlRequester> m_requester;
+   };
+
+   BOOST_AUTO_TEST_CASE(FailedConnectionGivesBackItsSlot)
+   {
+      // Nothing listens on port 1 : connection is refused at once
+      database::pgsql::CPgsqlConnectionPool pool(boost::make_shared<database::pgsql::CPgsqlLibrary>(),
+                                                 "host=127.0.0.1 port=1 connect_timeout=2",
+                                                 1,
+                                                 boost::posix_time::seconds(5));
+
+      BOOST_CHECK_THROW(pool.acquire(), database::CDatabaseException);
+
+      // The only slot must be free again : the second try fails to connect, it doesn't wait for a free slot
+      const auto start = boost::posix_time::microsec_clock::universal_time();
+      BOOST_CHECK_THROW(pool.acquire(), database::CDatabaseException);
+      BOOST_CHECK_LT(boost::posix_time::microsec_clock::universal_time() - start, boost::posix_time::seconds(4));
+   }
+
+   BOOST_AUTO_TEST_CASE(NotInitializedRequester)
+   {
+      database::pgsql::CPgsqlRequester requester(boost::make_shared<database::pgsql::CPgsqlLibrary>());
+      BOOST_CHECK_THROW(requester.queryStatement(CQuery::CustomQuery("DELETE FROM yadomsTestsAcquisition", CQuery::kDelete)), database::CDatabaseException);
+   }
+
+   BOOST_AUTO_TEST_CASE(PoolReusesConnections)
+   {
+      if (!serverAvailable())
+         return;
+
+      CPgsqlFixture fixture;
+      database::pgsql::CPgsqlConnectionPool pool(fixture.m_library, fixture.connectionString(), 1, boost::posix_time::milliseconds(200));
+
+      PGconn* first;
+      {
+         const auto connection = pool.acquire();
+         first = connection.get();
+
+         // All connections in use
+         BOOST_CHECK_THROW(pool.acquire(), database::CDatabaseException);
+      }
+
+      BOOST_CHECK_EQUAL(pool.acquire().get(), first);
+   }
+
+   BOOST_AUTO_TEST_CASE(PipelineExecutesAllStatements)
+   {
+      if (!serverAvailable())
+         return;
+
+      CPgsqlFixture fixture;
+
+      std::vector<database::IDatabaseRequester::PreparedStatement> statements;
+      statements.push_back(CPgsqlFixture::insert(1, "a"));
+      statements.push_back(CPgsqlFixture::insert(2, "b"));
+      statements.push_back(CPgsqlFixture::insert(3, "c"));
+      const auto affectedRows = fixture.m_requester->queryPreparedStatements(statements);
+
+      BOOST_CHECK_EQUAL(affectedRows.size(), 3);
+      BOOST_CHECK(std::all_of(affectedRows.begin(), affectedRows.end(), [](int rows) { return rows == 1; }));
+      BOOST_CHECK_EQUAL(fixture.count(), 3);
+
+      // Statements are already prepared on the connection
+      BOOST_CHECK_EQUAL(fixture.m_requester->queryPreparedStatements(std::vector<database::IDatabaseRequester::PreparedStatement>(1, CPgsqlFixture::insert(4, "d"))).size(), 1);
+      BOOST_CHECK_EQUAL(fixture.count(), 4);
+   }
+
+   BOOST_AUTO_TEST_CASE(PipelineFailingStatement)
+   {
+      if (!serverAvailable())
+         return;
+
+      CPgsqlFixture fixture;
+
+      std::vector<database::IDatabaseRequester::PreparedStatement> statements;
+      statements.push_back(CPgsqlFixture::insert(1, "a"));
+      statements.push_back(CPgsqlFixture::insert(1, "duplicate"));
+      statements.push_back(CPgsqlFixture::insert(2, "b"));
+      BOOST_CHECK_THROW(fixture.m_requester->queryPreparedStatements(statements), database::CDatabaseException);
+
+      // The connection is usable again
+      BOOST_CHECK_EQUAL(fixture.count(), 1);
+   }
+
+   BOOST_AUTO_TEST_CASE(PipelineSendFailureInTransaction)
+   {
+      if (!serverAvailable())
+         return;
+
+      CPgsqlFixture fixture;
+
+      // Too many parameters : libpq refuses to send the second statement, the first one is already sent
+      database::IDatabaseRequester::PreparedStatement tooManyParameters;
+      tooManyParameters.name = "yadomsTestsTooManyParameters";
+      tooManyParameters.statement = "SELECT $1::TEXT";
+      tooManyParameters.parameters.assign(70000, "x");
+
+      std::vector<database::IDatabaseRequester::PreparedStatement> statements;
+      statements.push_back(CPgsqlFixture::insert(1, "a"));
+      statements.push_back(tooManyParameters);
+
+      fixture.m_requester->transactionBegin();
+      BOOST_CHECK_THROW(fixture.m_requester->queryPreparedStatements(statements), database::CDatabaseException);
+
+      // Pipeline mode is left, the transaction connection still runs synchronous queries
+      BOOST_CHECK_NO_THROW(fixture.count());
+      fixture.m_requester->transactionRollback();
+
+      BOOST_CHECK_EQUAL(fixture.count(), 0);
+   }
+
+   BOOST_AUTO_TEST_CASE(BulkInsertAcquisitions)
+   {
+      if (!serverAvailable())
+         return;
+
+      CPgsqlFixture fixture;
+      const CDatabaseTable table("yadomsTestsAcquisition");
+
+      std::vector<boost::shared_ptr<database::entities::CAcquisition>> acquisitions;
+      acquisitions.push_back(CPgsqlFixture::acquisition(1, "12.5"));
+      acquisitions.push_back(CPgsqlFixture::acquisition(2, "some text"));
+      BOOST_CHECK(fixture.m_requester->bulkInsertAcquisitions(table, acquisitions));
+      BOOST_CHECK_EQUAL(fixture.count(), 2);
+
+      // Already existing acquisitions in a transaction : rejected, but the transaction goes on
+      fixture.m_requester->transactionBegin();
+      fixture.execute("INSERT INTO yadomsTestsAcquisition (date, keywordId, value) VALUES ('20200102T120000', 3, 'kept')", CQuery::kInsert);
+      BOOST_CHECK(!fixture.m_requester->bulkInsertAcquisitions(table, acquisitions));
+      BOOST_CHECK_EQUAL(fixture.count(), 3);
+      fixture.m_requester->transactionCommit();
+
+      BOOST_CHECK_EQUAL(fixture.count(), 3);
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,254 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../../sources/server/database/sqlite/SQLiteRequester.h"
+#include "../../../../../../sources/server/database/common/requesters/Acquisition.h"
+#include "../../../../../../sources/server/database/common/requesters/Keyword.h"
+#include "../../../../../../sources/server/database/common/versioning/Version_4_3_0.h"
+#include "../../../../../../sources/server/database/common/DatabaseTables.h"
+#include "../../../../../../sources/server/database/common/Query.h"
+#include <shared/versioning/Version.h>
+
+using namespace database::common;
+
+BOOST_AUTO_TEST_SUITE(TestAcquisitionPartitions)
+
+   //--------------------------------------------------------------
+   /// \brief	    A database at 4.2.0 version (acquisitions not partitioned yet), in a temporary file
+   //--------------------------------------------------------------
+   struct CDatabaseFixture
+   {
+      CDatabaseFixture()
+         : m_dbFile(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("yadomsTests-%%%%-%%%%.db3"))
+      {
+         m_requester = boost::make_shared<database::sqlite::CSQLiteRequester>(m_dbFile.string());
+         m_requester->initialize();
+         versioning::CVersion_4_2_0().checkForUpgrade(m_requester, shared::versioning::CVersion(0, 0, 0));
+      }
+
+      ~CDatabaseFixture()
+      {
+         m_requester->finalize();
+         boost::filesystem::remove(m_dbFile);
+      }
+
+      void upgradeTo4_3_0() const
+      {
+         versioning::CVersion_4_3_0().checkForUpgrade(m_requester, shared::versioning::CVersion(4, 2, 0));
+      }
+
+      int addKeyword(const std::string& name) const
+      {
+         database::entities::CKeyword keyword;
+         keyword.DeviceId = 1;
+         keyword.CapacityName = "counter";
+         keyword.AccessMode = shared::plugin::yPluginApi::EKeywordAccessMode::kGet;
+         keyword.Name = name;
+         keyword.Type = shared::plugin::yPluginApi::EKeywordDataType::kNumeric;
+         keyword.Measure = shared::plugin::yPluginApi::historization::EMeasureType::kCumulative;
+         keywordRequester()->addKeyword(keyword);
+         return keywordRequester()->getKeyword(1, name)->Id();
+      }
+
+      boost::shared_ptr<requesters::CKeyword> keywordRequester() const
+      {
+         return boost::make_shared<requesters::CKeyword>(m_requester);
+      }
+
+      boost::shared_ptr<requesters::CAcquisition> acquisitionRequester() const
+      {
+         return boost::make_shared<requesters::CAcquisition>(m_requester, keywordRequester());
+      }
+
+      std::vector<std::string> keywordValues(requesters::CAcquisition& acquisitions, int keywordId) const
+      {
+         std::vector<std::string> values;
+         for (const auto& data : acquisitions.getKeywordData(keywordId, boost::posix_time::not_a_date_time, boost::posix_time::not_a_date_time))
+            values.push_back(data.get<1>());
+         return values;
+      }
+
+      int count(const CDatabaseTable& table) const
+      {
+         auto q = m_requester->newQuery();
+         q->SelectCount().From(table);
+         return m_requester->queryCount(*q);
+      }
+
+      const boost::filesystem::path m_dbFile;
+      boost::shared_ptr<database::sqlite::CSQLiteRequester> m_requester;
+   };
+
+   static boost::posix_time::ptime date(int year, int month, int day)
+   {
+      return boost::posix_time::ptime(boost::gregorian::date(year, month, day), boost::posix_time::hours(12));
+   }
+
+   BOOST_FIXTURE_TEST_CASE(UpgradeMovesAcquisitionsToMonthlyPartitions, CDatabaseFixture)
+   {
+      const auto keywordId = addKeyword("counter");
+      for (const auto& dataTime : {date(2019, 12, 31), date(2020, 1, 1), date(2020, 1, 20), date(2020, 3, 5)})
+      {
+         auto q = m_requester->newQuery();
+         q->InsertInto(CAcquisitionTable::getTableName(), CAcquisitionTable::getDateColumnName(), CAcquisitionTable::getKeywordIdColumnName(), CAcquisitionTable::getValueColumnName()).
+            Values(dataTime, keywordId, boost::posix_time::to_iso_string(dataTime));
+         m_requester->queryStatement(*q);
+      }
+
+      upgradeTo4_3_0();
+
+      BOOST_CHECK(!m_requester->checkTableExists(CDatabaseTable("AcquisitionLegacy")));
+
+      // No partition for the month without data
+      CAcquisitionPartitions partitions(m_requester);
+      const std::vector<boost::gregorian::date> expectedPartitions = {
+         boost::gregorian::date(2019, 12, 1), boost::gregorian::date(2020, 1, 1), boost::gregorian::date(2020, 3, 1)
+      };
+      BOOST_CHECK(partitions.partitions() == expectedPartitions);
+      BOOST_CHECK_EQUAL(count(CDatabaseTable("Acquisition_201912")), 1);
+      BOOST_CHECK_EQUAL(count(CDatabaseTable("Acquisition_202001")), 2);
+      BOOST_CHECK_EQUAL(count(CDatabaseTable("Acquisition_202003")), 1);
+
+      // All acquisitions are still read through the partitions parent
+      BOOST_CHECK_EQUAL(count(CAcquisitionTable::getTableName()), 4);
+      const std::vector<std::string> expectedValues = {"20191231T120000", "20200101T120000", "20200120T120000", "20200305T120000"};
+      const auto values = keywordValues(*acquisitionRequester(), keywordId);
+      BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expectedValues.begin(), expectedValues.end());
+   }
+
+   BOOST_FIXTURE_TEST_CASE(UpgradeEmptyDatabase, CDatabaseFixture)
+   {
+      upgradeTo4_3_0();
+
+      CAcquisitionPartitions partitions(m_requester);
+      BOOST_CHECK(partitions.partitions().empty());
+      BOOST_CHECK_EQUAL(count(CAcquisitionTable::getTableName()), 0);
+   }
+
+   BOOST_FIXTURE_TEST_CASE(AcquisitionsAreRoutedToTheirMonthPartition, CDatabaseFixture)
+   {
+      upgradeTo4_3_0();
+      const auto keywordId = addKeyword("counter");
+      const auto acquisitions = acquisitionRequester();
+
+      auto dataTime = date(2020, 1, 31);
+      acquisitions->saveData(keywordId, "1", dataTime);
+      dataTime = date(2020, 2, 1);
+      acquisitions->saveData(keywordId, "2", dataTime);
+      dataTime = date(2020, 2, 2);
+      acquisitions->saveData(std::vector<int>(1, keywordId), std::vector<std::string>(1, "3"), dataTime);
+
+      BOOST_CHECK_EQUAL(count(CDatabaseTable("Acquisition_202001")), 1);
+      BOOST_CHECK_EQUAL(count(CDatabaseTable("Acquisition_202002")), 2);
+
+      // Partition is queried directly only if the whole range is in one month
+      CAcquisitionPartitions partitions(m_requester);
+      BOOST_CHECK_EQUAL(partitions.tableFor(date(2020, 2, 1), date(2020, 2, 29)).GetName(), "Acquisition_202002");
+      BOOST_CHECK_EQUAL(partitions.tableFor(date(2020, 1, 15), date(2020, 2, 15)).GetName(), CAcquisitionTable::getTableName().GetName());
+      BOOST_CHECK_EQUAL(partitions.tableFor(date(2020, 3, 1), date(2020, 3, 2)).GetName(), CAcquisitionTable::getTableName().GetName());
+      BOOST_CHECK_EQUAL(partitions.tableFor(boost::posix_time::not_a_date_time, date(2020, 2, 2)).GetName(), CAcquisitionTable::getTableName().GetName());
+
+      const std::vector<std::string> expectedValues = {"1", "2", "3"};
+      const auto values = keywordValues(*acquisitions, keywordId);
+      BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expectedValues.begin(), expectedValues.end());
+   }
+
+   BOOST_FIXTURE_TEST_CASE(IncrementUsesLastValueOfPreviousPartitions, CDatabaseFixture)
+   {
+      upgradeTo4_3_0();
+      const auto keywordId = addKeyword("counter");
+      const auto otherKeywordId = addKeyword("otherCounter");
+
+      {
+         const auto acquisitions = acquisitionRequester();
+         auto dataTime = date(2020, 1, 10);
+         BOOST_CHECK_EQUAL(acquisitions->incrementData(keywordId, "1", dataTime)->Value(), "1");
+         dataTime = date(2020, 3, 10);
+         BOOST_CHECK_EQUAL(acquisitions->incrementData(keywordId, "2", dataTime)->Value(), "3");
+         dataTime = date(2020, 3, 11);
+         BOOST_CHECK_EQUAL(acquisitions->incrementData(otherKeywordId, "10", dataTime)->Value(), "10");
+      }
+
+      // A new requester searches the last partitions in database
+      const auto acquisitions = acquisitionRequester();
+      auto dataTime = date(2020, 5, 1);
+      BOOST_CHECK_EQUAL(acquisitions->incrementData(keywordId, "4", dataTime)->Value(), "7");
+      dataTime = date(2020, 5, 2);
+      BOOST_CHECK_EQUAL(acquisitions->incrementData(keywordId, "1", dataTime)->Value(), "8");
+
+      // Saving data in an older partition doesn't hide the last one
+      dataTime = date(2020, 2, 1);
+      acquisitions->saveData(keywordId, "100", dataTime);
+      dataTime = date(2020, 6, 1);
+      BOOST_CHECK_EQUAL(acquisitions->incrementData(keywordId, "1", dataTime)->Value(), "9");
+
+      // Keyword data removed, counter restarts
+      acquisitions->removeKeywordData(keywordId);
+      dataTime = date(2020, 7, 1);
+      BOOST_CHECK_EQUAL(acquisitions->incrementData(keywordId, "5", dataTime)->Value(), "5");
+      dataTime = date(2020, 7, 2);
+      BOOST_CHECK_EQUAL(acquisitions->incrementData(otherKeywordId, "1", dataTime)->Value(), "11");
+   }
+
+   BOOST_FIXTURE_TEST_CASE(PurgeCountsAcquisitions, CDatabaseFixture)
+   {
+      upgradeTo4_3_0();
+      const auto keywordId = addKeyword("counter");
+      const auto keptKeywordId = addKeyword("kept");
+      const auto acquisitions = acquisitionRequester();
+
+      for (auto day = 1; day <= 3; ++day)
+      {
+         auto dataTime = date(2020, 1, day);
+         acquisitions->saveData(keywordId, "1", dataTime);
+         dataTime = date(2020, 2, day);
+         acquisitions->saveData(keywordId, "2", dataTime);
+         dataTime = date(2020, 3, day);
+         acquisitions->saveData(keywordId, "3", dataTime);
+      }
+      auto keptDataTime = date(2020, 2, 10);
+      acquisitions->saveData(keptKeywordId, "kept", keptDataTime);
+
+      // January partition is dropped (3 acquisitions), February acquisitions are deleted as it contains kept data
+      const auto purgeDate = boost::posix_time::ptime(boost::gregorian::date(2020, 3, 2));
+      BOOST_CHECK_EQUAL(acquisitions->purgeAcquisitions(purgeDate, std::vector<int>(1, keptKeywordId), 1000), 7);
+
+      CAcquisitionPartitions partitions(m_requester);
+      const std::vector<boost::gregorian::date> expectedPartitions = {boost::gregorian::date(2020, 2, 1), boost::gregorian::date(2020, 3, 1)};
+      BOOST_CHECK(partitions.partitions() == expectedPartitions);
+      BOOST_CHECK_EQUAL(count(CDatabaseTable("Acquisition_202002")), 1);
+      BOOST_CHECK_EQUAL(count(CDatabaseTable("Acquisition_202003")), 2);
+
+      // Nothing left to purge
+      BOOST_CHECK_EQUAL(acquisitions->purgeAcquisitions(purgeDate, std::vector<int>(1, keptKeywordId), 1000), 0);
+
+      // Last partitions are searched again after a drop
+      auto dataTime = date(2020, 3, 20);
+      BOOST_CHECK_EQUAL(acquisitions->incrementData(keywordId, "1", dataTime)->Value(), "4");
+   }
+
+   BOOST_FIXTURE_TEST_CASE(PurgeByBatches, CDatabaseFixture)
+   {
+      upgradeTo4_3_0();
+      const auto keywordId = addKeyword("counter");
+      const auto keptKeywordId = addKeyword("kept");
+      const auto acquisitions = acquisitionRequester();
+
+      for (auto day = 1; day <= 5; ++day)
+      {
+         auto dataTime = date(2020, 1, day);
+         acquisitions->saveData(keywordId, "1", dataTime);
+      }
+      auto keptDataTime = date(2020, 1, 10);
+      acquisitions->saveData(keptKeywordId, "kept", keptDataTime);
+
+      const auto purgeDate = boost::posix_time::ptime(boost::gregorian::date(2020, 2, 1));
+      BOOST_CHECK_EQUAL(acquisitions->purgeAcquisitions(purgeDate, std::vector<int>(1, keptKeywordId), 2), 2);
+      BOOST_CHECK_EQUAL(acquisitions->purgeAcquisitions(purgeDate, std::vector<int>(1, keptKeywordId), 2), 2);
+      BOOST_CHECK_EQUAL(acquisitions->purgeAcquisitions(purgeDate, std::vector<int>(1, keptKeywordId), 2), 1);
+      BOOST_CHECK_EQUAL(acquisitions->purgeAcquisitions(purgeDate, std::vector<int>(1, keptKeywordId), 2), 0);
+      BOOST_CHECK_EQUAL(count(CDatabaseTable("Acquisition_202001")), 1);
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
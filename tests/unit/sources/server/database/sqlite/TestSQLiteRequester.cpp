@@ -0,0 +1,249 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../../sources/server/database/sqlite/SQLiteRequester.h"
+#include "../../../../../../sources/server/database/common/Query.h"
+#include "../../../../../../sources/server/database/DatabaseException.hpp"
+#include "../../../../../../sources/server/database/common/DatabaseTables.h"
+#include "../../../../../../sources/server/i18n/ClientStrings.h"
+#include "../../../mock/shared/currentTime/DefaultCurrentTimeMock.h"
+
+using namespace database::common;
+
+BOOST_AUTO_TEST_SUITE(TestSQLiteRequester)
+
+   //--------------------------------------------------------------
+   /// \brief	    An empty database in a temporary file, with a table of acquisitions
+   //--------------------------------------------------------------
+   struct CDatabaseFixture
+   {
+      CDatabaseFixture()
+         : m_dbFile(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("yadomsTests-%%%%-%%%%.db3")),
+           m_table("TestAcquisition")
+      {
+         m_requester = boost::make_shared<database::sqlite::CSQLiteRequester>(m_dbFile.string());
+         m_requester->initialize();
+         m_requester->queryStatement(CQuery::CustomQuery("CREATE TABLE TestAcquisition (date TEXT NOT NULL, keywordId INTEGER NOT NULL, value TEXT, PRIMARY KEY (date, keywordId))",
+                                                         CQuery::kCreate));
+      }
+
+      ~CDatabaseFixture()
+      {
+         m_requester->finalize();
+         boost::filesystem::remove(m_dbFile);
+      }
+
+      void insert(int keywordId, const std::string& value) const
+      {
+         m_requester->queryStatement(CQuery::CustomQuery((boost::format("INSERT INTO TestAcquisition (date, keywordId, value) VALUES ('20200101T120000', %1%, '%2%')") % keywordId % value).str(),
+                                                         CQuery::kInsert));
+      }
+
+      int count() const
+      {
+         auto q = m_requester->newQuery();
+         q->SelectCount().From(m_table);
+         return m_requester->queryCount(*q);
+      }
+
+      static database::IDatabaseRequester::PreparedStatement preparedInsert(int keywordId, const std::string& value)
+      {
+         database::IDatabaseRequester::PreparedStatement statement;
+         statement.name = "testInsert";
+         statement.statement = "INSERT INTO TestAcquisition (date, keywordId, value) VALUES ('20200101T120000', $1, $2)";
+         statement.parameters = {std::to_string(keywordId), value};
+         return statement;
+      }
+
+      static boost::shared_ptr<database::entities::CAcquisition> acquisition(int keywordId, const std::string& value)
+      {
+         auto acquisition = boost::make_shared<database::entities::CAcquisition>();
+         acquisition->Date = boost::posix_time::ptime(boost::gregorian::date(2020, 1, 1), boost::posix_time::hours(12));
+         acquisition->KeywordId = keywordId;
+         acquisition->Value = value;
+         return acquisition;
+      }
+
+      const boost::filesystem::path m_dbFile;
+      const CDatabaseTable m_table;
+      boost::shared_ptr<database::sqlite::CSQLiteRequester> m_requester;
+   };
+
+   BOOST_FIXTURE_TEST_CASE(QueryPreparedStatements, CDatabaseFixture)
+   {
+      const auto affectedRows = m_requester->queryPreparedStatements({preparedInsert(1, "a"), preparedInsert(2, "b"), preparedInsert(3, "c")});
+      BOOST_CHECK_EQUAL(affectedRows.size(), 3);
+      BOOST_CHECK(std::all_of(affectedRows.begin(), affectedRows.end(), [](int rows) { return rows == 1; }));
+
+      database::IDatabaseRequester::PreparedStatement update;
+      update.name = "testUpdate";
+      update.statement = "UPDATE TestAcquisition SET value = $1";
+      update.parameters = {"d"};
+      BOOST_CHECK_EQUAL(m_requester->queryPreparedStatements({update}).front(), 3);
+      BOOST_CHECK_EQUAL(count(), 3);
+   }
+
+   BOOST_FIXTURE_TEST_CASE(QueryPreparedStatementsStopsAtFirstFailure, CDatabaseFixture)
+   {
+      BOOST_CHECK_THROW(m_requester->queryPreparedStatements({preparedInsert(1, "a"), preparedInsert(1, "duplicate"), preparedInsert(2, "b")}),
+                        database::CDatabaseException);
+      BOOST_CHECK_EQUAL(count(), 1);
+
+      // Statement is still usable
+      BOOST_CHECK_EQUAL(m_requester->queryPreparedStatements({preparedInsert(2, "b")}).front(), 1);
+   }
+
+   BOOST_FIXTURE_TEST_CASE(BulkInsertAllOrNothing, CDatabaseFixture)
+   {
+      BOOST_CHECK(m_requester->bulkInsertAcquisitions(m_table, {acquisition(1, "a"), acquisition(2, "b")}));
+      BOOST_CHECK_EQUAL(count(), 2);
+
+      // One already exists : none is inserted
+      BOOST_CHECK(!m_requester->bulkInsertAcquisitions(m_table, {acquisition(3, "c"), acquisition(1, "duplicate")}));
+      BOOST_CHECK_EQUAL(count(), 2);
+      BOOST_CHECK(!m_requester->transactionIsAlreadyCreated());
+   }
+
+   BOOST_FIXTURE_TEST_CASE(BulkInsertInTransaction, CDatabaseFixture)
+   {
+      m_requester->transactionBegin();
+      insert(1, "a");
+      BOOST_CHECK(!m_requester->bulkInsertAcquisitions(m_table, {acquisition(2, "b"), acquisition(1, "duplicate")}));
+      BOOST_CHECK(m_requester->bulkInsertAcquisitions(m_table, {acquisition(2, "b")}));
+      m_requester->transactionCommit();
+
+      BOOST_CHECK_EQUAL(count(), 2);
+   }
+
+   BOOST_FIXTURE_TEST_CASE(BulkInsertWaitsForTransactionOfAnotherThread, CDatabaseFixture)
+   {
+      m_requester->transactionBegin();
+      insert(1, "rolled back");
+
+      // Out of a transaction, the bulk insert savepoint must not be nested in the transaction of this thread
+      auto inserted = false;
+      boost::thread otherThread([this, &inserted]()
+      {
+         inserted = m_requester->bulkInsertAcquisitions(m_table, {acquisition(2, "a"), acquisition(3, "b")});
+      });
+      BOOST_CHECK(!otherThread.try_join_for(boost::chrono::milliseconds(200)));
+
+      m_requester->transactionRollback();
+      otherThread.join();
+
+      BOOST_CHECK(inserted);
+      BOOST_CHECK_EQUAL(count(), 2);
+   }
+
+   BOOST_FIXTURE_TEST_CASE(TransactionWaitsForTransactionOfAnotherThread, CDatabaseFixture)
+   {
+      m_requester->transactionBegin();
+      insert(1, "rolled back");
+
+      boost::thread otherThread([this]()
+      {
+         m_requester->transactionBegin();
+         insert(2, "committed");
+         m_requester->transactionCommit();
+      });
+      BOOST_CHECK(!otherThread.try_join_for(boost::chrono::milliseconds(200)));
+
+      m_requester->transactionRollback();
+      otherThread.join();
+
+      BOOST_CHECK_EQUAL(count(), 1);
+      BOOST_CHECK(!m_requester->transactionIsAlreadyCreated());
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    A database with acquisitions at 00:00 and 12:00 from 2020-01-01 to 2020-01-05 (now)
+   //--------------------------------------------------------------
+   struct CBackupFixture : CDatabaseFixture
+   {
+      CBackupFixture()
+         : m_backupFolder(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("yadomsTests-%%%%-%%%%"))
+      {
+         useTimeMock()->reset("2020-01-05 12:00:00.000");
+
+         m_requester->queryStatement(CQuery::CustomQuery(m_requester->getTableCreationScriptProvider()->getTableAcquisition(), CQuery::kCreate));
+         std::vector<boost::shared_ptr<database::entities::CAcquisition>> acquisitions;
+         for (auto day = 1; day <= 5; ++day)
+         {
+            for (auto hour = 0; hour <= 12; hour += 12)
+            {
+               auto acquisition = boost::make_shared<database::entities::CAcquisition>();
+               acquisition->Date = boost::posix_time::ptime(boost::gregorian::date(2020, 1, day), boost::posix_time::hours(hour));
+               acquisition->KeywordId = 1;
+               acquisition->Value = std::to_string(day * 100 + hour);
+               acquisitions.push_back(acquisition);
+            }
+         }
+         BOOST_REQUIRE(m_requester->bulkInsertAcquisitions(CAcquisitionTable::getTableName(), acquisitions));
+
+         boost::filesystem::create_directories(m_backupFolder);
+      }
+
+      ~CBackupFixture()
+      {
+         boost::filesystem::remove_all(m_backupFolder);
+      }
+
+      //--------------------------------------------------------------
+      /// \brief	    Get the values of the acquisitions of a backup file, by date order
+      //--------------------------------------------------------------
+      std::vector<std::string> backupValues(const std::string& backupFile) const
+      {
+         sqlite3* pFile;
+         BOOST_REQUIRE_EQUAL(sqlite3_open((m_backupFolder / backupFile).string().c_str(), &pFile), SQLITE_OK);
+
+         std::vector<std::string> values;
+         sqlite3_stmt* statement;
+         const auto query = (boost::format("SELECT %1% FROM %2% ORDER BY %3%")
+            % CAcquisitionTable::getValueColumnName().GetName()
+            % CAcquisitionTable::getTableName().GetName()
+            % CAcquisitionTable::getDateColumnName().GetName()).str();
+         BOOST_CHECK_EQUAL(sqlite3_prepare_v2(pFile, query.c_str(), -1, &statement, nullptr), SQLITE_OK);
+         while (sqlite3_step(statement) == SQLITE_ROW)
+            values.push_back(reinterpret_cast<const char*>(sqlite3_column_text(statement, 0)));
+         sqlite3_finalize(statement);
+
+         sqlite3_close(pFile);
+         return values;
+      }
+
+      const boost::filesystem::path m_backupFolder;
+   };
+
+   BOOST_FIXTURE_TEST_CASE(Backup, CBackupFixture)
+   {
+      auto succeeded = false;
+      m_requester->backupData(m_backupFolder.string(), [&](int remaining, int total, std::string i18nMessage, std::string error)
+                              {
+                                 succeeded = (i18nMessage == i18n::CClientStrings::DatabaseBackupSuccess);
+                              });
+
+      BOOST_CHECK(succeeded);
+      BOOST_CHECK(std::vector<std::string>({"100", "112", "200", "212", "300", "312", "400", "412", "500", "512"}) == backupValues("yadoms.db3"));
+   }
+
+   BOOST_FIXTURE_TEST_CASE(IncrementalBackup, CBackupFixture)
+   {
+      m_requester->backupAcquisitionsSince(m_backupFolder.string(),
+                                           boost::posix_time::ptime(boost::gregorian::date(2020, 1, 3), boost::posix_time::hours(6)),
+                                           database::IDataBackup::ProgressFunc());
+
+      // Only acquisitions since last backup, day by day until today
+      BOOST_CHECK(std::vector<std::string>({"312", "400", "412", "500", "512"}) == backupValues("yadoms-acquisitions.db3"));
+   }
+
+   BOOST_FIXTURE_TEST_CASE(IncrementalBackupOfToday, CBackupFixture)
+   {
+      m_requester->backupAcquisitionsSince(m_backupFolder.string(),
+                                           boost::posix_time::ptime(boost::gregorian::date(2020, 1, 5), boost::posix_time::hours(1)),
+                                           database::IDataBackup::ProgressFunc());
+
+      BOOST_CHECK(std::vector<std::string>({"512"}) == backupValues("yadoms-acquisitions.db3"));
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
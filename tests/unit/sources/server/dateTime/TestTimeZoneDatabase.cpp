@@ -0,0 +1,96 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../sources/server/dateTime/TimeZoneDatabase.h"
+#include <boost/date_time/local_time/local_time.hpp>
+
+BOOST_AUTO_TEST_SUITE(TestTimeZoneDatabase)
+
+   //--------------------------------------------------------------
+   /// \brief	    Some zones from boost date_time_zonespec.csv (the source of the generated table)
+   //--------------------------------------------------------------
+   static const std::string ReferenceZonespecCsv =
+      "\"America/Indiana/Indianapolis\",\"EST\",\"EST\",\"\",\"\",\"-05:00:00\",\"+00:00:00\",\"2;0;3\",\"\",\"1;0;11\",\"+00:00:00\"\n"
+      "\"America/New_York\",\"EST\",\"Eastern Standard Time\",\"EDT\",\"Eastern Daylight Time\",\"-05:00:00\",\"+01:00:00\",\"2;0;3\",\"+02:00:00\",\"1;0;11\",\"+02:00:00\"\n"
+      "\"America/Sao_Paulo\",\"BRT\",\"BRT\",\"BRST\",\"BRST\",\"-03:00:00\",\"+01:00:00\",\"2;0;10\",\"+00:00:00\",\"3;0;2\",\"+00:00:00\"\n"
+      "\"Asia/Tehran\",\"IRT\",\"IRT\",\"\",\"\",\"+03:30:00\",\"+00:00:00\",\"\",\"\",\"\",\"+00:00:00\"\n"
+      "\"Asia/Tokyo\",\"JST\",\"JST\",\"\",\"\",\"+09:00:00\",\"+00:00:00\",\"\",\"\",\"\",\"+00:00:00\"\n"
+      "\"Australia/Sydney\",\"EST\",\"EST\",\"EST\",\"EST\",\"+10:00:00\",\"+01:00:00\",\"1;0;10\",\"+02:00:00\",\"1;0;4\",\"+03:00:00\"\n"
+      "\"Europe/Paris\",\"CET\",\"CET\",\"CEST\",\"CEST\",\"+01:00:00\",\"+01:00:00\",\"-1;0;3\",\"+02:00:00\",\"-1;0;10\",\"+03:00:00\"\n";
+
+   //--------------------------------------------------------------
+   /// \brief	    Zones are the same than the ones parsed by boost
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(SameAsBoostParsing)
+   {
+      boost::local_time::tz_database reference;
+      std::istringstream referenceStream(ReferenceZonespecCsv);
+      reference.load_from_stream(referenceStream);
+
+      const dateTime::CTimeZoneDatabase database;
+
+      for (const auto& id : reference.region_list())
+      {
+         BOOST_TEST_MESSAGE(id);
+         const auto expected = reference.time_zone_from_region(id);
+         const auto zone = database.fromId(id);
+         BOOST_REQUIRE(!!zone);
+
+         BOOST_CHECK_EQUAL(zone->std_zone_abbrev(), expected->std_zone_abbrev());
+         BOOST_CHECK_EQUAL(zone->std_zone_name(), expected->std_zone_name());
+         BOOST_CHECK_EQUAL(zone->dst_zone_abbrev(), expected->dst_zone_abbrev());
+         BOOST_CHECK_EQUAL(zone->dst_zone_name(), expected->dst_zone_name());
+         BOOST_CHECK_EQUAL(zone->has_dst(), expected->has_dst());
+         BOOST_CHECK_EQUAL(zone->base_utc_offset(), expected->base_utc_offset());
+         BOOST_CHECK_EQUAL(zone->dst_offset(), expected->dst_offset());
+         BOOST_CHECK_EQUAL(zone->to_posix_string(), expected->to_posix_string());
+
+         for (auto year = 2015; year < 2030; ++year)
+         {
+            BOOST_CHECK_EQUAL(zone->dst_local_start_time(year), expected->dst_local_start_time(year));
+            BOOST_CHECK_EQUAL(zone->dst_local_end_time(year), expected->dst_local_end_time(year));
+         }
+      }
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Local time resolution
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(LocalTime)
+   {
+      const dateTime::CTimeZoneDatabase database;
+      const auto paris = database.fromId("Europe/Paris");
+
+      const boost::posix_time::ptime winter(boost::gregorian::date(2021, 1, 15), boost::posix_time::hours(12));
+      const boost::posix_time::ptime summer(boost::gregorian::date(2021, 7, 15), boost::posix_time::hours(12));
+      BOOST_CHECK_EQUAL(boost::local_time::local_date_time(winter, paris).local_time(), winter + boost::posix_time::hours(1));
+      BOOST_CHECK_EQUAL(boost::local_time::local_date_time(summer, paris).local_time(), summer + boost::posix_time::hours(2));
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    All ids are found, unknown ids are not
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(Lookup)
+   {
+      const dateTime::CTimeZoneDatabase database;
+
+      const auto ids = database.allIds();
+      BOOST_CHECK(!ids.empty());
+      BOOST_CHECK(std::is_sorted(ids.begin(), ids.end()));
+      for (const auto& id : ids)
+         BOOST_CHECK_MESSAGE(!!database.fromId(id), id);
+
+      BOOST_CHECK(!database.fromId(""));
+      BOOST_CHECK(!database.fromId("Europe/Pari"));
+      BOOST_CHECK(!database.fromId("europe/paris"));
+      BOOST_CHECK(!database.fromId("Mars/Olympus_Mons"));
+
+      //zones are built once
+      BOOST_CHECK(database.fromId("Europe/Paris") == database.fromId("Europe/Paris"));
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
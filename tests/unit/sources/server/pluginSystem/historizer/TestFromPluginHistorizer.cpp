@@ -0,0 +1,111 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../sources/server/communication/ReceiveArena.hpp"
+#include "../../../../../sources/server/pluginSystem/FromPluginHistorizer.h"
+
+BOOST_AUTO_TEST_SUITE(TestFromPluginHistorizer)
+
+   typedef shared::plugin::yPluginApi::EKeywordDataType EKeywordDataType;
+   typedef shared::plugin::yPluginApi::EKeywordAccessMode EKeywordAccessMode;
+   typedef shared::plugin::yPluginApi::historization::EMeasureType EMeasureType;
+
+   // Serialize a HistorizeData message, as sent by a plugin
+   static std::string serializedHistorizeData(const std::string& device,
+                                              const std::vector<std::pair<std::string, std::string>>& keywordsValues)
+   {
+      plugin_IPC::toYadoms::msg msg;
+      auto historizeData = msg.mutable_historizedata();
+      historizeData->set_device(device);
+      for (const auto& keywordValue : keywordsValues)
+      {
+         auto value = historizeData->add_value();
+         auto historizable = value->mutable_historizable();
+         historizable->set_name(keywordValue.first);
+         historizable->mutable_capacity()->set_name("temperature");
+         historizable->mutable_capacity()->set_unit("degrees");
+         historizable->mutable_capacity()->set_type(EKeywordDataType(EKeywordDataType::kNumeric).toString());
+         historizable->set_accessmode(EKeywordAccessMode(EKeywordAccessMode::kGet).toString());
+         historizable->set_measure(EMeasureType(EMeasureType::kAbsolute).toString());
+         historizable->set_typeinfo("{\"precision\":\"0.1\"}");
+         value->set_formattedvalue(keywordValue.second);
+      }
+
+      std::string serialized;
+      BOOST_REQUIRE(msg.SerializeToString(&serialized));
+      return serialized;
+   }
+
+   static std::vector<boost::shared_ptr<const shared::plugin::yPluginApi::historization::IHistorizable>> receive(communication::CReceiveArena& arena,
+                                                                                                                const std::string& serialized,
+                                                                                                                pluginSystem::CHistorizableDescriptionTable& table)
+   {
+      const auto& msg = arena.parse<plugin_IPC::toYadoms::msg>(reinterpret_cast<const unsigned char*>(serialized.data()), serialized.size());
+      BOOST_REQUIRE(msg.has_historizedata());
+      BOOST_CHECK_EQUAL(msg.historizedata().device(), "myDevice");
+      return pluginSystem::CFromPluginHistorizer::historizables(msg.historizedata(), table);
+   }
+
+   BOOST_AUTO_TEST_CASE(ReceivedValues)
+   {
+      communication::CReceiveArena arena;
+      pluginSystem::CHistorizableDescriptionTable table;
+
+      const auto historizables = receive(arena,
+                                         serializedHistorizeData("myDevice", {{"indoor", "21.5"}, {"outdoor", "-3.2"}, {"indoor", "21.6"}}),
+                                         table);
+
+      BOOST_REQUIRE_EQUAL(historizables.size(), static_cast<std::size_t>(3));
+      BOOST_CHECK_EQUAL(historizables[0]->getKeyword(), "indoor");
+      BOOST_CHECK_EQUAL(historizables[0]->formatValue(), "21.5");
+      BOOST_CHECK_EQUAL(historizables[1]->getKeyword(), "outdoor");
+      BOOST_CHECK_EQUAL(historizables[1]->formatValue(), "-3.2");
+      BOOST_CHECK_EQUAL(historizables[2]->getKeyword(), "indoor");
+      BOOST_CHECK_EQUAL(historizables[2]->formatValue(), "21.6");
+
+      BOOST_CHECK_EQUAL(historizables[1]->getCapacity().getName(), "temperature");
+      BOOST_CHECK_EQUAL(historizables[1]->getCapacity().getUnit(), "degrees");
+      BOOST_CHECK(historizables[1]->getCapacity().getType() == EKeywordDataType::kNumeric);
+      BOOST_CHECK(historizables[1]->getAccessMode() == EKeywordAccessMode::kGet);
+      BOOST_CHECK(historizables[1]->getMeasureType() == EMeasureType::kAbsolute);
+      BOOST_CHECK_EQUAL(historizables[1]->getTypeInfo().get<std::string>("precision"), "0.1");
+
+      // Values of the same keyword share its description
+      BOOST_CHECK(&historizables[0]->getCapacity() == &historizables[2]->getCapacity());
+      BOOST_CHECK(&historizables[0]->getCapacity() != &historizables[1]->getCapacity());
+      BOOST_CHECK_EQUAL(table.size(), static_cast<std::size_t>(2));
+   }
+
+   BOOST_AUTO_TEST_CASE(RepeatedMessages)
+   {
+      communication::CReceiveArena arena;
+      pluginSystem::CHistorizableDescriptionTable table;
+      const auto serialized = serializedHistorizeData("myDevice", {{"indoor", "21.5"}, {"outdoor", "-3.2"}});
+
+      const auto first = receive(arena, serialized, table);
+      const auto arenaSize = arena.spaceAllocated();
+
+      for (auto i = 0; i < 100; ++i)
+      {
+         const auto historizables = receive(arena, serialized, table);
+         BOOST_REQUIRE_EQUAL(historizables.size(), static_cast<std::size_t>(2));
+         BOOST_CHECK(&historizables[0]->getCapacity() == &first[0]->getCapacity());
+         BOOST_CHECK(&historizables[1]->getCapacity() == &first[1]->getCapacity());
+      }
+
+      // Known keywords are not described again, and the arena memory is reused
+      BOOST_CHECK_EQUAL(table.size(), static_cast<std::size_t>(2));
+      BOOST_CHECK_EQUAL(arena.spaceAllocated(), arenaSize);
+   }
+
+   BOOST_AUTO_TEST_CASE(InvalidMessage)
+   {
+      communication::CReceiveArena arena;
+      const std::string garbage("\xff\xff\xff\xff\xff", 5);
+
+      BOOST_CHECK_THROW(arena.parse<plugin_IPC::toYadoms::msg>(reinterpret_cast<const unsigned char*>(garbage.data()), garbage.size()),
+                        shared::exception::CInvalidParameter);
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
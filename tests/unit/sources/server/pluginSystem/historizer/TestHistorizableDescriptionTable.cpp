@@ -0,0 +1,55 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../sources/server/pluginSystem/HistorizableDescriptionTable.h"
+
+BOOST_AUTO_TEST_SUITE(TestHistorizableDescriptionTable)
+
+   typedef shared::plugin::yPluginApi::EKeywordDataType EKeywordDataType;
+   typedef shared::plugin::yPluginApi::EKeywordAccessMode EKeywordAccessMode;
+   typedef shared::plugin::yPluginApi::historization::EMeasureType EMeasureType;
+
+   BOOST_AUTO_TEST_CASE(SharedDescription)
+   {
+      pluginSystem::CHistorizableDescriptionTable table;
+
+      const auto temperature = table.get("temperature", "temperature", "degrees", EKeywordDataType::kNumeric, EKeywordAccessMode::kGet, EMeasureType::kAbsolute, std::string());
+      BOOST_CHECK_EQUAL(temperature->keyword, "temperature");
+      BOOST_CHECK_EQUAL(temperature->capacity.getUnit(), "degrees");
+      BOOST_CHECK(temperature == table.get("temperature", "temperature", "degrees", EKeywordDataType::kNumeric, EKeywordAccessMode::kGet, EMeasureType::kAbsolute, std::string()));
+
+      // Same name, but different description
+      const auto otherTemperature = table.get("temperature", "temperature", "degrees", EKeywordDataType::kNumeric, EKeywordAccessMode::kGetSet, EMeasureType::kAbsolute, std::string());
+      BOOST_CHECK(temperature != otherTemperature);
+      BOOST_CHECK_EQUAL(table.size(), static_cast<std::size_t>(2));
+   }
+
+   BOOST_AUTO_TEST_CASE(KnownKeywordIsNotDuplicated)
+   {
+      pluginSystem::CHistorizableDescriptionTable table;
+
+      const std::string keyword("outdoor temperature of the garden");
+      const std::string capacity("temperature");
+      const std::string unit("degrees");
+      const std::string typeInfo("{\"min\":\"-50\",\"max\":\"100\",\"precision\":\"0.1\"}");
+      const auto description = table.get(keyword, capacity, unit, EKeywordDataType::kNumeric, EKeywordAccessMode::kGet, EMeasureType::kAbsolute, typeInfo);
+
+      // Known keyword must give the same description, without creating a new one
+      for (auto i = 0; i < 100; ++i)
+         BOOST_CHECK(description == table.get(keyword, capacity, unit, EKeywordDataType::kNumeric, EKeywordAccessMode::kGet, EMeasureType::kAbsolute, typeInfo));
+
+      BOOST_CHECK_EQUAL(table.size(), static_cast<std::size_t>(1));
+      BOOST_CHECK_EQUAL(description->typeInfo.get<std::string>("max"), "100");
+   }
+
+   BOOST_AUTO_TEST_CASE(BoundedSize)
+   {
+      pluginSystem::CHistorizableDescriptionTable table(10);
+      for (auto i = 0; i < 25; ++i)
+         table.get("keyword" + std::to_string(i), "temperature", "degrees", EKeywordDataType::kNumeric, EKeywordAccessMode::kGet, EMeasureType::kAbsolute, std::string());
+
+      BOOST_CHECK(table.size() <= static_cast<std::size_t>(10));
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
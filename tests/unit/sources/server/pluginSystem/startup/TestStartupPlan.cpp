@@ -0,0 +1,101 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../sources/server/pluginSystem/StartupPlan.h"
+
+BOOST_AUTO_TEST_SUITE(TestStartupPlan)
+
+   static std::vector<int> ids(std::initializer_list<int> list)
+   {
+      return std::vector<int>(list);
+   }
+
+   BOOST_AUTO_TEST_CASE(BoundedParallelism)
+   {
+      pluginSystem::CStartupPlan plan(2);
+      for (auto id = 1; id <= 5; ++id)
+         plan.addInstance(id, "plugin" + std::to_string(id));
+
+      BOOST_CHECK(ids({1, 2}) == plan.nextInstancesToStart());
+      BOOST_CHECK(plan.nextInstancesToStart().empty());
+
+      plan.onInstanceStarted(2);
+      BOOST_CHECK(ids({3}) == plan.nextInstancesToStart());
+
+      plan.onInstanceStarted(1);
+      plan.onInstanceStarted(3);
+      BOOST_CHECK(ids({4, 5}) == plan.nextInstancesToStart());
+      BOOST_CHECK(!plan.completed());
+
+      plan.onInstanceStarted(4);
+      plan.onInstanceStarted(5);
+      BOOST_CHECK(plan.completed());
+   }
+
+   BOOST_AUTO_TEST_CASE(Priority)
+   {
+      pluginSystem::CStartupPlan plan(1);
+      plan.addInstance(1, "low", std::vector<std::string>(), -1);
+      plan.addInstance(2, "normal");
+      plan.addInstance(3, "high", std::vector<std::string>(), 10);
+      plan.addInstance(4, "normal");
+
+      BOOST_CHECK(ids({3}) == plan.nextInstancesToStart());
+      plan.onInstanceStarted(3);
+      BOOST_CHECK(ids({2}) == plan.nextInstancesToStart());
+      plan.onInstanceStarted(2);
+      BOOST_CHECK(ids({4}) == plan.nextInstancesToStart());
+      plan.onInstanceStarted(4);
+      BOOST_CHECK(ids({1}) == plan.nextInstancesToStart());
+   }
+
+   BOOST_AUTO_TEST_CASE(Dependencies)
+   {
+      pluginSystem::CStartupPlan plan(4);
+      plan.addInstance(1, "gateway", {"zwave", "unknownPlugin"});
+      plan.addInstance(2, "zwave");
+      plan.addInstance(3, "zwave");
+      plan.addInstance(4, "other");
+
+      BOOST_CHECK(ids({2, 3, 4}) == plan.nextInstancesToStart());
+      BOOST_CHECK(!plan.areStarted({1}));
+      BOOST_CHECK(plan.areStarted({42})); // Not in plan
+
+      plan.onInstanceStarted(2);
+      BOOST_CHECK(plan.areStarted({2}));
+      BOOST_CHECK(plan.nextInstancesToStart().empty()); // Still one zwave instance starting
+
+      plan.onInstanceStarted(3);
+      BOOST_CHECK(ids({1}) == plan.nextInstancesToStart());
+   }
+
+   BOOST_AUTO_TEST_CASE(CyclicDependencies)
+   {
+      pluginSystem::CStartupPlan plan(4);
+      plan.addInstance(1, "a", {"b"});
+      plan.addInstance(2, "b", {"a"});
+
+      BOOST_CHECK(ids({1}) == plan.nextInstancesToStart());
+      plan.onInstanceStarted(1);
+      BOOST_CHECK(ids({2}) == plan.nextInstancesToStart());
+   }
+
+   BOOST_AUTO_TEST_CASE(Abort)
+   {
+      pluginSystem::CStartupPlan plan(1);
+      plan.addInstance(1, "a");
+      plan.addInstance(2, "b");
+      plan.addInstance(3, "c", {"a"});
+      plan.addInstance(4, "d", std::vector<std::string>(), 10);
+      BOOST_CHECK(ids({4}) == plan.nextInstancesToStart());
+
+      // Waiting instances must still be started (in start order), whatever the parallel starts limit and the dependencies
+      BOOST_CHECK(ids({1, 2, 3}) == plan.abort());
+      BOOST_CHECK(plan.completed());
+      BOOST_CHECK(plan.areStarted({1, 2, 3, 4}));
+      BOOST_CHECK(plan.nextInstancesToStart().empty());
+      BOOST_CHECK(plan.abort().empty());
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -193,6 +193,7 @@ BOOST_AUTO_TEST_SUITE(TestLoader)
       BOOST_CHECK_EQUAL(loader.options().getUpdateSiteUri(), "http://www.yadoms.com/downloads/update/") ;
       BOOST_CHECK_EQUAL(loader.options().getDatabaseAcquisitionLifetime(), 30) ;
       BOOST_CHECK_EQUAL(loader.options().getDeveloperMode(), false) ;
+      BOOST_CHECK_EQUAL(loader.options().getMetricsEnabled(), false) ;
    }
 
    //--------------------------------------------------------------
@@ -825,6 +826,37 @@ BOOST_AUTO_TEST_SUITE(TestLoader)
       BOOST_CHECK_EQUAL(loader.options().getDeveloperMode(), false) ;
    }
 
+   //--------------------------------------------------------------
+   /// \brief	    Test CStartupOptionMokeup with acquisition lifetime by keyword
+   /// \result         No Error - lifetimes are parsed, global lifetime is unchanged
+   //--------------------------------------------------------------
+
+   BOOST_AUTO_TEST_CASE(AcquisitionLifetimeByKeyword)
+   {
+      char* argv[] = {"./TestLoader", "--acquisitionLifetimeByKeyword=12:7, 35:365,40:0"};
+
+      CStartupOptionMokeup loader(2, argv, true);
+
+      const auto lifetimes = loader.options().getDatabaseAcquisitionLifetimeByKeyword();
+      BOOST_CHECK_EQUAL(lifetimes.size(), static_cast<std::size_t>(3)) ;
+      BOOST_CHECK_EQUAL(lifetimes.at(12), 7) ;
+      BOOST_CHECK_EQUAL(lifetimes.at(35), 365) ;
+      BOOST_CHECK_EQUAL(lifetimes.at(40), 0) ;
+      BOOST_CHECK_EQUAL(loader.options().getDatabaseAcquisitionLifetime(), 30) ;
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Test CStartupOptionMokeup with a malformed acquisition lifetime by keyword
+   /// \result         Raise a Exception
+   //--------------------------------------------------------------
+
+   BOOST_AUTO_TEST_CASE(AcquisitionLifetimeByKeyword_Error)
+   {
+      char* argv[] = {"./TestLoader", "--acquisitionLifetimeByKeyword=12-7"};
+
+      BOOST_CHECK_THROW(CStartupOptionMokeup loader(2, argv, true), Poco::Exception) ;
+   }
+
    //--------------------------------------------------------------
    /// \brief	    Test CStartupOptionMokeup with the parameter -p without value
    /// \result         No Error - No Exception thrown
@@ -0,0 +1,52 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../../../sources/server/task/backup/BackupFile.h"
+
+BOOST_AUTO_TEST_SUITE(TestBackupFile)
+
+   static const boost::posix_time::ptime BackupDate(boost::gregorian::date(2020, 1, 5), boost::posix_time::time_duration(12, 30, 15));
+
+   static void createFile(const boost::filesystem::path& file)
+   {
+      std::ofstream out(file.string());
+   }
+
+   BOOST_AUTO_TEST_CASE(Name)
+   {
+      BOOST_CHECK_EQUAL(task::backup::CBackupFile::name(BackupDate, false), "backup_20200105T123015.zip");
+      BOOST_CHECK_EQUAL(task::backup::CBackupFile::name(BackupDate, true), "backup_20200105T123015_incremental.zip");
+      BOOST_CHECK_EQUAL(task::backup::CBackupFile::name(BackupDate + boost::posix_time::milliseconds(250), false), "backup_20200105T123015.250000.zip");
+   }
+
+   BOOST_AUTO_TEST_CASE(Date)
+   {
+      // Date is read from the names made for the backups
+      BOOST_CHECK_EQUAL(task::backup::CBackupFile::date(task::backup::CBackupFile::name(BackupDate, false)), BackupDate);
+      BOOST_CHECK_EQUAL(task::backup::CBackupFile::date(task::backup::CBackupFile::name(BackupDate, true)), BackupDate);
+      BOOST_CHECK_EQUAL(task::backup::CBackupFile::date(task::backup::CBackupFile::name(BackupDate + boost::posix_time::milliseconds(250), true)), BackupDate);
+
+      BOOST_CHECK(task::backup::CBackupFile::date("backup_20200105T123015.zip.inprogress").is_not_a_date_time());
+      BOOST_CHECK(task::backup::CBackupFile::date("backup_20201305T123015.zip").is_not_a_date_time());
+      BOOST_CHECK(task::backup::CBackupFile::date("yadoms.db3").is_not_a_date_time());
+   }
+
+   BOOST_AUTO_TEST_CASE(LastBackupDate)
+   {
+      const auto backupFolder = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("yadomsTests-%%%%-%%%%");
+      BOOST_CHECK(task::backup::CBackupFile::lastBackupDate(backupFolder).is_not_a_date_time());
+
+      boost::filesystem::create_directories(backupFolder);
+      BOOST_CHECK(task::backup::CBackupFile::lastBackupDate(backupFolder).is_not_a_date_time());
+
+      createFile(backupFolder / task::backup::CBackupFile::name(BackupDate - boost::gregorian::days(2), false));
+      createFile(backupFolder / task::backup::CBackupFile::name(BackupDate - boost::gregorian::days(1), true));
+      createFile(backupFolder / (task::backup::CBackupFile::name(BackupDate, true) + ".inprogress"));
+      createFile(backupFolder / "notABackup.zip");
+      BOOST_CHECK_EQUAL(task::backup::CBackupFile::lastBackupDate(backupFolder), BackupDate - boost::gregorian::days(1));
+
+      boost::filesystem::remove_all(backupFolder);
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
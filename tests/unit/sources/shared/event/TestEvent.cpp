@@ -420,4 +420,67 @@ BOOST_AUTO_TEST_CASE(ShutdownWhenSending)
    BOOST_CHECK_EQUAL(nbReceivedEvents, (nbthreads * nbMessagesPerThread) - 150);
 }
 
+//--------------------------------------------------------------
+/// \brief	    Clear pending events while producers are still sending
+/// \result         No Error
+//--------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ClearWhenSending)
+{
+   const unsigned int nbthreads = 10;
+   const unsigned int nbMessagesPerThread = 1000;
+   shared::event::CEventHandler evtHandler;
+
+   std::vector<boost::thread> threads;
+   for (unsigned int i = 0; i < nbthreads; ++i)
+      threads.push_back(boost::thread(postEventThreaded, &evtHandler, nbMessagesPerThread));
+
+   evtHandler.clear();
+
+   for (auto itThread = threads.begin(); itThread != threads.end(); ++itThread)
+      itThread->join();
+
+   // Remaining events are all available
+   const auto remainingEvents = evtHandler.size();
+   for (std::size_t i = 0; i < remainingEvents; ++i)
+      BOOST_CHECK_EQUAL(evtHandler.waitForEvents(boost::date_time::min_date_time), idEvent);
+   BOOST_CHECK(evtHandler.empty());
+
+   evtHandler.clear();
+   BOOST_CHECK_EQUAL(evtHandler.waitForEvents(boost::date_time::min_date_time), shared::event::kNoEvent);
+}
+
+//--------------------------------------------------------------
+/// \brief	    Contention benchmark : many producers sending to one consumer
+/// \result         No Error, all events received
+//--------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ManyProducersContentionBenchmark)
+{
+   const unsigned int nbthreads = 32;
+   const unsigned int nbMessagesPerThread = 20000;
+   shared::event::CEventHandler evtHandler;
+   CEventData data(42, "Yadoms test");
+
+   const auto start = boost::chrono::steady_clock::now();
+
+   std::vector<boost::thread> threads;
+   for (unsigned int i = 0; i < nbthreads; ++i)
+      threads.push_back(boost::thread(postEventWithDataThreaded, &evtHandler, data, nbMessagesPerThread));
+
+   unsigned int nbReceivedEvents = 0;
+   while (nbReceivedEvents < nbthreads * nbMessagesPerThread)
+   {
+      BOOST_REQUIRE_EQUAL(evtHandler.waitForEvents(boost::posix_time::seconds(5)), idEvent);
+      BOOST_REQUIRE(evtHandler.isEventType<CEventData>());
+      ++nbReceivedEvents;
+   }
+
+   const auto duration = boost::chrono::steady_clock::now() - start;
+
+   for (auto itThread = threads.begin(); itThread != threads.end(); ++itThread)
+      itThread->join();
+
+   BOOST_CHECK(evtHandler.empty());
+   BOOST_TEST_MESSAGE(nbthreads << " producers x " << nbMessagesPerThread << " events : " << boost::chrono::duration_cast<boost::chrono::microseconds>(duration).count() << " us");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../sources/shared/shared/event/EventHandler.hpp"
+#include "../../../../sources/shared/shared/event/TimeEventScheduler.h"
+
+#include "../mock/shared/currentTime/DefaultCurrentTimeMock.h"
+
+BOOST_AUTO_TEST_SUITE(TestTimeEventScheduler)
+
+   //--------------------------------------------------------------
+   /// \brief	    Time events are ordered by next stop point, and follow start/stop
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(Ordering)
+   {
+      useTimeMock();
+
+      boost::mutex mutex;
+      shared::event::CTimeEventScheduler scheduler(mutex);
+      BOOST_CHECK(!scheduler.hasRunningTimeEvents());
+      BOOST_CHECK(!scheduler.next());
+
+      auto timer1(boost::make_shared<shared::event::CEventTimer>(1, shared::event::CEventTimer::kOneShot, boost::posix_time::seconds(10)));
+      auto timer2(boost::make_shared<shared::event::CEventTimer>(2, shared::event::CEventTimer::kOneShot, boost::posix_time::seconds(5)));
+      auto timePoint(boost::make_shared<shared::event::CEventTimePoint>(3, shared::currentTime::Provider().now() + boost::posix_time::seconds(7)));
+      scheduler.add(timer1);
+      scheduler.add(timer2);
+      scheduler.add(timePoint);
+
+      BOOST_CHECK(scheduler.hasRunningTimeEvents());
+      BOOST_CHECK_EQUAL(scheduler.next(), timer2);
+
+      timer2->stop();
+      BOOST_CHECK_EQUAL(scheduler.next(), timePoint);
+
+      timePoint->cancel();
+      BOOST_CHECK_EQUAL(scheduler.next(), timer1);
+
+      timer2->start(boost::posix_time::seconds(1));
+      BOOST_CHECK_EQUAL(scheduler.next(), timer2);
+
+      timer1->stop();
+      timer2->stop();
+      BOOST_CHECK(!scheduler.hasRunningTimeEvents());
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Elapsed time events
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(Elapsed)
+   {
+      auto timeProviderMock = useTimeMock();
+
+      boost::mutex mutex;
+      shared::event::CTimeEventScheduler scheduler(mutex);
+      auto timer1(boost::make_shared<shared::event::CEventTimer>(1, shared::event::CEventTimer::kPeriodic, boost::posix_time::seconds(2)));
+      auto timer2(boost::make_shared<shared::event::CEventTimer>(2, shared::event::CEventTimer::kOneShot, boost::posix_time::seconds(5)));
+      scheduler.add(timer1);
+      scheduler.add(timer2);
+
+      BOOST_CHECK(scheduler.elapsed(shared::currentTime::Provider().now()).empty());
+
+      timeProviderMock->sleep(boost::posix_time::seconds(6));
+      const auto elapsed = scheduler.elapsed(shared::currentTime::Provider().now());
+      BOOST_REQUIRE_EQUAL(elapsed.size(), 2);
+      BOOST_CHECK_EQUAL(elapsed[0], timer1);
+      BOOST_CHECK_EQUAL(elapsed[1], timer2);
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Stopped time events are released only when no more referenced
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(Release)
+   {
+      useTimeMock();
+
+      boost::mutex mutex;
+      shared::event::CTimeEventScheduler scheduler(mutex);
+      auto keptTimer(boost::make_shared<shared::event::CEventTimer>(1, shared::event::CEventTimer::kOneShot, boost::posix_time::seconds(10)));
+      scheduler.add(keptTimer);
+      scheduler.add(boost::make_shared<shared::event::CEventTimer>(2, shared::event::CEventTimer::kOneShot, boost::posix_time::seconds(10)));
+      scheduler.add(boost::make_shared<shared::event::CEventTimer>(3));
+      BOOST_CHECK_EQUAL(scheduler.size(), 3);
+
+      // Not running and not referenced
+      scheduler.collect();
+      BOOST_CHECK_EQUAL(scheduler.size(), 2);
+
+      // Not running but referenced
+      keptTimer->stop();
+      scheduler.collect();
+      BOOST_CHECK_EQUAL(scheduler.size(), 2);
+
+      scheduler.elapsed(shared::currentTime::Provider().now() + boost::posix_time::seconds(11))[0]->reset();
+      scheduler.collect();
+      BOOST_CHECK_EQUAL(scheduler.size(), 1);
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Timer still referenced by user after scheduler destruction
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(TimerOutlivesScheduler)
+   {
+      useTimeMock();
+
+      auto timer(boost::make_shared<shared::event::CEventTimer>(1));
+      {
+         boost::mutex mutex;
+      shared::event::CTimeEventScheduler scheduler(mutex);
+         scheduler.add(timer);
+         timer->start(boost::posix_time::seconds(1));
+      }
+
+      timer->stop();
+      timer->start(boost::posix_time::seconds(1));
+      BOOST_CHECK(timer->isRunning());
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Thousands of concurrent one-shot timers, restarted like answer timeouts
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(ConcurrentTimersBenchmark)
+   {
+      static const int TimersCount = 5000;
+      static const int Rounds = 20;
+
+      auto timeProviderMock = useTimeMock();
+      shared::event::CEventHandler evtHandler;
+
+      std::vector<boost::shared_ptr<shared::event::CEventTimer>> timers;
+      for (auto i = 0; i < TimersCount; ++i)
+         timers.push_back(evtHandler.createTimer(shared::event::kUserFirstId + i));
+
+      const auto start = boost::chrono::steady_clock::now();
+      auto receivedEvents = 0;
+      for (auto round = 0; round < Rounds; ++round)
+      {
+         // (Re)start all timers, then let one tenth of them elapse
+         for (auto i = 0; i < TimersCount; ++i)
+            timers[i]->start(boost::posix_time::milliseconds(100 + 10 * i));
+
+         timeProviderMock->sleep(boost::posix_time::milliseconds(100 + TimersCount));
+         while (evtHandler.waitForEvents(boost::date_time::min_date_time) != shared::event::kNoEvent)
+            ++receivedEvents;
+
+         for (auto i = 0; i < TimersCount; ++i)
+            timers[i]->stop();
+      }
+      const auto duration = boost::chrono::steady_clock::now() - start;
+
+      BOOST_CHECK_EQUAL(receivedEvents, Rounds * TimersCount / 10);
+      BOOST_TEST_MESSAGE(Rounds << " rounds of " << TimersCount << " timers : " << boost::chrono::duration_cast<boost::chrono::microseconds>(duration).count() << " us");
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Timers created, started and stopped by another thread than the consumer one
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(TimersChangedFromAnotherThread)
+   {
+      static const int TimersCount = 100;
+      static const int Rounds = 200;
+
+      auto timeProviderMock = useTimeMock();
+      shared::event::CEventHandler evtHandler;
+
+      std::vector<boost::shared_ptr<shared::event::CEventTimer>> timers;
+      boost::thread producer([&]()
+         {
+            for (auto i = 0; i < TimersCount; ++i)
+               timers.push_back(evtHandler.createTimer(shared::event::kUserFirstId + i));
+
+            for (auto round = 0; round < Rounds; ++round)
+            {
+               for (const auto& timer : timers)
+                  timer->start(boost::posix_time::seconds(1 + round));
+               for (const auto& timer : timers)
+                  timer->stop();
+            }
+
+            // Let only even timers running
+            for (auto i = 0; i < TimersCount; i += 2)
+               timers[i]->start(boost::posix_time::seconds(1));
+         });
+
+      // Consumer walks the schedule while producer changes it (time is frozen, no timer elapses)
+      auto receivedEvents = 0;
+      while (!producer.try_join_for(boost::chrono::milliseconds(0)))
+      {
+         if (evtHandler.waitForEvents(boost::date_time::min_date_time) != shared::event::kNoEvent)
+            ++receivedEvents;
+      }
+      BOOST_CHECK_EQUAL(receivedEvents, 0);
+
+      timeProviderMock->sleep(boost::posix_time::seconds(2));
+      while (evtHandler.waitForEvents(boost::date_time::min_date_time) != shared::event::kNoEvent)
+         ++receivedEvents;
+      BOOST_CHECK_EQUAL(receivedEvents, TimersCount / 2);
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
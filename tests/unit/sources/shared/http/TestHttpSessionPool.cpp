@@ -0,0 +1,279 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../sources/shared/shared/http/HttpSessionPool.h"
+#include "../../../../sources/shared/shared/http/KeepAliveClientSession.h"
+
+#include <Poco/Net/HTTPRequestHandler.h>
+#include <Poco/Net/HTTPRequestHandlerFactory.h>
+#include <Poco/Net/HTTPServer.h>
+#include <Poco/Net/HTTPServerParams.h>
+#include <Poco/Net/HTTPServerRequest.h>
+#include <Poco/Net/HTTPServerResponse.h>
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/StreamCopier.h>
+#include <boost/scoped_ptr.hpp>
+#include <set>
+
+BOOST_AUTO_TEST_SUITE(TestHttpSessionPool)
+
+   //--------------------------------------------------------------
+   /// \brief	    Plain HTTP sessions only (no SSL needed by tests)
+   //--------------------------------------------------------------
+   class CPlainSessionFactory : public shared::IHttpClientSessionFactory
+   {
+   public:
+      boost::shared_ptr<Poco::Net::HTTPClientSession> createSession(const Poco::URI& uri) const override
+      {
+         return boost::make_shared<shared::CKeepAliveClientSession>(uri.getHost(), uri.getPort());
+      }
+   };
+
+   //--------------------------------------------------------------
+   /// \brief	    Local HTTP server, standing for a polled equipment
+   ///
+   /// Answers the requested path and query as body, and records the client connections.
+   /// Path "/close" asks to close the connection after the answer.
+   //--------------------------------------------------------------
+   class CLocalHttpServer
+   {
+   public:
+      explicit CLocalHttpServer(const Poco::Timespan& keepAliveTimeout = Poco::Timespan(10, 0))
+         : m_socket(Poco::Net::SocketAddress("127.0.0.1", 0))
+      {
+         Poco::Net::HTTPServerParams::Ptr params(new Poco::Net::HTTPServerParams);
+         params->setKeepAlive(true);
+         params->setKeepAliveTimeout(keepAliveTimeout);
+         params->setMaxKeepAliveRequests(100);
+
+         m_server.reset(new Poco::Net::HTTPServer(new CHandlerFactory(*this), m_socket, params));
+         m_server->start();
+      }
+
+      virtual ~CLocalHttpServer()
+      {
+         m_server->stop();
+      }
+
+      std::string url(const std::string& path = "/") const
+      {
+         return "http://127.0.0.1:" + boost::lexical_cast<std::string>(m_socket.address().port()) + path;
+      }
+
+      std::size_t connectionsCount() const
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         return m_clients.size();
+      }
+
+   private:
+      class CHandler : public Poco::Net::HTTPRequestHandler
+      {
+      public:
+         explicit CHandler(CLocalHttpServer& server)
+            : m_server(server)
+         {
+         }
+
+         void handleRequest(Poco::Net::HTTPServerRequest& request, Poco::Net::HTTPServerResponse& response) override
+         {
+            {
+               boost::lock_guard<boost::mutex> lock(m_server.m_mutex);
+               m_server.m_clients.insert(request.clientAddress().toString());
+            }
+
+            if (request.getURI() == "/close")
+               response.setKeepAlive(false);
+
+            response.setContentType("text/plain");
+            response.setContentLength(request.getURI().size());
+            response.send() << request.getURI();
+         }
+
+      private:
+         CLocalHttpServer& m_server;
+      };
+
+      class CHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory
+      {
+      public:
+         explicit CHandlerFactory(CLocalHttpServer& server)
+            : m_server(server)
+         {
+         }
+
+         Poco::Net::HTTPRequestHandler* createRequestHandler(const Poco::Net::HTTPServerRequest&) override
+         {
+            return new CHandler(m_server);
+         }
+
+      private:
+         CLocalHttpServer& m_server;
+      };
+
+      Poco::Net::ServerSocket m_socket;
+      boost::scoped_ptr<Poco::Net::HTTPServer> m_server;
+      mutable boost::mutex m_mutex;
+      std::set<std::string> m_clients;
+   };
+
+   static std::string get(shared::CHttpSessionPool& pool, const std::string& url)
+   {
+      const auto session = pool.getSession(url);
+      session->setTimeout(boost::posix_time::seconds(5));
+
+      Poco::Net::HTTPRequest request(Poco::Net::HTTPRequest::HTTP_GET,
+                                     Poco::URI(url).getPathAndQuery(),
+                                     Poco::Net::HTTPMessage::HTTP_1_1);
+      session->sendRequest(request);
+
+      Poco::Net::HTTPResponse response;
+      auto& body = session->receiveResponse(response);
+      BOOST_CHECK_EQUAL(response.getStatus(), Poco::Net::HTTPResponse::HTTP_OK);
+
+      std::ostringstream oss;
+      Poco::StreamCopier::copyStream(body, oss);
+      return oss.str();
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Pool key
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(Key)
+   {
+      BOOST_CHECK_EQUAL(shared::CHttpSessionPool::key("http://192.168.1.10/api/xdevices.json?Get=R"), "http://192.168.1.10:80");
+      BOOST_CHECK_EQUAL(shared::CHttpSessionPool::key("HTTP://MyHost:8080/"), "http://myhost:8080");
+      BOOST_CHECK_EQUAL(shared::CHttpSessionPool::key("https://api.example.com/"), "https://api.example.com:443");
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Successive requests reuse the same connection
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(ConnectionIsReused)
+   {
+      CLocalHttpServer server;
+      shared::CHttpSessionPool pool(boost::make_shared<CPlainSessionFactory>());
+
+      for (auto request = 0; request < 5; ++request)
+      {
+         const auto path = "/api?request=" + boost::lexical_cast<std::string>(request);
+         BOOST_CHECK_EQUAL(get(pool, server.url(path)), path);
+      }
+
+      BOOST_CHECK_EQUAL(server.connectionsCount(), 1);
+      BOOST_CHECK_EQUAL(pool.idleSessionsCount(), 1);
+
+      const auto statistics = pool.getStatistics(server.url());
+      BOOST_CHECK_EQUAL(statistics.requestCount(), 5);
+      BOOST_CHECK_EQUAL(statistics.connectionCount(), 1);
+      BOOST_CHECK_EQUAL(statistics.reuseCount(), 4);
+      BOOST_CHECK_EQUAL(statistics.failureCount(), 0);
+      BOOST_CHECK(!statistics.averageLatency().is_not_a_date_time());
+      BOOST_CHECK(statistics.minLatency() <= statistics.maxLatency());
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Pipelined requests, answers come in requests order
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(PipelinedRequests)
+   {
+      CLocalHttpServer server;
+      shared::CHttpSessionPool pool(boost::make_shared<CPlainSessionFactory>());
+
+      const std::vector<std::string> paths = {"/api?Get=R", "/api?Get=D", "/api?Get=A", "/api?Get=C"};
+      std::vector<std::string> answers(paths.size());
+      pool.sendPipelinedGetRequests(server.url(),
+                                    paths,
+                                    [&](std::size_t index, Poco::Net::HTTPResponse& response, std::istream& body)
+                                    {
+                                       BOOST_CHECK_EQUAL(response.getStatus(), Poco::Net::HTTPResponse::HTTP_OK);
+                                       std::ostringstream oss;
+                                       Poco::StreamCopier::copyStream(body, oss);
+                                       answers[index] = oss.str();
+                                    },
+                                    boost::posix_time::seconds(5));
+
+      BOOST_CHECK_EQUAL_COLLECTIONS(answers.begin(), answers.end(), paths.begin(), paths.end());
+      BOOST_CHECK_EQUAL(server.connectionsCount(), 1);
+
+      // Next single request reuses the pipelined connection
+      BOOST_CHECK_EQUAL(get(pool, server.url("/single")), "/single");
+      BOOST_CHECK_EQUAL(server.connectionsCount(), 1);
+
+      const auto statistics = pool.getStatistics(server.url());
+      BOOST_CHECK_EQUAL(statistics.requestCount(), 5);
+      BOOST_CHECK_EQUAL(statistics.pipelinedRequestCount(), 4);
+      BOOST_CHECK_EQUAL(statistics.connectionCount(), 1);
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Server closes the connection in the middle of a pipelined batch
+   /// \result     Remaining requests are sent on a new connection
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(PipelinedRequestsWithConnectionClose)
+   {
+      CLocalHttpServer server;
+      shared::CHttpSessionPool pool(boost::make_shared<CPlainSessionFactory>());
+
+      const std::vector<std::string> paths = {"/first", "/close", "/last"};
+      std::vector<std::string> answers(paths.size());
+      pool.sendPipelinedGetRequests(server.url(),
+                                    paths,
+                                    [&](std::size_t index, Poco::Net::HTTPResponse&, std::istream& body)
+                                    {
+                                       std::ostringstream oss;
+                                       Poco::StreamCopier::copyStream(body, oss);
+                                       answers[index] = oss.str();
+                                    },
+                                    boost::posix_time::seconds(5));
+
+      BOOST_CHECK_EQUAL_COLLECTIONS(answers.begin(), answers.end(), paths.begin(), paths.end());
+      BOOST_CHECK_EQUAL(server.connectionsCount(), 2);
+      BOOST_CHECK_EQUAL(pool.getStatistics(server.url()).connectionCount(), 2);
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Idle connection closed by the server is not reused
+   /// \result     No Error, new connection
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(IdleConnectionClosedByServer)
+   {
+      CLocalHttpServer server(Poco::Timespan(0, 200000));
+      shared::CHttpSessionPool pool(boost::make_shared<CPlainSessionFactory>());
+
+      BOOST_CHECK_EQUAL(get(pool, server.url("/before")), "/before");
+      boost::this_thread::sleep(boost::posix_time::seconds(1));
+      BOOST_CHECK_EQUAL(get(pool, server.url("/after")), "/after");
+
+      BOOST_CHECK_EQUAL(server.connectionsCount(), 2);
+      const auto statistics = pool.getStatistics(server.url());
+      BOOST_CHECK_EQUAL(statistics.requestCount(), 2);
+      BOOST_CHECK_EQUAL(statistics.failureCount(), 0);
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Unread answer body is skipped before connection reuse
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(UnreadBodyIsSkipped)
+   {
+      CLocalHttpServer server;
+      shared::CHttpSessionPool pool(boost::make_shared<CPlainSessionFactory>());
+
+      {
+         const auto session = pool.getSession(server.url("/unread"));
+         Poco::Net::HTTPRequest request(Poco::Net::HTTPRequest::HTTP_GET, "/unread", Poco::Net::HTTPMessage::HTTP_1_1);
+         session->sendRequest(request);
+         Poco::Net::HTTPResponse response;
+         session->receiveResponse(response);
+      }
+
+      BOOST_CHECK_EQUAL(get(pool, server.url("/read")), "/read");
+      BOOST_CHECK_EQUAL(server.connectionsCount(), 1);
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,131 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../sources/shared/shared/Log.h"
+#include "../../../../sources/shared/shared/logInternal/BoundedAsyncChannel.h"
+
+BOOST_AUTO_TEST_SUITE(TestLog)
+
+   //--------------------------------------------------------------
+   /// \brief	    Channel keeping the logged messages (optionally slow)
+   //--------------------------------------------------------------
+   class CMemoryChannel : public Poco::Channel
+   {
+   public:
+      explicit CMemoryChannel(int writeDelayMs = 0)
+         : m_writeDelayMs(writeDelayMs)
+      {
+      }
+
+      void log(const Poco::Message& msg) override
+      {
+         if (m_writeDelayMs)
+            boost::this_thread::sleep(boost::posix_time::milliseconds(m_writeDelayMs));
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         m_messages.push_back(msg.getText());
+      }
+
+      std::vector<std::string> messages() const
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         return m_messages;
+      }
+
+   protected:
+      virtual ~CMemoryChannel()
+      {
+      }
+
+   private:
+      const int m_writeDelayMs;
+      mutable boost::mutex m_mutex;
+      std::vector<std::string> m_messages;
+   };
+
+   static int evaluationsCount = 0;
+
+   static int countEvaluation()
+   {
+      return ++evaluationsCount;
+   }
+
+   static std::string logWhileStreaming()
+   {
+      YADOMS_LOG(information) << "inner message";
+      return "end of outer message";
+   }
+
+   static void printToLog(std::ostream& stream)
+   {
+      stream << "printed to log";
+   }
+
+   BOOST_AUTO_TEST_CASE(LogLevelAndStreams)
+   {
+      Poco::AutoPtr<CMemoryChannel> channel(new CMemoryChannel);
+      shared::CLog::logger().setChannel(channel);
+      shared::CLog::logger().setLevel(Poco::Message::PRIO_INFORMATION);
+
+      evaluationsCount = 0;
+      YADOMS_LOG(debug) << "disabled " << countEvaluation();
+      BOOST_CHECK_EQUAL(evaluationsCount, 0);
+
+      YADOMS_LOG(information) << "enabled " << countEvaluation() << " " << std::hex << 255;
+      YADOMS_LOG(information) << 255; // format must not leak from the previous message
+      YADOMS_LOG(information) << "outer message, " << logWhileStreaming();
+      printToLog(YADOMS_LOG(warning));
+      printToLog(YADOMS_LOG(trace));
+
+      const auto messages = channel->messages();
+      BOOST_REQUIRE_EQUAL(messages.size(), static_cast<std::size_t>(5));
+      BOOST_CHECK_EQUAL(messages[0], "enabled 1 ff");
+      BOOST_CHECK_EQUAL(messages[1], "255");
+      BOOST_CHECK_EQUAL(messages[2], "inner message");
+      BOOST_CHECK_EQUAL(messages[3], "outer message, end of outer message");
+      BOOST_CHECK_EQUAL(messages[4], "printed to log");
+
+      shared::CLog::logger().setChannel(nullptr);
+   }
+
+   BOOST_AUTO_TEST_CASE(AsyncChannelWritesAllMessages)
+   {
+      Poco::AutoPtr<CMemoryChannel> channel(new CMemoryChannel);
+      Poco::AutoPtr<shared::logInternal::CBoundedAsyncChannel> asyncChannel(new shared::logInternal::CBoundedAsyncChannel(channel, 100));
+
+      for (auto index = 0; index < 50; ++index)
+         asyncChannel->log(Poco::Message("test", boost::lexical_cast<std::string>(index), Poco::Message::PRIO_INFORMATION));
+      asyncChannel->close();
+
+      const auto messages = channel->messages();
+      BOOST_REQUIRE_EQUAL(messages.size(), static_cast<std::size_t>(50));
+      for (auto index = 0; index < 50; ++index)
+         BOOST_CHECK_EQUAL(messages[index], boost::lexical_cast<std::string>(index));
+
+      //after close, messages are written synchronously
+      asyncChannel->log(Poco::Message("test", "after close", Poco::Message::PRIO_INFORMATION));
+      BOOST_CHECK_EQUAL(channel->messages().back(), "after close");
+   }
+
+   BOOST_AUTO_TEST_CASE(AsyncChannelDropsWhenFull)
+   {
+      Poco::AutoPtr<CMemoryChannel> channel(new CMemoryChannel(5));
+      Poco::AutoPtr<shared::logInternal::CBoundedAsyncChannel> asyncChannel(new shared::logInternal::CBoundedAsyncChannel(channel, 4));
+
+      for (auto index = 0; index < 100; ++index)
+         asyncChannel->log(Poco::Message("test", "flood", Poco::Message::PRIO_INFORMATION));
+
+      //critical messages are never dropped, and are written when log returns
+      asyncChannel->log(Poco::Message("test", "critical", Poco::Message::PRIO_CRITICAL));
+      auto messages = channel->messages();
+      BOOST_CHECK_EQUAL(messages.back(), "critical");
+      BOOST_CHECK_LT(messages.size(), static_cast<std::size_t>(100));
+
+      asyncChannel->close();
+      messages = channel->messages();
+      BOOST_CHECK(std::find_if(messages.begin(),
+                               messages.end(),
+                               [](const std::string& message) { return message.find("log messages dropped") != std::string::npos; }) != messages.end());
+   }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,158 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../sources/shared/shared/metrics/MetricsRegistry.h"
+#include "../../../../sources/shared/shared/metrics/ScopedLatency.h"
+#include <shared/exception/InvalidParameter.hpp>
+
+namespace
+{
+   //--------------------------------------------------------------
+   /// \brief	    Enable metrics for the test duration
+   //--------------------------------------------------------------
+   class CEnabledMetrics
+   {
+   public:
+      explicit CEnabledMetrics(bool enabled = true)
+      {
+         shared::metrics::CMetricsSwitch::enable(enabled);
+      }
+
+      virtual ~CEnabledMetrics()
+      {
+         shared::metrics::CMetricsSwitch::enable(false);
+      }
+   };
+}
+
+BOOST_AUTO_TEST_SUITE(TestMetricsRegistry)
+
+BOOST_AUTO_TEST_CASE(DisabledMetricsAreNotRecorded)
+{
+   CEnabledMetrics metrics(false);
+   shared::metrics::CMetricsRegistry registry;
+
+   auto& counter = registry.counter("test_total", "Test counter");
+   auto& histogram = registry.histogram("test_duration_seconds", "Test histogram");
+   counter.increment();
+   histogram.record(100);
+   {
+      shared::metrics::CScopedLatency latency(histogram);
+   }
+
+   BOOST_CHECK_EQUAL(counter.value(), static_cast<unsigned long long>(0));
+   BOOST_CHECK_EQUAL(histogram.snapshot().count, static_cast<unsigned long long>(0));
+}
+
+BOOST_AUTO_TEST_CASE(SameNameAndLabelsGiveSameMetric)
+{
+   CEnabledMetrics metrics;
+   shared::metrics::CMetricsRegistry registry;
+
+   const shared::metrics::CMetricsRegistry::Labels labelsA = {{"route", "/a"}};
+   const shared::metrics::CMetricsRegistry::Labels labelsB = {{"route", "/b"}};
+
+   registry.counter("test_total", "Test counter", labelsA).increment(2);
+   registry.counter("test_total", "Test counter", labelsA).increment(3);
+   registry.counter("test_total", "Test counter", labelsB).increment();
+
+   BOOST_CHECK_EQUAL(registry.counter("test_total", "Test counter", labelsA).value(), static_cast<unsigned long long>(5));
+   BOOST_CHECK_EQUAL(registry.counter("test_total", "Test counter", labelsB).value(), static_cast<unsigned long long>(1));
+
+   BOOST_REQUIRE_THROW(registry.gauge("test_total", "Same name, other type"), shared::exception::CInvalidParameter);
+}
+
+BOOST_AUTO_TEST_CASE(HistogramBuckets)
+{
+   typedef shared::metrics::CLatencyHistogram Histogram;
+
+   // Exact for small values, then less than 12.5% of relative error
+   for (unsigned long long value = 0; value < 100000; value += 7)
+   {
+      const auto index = Histogram::bucketIndex(value);
+      BOOST_REQUIRE_LT(index, static_cast<std::size_t>(Histogram::kBucketCount));
+      const auto upperBound = Histogram::bucketUpperBound(index);
+      BOOST_REQUIRE_GE(upperBound, value);
+      BOOST_REQUIRE_LE(upperBound - value, value / Histogram::kSubBucketCount);
+      if (index > 0)
+         BOOST_REQUIRE_LT(Histogram::bucketUpperBound(index - 1), value);
+   }
+
+   // Too high values are clamped in last bucket
+   BOOST_CHECK_EQUAL(Histogram::bucketIndex(~0ULL), static_cast<std::size_t>(Histogram::kBucketCount - 1));
+}
+
+BOOST_AUTO_TEST_CASE(HistogramPercentiles)
+{
+   CEnabledMetrics metrics;
+   shared::metrics::CLatencyHistogram histogram;
+
+   for (unsigned long long value = 1; value <= 1000; ++value)
+      histogram.record(value);
+
+   const auto snapshot = histogram.snapshot();
+   BOOST_CHECK_EQUAL(snapshot.count, static_cast<unsigned long long>(1000));
+   BOOST_CHECK_EQUAL(snapshot.sumMicroseconds, static_cast<unsigned long long>(500500));
+   BOOST_CHECK_EQUAL(snapshot.maxMicroseconds, static_cast<unsigned long long>(1000));
+   BOOST_CHECK_CLOSE(static_cast<double>(snapshot.percentile(0.5)), 500.0, 12.5);
+   BOOST_CHECK_CLOSE(static_cast<double>(snapshot.percentile(0.99)), 990.0, 12.5);
+   BOOST_CHECK_EQUAL(snapshot.percentile(1.0), static_cast<unsigned long long>(1000));
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentRecording)
+{
+   CEnabledMetrics metrics;
+   shared::metrics::CMetricsRegistry registry;
+   auto& counter = registry.counter("test_total", "Test counter");
+   auto& histogram = registry.histogram("test_duration_seconds", "Test histogram");
+
+   static const unsigned int ThreadsCount = 4;
+   static const unsigned int RecordsCount = 100000;
+   boost::thread_group threads;
+   for (unsigned int thread = 0; thread < ThreadsCount; ++thread)
+   {
+      threads.create_thread([&counter, &histogram]()
+         {
+            for (unsigned int record = 0; record < RecordsCount; ++record)
+            {
+               counter.increment();
+               histogram.record(record % 1000);
+            }
+         });
+   }
+   threads.join_all();
+
+   BOOST_CHECK_EQUAL(counter.value(), static_cast<unsigned long long>(ThreadsCount * RecordsCount));
+   BOOST_CHECK_EQUAL(histogram.snapshot().count, static_cast<unsigned long long>(ThreadsCount * RecordsCount));
+   BOOST_CHECK_EQUAL(histogram.snapshot().maxMicroseconds, static_cast<unsigned long long>(999));
+}
+
+BOOST_AUTO_TEST_CASE(PrometheusFormat)
+{
+   CEnabledMetrics metrics;
+   shared::metrics::CMetricsRegistry registry;
+
+   registry.counter("test_requests_total", "Requests count", {{"route", "/system/\"metrics\""}}).increment(3);
+   registry.gauge("test_queue_size", "Queue size").set(-2);
+   registry.histogram("test_duration_seconds", "Requests duration", {{"type", "kHistorizeData"}}).record(1500000);
+
+   const std::string expected =
+      "# HELP test_duration_seconds Requests duration\n"
+      "# TYPE test_duration_seconds summary\n"
+      "test_duration_seconds{type=\"kHistorizeData\",quantile=\"0.5\"} 1.500000\n"
+      "test_duration_seconds{type=\"kHistorizeData\",quantile=\"0.9\"} 1.500000\n"
+      "test_duration_seconds{type=\"kHistorizeData\",quantile=\"0.99\"} 1.500000\n"
+      "test_duration_seconds_sum{type=\"kHistorizeData\"} 1.500000\n"
+      "test_duration_seconds_count{type=\"kHistorizeData\"} 1\n"
+      "# HELP test_queue_size Queue size\n"
+      "# TYPE test_queue_size gauge\n"
+      "test_queue_size -2\n"
+      "# HELP test_requests_total Requests count\n"
+      "# TYPE test_requests_total counter\n"
+      "test_requests_total{route=\"/system/\\\"metrics\\\"\"} 3\n";
+
+   BOOST_CHECK_EQUAL(registry.toPrometheus(), expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
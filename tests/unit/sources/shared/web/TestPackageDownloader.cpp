@@ -0,0 +1,431 @@
+#include "stdafx.h"
+#include <boost/test/unit_test.hpp>
+
+// Includes needed to compile tested classes
+#include "../../../../sources/shared/shared/web/PackageDownloader.h"
+#include "../../../../sources/shared/shared/http/KeepAliveClientSession.h"
+#include "../../../../sources/shared/shared/web/exception/InvalidHash.hpp"
+#include "../../../../sources/shared/shared/exception/Extract.hpp"
+
+#include <Poco/DeflatingStream.h>
+#include <Poco/DigestEngine.h>
+#include <Poco/File.h>
+#include <Poco/FileStream.h>
+#include <Poco/MD5Engine.h>
+#include <Poco/TemporaryFile.h>
+#include <Poco/StreamCopier.h>
+#include <Poco/Net/HTTPRequestHandler.h>
+#include <Poco/Net/HTTPRequestHandlerFactory.h>
+#include <Poco/Net/HTTPServer.h>
+#include <Poco/Net/HTTPServerParams.h>
+#include <Poco/Net/HTTPServerRequest.h>
+#include <Poco/Net/HTTPServerResponse.h>
+#include <Poco/Net/ServerSocket.h>
+#include <boost/scoped_ptr.hpp>
+
+BOOST_AUTO_TEST_SUITE(TestPackageDownloader)
+
+   //--------------------------------------------------------------
+   /// \brief	    Plain HTTP sessions only (no SSL needed by tests)
+   //--------------------------------------------------------------
+   class CPlainSessionFactory : public shared::IHttpClientSessionFactory
+   {
+   public:
+      boost::shared_ptr<Poco::Net::HTTPClientSession> createSession(const Poco::URI& uri) const override
+      {
+         return boost::make_shared<shared::CKeepAliveClientSession>(uri.getHost(), uri.getPort());
+      }
+   };
+
+   //--------------------------------------------------------------
+   /// \brief	    An archive entry
+   //--------------------------------------------------------------
+   struct ArchiveEntry
+   {
+      std::string name;
+      std::string content;
+      int mode;
+      char type;
+   };
+
+   //--------------------------------------------------------------
+   /// \brief	    Build a tar.gz archive (ustar format)
+   //--------------------------------------------------------------
+   static std::string makeTarGz(const std::vector<ArchiveEntry>& entries)
+   {
+      std::string tar;
+      for (const auto& entry : entries)
+      {
+         char header[512] = {0};
+         strncpy(header, entry.name.c_str(), 100);
+         sprintf(header + 100, "%07o", entry.mode);
+         sprintf(header + 108, "%07o", 0);
+         sprintf(header + 116, "%07o", 0);
+         sprintf(header + 124, "%011o", static_cast<unsigned int>(entry.content.size()));
+         sprintf(header + 136, "%011o", 0);
+         header[156] = entry.type;
+         memcpy(header + 257, "ustar\0" "00", 8);
+
+         memset(header + 148, ' ', 8);
+         unsigned int checksum = 0;
+         for (auto c : header)
+            checksum += static_cast<unsigned char>(c);
+         sprintf(header + 148, "%06o", checksum);
+         header[155] = ' ';
+
+         tar.append(header, sizeof(header));
+         tar += entry.content;
+         tar.append((512 - entry.content.size() % 512) % 512, '\0');
+      }
+      tar.append(1024, '\0');
+
+      std::ostringstream archive;
+      Poco::DeflatingOutputStream deflater(archive, Poco::DeflatingStreamBuf::STREAM_GZIP);
+      deflater << tar;
+      deflater.close();
+      return archive.str();
+   }
+
+   static std::string md5(const std::string& data)
+   {
+      Poco::MD5Engine md5Engine;
+      md5Engine.update(data);
+      return Poco::DigestEngine::digestToHex(md5Engine.digest());
+   }
+
+   static std::string readFile(const Poco::Path& path)
+   {
+      Poco::FileInputStream file(path.toString());
+      std::ostringstream content;
+      Poco::StreamCopier::copyStream(file, content);
+      return content.str();
+   }
+
+   static const std::vector<ArchiveEntry> UpdatePackage = {
+      {"package.json", "{\"yadoms\":{\"information\":{\"commandToRun\":\"update.sh\"}}}", 0644, '0'},
+      {"bin/", "", 0755, '5'},
+      {"bin/update.sh", "#!/bin/sh\necho updating\n", 0755, '0'},
+      {"bin/data.bin", std::string(300000, 'y'), 0644, '0'}
+   };
+
+   //--------------------------------------------------------------
+   /// \brief	    Local HTTP server, serving packages
+   ///
+   /// Range requests are supported (except for paths starting with "/norange").
+   /// Paths containing "/flaky/" close the connection in the middle of the first answer.
+   //--------------------------------------------------------------
+   class CLocalHttpServer
+   {
+   public:
+      CLocalHttpServer()
+         : m_socket(Poco::Net::SocketAddress("127.0.0.1", 0)),
+           m_rangeRequestsCount(0),
+           m_interrupted(false)
+      {
+         m_server.reset(new Poco::Net::HTTPServer(new CHandlerFactory(*this), m_socket, new Poco::Net::HTTPServerParams));
+         m_server->start();
+      }
+
+      virtual ~CLocalHttpServer()
+      {
+         m_server->stop();
+      }
+
+      void serve(const std::string& path, const std::string& content)
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         m_contents[path] = content;
+      }
+
+      Poco::URI uri(const std::string& path) const
+      {
+         return Poco::URI("http://127.0.0.1:" + std::to_string(m_socket.address().port()) + path);
+      }
+
+      int rangeRequestsCount() const
+      {
+         boost::lock_guard<boost::mutex> lock(m_mutex);
+         return m_rangeRequestsCount;
+      }
+
+   private:
+      void handleRequest(Poco::Net::HTTPServerRequest& request, Poco::Net::HTTPServerResponse& response)
+      {
+         const auto path = Poco::URI(request.getURI()).getPath();
+         const auto rangeSupported = !boost::starts_with(path, "/norange");
+
+         std::string content;
+         auto interrupt = false;
+         {
+            boost::lock_guard<boost::mutex> lock(m_mutex);
+            const auto it = m_contents.find(path);
+            if (it == m_contents.end())
+            {
+               response.setStatusAndReason(Poco::Net::HTTPResponse::HTTP_NOT_FOUND);
+               response.send();
+               return;
+            }
+            content = it->second;
+
+            if (path.find("/flaky/") != std::string::npos && !m_interrupted)
+               interrupt = m_interrupted = true;
+            if (request.has("Range"))
+               ++m_rangeRequestsCount;
+         }
+
+         response.set("ETag", "\"" + md5(content) + "\"");
+
+         std::size_t first = 0;
+         if (rangeSupported && request.has("Range"))
+         {
+            first = static_cast<std::size_t>(std::stoul(request.get("Range").substr(6)));
+            response.setStatusAndReason(Poco::Net::HTTPResponse::HTTP_PARTIAL_CONTENT);
+            response.set("Content-Range", "bytes " + std::to_string(first) + "-" + std::to_string(content.size() - 1) + "/" + std::to_string(content.size()));
+         }
+
+         response.setContentType("application/gzip");
+         response.setContentLength(content.size() - first);
+         if (interrupt)
+         {
+            //announce the whole content but send only the half, then close the connection
+            response.setKeepAlive(false);
+            response.send().write(content.data() + first, (content.size() - first) / 2);
+            return;
+         }
+         response.send().write(content.data() + first, content.size() - first);
+      }
+
+      class CHandler : public Poco::Net::HTTPRequestHandler
+      {
+      public:
+         explicit CHandler(CLocalHttpServer& server)
+            : m_server(server)
+         {
+         }
+
+         void handleRequest(Poco::Net::HTTPServerRequest& request, Poco::Net::HTTPServerResponse& response) override
+         {
+            m_server.handleRequest(request, response);
+         }
+
+      private:
+         CLocalHttpServer& m_server;
+      };
+
+      class CHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory
+      {
+      public:
+         explicit CHandlerFactory(CLocalHttpServer& server)
+            : m_server(server)
+         {
+         }
+
+         Poco::Net::HTTPRequestHandler* createRequestHandler(const Poco::Net::HTTPServerRequest&) override
+         {
+            return new CHandler(m_server);
+         }
+
+      private:
+         CLocalHttpServer& m_server;
+      };
+
+      Poco::Net::ServerSocket m_socket;
+      boost::scoped_ptr<Poco::Net::HTTPServer> m_server;
+      mutable boost::mutex m_mutex;
+      std::map<std::string, std::string> m_contents;
+      int m_rangeRequestsCount;
+      bool m_interrupted;
+   };
+
+   //--------------------------------------------------------------
+   /// \brief	    Staging directory, removed at end of test
+   //--------------------------------------------------------------
+   class CStagingDirectory
+   {
+   public:
+      CStagingDirectory()
+         : m_path(Poco::Path::forDirectory(Poco::TemporaryFile::tempName()))
+      {
+      }
+
+      virtual ~CStagingDirectory()
+      {
+         if (Poco::File(m_path).exists())
+            Poco::File(m_path).remove(true);
+      }
+
+      const Poco::Path& path() const
+      {
+         return m_path;
+      }
+
+   private:
+      const Poco::Path m_path;
+   };
+
+   static shared::web::CPackageDownloader makeDownloader()
+   {
+      return shared::web::CPackageDownloader(boost::make_shared<CPlainSessionFactory>(),
+                                             3,
+                                             boost::posix_time::milliseconds(10),
+                                             boost::posix_time::seconds(5));
+   }
+
+   static void checkUpdatePackageExtracted(const Poco::Path& extractPath)
+   {
+      BOOST_CHECK_EQUAL(readFile(Poco::Path(extractPath, Poco::Path("package.json"))), UpdatePackage[0].content);
+      BOOST_CHECK_EQUAL(readFile(Poco::Path(extractPath, Poco::Path("bin/update.sh"))), UpdatePackage[2].content);
+      BOOST_CHECK(readFile(Poco::Path(extractPath, Poco::Path("bin/data.bin"))) == UpdatePackage[3].content);
+#ifndef _WIN32
+      BOOST_CHECK(Poco::File(Poco::Path(extractPath, Poco::Path("bin/update.sh"))).canExecute());
+      BOOST_CHECK(!Poco::File(Poco::Path(extractPath, Poco::Path("package.json"))).canExecute());
+#endif
+   }
+
+   static void ignoreProgress(const std::string&, float)
+   {
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    tar.gz package is extracted while downloading
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(ExtractWhileDownloading)
+   {
+      CLocalHttpServer server;
+      const auto package = makeTarGz(UpdatePackage);
+      server.serve("/package.tar.gz", package);
+      CStagingDirectory staging;
+
+      auto lastProgress = 0.0f;
+      const auto extractPath = makeDownloader().downloadAndExtract(server.uri("/package.tar.gz"),
+                                                                   staging.path(),
+                                                                   md5(package),
+                                                                   [&](const std::string&, float progress)
+                                                                   {
+                                                                      BOOST_CHECK(progress >= lastProgress);
+                                                                      lastProgress = progress;
+                                                                   });
+
+      BOOST_CHECK_EQUAL(extractPath.toString(), staging.path().toString());
+      BOOST_CHECK_EQUAL(lastProgress, 100.0f);
+      checkUpdatePackageExtracted(extractPath);
+      BOOST_CHECK_EQUAL(server.rangeRequestsCount(), 0);
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Package with unexpected hash
+   /// \result     CInvalidHash, extracted files are removed
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(InvalidHash)
+   {
+      CLocalHttpServer server;
+      server.serve("/package.tar.gz", makeTarGz(UpdatePackage));
+      CStagingDirectory staging;
+
+      BOOST_CHECK_THROW(makeDownloader().downloadAndExtract(server.uri("/package.tar.gz"), staging.path(), md5("other"), ignoreProgress),
+                        shared::web::exception::CInvalidHash);
+      BOOST_CHECK(!Poco::File(staging.path()).exists());
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Interrupted download is resumed
+   /// \result     No Error, a range request was sent
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(ResumeInterruptedDownload)
+   {
+      CLocalHttpServer server;
+      const auto package = makeTarGz(UpdatePackage);
+      server.serve("/flaky/package.tar.gz", package);
+      CStagingDirectory staging;
+
+      makeDownloader().downloadAndExtract(server.uri("/flaky/package.tar.gz"), staging.path(), md5(package), ignoreProgress);
+
+      checkUpdatePackageExtracted(staging.path());
+      BOOST_CHECK_EQUAL(server.rangeRequestsCount(), 1);
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Interrupted download, server doesn't support range requests
+   /// \result     No Error, download restarted from the beginning
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(RestartInterruptedDownload)
+   {
+      CLocalHttpServer server;
+      const auto package = makeTarGz(UpdatePackage);
+      server.serve("/norange/flaky/package.tar.gz", package);
+      CStagingDirectory staging;
+
+      makeDownloader().downloadAndExtract(server.uri("/norange/flaky/package.tar.gz"), staging.path(), md5(package), ignoreProgress);
+
+      checkUpdatePackageExtracted(staging.path());
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Interrupted file download is resumed, hash computed while downloading
+   /// \result     No Error
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(ResumeAndVerifyFile)
+   {
+      CLocalHttpServer server;
+      const auto package = makeTarGz(UpdatePackage);
+      server.serve("/flaky/package.tar.gz", package);
+      CStagingDirectory staging;
+      Poco::File(staging.path()).createDirectories();
+      const Poco::Path location(staging.path(), "package.tar.gz");
+
+      makeDownloader().downloadAndVerify(server.uri("/flaky/package.tar.gz"), location, md5(package), ignoreProgress);
+
+      BOOST_CHECK(readFile(location) == package);
+      BOOST_CHECK_EQUAL(server.rangeRequestsCount(), 1);
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Entries must stay in the extraction directory
+   /// \result     CExtract, nothing written outside staging directory
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(PathTraversalIsRejected)
+   {
+      CLocalHttpServer server;
+      const auto package = makeTarGz({{"bin/../../evil.txt", "evil", 0644, '0'}});
+      server.serve("/package.tar.gz", package);
+      CStagingDirectory staging;
+
+      BOOST_CHECK_THROW(makeDownloader().downloadAndExtract(server.uri("/package.tar.gz"), staging.path(), md5(package), ignoreProgress),
+                        shared::exception::CExtract);
+      BOOST_CHECK(!Poco::File(staging.path()).exists());
+      BOOST_CHECK(!Poco::File(Poco::Path(Poco::Path(staging.path()).parent(), "evil.txt")).exists());
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Truncated archive
+   /// \result     CExtract
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(TruncatedArchive)
+   {
+      CLocalHttpServer server;
+      const auto archive = makeTarGz(UpdatePackage);
+      const auto package = archive.substr(0, archive.size() / 2);
+      server.serve("/package.tar.gz", package);
+      CStagingDirectory staging;
+
+      BOOST_CHECK_THROW(makeDownloader().downloadAndExtract(server.uri("/package.tar.gz"), staging.path(), md5(package), ignoreProgress),
+                        shared::exception::CExtract);
+      BOOST_CHECK(!Poco::File(staging.path()).exists());
+   }
+
+   //--------------------------------------------------------------
+   /// \brief	    Missing package
+   /// \result     CDownloadFailed
+   //--------------------------------------------------------------
+   BOOST_AUTO_TEST_CASE(MissingPackage)
+   {
+      CLocalHttpServer server;
+      CStagingDirectory staging;
+
+      BOOST_CHECK_THROW(makeDownloader().downloadAndExtract(server.uri("/package.tar.gz"), staging.path(), md5(""), ignoreProgress),
+                        shared::exception::CException);
+      BOOST_CHECK(!Poco::File(staging.path()).exists());
+   }
+
+BOOST_AUTO_TEST_SUITE_END()